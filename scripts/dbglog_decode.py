@@ -0,0 +1,128 @@
+#!/usr/bin/env python3
+# Copyright (c) 2026 — FluidDial-CYD
+# Use of this source code is governed by a GPLv3 license.
+#
+# Decodes the debug log of a build made with -DDBGLOG_BINARY (see
+# src/DebugLog.h).  Each record arrives as 0xFE 0xED followed by the record
+# exactly as it sat in the ring; the format string is looked up by its address
+# in the firmware ELF, so the ELF must be the one that is running.
+#
+#   pio device monitor --raw | python3 scripts/dbglog_decode.py .pio/build/cyd_new_ui/firmware.elf
+#   python3 scripts/dbglog_decode.py firmware.elf capture.bin
+#
+# Needs pyelftools (pip install pyelftools).
+
+import re
+import struct
+import sys
+
+from elftools.elf.elffile import ELFFile
+
+SYNC = b"\xfe\xed"
+HDR = struct.Struct("<HBBII")  # len, core, flags, us, fmt — matches RecHdr
+SPEC = re.compile(r"%([-+ #0]*)(\*|\d+)?(?:\.(\*|\d+))?([hlzjt]*)([diuxXocfFeEgGsp%])")
+
+
+class Strings:
+    def __init__(self, path):
+        self.sections = []
+        with open(path, "rb") as f:
+            elf = ELFFile(f)
+            for sec in elf.iter_sections():
+                if sec["sh_addr"] and sec["sh_type"] == "SHT_PROGBITS":
+                    self.sections.append((sec["sh_addr"], sec.data()))
+        self.cache = {}
+
+    def at(self, addr):
+        if addr not in self.cache:
+            text = None
+            for base, data in self.sections:
+                if base <= addr < base + len(data):
+                    end = data.index(b"\0", addr - base)
+                    text = data[addr - base:end].decode("utf-8", "replace")
+                    break
+            self.cache[addr] = text
+        return self.cache[addr]
+
+
+# Mirrors format() in DebugLog.cpp: same argument layout, same give-up rule
+# for a conversion it doesn't know.
+def render(fmt, args):
+    out, pos, i = [], 0, 0
+    for m in SPEC.finditer(fmt):
+        out.append(fmt[pos:m.start()])
+        flags, width, prec, length, conv = m.groups()
+        if conv == "%":
+            out.append("%")
+            pos = m.end()
+            continue
+        if width == "*":
+            width = str(struct.unpack_from("<i", args, i)[0])
+            i += 4
+        if prec == "*":
+            prec = str(struct.unpack_from("<i", args, i)[0])
+            i += 4
+        spec = "%" + flags + (width or "") + ("." + prec if prec is not None else "")
+        if conv in "diuxXoc":
+            if length.count("l") >= 2:
+                v = struct.unpack_from("<q", args, i)[0]
+                i += 8
+            else:
+                v = struct.unpack_from("<i" if conv in "di" else "<I", args, i)[0]
+                i += 4
+            out.append((spec + ("d" if conv == "u" else conv)) % v)
+        elif conv in "fFeEgG":
+            v = struct.unpack_from("<d", args, i)[0]
+            i += 8
+            out.append((spec + conv) % v)
+        elif conv == "s":
+            n = args[i]
+            v = args[i + 1:i + 1 + n].decode("utf-8", "replace")
+            i += 1 + n
+            out.append((spec + "s") % v)
+        elif conv == "p":
+            v = struct.unpack_from("<I", args, i)[0]
+            i += 4
+            out.append("0x%x" % v)
+        pos = m.end()
+    out.append(fmt[pos:])
+    return "".join(out)
+
+
+def main():
+    if len(sys.argv) < 2:
+        sys.exit("usage: dbglog_decode.py firmware.elf [capture.bin]")
+    strings = Strings(sys.argv[1])
+    src = open(sys.argv[2], "rb") if len(sys.argv) > 2 else sys.stdin.buffer
+    buf = b""
+    while True:
+        chunk = src.read1(4096) if hasattr(src, "read1") else src.read(4096)
+        if not chunk:
+            break
+        buf += chunk
+        while True:
+            start = buf.find(SYNC)
+            if start < 0 or len(buf) < start + 2 + HDR.size:
+                break
+            length, core, _flags, us, fmt = HDR.unpack_from(buf, start + 2)
+            if length < HDR.size or len(buf) < start + 2 + length:
+                if length < HDR.size:
+                    buf = buf[start + 2:]  # a false sync; look again
+                    continue
+                break
+            rec = buf[start + 2 + HDR.size:start + 2 + length]
+            buf = buf[start + 2 + length:]
+            text = strings.at(fmt)
+            if text is None:
+                line = "<unknown format 0x%08x>\n" % fmt
+            else:
+                try:
+                    line = render(text, rec)
+                except (struct.error, IndexError, TypeError, ValueError):
+                    line = "<bad record for %r>\n" % text
+            sys.stdout.write("%10.3f c%d %s" % (us / 1e6, core, line))
+            sys.stdout.flush()
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,187 @@
+#!/usr/bin/env python3
+# Copyright (c) 2026 — FluidDial-CYD
+# Use of this source code is governed by a GPLv3 license.
+#
+# Stand-in FluidNC for trying controller discovery (src/FluidNCDiscovery.h)
+# without a machine.  Answers the two things a discovery round looks at:
+#
+#   • mDNS: PTR queries for _http._tcp.local and A queries for <name>.local,
+#     the way FluidNC advertises its WebUI;
+#   • HTTP: GET /command?plain=[ESP800] with a FluidNC-style reply carrying
+#     "hostname:<name>", which is what tells FluidNC apart from other web
+#     servers (and what the port-probe fallback checks).
+#
+# It is not a controller — the WebSocket the pendant opens afterwards gets no
+# status reports.  Run one per name to see several controllers, or stop one
+# and start it on another machine to watch the pendant follow a moved host.
+#
+#   python3 scripts/fake_fluidnc.py                     # "fluidnc" on port 80 (may need root)
+#   python3 scripts/fake_fluidnc.py --name mill --port 8080
+#   python3 scripts/fake_fluidnc.py --no-mdns           # port-probe fallback (probes port 80 only)
+
+import argparse
+import http.server
+import socket
+import struct
+import threading
+
+MDNS_GROUP = "224.0.0.251"
+MDNS_PORT = 5353
+SERVICE = "_http._tcp.local"
+TTL = 120
+
+T_A, T_PTR, T_TXT, T_SRV = 1, 12, 16, 33
+
+
+def local_ip():
+    # The address the LAN route uses; no packet is sent.
+    s = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    try:
+        s.connect(("10.255.255.255", 1))
+        return s.getsockname()[0]
+    finally:
+        s.close()
+
+
+# ── DNS wire format ──────────────────────────────────────────────────────────
+
+def encode_name(name):
+    out = b""
+    for label in name.rstrip(".").split("."):
+        out += bytes([len(label)]) + label.encode()
+    return out + b"\0"
+
+
+def decode_name(msg, pos):
+    labels = []
+    jumped = False
+    end = pos
+    while True:
+        n = msg[pos]
+        if n & 0xC0 == 0xC0:  # compression pointer
+            if not jumped:
+                end = pos + 2
+            pos = ((n & 0x3F) << 8) | msg[pos + 1]
+            jumped = True
+            continue
+        if n == 0:
+            if not jumped:
+                end = pos + 1
+            return ".".join(labels), end
+        labels.append(msg[pos + 1:pos + 1 + n].decode(errors="replace"))
+        pos += n + 1
+
+
+def record(name, rtype, rdata, flush=True):
+    rclass = 0x8001 if flush else 0x0001  # cache-flush bit on unique records
+    return encode_name(name) + struct.pack("!HHIH", rtype, rclass, TTL, len(rdata)) + rdata
+
+
+def questions(msg):
+    _, flags, qd = struct.unpack("!HHH", msg[:6])
+    if flags & 0x8000:  # a response, not a query
+        return []
+    pos = 12
+    out = []
+    for _ in range(qd):
+        name, pos = decode_name(msg, pos)
+        qtype, _ = struct.unpack("!HH", msg[pos:pos + 4])
+        pos += 4
+        out.append((name.lower(), qtype))
+    return out
+
+
+# ── mDNS responder ───────────────────────────────────────────────────────────
+
+def mdns_responder(host, ip, port):
+    instance = f"{host}.{SERVICE}"
+    target = f"{host}.local"
+    a = record(target, T_A, socket.inet_aton(ip))
+    srv = record(instance, T_SRV, struct.pack("!HHH", 0, 0, port) + encode_name(target))
+    txt = record(instance, T_TXT, b"\0")
+    ptr = record(SERVICE, T_PTR, encode_name(instance), flush=False)
+
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM, socket.IPPROTO_UDP)
+    sock.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+    if hasattr(socket, "SO_REUSEPORT"):
+        sock.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEPORT, 1)
+    sock.bind(("", MDNS_PORT))
+    mreq = socket.inet_aton(MDNS_GROUP) + socket.inet_aton(ip)
+    sock.setsockopt(socket.IPPROTO_IP, socket.IP_ADD_MEMBERSHIP, mreq)
+    sock.setsockopt(socket.IPPROTO_IP, socket.IP_MULTICAST_IF, socket.inet_aton(ip))
+    print(f"mDNS: {instance} -> {ip}:{port}")
+
+    while True:
+        msg, peer = sock.recvfrom(9000)
+        try:
+            qs = questions(msg)
+        except (IndexError, struct.error):
+            continue
+        answers, extra = [], []
+        for name, qtype in qs:
+            if name == SERVICE.lower() and qtype in (T_PTR, 255):
+                answers.append(ptr)
+                extra += [srv, txt, a]
+            elif name == instance.lower() and qtype in (T_SRV, T_TXT, 255):
+                answers += [srv, txt]
+                extra.append(a)
+            elif name == target.lower() and qtype in (T_A, 255):
+                answers.append(a)
+        if not answers:
+            continue
+        extra = [r for r in dict.fromkeys(extra) if r not in answers]
+        reply = struct.pack("!HHHHHH", 0, 0x8400, 0, len(answers), 0, len(extra)) + b"".join(answers + extra)
+        # A legacy (non-5353) querier wants a unicast reply; everyone else
+        # gets it on the group, as the ESP-IDF client expects.
+        dest = peer if peer[1] != MDNS_PORT else (MDNS_GROUP, MDNS_PORT)
+        sock.sendto(reply, dest)
+        print(f"mDNS: answered {qs[0][0]} for {peer[0]}")
+
+
+# ── HTTP ─────────────────────────────────────────────────────────────────────
+
+def http_handler(host, port):
+    class Handler(http.server.BaseHTTPRequestHandler):
+        def do_GET(self):
+            if self.path.startswith("/command") and "ESP800" in self.path.replace("%5B", "[").upper():
+                body = (f"FW version: FluidNC v3.9.5 (stand-in) # FW target:grbl-embedded  # FW HW:Direct SD  "
+                        f"# primary sd:/sd # secondary sd:none  # authentication:no "
+                        f"# webcommunication: Sync: {port}:/ # hostname:{host} # axis:3").encode()
+                self.send_response(200)
+                self.send_header("Content-Type", "text/plain")
+            else:
+                body = b"<html><body>FluidNC stand-in</body></html>"
+                self.send_response(200)
+                self.send_header("Content-Type", "text/html")
+            self.send_header("Content-Length", str(len(body)))
+            self.send_header("Connection", "close")
+            self.end_headers()
+            self.wfile.write(body)
+
+        def log_message(self, fmt, *args):
+            print(f"HTTP: {self.client_address[0]} {fmt % args}")
+
+    return Handler
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Stand-in FluidNC for pendant discovery")
+    ap.add_argument("--name", default="fluidnc", help="hostname to advertise (without .local)")
+    ap.add_argument("--port", type=int, default=80, help="WebUI port to serve and advertise")
+    ap.add_argument("--ip", default=None, help="address to advertise (default: the LAN route's)")
+    ap.add_argument("--no-mdns", action="store_true", help="HTTP only, for the port-probe fallback")
+    args = ap.parse_args()
+
+    ip = args.ip or local_ip()
+    if not args.no_mdns:
+        threading.Thread(target=mdns_responder, args=(args.name, ip, args.port), daemon=True).start()
+    server = http.server.ThreadingHTTPServer(("", args.port), http_handler(args.name, args.port))
+    print(f"HTTP: [ESP800] on {ip}:{args.port} as '{args.name}'")
+    try:
+        server.serve_forever()
+    except KeyboardInterrupt:
+        pass
+
+
+if __name__ == "__main__":
+    main()
@@ -67,6 +67,7 @@ def _watch():
             last_fw = cur_fw
             try:
                 sync.regen_colors()  # may rewrite js/colors.js -> picked up below
+                sync.regen_layouts()  # ...and js/layouts.js
                 _generation += 1  # reload so colour changes show immediately
             except Exception as e:
                 print("sync error:", e)
@@ -13,6 +13,21 @@ function isTouchInBounds(tx, ty, x, y, w, h) {
   return tx >= x && tx <= x + w && ty >= y && ty <= y + h;
 }
 
+// uiHitTest() port — id of the widget in LAYOUTS[table] under (tx, ty), or -1.
+function uiHitTest(table, tx, ty) {
+  const ws = LAYOUTS[table];
+  for (let i = 0; i < ws.length; i++) {
+    const w = ws[i];
+    if (isTouchInBounds(tx, ty, w.x, w.y, w.w, w.h)) return i;
+  }
+  return -1;
+}
+
+function uiDrawButton(w, bgColor, textColor, textSize = 2) {
+  if (w.label2) drawMultiLineButton(w.x, w.y, w.w, w.h, w.label, w.label2, bgColor, textColor, textSize);
+  else drawButton(w.x, w.y, w.w, w.h, w.label, bgColor, textColor, textSize);
+}
+
 function drawRoundRect(x, y, w, h, r, color) {
   display.fillRoundRect(x, y, w, h, r, color);
 }
@@ -0,0 +1,120 @@
+/*
+ * layouts.js — widget rectangles for the screens that use a firmware layout
+ * table (static constexpr UiWidget kXxxLayout[] in src/screens/*.cpp).
+ *
+ * The block between the GENERATED markers below is produced by sync.py, so a
+ * button moved in the firmware moves in the sim too:
+ *     python3 simulator/sync.py
+ * Each widget-id enum becomes a const (its index in the table), and LAYOUTS
+ * maps the table name to its widgets.  Don't hand-edit inside the markers.
+ */
+
+// === BEGIN GENERATED LAYOUTS (sync.py — from firmware UiWidget tables) ===
+const FS_TOP = 0;
+const FS_FEED_50 = 1;
+const FS_FEED_75 = 2;
+const FS_FEED_100 = 3;
+const FS_FEED_125 = 4;
+const FS_FEED_DIAL = 5;
+const FS_FEED_150 = 6;
+const FS_SPIN_50 = 7;
+const FS_SPIN_75 = 8;
+const FS_SPIN_100 = 9;
+const FS_SPIN_125 = 10;
+const FS_SPIN_DIAL = 11;
+const FS_SPIN_150 = 12;
+const FS_MAIN_MENU = 13;
+const FN_VERSION = 0;
+const FN_CONNECTION = 1;
+const FN_RESOURCES = 2;
+const FN_MAIN_MENU = 3;
+const FN_MDI = 4;
+const FN_STATUS = 5;
+const JQW_STATE = 0;
+const JQW_LIST = 1;
+const JQW_UP = 2;
+const JQW_MACRO = 3;
+const JQW_REMOVE = 4;
+const JQW_BACK = 5;
+const JQW_POLICY = 6;
+const JQW_RUN = 7;
+const MM_STATUS_BAR = 0;
+const MM_JOG = 1;
+const MM_WORK_AREA = 2;
+const MM_FEEDS = 3;
+const MM_SPINDLE = 4;
+const MM_MACROS = 5;
+const MM_SD_CARD = 6;
+const MM_PROBE = 7;
+const MM_STATUS = 8;
+const MDW_PANE = 0;
+const MDW_INPUT = 1;
+const MDW_KEYS = 2;
+const ST_MACHINE = 0;
+const ST_FILE = 1;
+const ST_AXES = 2;
+const ST_FEED_SPINDLE = 3;
+const ST_MAIN_MENU = 4;
+const ST_FLUIDNC = 5;
+
+const LAYOUTS = {
+  kFeedsLayout: [
+    {"id": "FS_TOP", "x": 5, "y": 40, "w": 230, "h": 35, "label": null, "label2": null},
+    {"id": "FS_FEED_50", "x": 5, "y": 95, "w": 72, "h": 37, "label": "50%", "label2": null},
+    {"id": "FS_FEED_75", "x": 83, "y": 95, "w": 72, "h": 37, "label": "75%", "label2": null},
+    {"id": "FS_FEED_100", "x": 161, "y": 95, "w": 72, "h": 37, "label": "100%", "label2": null},
+    {"id": "FS_FEED_125", "x": 5, "y": 137, "w": 72, "h": 37, "label": "125%", "label2": null},
+    {"id": "FS_FEED_DIAL", "x": 83, "y": 137, "w": 72, "h": 37, "label": null, "label2": null},
+    {"id": "FS_FEED_150", "x": 161, "y": 137, "w": 72, "h": 37, "label": "150%", "label2": null},
+    {"id": "FS_SPIN_50", "x": 5, "y": 194, "w": 72, "h": 37, "label": "50%", "label2": null},
+    {"id": "FS_SPIN_75", "x": 83, "y": 194, "w": 72, "h": 37, "label": "75%", "label2": null},
+    {"id": "FS_SPIN_100", "x": 161, "y": 194, "w": 72, "h": 37, "label": "100%", "label2": null},
+    {"id": "FS_SPIN_125", "x": 5, "y": 236, "w": 72, "h": 37, "label": "125%", "label2": null},
+    {"id": "FS_SPIN_DIAL", "x": 83, "y": 236, "w": 72, "h": 37, "label": null, "label2": null},
+    {"id": "FS_SPIN_150", "x": 161, "y": 236, "w": 72, "h": 37, "label": "150%", "label2": null},
+    {"id": "FS_MAIN_MENU", "x": 5, "y": 280, "w": 230, "h": 40, "label": "Main Menu", "label2": null},
+  ],
+  kFluidNCLayout: [
+    {"id": "FN_VERSION", "x": 5, "y": 40, "w": 230, "h": 60, "label": null, "label2": null},
+    {"id": "FN_CONNECTION", "x": 5, "y": 108, "w": 230, "h": 70, "label": null, "label2": null},
+    {"id": "FN_RESOURCES", "x": 5, "y": 186, "w": 230, "h": 70, "label": null, "label2": null},
+    {"id": "FN_MAIN_MENU", "x": 5, "y": 272, "w": 72, "h": 40, "label": "Main Menu", "label2": null},
+    {"id": "FN_MDI", "x": 83, "y": 272, "w": 72, "h": 40, "label": "MDI", "label2": null},
+    {"id": "FN_STATUS", "x": 161, "y": 272, "w": 74, "h": 40, "label": "Status", "label2": null},
+  ],
+  kJobQueueLayout: [
+    {"id": "JQW_STATE", "x": 5, "y": 40, "w": 230, "h": 34, "label": null, "label2": null},
+    {"id": "JQW_LIST", "x": 5, "y": 78, "w": 230, "h": 156, "label": null, "label2": null},
+    {"id": "JQW_UP", "x": 5, "y": 242, "w": 72, "h": 36, "label": "Up", "label2": null},
+    {"id": "JQW_MACRO", "x": 83, "y": 242, "w": 72, "h": 36, "label": "Macro", "label2": null},
+    {"id": "JQW_REMOVE", "x": 161, "y": 242, "w": 74, "h": 36, "label": "Remove", "label2": null},
+    {"id": "JQW_BACK", "x": 5, "y": 282, "w": 72, "h": 36, "label": "SD Card", "label2": null},
+    {"id": "JQW_POLICY", "x": 83, "y": 282, "w": 72, "h": 36, "label": null, "label2": null},
+    {"id": "JQW_RUN", "x": 161, "y": 282, "w": 74, "h": 36, "label": null, "label2": null},
+  ],
+  kMainMenuLayout: [
+    {"id": "MM_STATUS_BAR", "x": 5, "y": 40, "w": 230, "h": 65, "label": null, "label2": null},
+    {"id": "MM_JOG", "x": 5, "y": 115, "w": 112, "h": 47, "label": "Jog", "label2": null},
+    {"id": "MM_WORK_AREA", "x": 123, "y": 115, "w": 112, "h": 47, "label": "Work Area", "label2": null},
+    {"id": "MM_FEEDS", "x": 5, "y": 167, "w": 112, "h": 47, "label": "Feeds &", "label2": "Speeds"},
+    {"id": "MM_SPINDLE", "x": 123, "y": 167, "w": 112, "h": 47, "label": "Spindle", "label2": "Control"},
+    {"id": "MM_MACROS", "x": 5, "y": 219, "w": 112, "h": 47, "label": "Macros", "label2": null},
+    {"id": "MM_SD_CARD", "x": 123, "y": 219, "w": 112, "h": 47, "label": "SD Card", "label2": null},
+    {"id": "MM_PROBE", "x": 5, "y": 271, "w": 112, "h": 47, "label": "Probe", "label2": null},
+    {"id": "MM_STATUS", "x": 123, "y": 271, "w": 112, "h": 47, "label": "Status", "label2": null},
+  ],
+  kMdiLayout: [
+    {"id": "MDW_PANE", "x": 5, "y": 40, "w": 230, "h": 92, "label": null, "label2": null},
+    {"id": "MDW_INPUT", "x": 5, "y": 136, "w": 230, "h": 24, "label": null, "label2": null},
+    {"id": "MDW_KEYS", "x": 5, "y": 164, "w": 230, "h": 154, "label": null, "label2": null},
+  ],
+  kStatusLayout: [
+    {"id": "ST_MACHINE", "x": 5, "y": 40, "w": 230, "h": 50, "label": null, "label2": null},
+    {"id": "ST_FILE", "x": 5, "y": 95, "w": 230, "h": 40, "label": null, "label2": null},
+    {"id": "ST_AXES", "x": 5, "y": 140, "w": 230, "h": 65, "label": null, "label2": null},
+    {"id": "ST_FEED_SPINDLE", "x": 5, "y": 210, "w": 230, "h": 65, "label": null, "label2": null},
+    {"id": "ST_MAIN_MENU", "x": 5, "y": 280, "w": 112, "h": 40, "label": "Main Menu", "label2": null},
+    {"id": "ST_FLUIDNC", "x": 123, "y": 280, "w": 112, "h": 40, "label": "FluidNC", "label2": null},
+  ],
+};
+// === END GENERATED LAYOUTS ===
@@ -163,51 +163,32 @@ function applySpindleOverride(targetPct) {
   overrideSetSpindleTarget(targetPct);
 }
 
+const kFeedPresetIds = [FS_FEED_50, FS_FEED_75, FS_FEED_100, FS_FEED_125, FS_FEED_150];
+const kSpindlePresetIds = [FS_SPIN_50, FS_SPIN_75, FS_SPIN_100, FS_SPIN_125, FS_SPIN_150];
+
 function handleFeedsSpeedsTouch(x, y) {
   const pcts = [50, 75, 100, 125, 150];
-  for (let i = 0; i < 3; i++) {
-    if (isTouchInBounds(x, y, 5 + i * 78, 95, 72, 37)) {
-      pendantFeeds.dialMode = 0; pendantFeeds.selectedFeedOverride = i;
-      applyFeedOverride(pcts[i]); redrawFeedOverrideButtons(); updateSpindleOverrideDisplay();
-      return;
-    }
-  }
-  if (isTouchInBounds(x, y, 5, 137, 72, 37)) {
-    pendantFeeds.dialMode = 0; pendantFeeds.selectedFeedOverride = 3;
-    applyFeedOverride(125); redrawFeedOverrideButtons(); updateSpindleOverrideDisplay();
-    return;
-  }
-  if (isTouchInBounds(x, y, 83, 137, 72, 37)) {
+  const id = uiHitTest("kFeedsLayout", x, y);
+  if (id === FS_FEED_DIAL) {
     pendantFeeds.dialMode = pendantFeeds.dialMode === 1 ? 0 : 1;
     updateFeedOverrideDisplay(); updateSpindleOverrideDisplay();
     return;
   }
-  if (isTouchInBounds(x, y, 161, 137, 72, 37)) {
-    pendantFeeds.dialMode = 0; pendantFeeds.selectedFeedOverride = 4;
-    applyFeedOverride(150); redrawFeedOverrideButtons(); updateSpindleOverrideDisplay();
-    return;
-  }
-  for (let i = 0; i < 3; i++) {
-    if (isTouchInBounds(x, y, 5 + i * 78, 194, 72, 37)) {
-      pendantFeeds.dialMode = 0; pendantFeeds.selectedSpindleOverride = i;
-      applySpindleOverride(pcts[i]); redrawSpindleOverrideButtons(); updateFeedOverrideDisplay();
-      return;
-    }
-  }
-  if (isTouchInBounds(x, y, 5, 236, 72, 37)) {
-    pendantFeeds.dialMode = 0; pendantFeeds.selectedSpindleOverride = 3;
-    applySpindleOverride(125); redrawSpindleOverrideButtons(); updateFeedOverrideDisplay();
-    return;
-  }
-  if (isTouchInBounds(x, y, 83, 236, 72, 37)) {
+  if (id === FS_SPIN_DIAL) {
     pendantFeeds.dialMode = pendantFeeds.dialMode === 2 ? 0 : 2;
     updateSpindleOverrideDisplay(); updateFeedOverrideDisplay();
     return;
   }
-  if (isTouchInBounds(x, y, 161, 236, 72, 37)) {
-    pendantFeeds.dialMode = 0; pendantFeeds.selectedSpindleOverride = 4;
-    applySpindleOverride(150); redrawSpindleOverrideButtons(); updateFeedOverrideDisplay();
+  if (id === FS_MAIN_MENU) { currentPendantScreen = PSCREEN_MAIN_MENU; return; }
+  let i = kFeedPresetIds.indexOf(id);
+  if (i >= 0) {
+    pendantFeeds.dialMode = 0; pendantFeeds.selectedFeedOverride = i;
+    applyFeedOverride(pcts[i]); redrawFeedOverrideButtons(); updateSpindleOverrideDisplay();
     return;
   }
-  if (isTouchInBounds(x, y, 5, 280, 230, 40)) currentPendantScreen = PSCREEN_MAIN_MENU;
+  i = kSpindlePresetIds.indexOf(id);
+  if (i >= 0) {
+    pendantFeeds.dialMode = 0; pendantFeeds.selectedSpindleOverride = i;
+    applySpindleOverride(pcts[i]); redrawSpindleOverrideButtons(); updateFeedOverrideDisplay();
+  }
 }
@@ -90,7 +90,8 @@ function drawFluidNCScreen() {
 }
 
 function handleFluidNCTouch(x, y) {
-  if (isTouchInBounds(x, y, 5, 272, 112, 40)) currentPendantScreen = PSCREEN_MAIN_MENU;
-  else if (isTouchInBounds(x, y, 123, 272, 112, 40)) currentPendantScreen = PSCREEN_STATUS;
-  else if (isTouchInBounds(x, y, 5, 108, 230, 70)) currentPendantScreen = PSCREEN_WIFI_SETUP;
+  const id = uiHitTest("kFluidNCLayout", x, y);
+  if (id === FN_MAIN_MENU) currentPendantScreen = PSCREEN_MAIN_MENU;
+  else if (id === FN_STATUS) currentPendantScreen = PSCREEN_STATUS;
+  else if (id === FN_CONNECTION) currentPendantScreen = PSCREEN_WIFI_SETUP;
 }
@@ -9,15 +9,8 @@ function drawMainMenu() {
   display.fillRoundRect(5, 40, 230, 65, 5, COLOR_DARKER_BG);
   updateMainMenuDisplay();
 
-  const btnY = 115, btnH = 47, btnGap = 52;
-  drawButton(5, btnY, 112, btnH, "Jog", COLOR_BLUE, COLOR_WHITE, 2);
-  drawButton(123, btnY, 112, btnH, "Work Area", COLOR_BLUE, COLOR_WHITE, 2);
-  drawMultiLineButton(5, btnY + btnGap, 112, btnH, "Feeds &", "Speeds", COLOR_BLUE, COLOR_WHITE, 2);
-  drawMultiLineButton(123, btnY + btnGap, 112, btnH, "Spindle", "Control", COLOR_BLUE, COLOR_WHITE, 2);
-  drawButton(5, btnY + btnGap * 2, 112, btnH, "Macros", COLOR_BLUE, COLOR_WHITE, 2);
-  drawButton(123, btnY + btnGap * 2, 112, btnH, "SD Card", COLOR_BLUE, COLOR_WHITE, 2);
-  drawButton(5, btnY + btnGap * 3, 112, btnH, "Probe", COLOR_BLUE, COLOR_WHITE, 2);
-  drawButton(123, btnY + btnGap * 3, 112, btnH, "Status", COLOR_BLUE, COLOR_WHITE, 2);
+  const L = LAYOUTS.kMainMenuLayout;
+  for (let id = MM_JOG; id < L.length; id++) uiDrawButton(L[id], COLOR_BLUE, COLOR_WHITE, 2);
 }
 
 function updateMainMenuDisplay() {
@@ -53,14 +46,12 @@ function updateMainMenuDisplay() {
   }
 }
 
+const kMainMenuTargets = [
+  null, PSCREEN_JOG_HOMING, PSCREEN_PROBING_WORK, PSCREEN_FEEDS_SPEEDS, PSCREEN_SPINDLE_CONTROL,
+  PSCREEN_MACROS, PSCREEN_SD_CARD, PSCREEN_PROBE, PSCREEN_STATUS,
+];
+
 function handleMainMenuTouch(x, y) {
-  const btnY = 115, btnH = 47, btnGap = 52;
-  if (isTouchInBounds(x, y, 5, btnY, 112, btnH)) currentPendantScreen = PSCREEN_JOG_HOMING;
-  else if (isTouchInBounds(x, y, 123, btnY, 112, btnH)) currentPendantScreen = PSCREEN_PROBING_WORK;
-  else if (isTouchInBounds(x, y, 5, btnY + btnGap, 112, btnH)) currentPendantScreen = PSCREEN_FEEDS_SPEEDS;
-  else if (isTouchInBounds(x, y, 123, btnY + btnGap, 112, btnH)) currentPendantScreen = PSCREEN_SPINDLE_CONTROL;
-  else if (isTouchInBounds(x, y, 5, btnY + btnGap * 2, 112, btnH)) currentPendantScreen = PSCREEN_MACROS;
-  else if (isTouchInBounds(x, y, 123, btnY + btnGap * 2, 112, btnH)) currentPendantScreen = PSCREEN_SD_CARD;
-  else if (isTouchInBounds(x, y, 5, btnY + btnGap * 3, 112, btnH)) currentPendantScreen = PSCREEN_PROBE;
-  else if (isTouchInBounds(x, y, 123, btnY + btnGap * 3, 112, btnH)) currentPendantScreen = PSCREEN_STATUS;
+  const id = uiHitTest("kMainMenuLayout", x, y);
+  if (id > MM_STATUS_BAR) currentPendantScreen = kMainMenuTargets[id];
 }
@@ -132,6 +132,7 @@ function updateStatusFeedSpindle() {
 }
 
 function handleStatusTouch(x, y) {
-  if (isTouchInBounds(x, y, 5, 280, 112, 40)) currentPendantScreen = PSCREEN_MAIN_MENU;
-  else if (isTouchInBounds(x, y, 123, 280, 112, 40)) currentPendantScreen = PSCREEN_FLUIDNC;
+  const id = uiHitTest("kStatusLayout", x, y);
+  if (id === ST_MAIN_MENU) currentPendantScreen = PSCREEN_MAIN_MENU;
+  else if (id === ST_FLUIDNC) currentPendantScreen = PSCREEN_FLUIDNC;
 }
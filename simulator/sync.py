@@ -7,6 +7,9 @@ What it does automatically:
     src/screens/screen_probe.h and regenerates the marked block in
     js/colors.js.  A colour tweak in the firmware shows up in the sim with no
     manual work.
+  • LAYOUTS — parses the `static constexpr UiWidget kXxxLayout[]` tables in
+    src/screens/*.cpp (see screen_layout.h) and regenerates js/layouts.js, so
+    the sim's button rectangles and widget ids come straight from the firmware.
 
 What it can't do automatically (and instead reports):
   • SCREEN LOGIC — each js/screens/<x>.js is a hand-port of the matching
@@ -16,7 +19,7 @@ What it can't do automatically (and instead reports):
     `sync.py --accept` — i.e. exactly which JS ports need a manual update.
 
 Usage:
-    python3 simulator/sync.py            # regen colours + print staleness report
+    python3 simulator/sync.py            # regen colours/layouts + print staleness report
     python3 simulator/sync.py --accept   # ...and mark all firmware files as
                                          #    reviewed (clears the report)
 
@@ -34,10 +37,13 @@ REPO = os.path.dirname(SIM_DIR)
 SRC = os.path.join(REPO, "src")
 SCREENS = os.path.join(SRC, "screens")
 COLORS_JS = os.path.join(SIM_DIR, "js", "colors.js")
+LAYOUTS_JS = os.path.join(SIM_DIR, "js", "layouts.js")
 MANIFEST = os.path.join(SIM_DIR, ".sync_manifest.json")
 
 GEN_BEGIN = "// === BEGIN GENERATED COLORS (sync.py — from firmware #defines) ==="
 GEN_END = "// === END GENERATED COLORS ==="
+LAYOUT_BEGIN = "// === BEGIN GENERATED LAYOUTS (sync.py — from firmware UiWidget tables) ==="
+LAYOUT_END = "// === END GENERATED LAYOUTS ==="
 
 # firmware file (relative to src/)  ->  simulator JS port it feeds
 PORT_MAP = {
@@ -125,6 +131,85 @@ def regen_colors():
     return False
 
 
+_TABLE_RE = re.compile(r"static\s+constexpr\s+UiWidget\s+(\w+)\s*\[\s*\]\s*=\s*\{(.*?)\n\};", re.S)
+_ENTRY_RE = re.compile(r"^\s*\{\s*(.*?)\s*\},?\s*(?://.*)?$")
+_FIELD_RE = re.compile(r'"(?:[^"\\]|\\.)*"|[^,]+')
+
+
+def _parse_field(tok):
+    tok = tok.strip()
+    if tok == "nullptr":
+        return None
+    if tok.startswith('"'):
+        return json.loads(tok)
+    return int(tok, 0) if re.fullmatch(r"-?(0x)?[0-9a-fA-F]+", tok) else tok
+
+
+def _parse_layouts(path):
+    """Return ordered [(table, [widget dict])] for every UiWidget table in a file.
+    Entries are one per line: { ID, x, y, w, h, "label"|nullptr, "label2"|nullptr }."""
+    out = []
+    src = open(path, encoding="utf-8").read()
+    for m in _TABLE_RE.finditer(src):
+        widgets = []
+        for line in m.group(2).splitlines():
+            e = _ENTRY_RE.match(line)
+            if not e:
+                continue
+            f = [_parse_field(t) for t in _FIELD_RE.findall(e.group(1))]
+            if len(f) != 7:
+                continue
+            widgets.append({"id": f[0], "x": f[1], "y": f[2], "w": f[3], "h": f[4],
+                            "label": f[5], "label2": f[6]})
+        out.append((m.group(1), widgets))
+    return out
+
+
+def build_layouts_block():
+    tables = []
+    for name in sorted(os.listdir(SCREENS)):
+        if name.endswith(".cpp"):
+            tables += _parse_layouts(os.path.join(SCREENS, name))
+    lines = [LAYOUT_BEGIN]
+    for table, widgets in tables:
+        for i, w in enumerate(widgets):
+            lines.append(f"const {w['id']} = {i};")
+    if tables:
+        lines.append("")
+    lines.append("const LAYOUTS = {")
+    for table, widgets in tables:
+        lines.append(f"  {table}: [")
+        for w in widgets:
+            lines.append("    " + json.dumps(w, ensure_ascii=False) + ",")
+        lines.append("  ],")
+    lines.append("};")
+    lines.append(LAYOUT_END)
+    return "\n".join(lines), len(tables)
+
+
+def regen_layouts():
+    """Rewrite the generated block in js/layouts.js. Returns True if it changed."""
+    if not os.path.isfile(LAYOUTS_JS) or not os.path.isdir(SCREENS):
+        return False
+    block, ntables = build_layouts_block()
+    if ntables == 0:
+        return False  # nothing parsed — leave file as-is
+    src = open(LAYOUTS_JS, encoding="utf-8").read()
+    if LAYOUT_BEGIN in src and LAYOUT_END in src:
+        new = re.sub(
+            re.escape(LAYOUT_BEGIN) + r".*?" + re.escape(LAYOUT_END),
+            block.replace("\\", "\\\\"),
+            src,
+            flags=re.S,
+        )
+    else:
+        new = src.rstrip() + "\n\n" + block + "\n"
+    if new != src:
+        open(LAYOUTS_JS, "w", encoding="utf-8").write(new)
+        return True
+    return False
+
+
 def _hash(path):
     if not os.path.isfile(path):
         return None
@@ -176,6 +261,10 @@ def main():
             print("colours: regenerated js/colors.js from firmware #defines")
         else:
             print("colours: already up to date")
+        if regen_layouts():
+            print("layouts: regenerated js/layouts.js from firmware UiWidget tables")
+        else:
+            print("layouts: already up to date")
 
     report = compute_report()
     if report["missing"]:
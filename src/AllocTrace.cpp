@@ -0,0 +1,106 @@
+// Copyright (c) 2026 — FluidDial-CYD
+// Use of this source code is governed by a GPLv3 license.
+
+// ── Steady-state heap allocation tracer ──────────────────────────────────────
+//
+// Linker-level hook: the alloctrace env passes -Wl,--wrap=malloc (and calloc /
+// realloc), so every reference to malloc() in the image — Arduino String,
+// operator new, LovyanGFX sprite buffers — resolves to __wrap_malloc() here,
+// which counts and forwards to the real allocator.  Only allocations made on
+// the task that called alloc_trace_begin() (the UI loop task) are counted, so
+// the comms / WiFi tasks don't pollute the numbers.
+//
+// A summary is printed at most every REPORT_MS, and only if some steady-state
+// iteration allocated.  "first caller" is the return address of the first
+// allocation in the worst iteration — feed it to addr2line (or let the
+// esp32_exception_decoder monitor filter do it) to find the offending line.
+
+#ifdef ALLOC_TRACE
+
+#include "AllocTrace.h"
+#include "System.h"   // dbg_printf
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+extern "C" {
+void* __real_malloc(size_t size);
+void* __real_calloc(size_t n, size_t size);
+void* __real_realloc(void* ptr, size_t size);
+}
+
+static const uint32_t REPORT_MS = 5000;
+
+static TaskHandle_t   _traceTask = nullptr;   // set once, on the UI task
+static volatile bool  _counting  = false;
+static uint32_t       _iterAllocs;
+static uint32_t       _iterBytes;
+static void*          _iterFirstCaller;
+
+// Accumulated between reports (steady-state iterations only).
+static uint32_t _steadyIters;       // steady iterations seen
+static uint32_t _allocIters;        // ... of which allocated
+static uint32_t _totalAllocs;
+static uint32_t _totalBytes;
+static uint32_t _worstAllocs;
+static void*    _worstCaller;
+static uint32_t _lastReportMs;
+
+static inline void note_alloc(size_t size, void* caller) {
+    if (!_counting || xTaskGetCurrentTaskHandle() != _traceTask) return;
+    if (_iterAllocs++ == 0) _iterFirstCaller = caller;
+    _iterBytes += size;
+}
+
+extern "C" void* __wrap_malloc(size_t size) {
+    note_alloc(size, __builtin_return_address(0));
+    return __real_malloc(size);
+}
+
+extern "C" void* __wrap_calloc(size_t n, size_t size) {
+    note_alloc(n * size, __builtin_return_address(0));
+    return __real_calloc(n, size);
+}
+
+extern "C" void* __wrap_realloc(void* ptr, size_t size) {
+    note_alloc(size, __builtin_return_address(0));
+    return __real_realloc(ptr, size);
+}
+
+void alloc_trace_begin() {
+    if (!_traceTask) _traceTask = xTaskGetCurrentTaskHandle();
+    _iterAllocs      = 0;
+    _iterBytes       = 0;
+    _iterFirstCaller = nullptr;
+    _counting        = true;
+}
+
+void alloc_trace_end(bool steady) {
+    _counting = false;   // the report below may itself allocate
+
+    if (steady) {
+        _steadyIters++;
+        if (_iterAllocs) {
+            _allocIters++;
+            _totalAllocs += _iterAllocs;
+            _totalBytes += _iterBytes;
+            if (_iterAllocs > _worstAllocs) {
+                _worstAllocs = _iterAllocs;
+                _worstCaller = _iterFirstCaller;
+            }
+        }
+    }
+
+    uint32_t now = millis();
+    if (now - _lastReportMs < REPORT_MS) return;
+    _lastReportMs = now;
+    if (_allocIters) {
+        dbg_printf("[alloc] %u/%u steady iterations allocated: %u allocs, %u bytes; worst %u, first caller %p\n",
+                   (unsigned)_allocIters, (unsigned)_steadyIters, (unsigned)_totalAllocs, (unsigned)_totalBytes,
+                   (unsigned)_worstAllocs, _worstCaller);
+    }
+    _steadyIters = _allocIters = _totalAllocs = _totalBytes = _worstAllocs = 0;
+    _worstCaller = nullptr;
+}
+
+#endif  // ALLOC_TRACE
@@ -0,0 +1,24 @@
+// Copyright (c) 2026 — FluidDial-CYD
+// Use of this source code is governed by a GPLv3 license.
+
+#pragma once
+#include <stdint.h>
+
+// ── Steady-state heap allocation tracer (debug builds only) ──────────────────
+//
+// Counts heap allocations made by the UI task during each loop_pendant()
+// iteration and reports iterations that allocated while nothing was
+// happening (no input, no navigation) — a steady-state redraw should never
+// touch the heap.  Build with the cyd_new_ui_alloctrace env, which defines
+// ALLOC_TRACE and links malloc/calloc/realloc through --wrap so every
+// String / new / malloc call is seen.
+//
+// In every other build these compile to nothing.
+
+#ifdef ALLOC_TRACE
+void alloc_trace_begin();              // top of loop_pendant(), on the UI task
+void alloc_trace_end(bool steady);     // bottom; steady = no input/navigation this pass
+#else
+inline void alloc_trace_begin() {}
+inline void alloc_trace_end(bool) {}
+#endif
@@ -20,10 +20,17 @@
 #include "Scene.h"
 #include "AboutScene.h"   // aboutScene.getBrightness() — normal backlight level
 #include "FluidNCModel.h"
+#include "AllocTrace.h"
 #include "FileParser.h"
 #include "ConfigItem.h"
 #include "Encoder.h"
 #include "GrblParserC.h"
+#include "LinkRtt.h"
+#include "CommandQueue.h"
+#include "OverridePlanner.h"
+#include "UiTimers.h"
+#include "WcsOffsets.h"
+#include "GcodeStreamer.h"
 
 // Screen files
 #include "screens/pendant_shared.h"
@@ -40,7 +47,11 @@
 #include "screens/screen_spindle_control.h"
 #include "screens/screen_macros.h"
 #include "screens/screen_sd_card.h"
+#include "screens/screen_job_queue.h"
+#include "screens/job_queue.h"
 #include "screens/screen_fluidnc.h"
+#include "screens/screen_mdi.h"
+#include "screens/mdi_console.h"
 #include "screens/screen_wifi_setup.h"
 
 #include "Comms.h"
@@ -88,46 +99,12 @@ static bool          jogContinuous  = false;
 static int           jogRapidCount  = 0;
 static bool          jogForceReseed = false;  // set on cancel → soft-limit predMm re-seeds
 
-// ── Paced feed/spindle override stepper ───────────────────────────────────────
-// FluidNC overrides are relative-only (reset / ±10% coarse / ±1% fine real-time
-// bytes); an absolute target is reached by stepping.  Firing all the steps in a
-// tight loop floods a Modbus VFD's command queue (→ "VFD Queue Full", wrong
-// landing) and can starve FluidNC's network task into a watchdog reboot.  So we
-// store a TARGET and walk toward it from the current REPORTED value — coarse then
-// fine — one real-time byte every OVR_STEP_MS from the periodic loop.  Uses only
-// realtime bytes, so it works during a running job; anchoring off the reported
-// value means no reset-to-100% spike and the fewest possible steps.
-static const unsigned long OVR_STEP_MS = 60;   // min gap between override bytes
-struct OvrStepper {
-    int           target     = -1;    // -1 = idle (no ramp in progress)
-    int           commanded  = 100;   // running estimate of the % last commanded
-    unsigned long lastSendMs = 0;
-    bool          active     = false;
-};
-static OvrStepper feedOvr;
-static OvrStepper spindleOvr;
-
-static void ovrSetTarget(OvrStepper& s, int reported, int target) {
-    target = constrain(target, 10, 200);
-    if (!s.active) { s.commanded = constrain(reported, 10, 200); s.active = true; }
-    s.target = target;
-}
-void overrideSetFeedTarget(int pct)    { ovrSetTarget(feedOvr,    pendantMachine.feedOverride,    pct); }
-void overrideSetSpindleTarget(int pct) { ovrSetTarget(spindleOvr, pendantMachine.spindleOverride, pct); }
-
-// One paced step toward the target: coarse (±10%) while ≥10 away, else fine (±1%).
-static void ovrStep(OvrStepper& s, unsigned long now, realtime_cmd_t cP,
-                    realtime_cmd_t cM, realtime_cmd_t fP, realtime_cmd_t fM) {
-    if (s.target < 0) return;
-    if (s.commanded == s.target) { s.target = -1; s.active = false; return; }
-    if (now - s.lastSendMs < OVR_STEP_MS) return;
-    s.lastSendMs = now;
-    int gap = s.target - s.commanded;
-    if      (gap >=  10) { fnc_realtime(cP); s.commanded += 10; }
-    else if (gap <= -10) { fnc_realtime(cM); s.commanded -= 10; }
-    else if (gap >   0)  { fnc_realtime(fP); s.commanded += 1;  }
-    else                 { fnc_realtime(fM); s.commanded -= 1;  }
-}
+// ── Feed/spindle overrides ────────────────────────────────────────────────────
+// Screens set an absolute target; OverridePlanner.cpp reaches it from the
+// reported value in the fewest realtime bytes, paced by the status reports
+// that acknowledge each batch (ovr_poll() in the periodic loop below).
+void overrideSetFeedTarget(int pct)    { ovr_set_target(OVR_FEED, pct); }
+void overrideSetSpindleTarget(int pct) { ovr_set_target(OVR_SPINDLE, pct); }
 
 // ===== Screen State =====
 PendantScreen currentPendantScreen = PSCREEN_MAIN_MENU;
@@ -148,23 +125,102 @@ LGFX_Sprite spriteValueDisplay(&display);
 LGFX_Sprite spriteStatusBar(&display);
 LGFX_Sprite spriteFileDisplay(&display);
 
-// 8-bit panel-sprite allocator (see pendant_shared.h).  Depth is set BEFORE
-// createSprite() — that's the whole point: the previous code set 16-bit AFTER
-// creation, a no-op, so panels were full 16-bit and frequently failed to
-// allocate on the heap-tight WiFi build (→ flicker).  8-bit (rgb332) halves
-// the buffer, so allocation succeeds far more often and the flicker-free
-// sprite path becomes the common case.  pushSprite() converts 8→16 bit for the
-// display automatically.
-bool allocPanelSprite(LGFX_Sprite& s, int w, int h, uint32_t minHeap) {
+// ── Palettized panel sprites ──────────────────────────────────────────────
+// Every panel on the new UI is drawn from the same small set of theme colours
+// (cnc_pendant_config.h + the probe screens' dim-gray hint ink), so instead of
+// 8-bit rgb332 (which crushed COLOR_DARKER_BG's blue → greenish) or 16-bit
+// (2 bytes/px) the panel sprites are palette-indexed: 4 bits/px against the
+// exact theme colours below, or 2 bits/px for the single-ink probing-work
+// readouts.  LovyanGFX expands palette → RGB565 in pushSprite(), so what lands
+// on the glass is the exact 565 value — no tint, a quarter of the 16-bit RAM.
+// A 230×200 list is 23 KB (was 46 KB at 8-bit), the shared scratch ~7.5 KB.
+//
+// Palette sprites take a palette INDEX as the draw colour, not RGB565, so all
+// panel drawing goes through panelInk(g, COLOR_*) (see pendant_shared.h).
+static const uint16_t kUiPalette[16] = {
+    COLOR_BACKGROUND,   COLOR_DARKER_BG,   COLOR_GRAY_TEXT,   COLOR_ORANGE,
+    COLOR_GREEN,        COLOR_DARK_GREEN,  COLOR_CYAN,        COLOR_BLUE,
+    COLOR_RED,          COLOR_YELLOW,      COLOR_WHITE,       COLOR_BUTTON_GRAY,
+    COLOR_BUTTON_ACTIVE, COLOR_TEAL,       COLOR_TEAL_BRIGHT, 0x4208,  // PROBE_C_DIMBLUE
+};
+
+// Which palette each live panel sprite was created with, so panelInk() can map
+// a theme colour to that sprite's index.  One slot per panel sprite below.
+struct PanelPalette {
+    const LovyanGFX* target;
+    uint16_t         colors[16];
+    uint8_t          count;
+};
+static PanelPalette _panelPalettes[5];
+
+static PanelPalette* panelPaletteSlot(const LovyanGFX* target, bool claim) {
+    PanelPalette* freeSlot = nullptr;
+    for (auto& p : _panelPalettes) {
+        if (p.target == target) return &p;
+        if (!p.target && !freeSlot) freeSlot = &p;
+    }
+    return claim ? freeSlot : nullptr;
+}
+
+// Create s as a palette sprite (depth set BEFORE createSprite()) and load the
+// given RGB565 colours into its palette.  Returns false with s empty on failure.
+static bool createPaletteSprite(LGFX_Sprite& s, int w, int h, const uint16_t* colors, uint8_t count) {
     s.deleteSprite();
-    if (minHeap && ESP.getFreeHeap() < minHeap) return false;
-    s.setColorDepth(8);
+    s.setColorDepth(count <= 4 ? 2 : 4);
     s.createSprite(w, h);
     if (!s.getBuffer()) { s.deleteSprite(); return false; }
+    if (!s.createPalette()) { s.deleteSprite(); return false; }
+    PanelPalette* slot = panelPaletteSlot(&s, true);
+    if (!slot) { s.deleteSprite(); return false; }
+    slot->target = &s;
+    slot->count  = count;
+    for (uint8_t i = 0; i < count; i++) {
+        uint16_t c = colors[i];
+        slot->colors[i] = c;
+        // 565 → 888 with bit replication so 0xFFFF stays pure white.
+        uint8_t r = (c >> 11) & 0x1F, g = (c >> 5) & 0x3F, b = c & 0x1F;
+        s.setPaletteColor(i, (uint8_t)((r << 3) | (r >> 2)), (uint8_t)((g << 2) | (g >> 4)), (uint8_t)((b << 3) | (b >> 2)));
+    }
     return true;
 }
 
-// One shared 16-bit scratch sprite, reused for every panel draw on a screen.
+static void deletePanelSprite(LGFX_Sprite& s) {
+    s.deleteSprite();
+    if (PanelPalette* slot = panelPaletteSlot(&s, false)) slot->target = nullptr;
+}
+
+uint32_t panelInk(const LovyanGFX* g, uint16_t color) {
+    const PanelPalette* p = panelPaletteSlot(g, false);
+    if (!p) return color;  // the display itself (direct-draw fallback) — plain RGB565
+    // Exact theme colour in the common case; otherwise the nearest entry, so an
+    // off-palette colour degrades to a close shade instead of a random index.
+    uint32_t best = 0, bestDist = UINT32_MAX;
+    for (uint8_t i = 0; i < p->count; i++) {
+        uint16_t e = p->colors[i];
+        if (e == color) return i;
+        int      dr = ((e >> 11) & 0x1F) - ((color >> 11) & 0x1F);
+        int      dg = (((e >> 5) & 0x3F) - ((color >> 5) & 0x3F)) / 2;
+        int      db = (e & 0x1F) - (color & 0x1F);
+        uint32_t d  = dr * dr + dg * dg + db * db;
+        if (d < bestDist) { bestDist = d; best = i; }
+    }
+    return best;
+}
+
+bool allocPanelSprite(LGFX_Sprite& s, int w, int h, uint32_t minHeap) {
+    deletePanelSprite(s);
+    if (minHeap && ESP.getFreeHeap() < minHeap) return false;
+    return createPaletteSprite(s, w, h, kUiPalette, 16);
+}
+
+bool allocMonoPanelSprite(LGFX_Sprite& s, int w, int h, uint16_t ink, uint32_t minHeap) {
+    deletePanelSprite(s);
+    if (minHeap && ESP.getFreeHeap() < minHeap) return false;
+    const uint16_t colors[4] = { COLOR_BACKGROUND, COLOR_DARKER_BG, COLOR_GRAY_TEXT, ink };
+    return createPaletteSprite(s, w, h, colors, 4);
+}
+
+// One shared 4-bit scratch sprite, reused for every panel draw on a screen.
 // Grows on demand to the largest panel size seen and is then held (no per-frame
 // alloc/free churn), and is released by releasePanelSprites() on screen change
 // so it never competes with the macros/SD list sprites.
@@ -173,22 +229,22 @@ static int         scratchW = 0;
 static int         scratchH = 0;
 
 void releasePanelSprites() {
-    spriteAxisDisplay.deleteSprite();
-    spriteValueDisplay.deleteSprite();
-    spriteStatusBar.deleteSprite();
-    spriteFileDisplay.deleteSprite();
-    spritePanelScratch.deleteSprite();
+    deletePanelSprite(spriteAxisDisplay);
+    deletePanelSprite(spriteValueDisplay);
+    deletePanelSprite(spriteStatusBar);
+    deletePanelSprite(spriteFileDisplay);
+    deletePanelSprite(spritePanelScratch);
     scratchW = scratchH = 0;
 }
 
 // Shared-scratch panel helpers.  Instead of allocating/freeing a sprite on
 // every panel every frame (heap churn + fragmentation), or holding a separate
-// persistent buffer per panel (too much RAM at 16-bit), these draw every panel
-// into ONE 16-bit scratch sprite and push only the panel's w×h region via a
-// destination clip rect.  The scratch grows monotonically to the screen's
-// largest panel, then stays put — zero churn in steady state.  16-bit keeps the
-// near-neutral COLOR_DARKER_BG panels true gray (8-bit rgb332 crushed them
-// green).  Freed by releasePanelSprites() on screen change.
+// persistent buffer per panel, these draw every panel into ONE 4-bit palette
+// scratch sprite and push only the panel's w×h region via a destination clip
+// rect.  The scratch grows monotonically to the screen's largest panel, then
+// stays put — zero churn in steady state.  The palette holds the exact theme
+// colours, so the near-neutral COLOR_DARKER_BG panels stay true gray.  Freed by
+// releasePanelSprites() on screen change.
 //
 // beginPanelSprite() returns the graphics target and sets ox/oy to the draw
 // origin: (0,0) into the scratch, or the on-screen panel origin (px,py) when the
@@ -198,26 +254,24 @@ LovyanGFX* beginPanelSprite(int w, int h, int& ox, int& oy, int px, int py) {
     if (!spritePanelScratch.getBuffer() || w > scratchW || h > scratchH) {
         int nw = w > scratchW ? w : scratchW;
         int nh = h > scratchH ? h : scratchH;
-        spritePanelScratch.deleteSprite();
-        spritePanelScratch.setColorDepth(16);
-        spritePanelScratch.createSprite(nw, nh);
-        if (spritePanelScratch.getBuffer()) { scratchW = nw; scratchH = nh; }
-        else                                { scratchW = scratchH = 0; }
+        deletePanelSprite(spritePanelScratch);
+        if (createPaletteSprite(spritePanelScratch, nw, nh, kUiPalette, 16)) { scratchW = nw; scratchH = nh; }
+        else                                                                  { scratchW = scratchH = 0; }
     }
     if (spritePanelScratch.getBuffer()) {
         ox = 0; oy = 0;
         return (LovyanGFX*)&spritePanelScratch;
     }
     ox = px; oy = py;
-    return (LovyanGFX*)&display;
+    return gfx;
 }
 
 void endPanelSprite(int w, int h, int px, int py) {
     if (spritePanelScratch.getBuffer()) {
         // Clip the destination so a larger scratch writes only the panel region.
-        display.setClipRect(px, py, w, h);
-        spritePanelScratch.pushSprite(px, py);
-        display.clearClipRect();
+        gfxSetClip(px, py, w, h);
+        spritePanelScratch.pushSprite(gfx, px, py);
+        gfxClearClip();
     }
 }
 
@@ -227,33 +281,39 @@ bool isTouchInBounds(int tx, int ty, int x, int y, int w, int h) {
 }
 
 void drawRoundRect(int x, int y, int w, int h, int r, uint16_t color) {
-    display.fillRoundRect(x, y, w, h, r, color);
+    gfx->fillRoundRect(x, y, w, h, r, color);
 }
 
-void drawButton(int x, int y, int w, int h, String text, uint16_t bgColor, uint16_t textColor, int textSize) {
+void drawButton(int x, int y, int w, int h, const char* text, uint16_t bgColor, uint16_t textColor, int textSize) {
     drawRoundRect(x, y, w, h, 8, bgColor);
-    display.setTextColor(textColor);
-    display.setTextSize(textSize);
-    int16_t tw = display.textWidth(text.c_str());
-    int16_t th = display.fontHeight();
-    display.setCursor(x + (w - tw) / 2, y + (h - th) / 2);
-    display.print(text);
+    gfx->setTextColor(textColor);
+    gfx->setTextSize(textSize);
+    int16_t tw = gfx->textWidth(text);
+    int16_t th = gfx->fontHeight();
+    gfx->setCursor(x + (w - tw) / 2, y + (h - th) / 2);
+    gfx->print(text);
 }
 
-void drawMultiLineButton(int x, int y, int w, int h, String line1, String line2,
+void drawMultiLineButton(int x, int y, int w, int h, const char* line1, const char* line2,
                          uint16_t bgColor, uint16_t textColor, int textSize) {
     drawRoundRect(x, y, w, h, 8, bgColor);
-    display.setTextColor(textColor);
-    display.setTextSize(textSize);
-    int16_t fh     = display.fontHeight();
+    gfx->setTextColor(textColor);
+    gfx->setTextSize(textSize);
+    int16_t fh     = gfx->fontHeight();
     int16_t totalH = fh * 2 + 4;
     int16_t startY = y + (h - totalH) / 2;
-    int16_t tw1    = display.textWidth(line1.c_str());
-    display.setCursor(x + (w - tw1) / 2, startY);
-    display.print(line1);
-    int16_t tw2 = display.textWidth(line2.c_str());
-    display.setCursor(x + (w - tw2) / 2, startY + fh + 4);
-    display.print(line2);
+    int16_t tw1    = gfx->textWidth(line1);
+    gfx->setCursor(x + (w - tw1) / 2, startY);
+    gfx->print(line1);
+    int16_t tw2 = gfx->textWidth(line2);
+    gfx->setCursor(x + (w - tw2) / 2, startY + fh + 4);
+    gfx->print(line2);
+}
+
+// Draw a layout-table button: two-line when the widget has a second label.
+void uiDrawButton(const UiWidget& w, uint16_t bgColor, uint16_t textColor, int textSize) {
+    if (w.label2) drawMultiLineButton(w.x, w.y, w.w, w.h, w.label, w.label2, bgColor, textColor, textSize);
+    else          drawButton(w.x, w.y, w.w, w.h, w.label ? w.label : "", bgColor, textColor, textSize);
 }
 
 // ── Battery icon ─────────────────────────────────────────────────────────────
@@ -319,7 +379,7 @@ static void drawBatteryIcon() {
         drawChargeBolt(spr, 8, 2);                // full-height yellow lightning bolt overlay
     // Position: x=212 to leave a ~3px right margin so the icon's right edge
     // sits symmetrically relative to the WiFi icon's left edge at x=5.
-    spr.pushSprite(212, 11);                      // atomic blit — no visible clear step
+    spr.pushSprite(gfx, 212, 11);                 // atomic blit — no visible clear step
 }
 
 // ── WiFi signal-strength icon ────────────────────────────────────────────────
@@ -367,31 +427,40 @@ static void drawWiFiIcon() {
             spr.fillRect(x, y, 3, h, col);
         }
     }
-    spr.pushSprite(5, 11);
+    spr.pushSprite(gfx, 5, 11);
 #endif
 }
 
-void drawTitle(String title) {
-    display.fillRect(0, 0, 240, 35, COLOR_DARKER_BG);
-    display.setTextColor(COLOR_TITLE);
-    display.setTextSize(2);
-    int16_t tw = display.textWidth(title.c_str());
-    display.setCursor((240 - tw) / 2, 10);
-    display.print(title);
+// Title bar without the status icons — the static part, for screen chrome.
+void drawTitleBar(const char* title) {
+    gfx->fillRect(0, 0, 240, 35, COLOR_DARKER_BG);
+    gfx->setTextColor(COLOR_TITLE);
+    gfx->setTextSize(2);
+    int16_t tw = gfx->textWidth(title);
+    gfx->setCursor((240 - tw) / 2, 10);
+    gfx->print(title);
+}
+
+void drawTitleIcons() {
     drawWiFiIcon();     // overlay icon at top-left;  no-op if not in WiFi mode
     drawBatteryIcon();  // overlay icon at top-right; no-op if battery unavailable
 }
 
-void drawInfoBox(int x, int y, int w, int h, String label, String value, uint16_t valueColor) {
-    display.fillRoundRect(x, y, w, h, 5, COLOR_DARKER_BG);
-    display.setTextColor(COLOR_GRAY_TEXT);
-    display.setTextSize(1);
-    display.setCursor(x + 5, y + 5);
-    display.print(label);
-    display.setTextColor(valueColor);
-    display.setTextSize(2);
-    display.setCursor(x + 5, y + 20);
-    display.print(value);
+void drawTitle(const char* title) {
+    drawTitleBar(title);
+    drawTitleIcons();
+}
+
+void drawInfoBox(int x, int y, int w, int h, const char* label, const char* value, uint16_t valueColor) {
+    gfx->fillRoundRect(x, y, w, h, 5, COLOR_DARKER_BG);
+    gfx->setTextColor(COLOR_GRAY_TEXT);
+    gfx->setTextSize(1);
+    gfx->setCursor(x + 5, y + 5);
+    gfx->print(label);
+    gfx->setTextColor(valueColor);
+    gfx->setTextSize(2);
+    gfx->setCursor(x + 5, y + 20);
+    gfx->print(value);
 }
 
 // ===== Screen sleep (PSCREEN_SLEEP) =====
@@ -407,12 +476,32 @@ void drawInfoBox(int x, int y, int w, int h, String label, String value, uint16_
 extern AboutScene aboutScene;   // normal backlight level (AboutScene.cpp)
 
 static PendantScreen sleepReturnScreen        = PSCREEN_MAIN_MENU;
-static unsigned long lastActivityMs           = 0;
+static UiTimer       sleepTimer               = {};  // re-armed by every bit of activity
 static bool          swallowTouchUntilRelease = false;
 
+// Only WiFi (battery) pendants sleep — wired pendants are powered from the
+// controller and have no battery, so they power down with it and there's
+// nothing to blank.  Eligible to blank when the CNC is Idle OR while the
+// pendant is still "Connecting" (not connected) — both are no-activity states.
+static bool sleepEligible() {
+    return comms_active_mode() == COMMS_MODE_WIFI
+           && (!pendantConnected || pendantMachine.status.startsWith("Idle"));
+}
+
+static void sleepTimeout(void* /*ctx*/) {
+    if (currentPendantScreen != PSCREEN_SLEEP && currentPendantScreen != PSCREEN_WIFI_SETUP && sleepEligible()) {
+        sleepReturnScreen = currentPendantScreen;
+        navigateTo(PSCREEN_SLEEP);   // enterSleep() turns the backlight off
+    }
+}
+
+static void noteActivity() {
+    ui_timer_arm(sleepTimer, SLEEP_TIMEOUT_MS, sleepTimeout);
+}
+
 static void enterSleep()      { display.setBrightness(0); }                          // backlight off
 static void exitSleep()       { display.setBrightness(aboutScene.getBrightness()); } // restore normal
-static void drawSleepScreen() { display.fillScreen(COLOR_BACKGROUND); }              // black (invisible w/ BL off)
+static void drawSleepScreen() { gfx->fillScreen(COLOR_BACKGROUND); }                 // black (invisible w/ BL off)
 
 static void handleSleepTouch(int /*x*/, int /*y*/) {
     // ANY touch wakes.  The touch is consumed here and never dispatched to the
@@ -422,8 +511,8 @@ static void handleSleepTouch(int /*x*/, int /*y*/) {
     // release-gate stops a held finger from carrying into a button on the
     // restored screen until it is lifted.
     swallowTouchUntilRelease = true;
-    lastActivityMs           = millis();
     currentPendantScreen     = sleepReturnScreen;
+    noteActivity();
 }
 
 // ===== Screen Lifecycle Routing =====
@@ -444,7 +533,9 @@ static void callScreenExit(PendantScreen s) {
         case PSCREEN_SPINDLE_CONTROL:  exitSpindleControl();  break;
         case PSCREEN_MACROS:           exitMacros();          break;
         case PSCREEN_SD_CARD:          exitSDCard();          break;
+        case PSCREEN_JOB_QUEUE:        exitJobQueue();        break;
         case PSCREEN_FLUIDNC:          exitFluidNC();         break;
+        case PSCREEN_MDI:              exitMdi();             break;
         case PSCREEN_WIFI_SETUP:       exitWiFiSetup();       break;
         case PSCREEN_SLEEP:            exitSleep();           break;
     }
@@ -467,13 +558,15 @@ static void callScreenEnter(PendantScreen s) {
         case PSCREEN_SPINDLE_CONTROL:  enterSpindleControl();  break;
         case PSCREEN_MACROS:           enterMacros();          break;
         case PSCREEN_SD_CARD:          enterSDCard();          break;
+        case PSCREEN_JOB_QUEUE:        enterJobQueue();        break;
         case PSCREEN_FLUIDNC:          enterFluidNC();         break;
+        case PSCREEN_MDI:              enterMdi();             break;
         case PSCREEN_WIFI_SETUP:       enterWiFiSetup();       break;
         case PSCREEN_SLEEP:            enterSleep();           break;
     }
 }
 
-void drawCurrentPendantScreen() {
+static void drawPendantScreenBody() {
     switch (currentPendantScreen) {
         case PSCREEN_MAIN_MENU:        drawMainMenu();              break;
         case PSCREEN_STATUS:           drawStatusScreen();          break;
@@ -490,12 +583,20 @@ void drawCurrentPendantScreen() {
         case PSCREEN_SPINDLE_CONTROL:  drawSpindleControlScreen();  break;
         case PSCREEN_MACROS:           drawMacrosScreen();          break;
         case PSCREEN_SD_CARD:          drawSDCardScreen();          break;
+        case PSCREEN_JOB_QUEUE:        drawJobQueueScreen();        break;
         case PSCREEN_FLUIDNC:          drawFluidNCScreen();         break;
+        case PSCREEN_MDI:              drawMdiScreen();             break;
         case PSCREEN_WIFI_SETUP:       drawWiFiSetupScreen();       break;
         case PSCREEN_SLEEP:            drawSleepScreen();           break;
     }
 }
 
+// Full redraws go out in DMA-pushed strips (band_render.h) so a screen switch
+// never shows a cleared or half-drawn frame.
+void drawCurrentPendantScreen() {
+    bandRender(drawPendantScreenBody);
+}
+
 void navigateTo(PendantScreen next) {
     if (next == currentPendantScreen) return;
     callScreenExit(currentPendantScreen);
@@ -520,6 +621,8 @@ static void handlePendantTouch(int x, int y) {
         case PSCREEN_SPINDLE_CONTROL:  handleSpindleControlTouch(x, y);  break;
         case PSCREEN_FEEDS_SPEEDS:     handleFeedsSpeedsTouch(x, y);     break;
         case PSCREEN_SD_CARD:          handleSDCardTouch(x, y);          break;
+        case PSCREEN_JOB_QUEUE:        handleJobQueueTouch(x, y);        break;
+        case PSCREEN_MDI:              handleMdiTouch(x, y);             break;
         case PSCREEN_PROBING_WORK:     handleProbingWorkTouch(x, y);     break;
         case PSCREEN_PROBE:            handleProbeTouch(x, y);           break;
         case PSCREEN_PROBE_CFG_3D:     handleProbeCfg3DTouch(x, y);      break;
@@ -597,7 +700,7 @@ static void handleEncoderDelta(int32_t delta) {
         {
             int velFactor = (interval < 80) ? 4 : (interval < 150) ? 2 : 1;
 
-            String axisNames[] = { "X", "Y", "Z", "A" };
+            static const char* const axisNames[] = { "X", "Y", "Z", "A" };
             float  distance    = (float)delta * velFactor * pendantJog.increment;
 
             // Safety clamp: never request more than half the axis travel range in a
@@ -690,11 +793,11 @@ static void handleEncoderDelta(int32_t delta) {
                 int maxIn = constrain((int)(pendantJog.maxFeedRate / 25.4f), 40, 400);
                 int speed = constrain(pendantJog.jogSpeedIn, 40, maxIn);
                 snprintf(cmd, sizeof(cmd), "$J=G91 G20 %s%.4f F%d",
-                         axisNames[pendantJog.selectedAxis].c_str(), distance, speed);
+                         axisNames[pendantJog.selectedAxis], distance, speed);
             } else {
                 int speed = constrain(pendantJog.jogSpeedMm, 1000, pendantJog.maxFeedRate);
                 snprintf(cmd, sizeof(cmd), "$J=G91 G21 %s%.3f F%d",
-                         axisNames[pendantJog.selectedAxis].c_str(), distance, speed);
+                         axisNames[pendantJog.selectedAxis], distance, speed);
             }
             // Use the no-ack-wait variant — jog commands queue in FluidNC's
             // motion planner and don't need synchronous handshake.  Critical
@@ -788,17 +891,23 @@ static void handleEncoderDelta(int32_t delta) {
     } else if (currentPendantScreen == PSCREEN_FEEDS_SPEEDS) {
         if (!pendantConnected) return;
         if (pendantFeeds.dialMode == 1) {
-            // Feed override — 10% per detent, applied by the paced stepper.
-            int base = (feedOvr.target >= 0) ? feedOvr.target : pendantMachine.feedOverride;
+            // Feed override — 10% per detent, applied by the override planner.
+            int base = (ovr_target(OVR_FEED) >= 0) ? ovr_target(OVR_FEED) : pendantMachine.feedOverride;
             overrideSetFeedTarget(base + delta * 10);
             updateFeedOverrideDisplay();
         } else if (pendantFeeds.dialMode == 2) {
-            // Spindle override — 10% per detent, applied by the paced stepper.
-            int base = (spindleOvr.target >= 0) ? spindleOvr.target : pendantMachine.spindleOverride;
+            // Spindle override — 10% per detent, applied by the override planner.
+            int base = (ovr_target(OVR_SPINDLE) >= 0) ? ovr_target(OVR_SPINDLE) : pendantMachine.spindleOverride;
             overrideSetSpindleTarget(base + delta * 10);
             updateSpindleOverrideDisplay();
         }
         return;
+    } else if (currentPendantScreen == PSCREEN_JOB_QUEUE) {
+        handleJobQueueEncoder(delta);
+        return;
+    } else if (currentPendantScreen == PSCREEN_MDI) {
+        handleMdiEncoder(delta);
+        return;
     } else if (currentPendantScreen == PSCREEN_FLUIDNC) {
         // Toggle display rotation. NVS write is deferred to exitFluidNC() —
         // a rapid spin would otherwise hammer flash with redundant writes.
@@ -839,6 +948,7 @@ static void updateCurrentScreenSprites() {
         case PSCREEN_PROBING_WORK:
             updateWorkMachinePos();
             updateWorkAreaPos();
+            updateWorkOffsets();
             break;
         case PSCREEN_FEEDS_SPEEDS:
             updateFeedsSpeedsTopDisplay();
@@ -869,6 +979,12 @@ static void updateCurrentScreenSprites() {
         case PSCREEN_SD_CARD:
             updateSDCardFileList();
             break;
+        case PSCREEN_JOB_QUEUE:
+            updateJobQueueDisplay();
+            break;
+        case PSCREEN_MDI:
+            updateMdiDisplay();
+            break;
         case PSCREEN_MACROS:
             updateMacrosFileList();
             break;
@@ -900,41 +1016,20 @@ static IntConfigItem jogHomingDirMask("$23");   // homing direction invert mask
 // Called from loop_pendant() when HwEvent::CONNECTED arrives.
 // FluidNC version, IP address, WiFi SSID arrive automatically via [VER:] / status
 // callbacks once a connection is established — no explicit query required.
-// Helper: send a settings query without waiting for the "ok" ack.
-//
-// The library's fnc_send_line() spins on Core 1 waiting for the *previous*
-// command's ack at the START of every call, up to a 2 s timeout per call.
-// Calling it 7 times in a row over WiFi (where TCP latency can briefly stall
-// FluidNC's reply path) can therefore block Core 1 for up to 14 s — well
-// past the 5 s loop-task watchdog.  The captured Core 0 stage being 101
-// (drain) was a red herring; the watchdog was actually firing because the
-// Arduino loop task on Core 1 hadn't returned to the framework in time.
-//
-// The fix: bypass fnc_send_line's ack-wait entirely for these read-only
-// settings queries.  We just put the bytes on the wire and let the existing
-// GrblParser state machine parse the responses asynchronously (it already
-// does — that's how it populates the ConfigItem values).  Nothing else
-// depends on a synchronous ack here.
-static void sendQueryRaw(const char* s) {
-    // Hold the TX-line lock so this multi-byte query can't interleave in the
-    // WiFi TX ring with a line command being pushed from the other core.
-    bool locked = txLineLock();
-    while (*s) fnc_putchar((uint8_t)*s++);
-    fnc_putchar('\n');
-    if (locked) txLineUnlock();
-}
-
+// The replies are parsed asynchronously on Core 0 (that's how the ConfigItems
+// get their values); the queries themselves go through the command queue, so
+// a burst of eight never blocks Core 1 however slow the link is.
 static void requestControllerConfig() {
     extern uint32_t rtcCore1Stage;   // defined in ardmain.cpp
     rtcCore1Stage = 200;       // requestControllerConfig start
-    sendQueryRaw("$30");       // spindle max RPM
-    sendQueryRaw("$31");       // spindle min RPM
-    sendQueryRaw("$110");      // jog max feed rate
-    sendQueryRaw("$130");      // X travel
-    sendQueryRaw("$131");      // Y travel
-    sendQueryRaw("$132");      // Z travel
-    sendQueryRaw("$133");      // A travel
-    sendQueryRaw("$23");       // homing direction mask (per-axis envelope sign)
+    send_line("$30");          // spindle max RPM
+    send_line("$31");          // spindle min RPM
+    send_line("$110");         // jog max feed rate
+    send_line("$130");         // X travel
+    send_line("$131");         // Y travel
+    send_line("$132");         // Z travel
+    send_line("$133");         // A travel
+    send_line("$23");          // homing direction mask (per-axis envelope sign)
     rtcCore1Stage = 208;       // requestControllerConfig done
 }
 
@@ -956,7 +1051,7 @@ void requestMacros() {
     pendantMacros.count       = 0;
     pendantMacros.selected    = -1;
     pendantMacros.loadFailed  = false;
-    pendantMacros.loadStartMs = millis();   // arm the UI loading deadline
+    armMacrosLoadDeadline();
 
     // Clear the WebSocket JSON-parser latches before every macros fetch.  These
     // can stay stuck `true` if a previous file/JSON transfer (e.g. an SD-card
@@ -1075,7 +1170,10 @@ public:
         }
     }
 
-    void onStateChange(state_t /*newState*/) override {
+    void onStateChange(state_t oldState) override {
+        // The job queue advances on a job's Run→Idle edge; it only notes the
+        // edge here and does the work on Core 1.
+        jobQueueStateChange(oldState);
         if (xSemaphoreTake(stateMutex, pdMS_TO_TICKS(10)) == pdTRUE) {
             pendantMachine.status           = my_state_string;
             pendantMachine.connectionStatus = "Connected";
@@ -1092,7 +1190,10 @@ public:
 
     void onFilesList() override {
         // Called from Core 0 when JSON/file-list parsing completes.
-        // Routes to macros or SD card depending on which screen requested data.
+        // Routes to macros or SD card depending on which screen requested data
+        // (the job queue asks for the macro list too).
+        const bool forMacros = currentPendantScreen == PSCREEN_MACROS ||
+                               currentPendantScreen == PSCREEN_JOB_QUEUE;
 
         // Clear the loading flag FIRST, OUTSIDE the mutex.  `loading` is a plain
         // bool (atomic on Xtensa), and it must clear even if the brief
@@ -1103,11 +1204,11 @@ public:
         // parse had completed.  This was THE remaining SD/macros bug after the
         // raw-JSON routing fix — the diagnostic showed fl>0 (parse done) yet
         // the screen still said Loading.
-        if (currentPendantScreen == PSCREEN_MACROS) { pendantMacros.loading = false; pendantMacros.loadFailed = false; }
-        else                                        { pendantSdCard.loading = false; pendantSdCard.loadFailed = false; }
+        if (forMacros) { pendantMacros.loading = false; pendantMacros.loadFailed = false; }
+        else           { pendantSdCard.loading = false; pendantSdCard.loadFailed = false; }
 
         if (xSemaphoreTake(stateMutex, pdMS_TO_TICKS(50)) == pdTRUE) {
-            if (currentPendantScreen == PSCREEN_MACROS) {
+            if (forMacros) {
                 // Populate from the 'macros' vector filled by FileParser listeners
                 pendantMacros.count      = 0;
                 pendantMacros.cacheValid = true;  // mark cache warm for re-entry
@@ -1118,7 +1219,7 @@ public:
                     pendantMacros.filename[pendantMacros.count] = String(m->filename.c_str());
                     pendantMacros.count++;
                 }
-            } else {
+            } else if (!pendantSdCard.local) {  // a late reply must not replace the pendant's list
                 // SD card file list from $Files/ListGCode
                 pendantSdCard.fileCount    = 0;
                 pendantSdCard.scrollOffset = 0;
@@ -1143,7 +1244,7 @@ public:
         // → a real load failure → "Couldn't load — tap Refresh".  (UART mode
         // leaves g_macros_http_served false, so it reports a load failure, which
         // matches its $File chain having produced no usable reply.)
-        if (currentPendantScreen == PSCREEN_MACROS) {
+        if (currentPendantScreen == PSCREEN_MACROS || currentPendantScreen == PSCREEN_JOB_QUEUE) {
             pendantMacros.loading    = false;
             pendantMacros.count      = 0;
 #ifdef USE_WIFI
@@ -1289,10 +1390,9 @@ void pendant_comms_task(void* /*pvParameters*/) {
     //      even if the Core 1 UI loop is wedged (drawing, touch, a stuck
     //      scheduled action, etc.).  Core 0 owns comms and is the task least
     //      likely to stall, so critical controls belong here.
-    //   2. Latency: the red-button post-reset "$X" is an ack-waiting send.
-    //      Issued from Core 1 it could only spin waiting for Core 0 to clear
-    //      _ackwait across cores (slow / sometimes seconds).  On Core 0 it
-    //      self-services through ws_getchar's transport pump in a round-trip.
+    //   2. Latency: the post-reset "$X" is queued by the same task that drains
+    //      the transport, so it goes out on the next pass instead of waiting
+    //      for Core 1 to get round to it.
     // The encoder and battery sampling stay on Core 1 (jog uses non-blocking
     // sends, and battery is not time-critical).
     unsigned long btnLastDebounce[3] = { 0, 0, 0 };
@@ -1323,7 +1423,7 @@ void pendant_comms_task(void* /*pvParameters*/) {
         //   105 = button checks done
         //   106 = battery sample done
         //   107 = WiFi state cache done
-        //   108 = vTaskDelay about to run (end of iteration)
+        //   108 = comms_wait_rx about to run (end of iteration)
         rtcLastBootStage = 100;
         rtcCore0Iters++;       // iteration counter — distinguishes "iterating" from "stuck"
 
@@ -1387,10 +1487,10 @@ void pendant_comms_task(void* /*pvParameters*/) {
             jogForceReseed = true;   // predMm holds flushed distance — resync next tick
         }
 
-        // Paced feed/spindle override ramp — one coarse/fine byte per OVR_STEP_MS.
+        // Feed/spindle override batches, each released by the report that
+        // acknowledges the previous one.
         if (pendantConnected) {
-            ovrStep(feedOvr,    nowMs, FeedOvrCoarsePlus,    FeedOvrCoarseMinus,    FeedOvrFinePlus,    FeedOvrFineMinus);
-            ovrStep(spindleOvr, nowMs, SpindleOvrCoarsePlus, SpindleOvrCoarseMinus, SpindleOvrFinePlus, SpindleOvrFineMinus);
+            ovr_poll();
         }
 
         bool          running  = pendantMachine.status.startsWith("Run");
@@ -1426,8 +1526,7 @@ void pendant_comms_task(void* /*pvParameters*/) {
         // ── Physical buttons (Core 0) ────────────────────────────────────────
         // Debounce + realtime commands + post-reset $X + long-press power-off.
         // Realtime bytes (Reset/FeedHold/CycleStart) and the $X line are sent
-        // from this task, so they reach FluidNC even if Core 1's UI is stuck,
-        // and the ack-waiting $X self-services via the transport pump.
+        // from this task, so they reach FluidNC even if Core 1's UI is stuck.
         {
             unsigned long bnow = millis();
             for (int i = 0; i < 3; i++) {
@@ -1442,7 +1541,9 @@ void pendant_comms_task(void* /*pvParameters*/) {
                         btnHandled[i] = true;
                         switch (i) {
                             case 0:  // Red → soft reset; $X follows 500 ms later
+                                stream_stop();  // a streamed job ends here too
                                 fnc_realtime(Reset);
+                                cmd_abort();  // the controller drops its RX buffer
                                 redResetPending = true;
                                 redResetMs      = bnow;
                                 redHolding      = true;
@@ -1471,8 +1572,7 @@ void pendant_comms_task(void* /*pvParameters*/) {
                 }
             }
 
-            // Post-reset $X, 500 ms after the Red press.  On Core 0 this
-            // ack-waiting send self-services via ws_getchar's pump.
+            // Post-reset $X, 500 ms after the Red press.
             if (redResetPending && (millis() - redResetMs >= 500)) {
                 send_line("$X");
                 redResetPending = false;
@@ -1511,8 +1611,9 @@ void pendant_comms_task(void* /*pvParameters*/) {
 
         // Active status polling for WiFi/WebSocket.
         //
-        // fnc_is_connected()'s built-in poll only fires every ping_interval_ms
-        // (4 s) and only when nothing else has been received — a cadence tuned
+        // fnc_is_connected()'s built-in poll only fires after
+        // link_probe_interval_ms() of silence (4 s until the status RTT has
+        // been measured) and only when nothing else has been received — a cadence tuned
         // for UART, where FluidNC's serial channel auto-reports continuously so
         // the pendant rarely needs to ask.  Over WebSocket we can't rely on the
         // controller volunteering status on its own (the per-channel auto-report
@@ -1530,6 +1631,7 @@ void pendant_comms_task(void* /*pvParameters*/) {
             if (nowMs - lastWsStatusPoll >= 250) {
                 lastWsStatusPoll = nowMs;
                 fnc_realtime(StatusReport);   // '?'
+                link_rtt_probe_sent();        // also feeds the status RTT
             }
         }
         #endif
@@ -1540,6 +1642,19 @@ void pendant_comms_task(void* /*pvParameters*/) {
         // and would otherwise leave the jog throttle stuck high.
         nowait_pending_decay();
 
+        // Command queue: expire acks lost while the controller idles, and run
+        // completions for commands this task queued (post-reset $X).
+        cmd_poll();
+        cmd_dispatch();
+
+        // Work-offset table: one "$#" once the queue drains after anything
+        // that moved an offset (WcsOffsets.h).
+        wcs_poll();
+
+        // Pendant-side G-code stream: top up the command queue from the
+        // read-ahead ring (GcodeStreamer.h).
+        stream_poll();
+
         // WiFi state cache — sample on Core 0 (the task that owns the WiFi
         // state machine) and publish to pendantMachine so Core 1's UI can
         // read without touching the WiFi.h API across cores.
@@ -1565,7 +1680,9 @@ void pendant_comms_task(void* /*pvParameters*/) {
             lastDiagCheckpointMs = millis();
         }
 
-        vTaskDelay(pdMS_TO_TICKS(2));
+        // 2 ms tick for buttons and pings, but a status report or "ok" that
+        // lands mid-tick wakes the drain immediately (UART line events).
+        comms_wait_rx(2);
     }
 }
 
@@ -1668,6 +1785,8 @@ void setup_pendant() {
 
     // Load probe settings from NVS (must come before screen enter)
     loadProbeSettings();
+    jobQueueLoad();
+    mdiLoad();
 
     // Load saved display rotation and jog preferences
     preferences.begin("pendant", false);
@@ -1702,65 +1821,93 @@ void setup_pendant() {
     dbg_println("CNC Pendant UI ready (Core 1)");
 }
 
+// Touch-panel poll interval while the loop is otherwise idle.
+#define TOUCH_POLL_IDLE_MS   25
+#define TOUCH_POLL_ACTIVE_MS 10
+
+static UiTimer spriteTimer = {};
+
+static void spriteRefresh(void* /*ctx*/) {
+    updateCurrentScreenSprites();
+}
+
+static void armSpriteRefresh() {
+    ui_timer_arm(spriteTimer, 100, spriteRefresh, nullptr, 100);
+}
+
 void loop_pendant() {
     // Core 1 stage map (in loop_pendant):
     //   1   entered loop_pendant
-    //   2   action() callback done
+    //   2   due timers and deferred actions done
     //   3   about to process queue (or queue empty)
     //   4   inside CONNECTED handler / requestControllerConfig
     //   5   inside STATE_UPDATE handler (updateCurrentScreenSprites)
     //   6   inside GREEN handler (SD-card run)
     //   7   inside POWER_OFF handler
     //   8   queue dispatch done
-    //   9   periodic sprite refresh done
-    //   10  touch handling done — about to return from loop_pendant
+    //   9   periodic sprite refresh armed
+    //   10  touch handling done
+    //   11  waiting for the next event, timer or touch poll
     rtcCore1Stage = 1;     // entered loop_pendant
     rtcCore1Iters++;       // iteration counter
 
-    // Execute any action deferred by schedule_action() in FileParser / Scene code.
-    // In the original FluidDial this runs inside dispatch_events(); we replicate
-    // just that one step here so macro file requests (and their fallbacks) fire.
-    extern ActionHandler action;  // Scene.cpp
-    if (action) {
-        ActionHandler a = action;
-        action          = nullptr;
-        a();
+    // Debug builds (ALLOC_TRACE): count heap allocations this pass.  A pass is
+    // "steady" unless it handled input or changed screen — those may allocate
+    // (sprite creation, command strings); a plain redraw pass must not.
+    alloc_trace_begin();
+    bool                steady      = true;
+    const PendantScreen entryScreen = currentPendantScreen;
+
+    // Due UI timers (sprite refresh, sleep, loading deadlines), then actions
+    // deferred by schedule_action() in FileParser / Scene code.  In the
+    // original FluidDial the latter run inside dispatch_events().
+    if (ui_timers_run()) {
+        steady = false;
     }
-    rtcCore1Stage = 2;     // action callback done
+    rtcCore1Stage = 2;     // timers and deferred actions done
 
-    // Periodic sprite-refresh timestamp. Declared here so the STATE_UPDATE
-    // queue handler can reset it after a queue-driven sprite refresh — that
-    // coalesces the periodic 100 ms tick with the event-driven update so we
-    // don't redraw twice in quick succession when DRO updates arrive.
-    static unsigned long lastSpriteUpdate = 0;
+    // Completions for commands the screens queued with cmd_submit().
+    cmd_dispatch();
+    spindleStreamTick();
 
     rtcCore1Stage = 3;     // about to process queue
 
     // Process hardware events from Core 0
     HwEvent ev;
     while (xQueueReceive(hwEventQueue, &ev, 0) == pdTRUE) {
+        if (ev.type != HwEvent::STATE_UPDATE) steady = false;
         switch (ev.type) {
             case HwEvent::ENCODER_DELTA:
                 // Discard dial movement while asleep (touch-only wake; never jog
                 // blind, and don't let queued detents fire a burst on wake).
                 if (currentPendantScreen != PSCREEN_SLEEP) {
                     handleEncoderDelta(ev.value);
-                    lastActivityMs = millis();
+                    noteActivity();
                 }
                 break;
             case HwEvent::BUTTON_RED:
-                lastActivityMs = millis();
+                noteActivity();
                 break;
             case HwEvent::BUTTON_YELLOW:
-                lastActivityMs = millis();
+                noteActivity();
                 break;
             case HwEvent::BUTTON_GREEN:
-                lastActivityMs = millis();
+                noteActivity();
                 rtcCore1Stage = 6;     // inside GREEN handler
+                // A queued job waiting for confirmation takes green first
+                if (jobQueueConfirm()) {
+                    if (jobQueueRunning()) navigateTo(PSCREEN_STATUS);
+                    break;
+                }
                 // If a file has been loaded via the SD card Load button, run it now
                 if (pendantSdCard.loadedFile.length() > 0 && pendantConnected) {
-                    String cmd = "$SD/Run=" + pendantSdCard.loadedFile;
-                    send_line(cmd.c_str());
+                    if (pendantSdCard.loadedLocal) {
+                        stream_start(pendantSdCard.loadedFile.c_str());
+                    } else {
+                        char cmd[128];
+                        snprintf(cmd, sizeof(cmd), "$SD/Run=%s", pendantSdCard.loadedFile.c_str());
+                        send_line(cmd);
+                    }
                     pendantSdCard.loadedFile = "";
                     navigateTo(PSCREEN_STATUS);
                 }
@@ -1770,7 +1917,7 @@ void loop_pendant() {
                 // Use the sprite-only update path to avoid fillScreen flicker.
                 // Full drawXxxScreen() is only called on initial entry or user touch.
                 updateCurrentScreenSprites();
-                lastSpriteUpdate = millis();   // suppress duplicate periodic tick
+                armSpriteRefresh();   // push back the periodic tick
                 break;
             case HwEvent::CONNECTED:
                 rtcCore1Stage = 4;     // inside CONNECTED handler
@@ -1783,17 +1930,17 @@ void loop_pendant() {
                 rtcCore1Stage = 7;     // inside POWER_OFF handler
                 // Draw shutdown screen, dim backlight, then enter deep sleep.
                 // Green button press wakes the device (full reboot — not a resume).
-                display.fillScreen(COLOR_BACKGROUND);
+                gfx->fillScreen(COLOR_BACKGROUND);
                 drawTitle("POWERING OFF");
-                display.setTextSize(2);
-                display.setTextColor(COLOR_GRAY_TEXT);
+                gfx->setTextSize(2);
+                gfx->setTextColor(COLOR_GRAY_TEXT);
                 {
                     const char* l1 = "Press red button";
                     const char* l2 = "to power on";
-                    display.setCursor((240 - display.textWidth(l1)) / 2, 130);
-                    display.print(l1);
-                    display.setCursor((240 - display.textWidth(l2)) / 2, 158);
-                    display.print(l2);
+                    gfx->setCursor((240 - gfx->textWidth(l1)) / 2, 130);
+                    gfx->print(l1);
+                    gfx->setCursor((240 - gfx->textWidth(l2)) / 2, 158);
+                    gfx->print(l2);
                 }
                 delay(1500);
                 display.setBrightness(0);
@@ -1805,52 +1952,67 @@ void loop_pendant() {
     rtcCore1Stage = 8;     // queue dispatch done
 
     // ── Screen sleep management (WiFi pendants only) ──────────────────────────
-    // Only WiFi (battery) pendants sleep — wired pendants are powered from the
-    // controller and have no battery, so they power down with it and there's
-    // nothing to blank.  Eligible to blank when the CNC is Idle OR while the
-    // pendant is still "Connecting" (not connected) — both are no-activity
-    // states.  Any connected-but-busy state (Run/Jog/Hold/Home/Alarm/…) keeps
-    // it awake and resets the idle clock, so it never blanks mid-job.
-    if (comms_active_mode() == COMMS_MODE_WIFI) {
-        bool sleepEligible = !pendantConnected || pendantMachine.status.startsWith("Idle");
-        if (!sleepEligible) {
-            lastActivityMs = millis();
+    // sleepTimer does the blanking.  Any connected-but-busy state (Run/Jog/
+    // Hold/Home/Alarm/…) holds it off and restarts the idle clock when it ends,
+    // so the pendant never blanks mid-job or right after one.
+    static bool wasEligible = false;
+    bool        eligible    = sleepEligible();
+    if (eligible != wasEligible) {
+        if (eligible) {
+            noteActivity();
+        } else {
+            ui_timer_cancel(sleepTimer);
         }
-        if (currentPendantScreen == PSCREEN_SLEEP) {
-            // Wake if the machine becomes active while asleep (e.g. a job is started
-            // from the WebUI, or an alarm fires) so it's never hidden behind the blank.
-            if (pendantConnected && !pendantMachine.status.startsWith("Idle")) {
-                navigateTo(sleepReturnScreen);
-            }
-        } else if (currentPendantScreen != PSCREEN_WIFI_SETUP
-                   && sleepEligible
-                   && (millis() - lastActivityMs >= SLEEP_TIMEOUT_MS)) {
-            sleepReturnScreen = currentPendantScreen;
-            navigateTo(PSCREEN_SLEEP);   // enterSleep() turns the backlight off
+        wasEligible = eligible;
+    }
+    if (currentPendantScreen == PSCREEN_SLEEP) {
+        // Wake if the machine becomes active while asleep (e.g. a job is started
+        // from the WebUI, or an alarm fires) so it's never hidden behind the blank.
+        if (pendantConnected && !pendantMachine.status.startsWith("Idle")) {
+            navigateTo(sleepReturnScreen);
         }
     }
 
     // Periodic sprite refresh (100ms) — only fires if STATE_UPDATE didn't already
-    // redraw.  Skipped while asleep (nothing visible; full redraw happens on wake).
-    if (currentPendantScreen != PSCREEN_SLEEP && millis() - lastSpriteUpdate >= 100) {
-        updateCurrentScreenSprites();
-        lastSpriteUpdate = millis();
+    // redraw.  Stopped while asleep (nothing visible; full redraw happens on wake).
+    if (currentPendantScreen == PSCREEN_SLEEP) {
+        ui_timer_cancel(spriteTimer);
+    } else if (!ui_timer_armed(spriteTimer)) {
+        armSpriteRefresh();
     }
-    rtcCore1Stage = 9;     // periodic sprite refresh done
+    rtcCore1Stage = 9;     // periodic sprite refresh armed
 
     // Touch input (200ms debounce).  swallowTouchUntilRelease guards the wake
     // touch: after a wake we ignore touches until the finger lifts, so a held
-    // press/drag can't carry into a button on the restored screen.
+    // press/drag can't carry into a button on the restored screen.  The Jog XY
+    // pad sees every pass, touched or not — it tracks a drag and must see the
+    // release promptly — and swallows the touches it owns.
     lgfx::touch_point_t tp;
-    if (!display.getTouch(&tp)) {
+    bool                touched = display.getTouch(&tp);
+    if (!swallowTouchUntilRelease && jogPadTouch(touched, tp.x, tp.y)) {
+        noteActivity();
+        steady = false;
+    } else if (!touched) {
         swallowTouchUntilRelease = false;          // finger lifted — re-arm dispatch
     } else if (!swallowTouchUntilRelease) {
         static unsigned long lastTouch = 0;
         if (millis() - lastTouch > 200) {
-            lastActivityMs = millis();             // any touch counts as activity
+            noteActivity();                        // any touch counts as activity
             handlePendantTouch(tp.x, tp.y);        // on SLEEP → handleSleepTouch wakes
             lastTouch = millis();
+            steady    = false;
         }
     }
-    rtcCore1Stage = 10;    // loop_pendant about to return
+    rtcCore1Stage = 10;    // touch handling done
+
+    alloc_trace_end(steady && currentPendantScreen == entryScreen);
+
+    // Nothing else to do until a hardware event arrives, a timer falls due,
+    // or it is time to poll the touch panel again (it has no interrupt wired)
+    // — faster while a finger is down so drags and the Jog XY pad track it.
+    rtcCore1Stage = 11;    // idle wait
+    uint32_t idleMs = ui_timers_idle_ms(touched ? TOUCH_POLL_ACTIVE_MS : TOUCH_POLL_IDLE_MS);
+    if (idleMs) {
+        xQueuePeek(hwEventQueue, &ev, pdMS_TO_TICKS(idleMs));
+    }
 }
@@ -0,0 +1,330 @@
+// Copyright (c) 2026 — FluidDial-CYD
+// Use of this source code is governed by a GPLv3 license.
+
+// Asynchronous command queue.  See CommandQueue.h.
+
+#include "CommandQueue.h"
+#include "FluidNCModel.h"  // txLineLock(), state, fnc_putchar()
+#include "LinkRtt.h"
+#include "System.h"        // dbg_printf
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+#ifdef ARDUINO
+#    include <freertos/FreeRTOS.h>
+#    include <freertos/task.h>
+static portMUX_TYPE _cmdMux = portMUX_INITIALIZER_UNLOCKED;
+#    define CMD_LOCK()   portENTER_CRITICAL(&_cmdMux)
+#    define CMD_UNLOCK() portEXIT_CRITICAL(&_cmdMux)
+#    define CMD_OWNER()  ((void*)xTaskGetCurrentTaskHandle())
+#else
+#    define CMD_LOCK()
+#    define CMD_UNLOCK()
+#    define CMD_OWNER() ((void*)nullptr)
+#endif
+
+enum : uint8_t { SLOT_FREE = 0, SLOT_QUEUED, SLOT_SENT, SLOT_DONE };
+
+struct CmdSlot {
+    cmd_handle_t   handle;
+    uint8_t        st;
+    bool           cancelled;
+    bool           nowait;  // exempt from the window (send_line_nowait)
+    cmd_status_t   status;
+    int            error;
+    cmd_callback_t cb;
+    void*          ctx;
+    void*          owner;
+    char           line[CMD_LINE_MAX];
+};
+
+// One per line on the wire awaiting its ack.
+struct CmdToken {
+    int8_t   slot;
+    uint8_t  len;
+    uint32_t sentMs;
+};
+
+static CmdSlot      _slots[CMD_SLOTS];
+static uint8_t      _queue[CMD_SLOTS];  // slot indices in submission order
+static int          _qHead   = 0;
+static int          _qCount  = 0;
+static CmdToken     _tok[CMD_TOKENS];
+static int          _tHead   = 0;
+static int          _tCount  = 0;
+static int          _tBytes  = 0;
+static cmd_handle_t _next    = 0;
+static uint32_t     _lastAck = 0;
+static int          _winLines = CMD_WINDOW;
+static int          _winBytes = CMD_WINDOW_BYTES;
+
+// Caller holds the lock.
+static void complete(int s, cmd_status_t status, int error) {
+    CmdSlot& slot = _slots[s];
+    if (slot.cancelled) {
+        status = CMD_CANCELLED;
+    }
+    if (!slot.cb) {
+        slot.st = SLOT_FREE;
+        return;
+    }
+    slot.st     = SLOT_DONE;
+    slot.status = status;
+    slot.error  = error;
+}
+
+// Caller holds the lock.
+static CmdToken pop_token() {
+    CmdToken t = _tok[_tHead];
+    _tHead     = (_tHead + 1) % CMD_TOKENS;
+    _tCount--;
+    _tBytes -= t.len;
+    return t;
+}
+
+// Moves queued lines onto the wire while the window has room.  The token is
+// taken and the bytes pushed under txLineLock(), so token order is wire order
+// whichever core gets here.
+static void pump() {
+    if (!_qCount) return;
+    char line[CMD_LINE_MAX];
+    bool locked = txLineLock();
+    for (;;) {
+        CMD_LOCK();
+        if (!_qCount) {
+            CMD_UNLOCK();
+            break;
+        }
+        int s   = _queue[_qHead];
+        int len = (int)strlen(_slots[s].line) + 1;
+        if (_tCount == CMD_TOKENS ||
+            (!_slots[s].nowait && _tCount && (_tCount >= _winLines || _tBytes + len > _winBytes))) {
+            CMD_UNLOCK();
+            break;
+        }
+        _qHead = (_qHead + 1) % CMD_SLOTS;
+        _qCount--;
+        _tok[(_tHead + _tCount) % CMD_TOKENS] = { (int8_t)s, (uint8_t)len, (uint32_t)milliseconds() };
+        _tCount++;
+        _tBytes += len;
+        _slots[s].st = SLOT_SENT;
+        memcpy(line, _slots[s].line, len);
+        CMD_UNLOCK();
+
+        link_rtt_line_sent();
+        for (const char* p = line; *p; ++p) {
+            fnc_putchar((uint8_t)*p);
+        }
+        fnc_putchar('\n');
+        dbg_println(line);
+    }
+    if (locked) txLineUnlock();
+}
+
+static cmd_handle_t submit(const char* line, cmd_callback_t cb, void* ctx, bool nowait) {
+    size_t len = strlen(line);
+    if (len >= CMD_LINE_MAX) {
+        dbg_printf("Cmd: line too long, dropped \"%.32s...\"\n", line);
+        return 0;
+    }
+    CMD_LOCK();
+    int s = 0;
+    while (s < CMD_SLOTS && _slots[s].st != SLOT_FREE) {
+        ++s;
+    }
+    if (s == CMD_SLOTS) {
+        CMD_UNLOCK();
+        dbg_printf("Cmd: queue full, dropped \"%s\"\n", line);
+        return 0;
+    }
+    if (++_next == 0) {
+        _next = 1;
+    }
+    CmdSlot& slot  = _slots[s];
+    slot.handle    = _next;
+    slot.st        = SLOT_QUEUED;
+    slot.cancelled = false;
+    slot.nowait    = nowait;
+    slot.cb        = cb;
+    slot.ctx       = ctx;
+    slot.owner     = CMD_OWNER();
+    memcpy(slot.line, line, len + 1);
+    _queue[(_qHead + _qCount) % CMD_SLOTS] = (uint8_t)s;
+    _qCount++;
+    cmd_handle_t handle = slot.handle;
+    CMD_UNLOCK();
+
+    pump();
+    return handle;
+}
+
+cmd_handle_t cmd_submit(const char* line, cmd_callback_t cb, void* ctx) {
+    return submit(line, cb, ctx, false);
+}
+
+cmd_handle_t cmd_submit_nowait(const char* line) {
+    return submit(line, nullptr, nullptr, true);
+}
+
+cmd_handle_t cmd_submitf(cmd_callback_t cb, void* ctx, const char* fmt, ...) {
+    char    buf[CMD_LINE_MAX];
+    va_list args;
+    va_start(args, fmt);
+    vsnprintf(buf, sizeof(buf), fmt, args);
+    va_end(args);
+    return cmd_submit(buf, cb, ctx);
+}
+
+bool cmd_cancel(cmd_handle_t handle) {
+    if (!handle) return false;
+    bool found = false;
+    CMD_LOCK();
+    for (int i = 0; i < _qCount; ++i) {
+        int s = _queue[(_qHead + i) % CMD_SLOTS];
+        if (_slots[s].handle == handle) {
+            for (int j = i; j < _qCount - 1; ++j) {
+                _queue[(_qHead + j) % CMD_SLOTS] = _queue[(_qHead + j + 1) % CMD_SLOTS];
+            }
+            _qCount--;
+            _slots[s].cancelled = true;
+            complete(s, CMD_CANCELLED, 0);
+            found = true;
+            break;
+        }
+    }
+    for (int s = 0; !found && s < CMD_SLOTS; ++s) {
+        if (_slots[s].st == SLOT_SENT && _slots[s].handle == handle) {
+            _slots[s].cancelled = true;
+            found               = true;
+        }
+    }
+    CMD_UNLOCK();
+    return found;
+}
+
+void cmd_dispatch() {
+    void* me = CMD_OWNER();
+    for (int s = 0; s < CMD_SLOTS; ++s) {
+        CMD_LOCK();
+        if (_slots[s].st != SLOT_DONE || _slots[s].owner != me) {
+            CMD_UNLOCK();
+            continue;
+        }
+        CmdSlot slot  = _slots[s];  // the slot is reusable as soon as it's freed
+        _slots[s].st  = SLOT_FREE;
+        CMD_UNLOCK();
+
+        CmdResult r = { slot.handle, slot.status, slot.error, slot.line };
+        slot.cb(r, slot.ctx);
+    }
+}
+
+void cmd_acked(int error, char* line, size_t len) {
+    if (len) {
+        *line = '\0';
+    }
+    CMD_LOCK();
+    _lastAck = milliseconds();
+    if (_tCount) {
+        CmdToken t = pop_token();
+        if (t.slot >= 0) {
+            if (len) {
+                strncpy(line, _slots[t.slot].line, len - 1);
+                line[len - 1] = '\0';
+            }
+            complete(t.slot, error ? CMD_ERROR : CMD_OK, error);
+        }
+    }
+    CMD_UNLOCK();
+    pump();
+}
+
+// Fails every queued and in-flight line; returns how many.
+static int fail_all() {
+    int lost = 0;
+    CMD_LOCK();
+    while (_tCount) {
+        CmdToken t = pop_token();
+        if (t.slot >= 0) {
+            complete(t.slot, CMD_LOST, 0);
+            lost++;
+        }
+    }
+    // Queued motion must never reach a controller that comes back later.
+    while (_qCount) {
+        complete(_queue[_qHead], CMD_LOST, 0);
+        _qHead = (_qHead + 1) % CMD_SLOTS;
+        _qCount--;
+        lost++;
+    }
+    _tBytes = 0;
+    CMD_UNLOCK();
+    return lost;
+}
+
+void cmd_reset() {
+    int lost = fail_all();
+    if (lost) {
+        dbg_printf("Cmd: link lost, %d commands failed\n", lost);
+    }
+}
+
+void cmd_abort() {
+    int lost = fail_all();
+    link_rtt_reset();  // pending send times would pair with post-reset acks
+    if (lost) {
+        dbg_printf("Cmd: controller reset, %d commands failed\n", lost);
+    }
+}
+
+// An idle controller has answered everything it received, so an ack that is
+// still missing after a few ack timeouts was lost on the wire (a dropped
+// byte on UART, a WebSocket frame lost across a reconnect).  Without this one
+// lost "ok" would shift every later completion onto the wrong command.
+void cmd_poll() {
+    int stale = 2 * link_ack_timeout_ms();
+    if (stale < CMD_STALE_MIN_MS) {
+        stale = CMD_STALE_MIN_MS;
+    }
+    uint32_t now = milliseconds();
+    bool     expired = false;
+    char     line[CMD_LINE_MAX] = "";
+    CMD_LOCK();
+    if (_tCount && (state == Idle || state == Alarm) && (int32_t)(now - _lastAck) > stale &&
+        (int32_t)(now - _tok[_tHead].sentMs) > stale) {
+        CmdToken t = pop_token();
+        if (t.slot >= 0) {
+            strcpy(line, _slots[t.slot].line);
+            complete(t.slot, CMD_LOST, 0);
+        }
+        _lastAck = now;  // one per stale period, like nowait_pending_decay()
+        expired  = true;
+    }
+    CMD_UNLOCK();
+    if (expired) {
+        dbg_printf("Cmd: no ack for \"%s\", presumed lost\n", line);
+        link_rtt_line_lost();
+    }
+    pump();
+}
+
+void cmd_set_window(int lines, int bytes) {
+    if (lines <= 0 || lines > CMD_TOKENS) {
+        lines = CMD_TOKENS;
+    }
+    CMD_LOCK();
+    _winLines = lines;
+    _winBytes = bytes;
+    CMD_UNLOCK();
+    pump();  // a wider window may have room now
+}
+
+int cmd_in_flight() {
+    return _tCount;
+}
+
+int cmd_queued() {
+    return _qCount;
+}
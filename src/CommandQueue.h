@@ -0,0 +1,92 @@
+// Copyright (c) 2026 — FluidDial-CYD
+// Use of this source code is governed by a GPLv3 license.
+
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+// ── Asynchronous command queue ───────────────────────────────────────────────
+//
+// cmd_submit() copies a line into a slot and returns at once with a handle;
+// nothing on the calling core ever waits for the controller.  Lines go on
+// the wire in submission order, but only while the in-flight window has room
+// — by default at most CMD_WINDOW lines and CMD_WINDOW_BYTES bytes awaiting
+// their "ok"/"error:N", the same character-counting flow control a G-code
+// streamer uses, so FluidNC's input buffer can't overrun however many lines
+// a probe sequence queues up.
+//
+// FluidNC answers every line exactly once and in order, so acks are matched
+// to lines through a FIFO of in-flight tokens.  Every line goes through the
+// queue; send_line_nowait() lines are only exempt from the window, so they
+// keep their place behind earlier lines and their acks can't be mistaken
+// for anyone else's.
+//
+// A completion is handed to the callback on the task that submitted it, from
+// that task's next cmd_dispatch() — loop_pendant(), dispatch_events() and the
+// comms task loops call it.  Lines without a callback just retire.
+//
+// send_line() / send_linef() are now thin wrappers over cmd_submit().
+
+#define CMD_SLOTS        48   // queued + in flight + completed-not-dispatched
+#define CMD_LINE_MAX     128  // including the terminating NUL
+#define CMD_WINDOW       4    // lines awaiting an ack
+#define CMD_WINDOW_BYTES 128  // bytes awaiting an ack (a 1-line window always opens)
+#define CMD_STALE_MIN_MS 3000
+#define CMD_TOKENS       32   // lines on the wire awaiting an ack, nowait ones included
+
+typedef uint16_t cmd_handle_t;  // 0 = not queued
+
+enum cmd_status_t {
+    CMD_OK = 0,
+    CMD_ERROR,      // "error:N", N in CmdResult::error
+    CMD_CANCELLED,  // cmd_cancel()ed — never sent, or its ack was ignored
+    CMD_LOST,       // link dropped, or the ack never came
+};
+
+struct CmdResult {
+    cmd_handle_t handle;
+    cmd_status_t status;
+    int          error;  // FluidNC error code for CMD_ERROR, else 0
+    const char*  line;   // the command text; valid during the callback only
+};
+
+typedef void (*cmd_callback_t)(const CmdResult& result, void* ctx);
+
+// Returns 0 if the line is too long or every slot is in use.
+cmd_handle_t cmd_submit(const char* line, cmd_callback_t cb = nullptr, void* ctx = nullptr);
+cmd_handle_t cmd_submitf(cmd_callback_t cb, void* ctx, const char* fmt, ...);
+
+// send_line_nowait(): queued in order like cmd_submit(), but sent as soon as
+// it reaches the head, whatever the window holds.  It still waits for a free
+// ack token, so its "ok" is always accounted for.
+cmd_handle_t cmd_submit_nowait(const char* line);
+
+// A queued line is withdrawn; a line already sent can't be unsent, so its
+// completion is reported as CMD_CANCELLED instead.  False once it completed.
+bool cmd_cancel(cmd_handle_t handle);
+
+// Run callbacks for completions that belong to the calling task.
+void cmd_dispatch();
+
+// Comms task: presume acks lost while the controller sits idle, and keep the
+// window moving.
+void cmd_poll();
+
+// Parser side.  cmd_acked() closes the oldest in-flight line and copies its
+// text to `line` (empty if it was not queued here).
+void cmd_acked(int error, char* line, size_t len);
+void cmd_reset();  // link lost: fail everything
+
+// Soft reset (CTRL-X) sent, or the controller's restart banner seen: its RX
+// buffer is gone, so nothing in flight will be acked and nothing queued may
+// run afterwards.  Fails every line with CMD_LOST and forgets the pending
+// RTT samples.
+void cmd_abort();
+
+// Resize the in-flight window; lines <= 0 lifts the line cap, leaving only
+// the byte count.  The G-code streamer widens it for a run and puts
+// cmd_set_window(CMD_WINDOW, CMD_WINDOW_BYTES) back afterwards.
+void cmd_set_window(int lines, int bytes);
+
+int cmd_in_flight();
+int cmd_queued();
@@ -3,9 +3,14 @@
 
 #include "Comms.h"
 #include "CommsUart.h"
+#include "CommsCapture.h"
+#include "CommsImpair.h"
+#include "FluidNCModel.h"  // hold_rx_time()
 #include "System.h"           // dbg_print*
 
 #include <Preferences.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
 
 #ifdef USE_WIFI
 #include "WiFiConnection.h"
@@ -86,6 +91,7 @@ void comms_init() {
         wifi_init();              // start STA / AP captive portal
         return;
     }
+    dbg_printf("Comms: %u B of WiFi buffers left unallocated\n", (unsigned)wifi_unallocated_bytes());
 #endif
 
     // UART path: the driver was already installed by the hardware init pass.
@@ -123,6 +129,78 @@ const char* transport_force_label() {
     return (get_transport_force() == TFORCE_WIFI) ? "WiFi" : "UART";
 }
 
+// ── Capture / replay ─────────────────────────────────────────────────────────
+// The recording decorators sit between the facade and the backend, so they
+// see exactly the bytes the backend does — XON/XOFF included on UART, and
+// nothing the WiFi backend generates internally (pings, handshake).
+
+static void (*_rec_inner_putchar)(uint8_t) = nullptr;
+static int  (*_rec_inner_getchar)()        = nullptr;
+
+static void _rec_putchar(uint8_t c) {
+    capture_tx(c);
+    _rec_inner_putchar(c);
+}
+
+static int _rec_getchar() {
+    int c = _rec_inner_getchar();
+    if (c >= 0) {
+        capture_rx((uint8_t)c);
+    }
+    return c;
+}
+
+void comms_record(bool on) {
+    if (on) {
+        if (_putchar_fn == _rec_putchar || !capture_start()) return;
+        _rec_inner_putchar = _putchar_fn;
+        _rec_inner_getchar = _getchar_fn;
+        _putchar_fn        = _rec_putchar;
+        _getchar_fn        = _rec_getchar;
+    } else {
+        capture_stop();
+        if (_putchar_fn != _rec_putchar) return;
+        _putchar_fn = _rec_inner_putchar;
+        _getchar_fn = _rec_inner_getchar;
+    }
+}
+
+bool comms_replay(const char* path, int speed_pct) {
+    comms_record(false);
+    if (!replay_open(path, speed_pct)) return false;
+    _putchar_fn = replay_putchar;
+    _getchar_fn = replay_getchar;
+    _poll_fn    = _noop_poll;
+    return true;
+}
+
+// An impaired outage has to look like one to everything above the facade:
+// RX stops counting as proof of life, and in WiFi mode the WebSocket really
+// closes so the reconnect path runs too.
+static void _impair_down() {
+    hold_rx_time(true);
+#ifdef USE_WIFI
+    if (_mode == COMMS_MODE_WIFI) wifi_ws_request_suspend();
+#endif
+}
+
+static void _impair_up() {
+    hold_rx_time(false);
+#ifdef USE_WIFI
+    if (_mode == COMMS_MODE_WIFI) wifi_ws_resume();
+#endif
+}
+
+void comms_impair(int profile) {
+    if (_putchar_fn != impair_putchar) {
+        impair_wrap(_putchar_fn, _getchar_fn);
+        impair_set_outage_hooks(_impair_down, _impair_up);
+        _putchar_fn = impair_putchar;
+        _getchar_fn = impair_getchar;
+    }
+    impair_set_profile(profile);
+}
+
 void comms_putchar(uint8_t c) {
     _putchar_fn(c);
 }
@@ -135,6 +213,14 @@ void comms_poll() {
     _poll_fn();
 }
 
+void comms_wait_rx(uint32_t timeout_ms) {
+    if (_mode == COMMS_MODE_UART && !replay_active()) {
+        uart_backend_wait_rx(timeout_ms);
+    } else {
+        vTaskDelay(pdMS_TO_TICKS(timeout_ms));
+    }
+}
+
 CommsMode comms_active_mode() {
     return _mode;
 }
@@ -59,11 +59,29 @@ void comms_init();
 void comms_putchar(uint8_t c);
 int  comms_getchar();      // returns -1 if no byte is available
 
+// Sleep the calling (comms) task for up to timeout_ms, waking early when the
+// backend has a complete line buffered.  UART blocks on the driver's pattern
+// event queue; WiFi just delays, since its RX arrives via comms_poll().
+void comms_wait_rx(uint32_t timeout_ms);
+
 // Periodic service hook.  No-op when the active backend is UART; in WiFi
 // mode this drains the TCP socket into the RX ring buffer, runs the AP
 // captive portal, and handles reconnects.
 void comms_poll();
 
+// Traffic capture (CommsCapture.h).  comms_record() wraps the active
+// backend's putchar/getchar in recording decorators, or unwraps them.
+// comms_replay() swaps the backend for a capture file: RX comes from the file
+// at speed_pct of its original timing, TX is discarded, comms_poll() is a
+// no-op.  There is no way back to the live backend short of a restart.
+void comms_record(bool on);
+bool comms_replay(const char* path, int speed_pct);
+
+// Link impairment (CommsImpair.h).  The first call wraps the active backend;
+// the wrapper stays in place and profile 0 is a passthrough.  Call before
+// comms_record() so the capture sees the impaired link.
+void comms_impair(int profile);
+
 // Diagnostics / UI — used by the WiFi setup screen and the FluidNC info
 // screen to show which transport is live.
 CommsMode   comms_active_mode();
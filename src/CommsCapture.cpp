@@ -0,0 +1,258 @@
+// Copyright (c) 2026 — FluidDial-CYD
+// Use of this source code is governed by a GPLv3 license.
+
+// Comms traffic recorder and replay backend.  See CommsCapture.h.
+
+#include "CommsCapture.h"
+#include "System.h"        // dbg_printf
+#include "FluidNCModel.h"  // update_rx_time()
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef ARDUINO
+#    include <freertos/FreeRTOS.h>
+#    include <esp_heap_caps.h>
+static portMUX_TYPE _capMux = portMUX_INITIALIZER_UNLOCKED;
+#    define CAP_LOCK()   portENTER_CRITICAL(&_capMux)
+#    define CAP_UNLOCK() portEXIT_CRITICAL(&_capMux)
+#else
+#    define CAP_LOCK()
+#    define CAP_UNLOCK()
+#endif
+
+#define REC_HEADER  3
+#define REC_MAX_LEN 0x7f
+#define REC_TX      0x80
+
+// ── Recorder ─────────────────────────────────────────────────────────────────
+
+static uint8_t* _ring      = nullptr;
+static uint32_t _size      = 0;
+static uint32_t _head      = 0;   // next free byte
+static uint32_t _tail      = 0;   // header of the oldest record
+static uint32_t _used      = 0;
+static int32_t  _cur       = -1;  // header of the record still being appended to
+static uint8_t  _curDir    = 0;
+static uint32_t _lastMs    = 0;
+static uint32_t _dropped   = 0;   // records lost off the old end
+static bool     _recording = false;
+
+static inline void put(uint8_t b) {
+    _ring[_head] = b;
+    _head        = (_head + 1) % _size;
+    _used++;
+}
+
+// Caller holds the lock.  Drops whole records from the oldest end.
+static void make_room(uint32_t n) {
+    while (_size - _used < n) {
+        uint32_t rec = REC_HEADER + (_ring[(_tail + 2) % _size] & REC_MAX_LEN);
+        if ((int32_t)_tail == _cur) {
+            _cur = -1;
+        }
+        _tail = (_tail + rec) % _size;
+        _used -= rec;
+        _dropped++;
+    }
+}
+
+static void record(uint8_t dir, uint8_t c) {
+    uint32_t now = milliseconds();
+    CAP_LOCK();
+    if (!_recording) {
+        CAP_UNLOCK();
+        return;
+    }
+    make_room(REC_HEADER + 1);
+    uint8_t* dirlen = _cur >= 0 ? &_ring[(_cur + 2) % _size] : nullptr;
+    if (dirlen && _curDir == dir && now == _lastMs && (*dirlen & REC_MAX_LEN) < REC_MAX_LEN) {
+        put(c);
+        (*dirlen)++;
+    } else {
+        uint32_t dt = now - _lastMs;
+        if (dt > 0xffff) dt = 0xffff;
+        _cur    = _head;
+        _curDir = dir;
+        _lastMs = now;
+        put(dt & 0xff);
+        put(dt >> 8);
+        put(dir | 1);
+        put(c);
+    }
+    CAP_UNLOCK();
+}
+
+void capture_rx(uint8_t c) {
+    record(0, c);
+}
+void capture_tx(uint8_t c) {
+    record(REC_TX, c);
+}
+
+bool capture_start() {
+    if (!_ring) {
+        uint32_t size = CAPTURE_RING_PSRAM;
+        uint8_t* ring = nullptr;
+#ifdef ARDUINO
+        ring = (uint8_t*)heap_caps_malloc(size, MALLOC_CAP_SPIRAM);
+#endif
+        if (!ring) {
+            size = CAPTURE_RING_INTERNAL;
+            ring = (uint8_t*)malloc(size);
+        }
+        if (!ring) {
+            dbg_println("Capture: no memory for ring");
+            return false;
+        }
+        _ring = ring;
+        _size = size;
+        dbg_printf("Capture: %u byte ring\n", (unsigned)size);
+    }
+    CAP_LOCK();
+    _head = _tail = _used = 0;
+    _cur       = -1;
+    _dropped   = 0;
+    _lastMs    = milliseconds();
+    _recording = true;
+    CAP_UNLOCK();
+    return true;
+}
+
+void capture_stop() {
+    CAP_LOCK();
+    _recording = false;
+    CAP_UNLOCK();
+}
+
+bool capture_active() {
+    return _recording;
+}
+
+size_t capture_used() {
+    return _used;
+}
+
+// Recording pauses while the file is written — the ring can't be read under a
+// spinlock — and resumes afterwards; the gap shows up as one long dt.
+bool capture_save(const char* path) {
+    if (!_ring) return false;
+    CAP_LOCK();
+    bool was   = _recording;
+    _recording = false;
+    CAP_UNLOCK();
+
+    bool  ok = false;
+    FILE* f  = fopen(path, "wb");
+    if (f) {
+        ok = fwrite(CAPTURE_MAGIC, 1, sizeof(CAPTURE_MAGIC) - 1, f) == sizeof(CAPTURE_MAGIC) - 1;
+        uint32_t first = _size - _tail < _used ? _size - _tail : _used;
+        ok             = ok && fwrite(_ring + _tail, 1, first, f) == first;
+        ok             = ok && fwrite(_ring, 1, _used - first, f) == _used - first;
+        ok             = (fclose(f) == 0) && ok;
+    }
+    dbg_printf("Capture: %s %u bytes to %s (%u records dropped)\n",
+               ok ? "saved" : "FAILED saving", (unsigned)_used, path, (unsigned)_dropped);
+
+    CAP_LOCK();
+    _recording = was;
+    CAP_UNLOCK();
+    return ok;
+}
+
+// ── Replay ───────────────────────────────────────────────────────────────────
+// Single consumer (the comms task / host loop), so no locking.  Records are
+// streamed from the file one at a time; only the current one is in memory.
+
+static FILE*    _rf       = nullptr;
+static int      _speed    = 100;
+static uint32_t _t0       = 0;
+static uint64_t _capMs    = 0;  // capture time of the current record
+static uint8_t  _rbuf[REC_MAX_LEN];
+static int      _rlen     = 0;
+static int      _rpos     = 0;
+static bool     _rTx      = false;
+static bool     _eof      = false;
+static uint32_t _rxBytes  = 0;
+static uint32_t _txBytes  = 0;
+
+static bool load_next() {
+    uint8_t h[REC_HEADER];
+    if (_eof || fread(h, 1, REC_HEADER, _rf) != REC_HEADER) {
+        if (!_eof) {
+            _eof = true;
+            dbg_printf("Replay: done, %u RX bytes fed, %u TX bytes discarded\n", (unsigned)_rxBytes, (unsigned)_txBytes);
+        }
+        return false;
+    }
+    _capMs += h[0] | (h[1] << 8);
+    _rTx  = (h[2] & REC_TX) != 0;
+    _rlen = (int)fread(_rbuf, 1, h[2] & REC_MAX_LEN, _rf);
+    _rpos = 0;
+    return true;
+}
+
+bool replay_open(const char* path, int speed_pct) {
+    replay_close();
+    _rf = fopen(path, "rb");
+    if (!_rf) {
+        dbg_printf("Replay: can't open %s\n", path);
+        return false;
+    }
+    char magic[sizeof(CAPTURE_MAGIC) - 1];
+    if (fread(magic, 1, sizeof(magic), _rf) != sizeof(magic) || memcmp(magic, CAPTURE_MAGIC, sizeof(magic)) != 0) {
+        dbg_printf("Replay: %s is not a capture\n", path);
+        replay_close();
+        return false;
+    }
+    _speed   = speed_pct < 0 ? 0 : speed_pct;
+    _t0      = milliseconds();
+    _capMs   = 0;
+    _rlen    = _rpos = 0;
+    _eof     = false;
+    _rxBytes = _txBytes = 0;
+    dbg_printf("Replay: %s at %d%%\n", path, _speed);
+    return true;
+}
+
+void replay_close() {
+    if (_rf) {
+        fclose(_rf);
+        _rf = nullptr;
+    }
+}
+
+bool replay_active() {
+    return _rf != nullptr;
+}
+
+bool replay_done() {
+    return _rf && _eof && _rpos >= _rlen;
+}
+
+int replay_getchar() {
+    if (!_rf) return -1;
+    for (;;) {
+        if (_rpos >= _rlen && !load_next()) {
+            return -1;
+        }
+        if (_speed) {
+            uint64_t elapsed = (uint32_t)(milliseconds() - _t0);
+            if (elapsed * _speed < _capMs * 100) {
+                return -1;
+            }
+        }
+        if (_rTx) {
+            _rpos = _rlen;  // what the pendant sent back then; now it sends its own
+            continue;
+        }
+        _rxBytes++;
+        update_rx_time();
+        return _rbuf[_rpos++];
+    }
+}
+
+void replay_putchar(uint8_t /*c*/) {
+    _txBytes++;
+}
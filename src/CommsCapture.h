@@ -0,0 +1,54 @@
+// Copyright (c) 2026 — FluidDial-CYD
+// Use of this source code is governed by a GPLv3 license.
+
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+// ── Comms traffic capture and replay ─────────────────────────────────────────
+//
+// Recorder: comms_record(true) (Comms.h) wraps the active backend's putchar /
+// getchar so every byte that crosses the wire is also appended to an in-RAM
+// ring — PSRAM when the board has it.  Consecutive bytes in the same
+// direction and millisecond share one record, so the per-byte cost is a
+// spinlock and a store.  When the ring fills, whole records are dropped from
+// the oldest end; capture_save() writes what is left to a file.
+//
+// Replay: replay_open() streams a capture file back as if it were a comms
+// backend — replay_getchar() hands out each RX byte once its original time
+// (scaled by speed) has come, and TX is discarded.  On the device this runs
+// through comms_replay(); the SDL host build takes "--replay file [speed]" on
+// the command line.  Either way the bytes go through fnc_getchar() →
+// collect(), so a field capture reproduces the same parser and UI load.
+//
+// File format: CAPTURE_MAGIC, then records of
+//   uint16_t dt      ms since the previous record (little endian, saturating)
+//   uint8_t  dirlen  bit 7 = TX, bits 0-6 = byte count (1..127)
+//   uint8_t  bytes[dirlen & 0x7f]
+
+#define CAPTURE_MAGIC "FNCCAP1\n"
+
+#ifdef ARDUINO
+#    define CAPTURE_PATH "/littlefs/capture.fnc"  // LittleFS VFS mount point
+#else
+#    define CAPTURE_PATH "capture.fnc"
+#endif
+
+#define CAPTURE_RING_PSRAM    (256 * 1024)
+#define CAPTURE_RING_INTERNAL (16 * 1024)
+
+bool   capture_start();   // allocate the ring (once) and start recording
+void   capture_stop();
+bool   capture_active();
+bool   capture_save(const char* path = CAPTURE_PATH);
+size_t capture_used();    // bytes in the ring, including record headers
+void   capture_rx(uint8_t c);
+void   capture_tx(uint8_t c);
+
+// speed_pct: 100 = original timing, 400 = 4x faster, 0 = as fast as possible.
+bool replay_open(const char* path = CAPTURE_PATH, int speed_pct = 100);
+void replay_close();
+bool replay_active();
+bool replay_done();        // open, and every record has been played
+int  replay_getchar();     // -1 until the next RX byte is due
+void replay_putchar(uint8_t c);
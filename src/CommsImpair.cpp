@@ -0,0 +1,242 @@
+// Copyright (c) 2026 — FluidDial-CYD
+// Use of this source code is governed by a GPLv3 license.
+
+// Link impairment injector.  See CommsImpair.h.
+
+#include "CommsImpair.h"
+#include "System.h"        // dbg_printf
+#include "GrblParserC.h"   // milliseconds()
+
+#include <stdlib.h>
+
+#ifdef ARDUINO
+#    include <freertos/FreeRTOS.h>
+static portMUX_TYPE _impMux = portMUX_INITIALIZER_UNLOCKED;
+#    define IMP_LOCK()   portENTER_CRITICAL(&_impMux)
+#    define IMP_UNLOCK() portEXIT_CRITICAL(&_impMux)
+#else
+#    define IMP_LOCK()
+#    define IMP_UNLOCK()
+#endif
+
+// clang-format off
+static const ImpairProfile _profiles[] = {
+    //  name          lat  jit   bw B/s  loss ppm  storm every  down
+    { "off",            0,   0,       0,       0,          0,      0 },
+    { "lan",            2,   2,       0,       0,          0,      0 },
+    { "weak wifi",     40,  60,   20000,       0,          0,      0 },
+    { "bursty",        10, 250,       0,       0,          0,      0 },
+    { "lossy uart",     0,   0,       0,     200,          0,      0 },
+    { "storm",         20,  20,       0,       0,      15000,   3000 },
+};
+// clang-format on
+#define N_PROFILES (int)(sizeof(_profiles) / sizeof(_profiles[0]))
+
+// Per-direction delay line.  Allocated the first time a profile is chosen so
+// a build that never impairs pays nothing.
+#define IMPAIR_QUEUE 1024
+
+struct DelayedByte {
+    uint32_t due;  // ms
+    uint8_t  c;
+};
+
+struct DelayLine {
+    DelayedByte* q;
+    uint16_t     head;
+    uint16_t     count;
+    uint64_t     lastDueUs;  // µs, so a bandwidth cap finer than 1 byte/ms works
+    uint32_t     dropped;
+
+    bool push(uint32_t due, uint8_t c) {
+        if (count == IMPAIR_QUEUE) {
+            dropped++;
+            return false;
+        }
+        q[(head + count) % IMPAIR_QUEUE] = { due, c };
+        count++;
+        return true;
+    }
+    int pop_due(uint32_t now) {
+        if (!count || (int32_t)(now - q[head].due) < 0) return -1;
+        uint8_t c = q[head].c;
+        head      = (head + 1) % IMPAIR_QUEUE;
+        count--;
+        return c;
+    }
+};
+
+static void (*_innerPut)(uint8_t) = nullptr;
+static int  (*_innerGet)()        = nullptr;
+
+static volatile int  _profile   = 0;
+static DelayLine     _tx;
+static DelayLine     _rx;
+static uint32_t      _rng       = 0x9e3779b9;
+static uint32_t      _stormAt   = 0;  // next outage starts
+static uint32_t      _stormEnd  = 0;  // current outage ends
+static volatile bool _linkUp    = true;
+static uint32_t      _lostBytes = 0;
+
+static void (*_onDown)() = nullptr;
+static void (*_onUp)()   = nullptr;
+
+static uint32_t rnd() {
+    _rng ^= _rng << 13;
+    _rng ^= _rng >> 17;
+    _rng ^= _rng << 5;
+    return _rng;
+}
+
+int impair_profile_count() {
+    return N_PROFILES;
+}
+
+const ImpairProfile& impair_profile_info(int index) {
+    return _profiles[index >= 0 && index < N_PROFILES ? index : 0];
+}
+
+int impair_profile() {
+    return _profile;
+}
+
+void impair_wrap(void (*put)(uint8_t), int (*get)()) {
+    if (put == impair_putchar) return;
+    _innerPut = put;
+    _innerGet = get;
+}
+
+void impair_set_outage_hooks(void (*down)(), void (*up)()) {
+    _onDown = down;
+    _onUp   = up;
+}
+
+static void schedule_storm(uint32_t now, const ImpairProfile& p) {
+    uint32_t half = p.storm_period_ms / 2;
+    _stormAt      = now + half + (half ? rnd() % p.storm_period_ms : 0);
+}
+
+void impair_set_profile(int index) {
+    if (index < 0 || index >= N_PROFILES) index = 0;
+    if (index && !_tx.q) {
+        DelayedByte* txq = (DelayedByte*)malloc(IMPAIR_QUEUE * sizeof(DelayedByte));
+        DelayedByte* rxq = (DelayedByte*)malloc(IMPAIR_QUEUE * sizeof(DelayedByte));
+        if (!txq || !rxq) {
+            free(txq);
+            free(rxq);
+            dbg_println("Impair: no memory for delay lines");
+            return;
+        }
+        _tx.q = txq;
+        _rx.q = rxq;
+    }
+    const ImpairProfile& p   = _profiles[index];
+    uint32_t             now = milliseconds();
+    IMP_LOCK();
+    _stormEnd = now;
+    if (p.storm_period_ms) {
+        schedule_storm(now, p);
+    }
+    _profile     = index;
+    _tx.count    = 0;
+    _rx.count    = 0;
+    bool wasDown = !_linkUp;
+    _linkUp      = true;
+    IMP_UNLOCK();
+    if (wasDown && _onUp) {
+        _onUp();
+    }
+    dbg_printf("Impair: profile %d \"%s\" (%u TX / %u RX overflowed, %u lost so far)\n",
+               index, p.name, (unsigned)_tx.dropped, (unsigned)_rx.dropped, (unsigned)_lostBytes);
+}
+
+// Caller holds the lock.  False while an outage is in progress.
+static bool link_up(uint32_t now, const ImpairProfile& p) {
+    if (!p.storm_period_ms) return true;
+    if ((int32_t)(now - _stormAt) >= 0) {
+        _stormEnd = _stormAt + p.storm_down_ms;
+        schedule_storm(_stormEnd, p);
+    }
+    return (int32_t)(now - _stormEnd) >= 0;
+}
+
+// Caller holds the lock.  Release time for one more byte on this line.
+static uint32_t due_time(DelayLine& line, uint32_t now, const ImpairProfile& p) {
+    uint64_t due = ((uint64_t)now + p.latency_ms + (p.jitter_ms ? rnd() % (p.jitter_ms + 1) : 0)) * 1000;
+    uint64_t gap = p.bw_bytes_per_s ? 1000000 / p.bw_bytes_per_s : 0;
+    if (line.count && due < line.lastDueUs + gap) {
+        due = line.lastDueUs + gap;
+    }
+    line.lastDueUs = due;
+    return (uint32_t)(due / 1000);
+}
+
+// Caller holds the lock.
+static bool lose(const ImpairProfile& p) {
+    if (p.loss_ppm && rnd() % 1000000 < p.loss_ppm) {
+        _lostBytes++;
+        return true;
+    }
+    return false;
+}
+
+void impair_putchar(uint8_t c) {
+    int profile = _profile;
+    if (!profile) {
+        _innerPut(c);
+        return;
+    }
+    const ImpairProfile& p   = _profiles[profile];
+    uint32_t             now = milliseconds();
+    IMP_LOCK();
+    if (_linkUp && !lose(p)) {
+        _tx.push(due_time(_tx, now, p), c);
+    }
+    IMP_UNLOCK();
+}
+
+int impair_getchar() {
+    int profile = _profile;
+    if (!profile) {
+        return _innerGet();
+    }
+    const ImpairProfile& p   = _profiles[profile];
+    uint32_t             now = milliseconds();
+
+    // Outage edges are only detected here, so the hooks always run on the
+    // comms task.
+    IMP_LOCK();
+    bool up      = link_up(now, p);
+    bool changed = up != _linkUp;
+    _linkUp      = up;
+    IMP_UNLOCK();
+    if (changed) {
+        dbg_printf("Impair: link %s\n", up ? "back" : "down");
+        if (up && _onUp) _onUp();
+        if (!up && _onDown) _onDown();
+    }
+
+    // TX is released here too: this is the one call that runs continuously,
+    // and it runs on the core that owns the backend.
+    for (;;) {
+        IMP_LOCK();
+        int c = _tx.pop_due(now);
+        IMP_UNLOCK();
+        if (c < 0) break;
+        _innerPut((uint8_t)c);
+    }
+
+    // Pull everything the backend has so arrival times are stamped promptly.
+    int c;
+    while ((c = _innerGet()) >= 0) {
+        IMP_LOCK();
+        if (up && !lose(p)) {
+            _rx.push(due_time(_rx, now, p), (uint8_t)c);
+        }
+        IMP_UNLOCK();
+    }
+    IMP_LOCK();
+    c = _rx.pop_due(now);
+    IMP_UNLOCK();
+    return c;
+}
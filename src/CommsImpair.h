@@ -0,0 +1,49 @@
+// Copyright (c) 2026 — FluidDial-CYD
+// Use of this source code is governed by a GPLv3 license.
+
+#pragma once
+#include <stdint.h>
+
+// ── Link impairment injector ─────────────────────────────────────────────────
+//
+// Sits between the comms facade and the real backend (Comms.cpp on the device,
+// the serial / replay hooks in SystemWindows.cpp on the host) and degrades the
+// link according to a profile:
+//   • latency + jitter   each byte is held until now + latency + rand(jitter).
+//                        Release times never go backwards, so jitter bunches
+//                        bytes into bursts but never reorders them — neither
+//                        UART nor TCP reorders within a connection.
+//   • bandwidth cap      bytes are spaced at least 1/bw apart.
+//   • byte loss          each byte is dropped with probability loss_ppm.
+//   • outage storms      every storm_period_ms (±50 %) the link goes dark for
+//                        storm_down_ms: nothing in, nothing out.
+// Both directions are impaired independently.  Queued bytes are released from
+// impair_getchar(), which the comms task calls continuously on Core 0.
+//
+// Select with -DCOMMS_IMPAIR=<index> at build time (then CTRL-E on the debug
+// port cycles through the table), or FLUIDDIAL_IMPAIR=<index> on the host.
+
+struct ImpairProfile {
+    const char* name;
+    uint16_t    latency_ms;
+    uint16_t    jitter_ms;
+    uint32_t    bw_bytes_per_s;  // 0 = unlimited
+    uint32_t    loss_ppm;
+    uint32_t    storm_period_ms; // 0 = no storms
+    uint16_t    storm_down_ms;
+};
+
+int                  impair_profile_count();
+const ImpairProfile& impair_profile_info(int index);
+
+// Wrap the given backend.  Idempotent; profile 0 ("off") is a passthrough.
+void impair_wrap(void (*put)(uint8_t), int (*get)());
+void impair_set_profile(int index);  // discards anything still queued
+int  impair_profile();
+
+// Called on the comms task when an outage starts / ends, so the transport can
+// make it real — drop the WebSocket, stop counting RX as proof of life.
+void impair_set_outage_hooks(void (*down)(), void (*up)());
+
+void impair_putchar(uint8_t c);
+int  impair_getchar();
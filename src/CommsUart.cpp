@@ -11,13 +11,46 @@
 #include "System.h"               // dbg_print*, FNC_BAUD, ECHO_FNC_TO_DEBUG
 #include "FluidNCModel.h"         // update_rx_time()
 
+#include <string.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
 #include <driver/uart.h>
 #include "hal/uart_hal.h"
 
 // Private to this translation unit — no other file should touch the port.
-static uart_port_t fnc_uart_port;
+static uart_port_t   fnc_uart_port;
+static QueueHandle_t fnc_uart_events = nullptr;
+static bool          fnc_uart_hw_flow = false;
 
 // ── Hot-path I/O ────────────────────────────────────────────────────────────
+//
+// RX is served from a span: each refill takes one whole line out of the
+// driver's ring in a single uart_read_bytes() call — up to the next '\n' the
+// pattern detector has marked, or whatever is buffered if no complete line is
+// waiting.  That is one driver lock and one proof-of-life stamp per line
+// instead of per byte, which is most of the per-status-report cost at
+// 1-2 Mbaud.  Only ever called on Core 0 (fnc_getchar gates the other core).
+
+#define RX_SPAN 256
+static uint8_t _span[RX_SPAN];
+static int     _spanLen = 0;
+static int     _spanPos = 0;
+
+// The pattern queue holds 32 line ends.  A burst of short lines the comms
+// task hasn't caught up with overflows it, and the driver then drops line
+// ends (or stops detecting them) while the bytes still arrive.  A span read
+// without a recorded line end that turns out to contain one is the sign:
+// the queue is reset, and until the ring has been drained past that point
+// spans take whatever is buffered instead of trusting the positions.
+static bool              _rescan           = false;
+static volatile uint32_t _patternOverflows = 0;
+
+static void pattern_overflow() {
+    _patternOverflows++;
+    dbg_printf("UART pattern queue overflow (%u)\n", (unsigned)_patternOverflows);
+    uart_pattern_queue_reset(fnc_uart_port, 32);
+    _rescan = true;
+}
 
 void uart_backend_putchar(uint8_t c) {
     uart_write_bytes(fnc_uart_port, (const char*)&c, 1);
@@ -26,21 +59,90 @@ void uart_backend_putchar(uint8_t c) {
 #endif
 }
 
+static bool refill_span() {
+    size_t avail = 0;
+    uart_get_buffered_data_len(fnc_uart_port, &avail);
+    if (avail == 0) {
+        return false;
+    }
+    // Positions for bytes a rescan reads past go negative and the driver
+    // drops them, so only the ones still ahead of us are left afterwards.
+    int pos  = _rescan ? -1 : uart_pattern_pop_pos(fnc_uart_port);  // next '\n', -1 if none
+    int want = (pos >= 0) ? pos + 1 : (int)avail;
+    if (want > RX_SPAN) want = RX_SPAN;
+    int got = uart_read_bytes(fnc_uart_port, _span, want, 0);
+    if (got <= 0) {
+        return false;
+    }
+    if (_rescan) {
+        _rescan = (size_t)got < avail;
+    } else if (pos < 0 && memchr(_span, '\n', got)) {
+        pattern_overflow();
+        _rescan = (size_t)got < avail;
+    }
+    _spanLen = got;
+    _spanPos = 0;
+    update_rx_time();
+    return true;
+}
+
 int uart_backend_getchar() {
-    char c;
-    int  res = uart_read_bytes(fnc_uart_port, &c, 1, 0);
-    if (res == 1) {
-        update_rx_time();
+    if (_spanPos >= _spanLen && !refill_span()) {
+        return -1;
+    }
+    uint8_t c = _span[_spanPos++];
 #ifdef ECHO_FNC_TO_DEBUG
-        dbg_write(c);
+    dbg_write(c);
 #endif
-        return c;
+    return c;
+}
+
+// Block until the driver reports a complete line (or trouble), or timeout.
+// Plain UART_DATA events (FIFO threshold / RX idle) don't end the wait: a
+// partial line isn't worth waking for, and the timeout picks it up anyway.
+bool uart_backend_wait_rx(uint32_t timeout_ms) {
+    if (_spanPos < _spanLen) {
+        return true;
     }
-    return -1;
+    TickType_t deadline = xTaskGetTickCount() + pdMS_TO_TICKS(timeout_ms);
+    for (;;) {
+        TickType_t now  = xTaskGetTickCount();
+        TickType_t wait = (TickType_t)(deadline - now);
+        if ((int32_t)wait <= 0) {
+            return false;
+        }
+        uart_event_t ev;
+        if (xQueueReceive(fnc_uart_events, &ev, wait) != pdTRUE) {
+            return false;
+        }
+        switch (ev.type) {
+            case UART_PATTERN_DET:
+                return true;
+            case UART_FIFO_OVF:
+            case UART_BUFFER_FULL:
+                // Flow control didn't hold the sender off.  The ring's
+                // contents can't be trusted to be contiguous any more.
+                dbg_printf("UART RX overflow (%s)\n", ev.type == UART_FIFO_OVF ? "fifo" : "ring");
+                uart_flush_input(fnc_uart_port);
+                uart_pattern_queue_reset(fnc_uart_port, 32);
+                xQueueReset(fnc_uart_events);
+                _spanLen = _spanPos = 0;
+                _rescan             = false;
+                return false;
+            default:
+                break;
+        }
+    }
+}
+
+uint32_t uart_backend_pattern_overflows() {
+    return _patternOverflows;
 }
 
 void uart_backend_reset_flow_control() {
-    uart_ll_force_xon(fnc_uart_port);
+    if (!fnc_uart_hw_flow) {
+        uart_ll_force_xon(fnc_uart_port);
+    }
 }
 
 // ── Driver install ──────────────────────────────────────────────────────────
@@ -54,11 +156,13 @@ void uart_backend_reset_flow_control() {
 #    define FNC_BAUD 115200
 #endif
 
-void init_fnc_uart(int uart_num, int tx_pin, int rx_pin) {
-    fnc_uart_port = (uart_port_t)uart_num;
-    int baudrate  = FNC_BAUD;
+void init_fnc_uart(int uart_num, int tx_pin, int rx_pin, int rts_pin, int cts_pin) {
+    fnc_uart_port    = (uart_port_t)uart_num;
+    fnc_uart_hw_flow = rts_pin >= 0 && cts_pin >= 0;
+    int baudrate     = FNC_BAUD;
     uart_driver_delete(fnc_uart_port);
-    uart_set_pin(fnc_uart_port, (gpio_num_t)tx_pin, (gpio_num_t)rx_pin, -1, -1);
+    uart_set_pin(fnc_uart_port, (gpio_num_t)tx_pin, (gpio_num_t)rx_pin,
+                 fnc_uart_hw_flow ? rts_pin : UART_PIN_NO_CHANGE, fnc_uart_hw_flow ? cts_pin : UART_PIN_NO_CHANGE);
     uart_config_t conf;
 #if defined(CONFIG_IDF_TARGET_ESP32) || defined(CONFIG_IDF_TARGET_ESP32S2)
     conf.source_clk = UART_SCLK_APB;  // ESP32, ESP32S2
@@ -72,8 +176,10 @@ void init_fnc_uart(int uart_num, int tx_pin, int rx_pin) {
     conf.data_bits           = UART_DATA_8_BITS;
     conf.parity              = UART_PARITY_DISABLE;
     conf.stop_bits           = UART_STOP_BITS_1;
-    conf.flow_ctrl           = UART_HW_FLOWCTRL_DISABLE;
-    conf.rx_flow_ctrl_thresh = 0;
+    // RTS drops when the 128-byte hardware FIFO is 3/4 full, well before the
+    // ISR falls behind even at 2 Mbaud.
+    conf.flow_ctrl           = fnc_uart_hw_flow ? UART_HW_FLOWCTRL_CTS_RTS : UART_HW_FLOWCTRL_DISABLE;
+    conf.rx_flow_ctrl_thresh = fnc_uart_hw_flow ? 96 : 0;
     if (uart_param_config(fnc_uart_port, &conf) != ESP_OK) {
         dbg_println("UART config failed");
         while (1) {}
@@ -85,8 +191,15 @@ void init_fnc_uart(int uart_num, int tx_pin, int rx_pin) {
     // seconds to receive.  XON/XOFF thresholds are uint8_t (max 255); use
     // near-max values so XOFF fires rarely — the drain loop in
     // pendant_hw_task empties the buffer every 2 ms.
-    uart_driver_install(fnc_uart_port, 4096, 0, 0, NULL, ESP_INTR_FLAG_IRAM);
-    uart_set_sw_flow_ctrl(fnc_uart_port, true, 128, 250);
+    //
+    // The event queue carries one UART_PATTERN_DET per received '\n'; the
+    // pattern queue holds the matching line-end positions for refill_span().
+    // With RTS/CTS wired, XON/XOFF is turned off so 0x11/0x13 in the stream
+    // pass through untouched.
+    uart_driver_install(fnc_uart_port, 4096, 0, 32, &fnc_uart_events, ESP_INTR_FLAG_IRAM);
+    uart_enable_pattern_det_baud_intr(fnc_uart_port, '\n', 1, 9, 0, 0);
+    uart_pattern_queue_reset(fnc_uart_port, 32);
+    uart_set_sw_flow_ctrl(fnc_uart_port, !fnc_uart_hw_flow, 128, 250);
     uint32_t baud;
     uart_get_baudrate(fnc_uart_port, &baud);
 }
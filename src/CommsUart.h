@@ -11,11 +11,26 @@
 // and the XON/XOFF software flow-control wiring.
 //
 // init_fnc_uart() is called once during hardware setup (Hardware2432.cpp,
-// HardwareM5Dial.cpp).  After that the backend is ready and the three
-// hot-path functions are safe to call from the task that drives them.
+// HardwareM5Dial.cpp).  After that the backend is ready and the hot-path
+// functions are safe to call from the task that drives them.
+//
+// RX uses the driver's '\n' pattern detection: getchar() is served from
+// whole-line spans, and wait_rx() lets the comms task sleep until a line
+// has actually arrived.  Define FNC_RTS_PIN and FNC_CTS_PIN when the
+// wiring has hardware handshake; that replaces XON/XOFF and is what makes
+// FNC_BAUD=2000000 reliable.
+
+#ifndef FNC_RTS_PIN
+#    define FNC_RTS_PIN -1
+#endif
+#ifndef FNC_CTS_PIN
+#    define FNC_CTS_PIN -1
+#endif
 
-void init_fnc_uart(int uart_num, int tx_pin, int rx_pin);
+void init_fnc_uart(int uart_num, int tx_pin, int rx_pin, int rts_pin = FNC_RTS_PIN, int cts_pin = FNC_CTS_PIN);
 
-void uart_backend_putchar(uint8_t c);
-int  uart_backend_getchar();                 // returns -1 if no byte available
-void uart_backend_reset_flow_control();      // force HW XON (recovers from XOFF)
+void     uart_backend_putchar(uint8_t c);
+int      uart_backend_getchar();                     // returns -1 if no byte available
+bool     uart_backend_wait_rx(uint32_t timeout_ms);  // true once a full line is buffered
+void     uart_backend_reset_flow_control();          // force HW XON (recovers from XOFF)
+uint32_t uart_backend_pattern_overflows();           // line-end queue overflows recovered from
@@ -0,0 +1,65 @@
+// Copyright (c) 2026 — FluidDial-CYD
+// Use of this source code is governed by a GPLv3 license.
+
+// Console response ring.  See ConsoleLog.h.
+
+#include "ConsoleLog.h"
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+#ifdef ARDUINO
+#    include <freertos/FreeRTOS.h>
+static portMUX_TYPE _conMux = portMUX_INITIALIZER_UNLOCKED;
+#    define CON_LOCK()   portENTER_CRITICAL(&_conMux)
+#    define CON_UNLOCK() portEXIT_CRITICAL(&_conMux)
+#else
+#    define CON_LOCK()
+#    define CON_UNLOCK()
+#endif
+
+static ConLine       _ring[CON_LINES];
+static uint32_t      _seq     = 0;
+static volatile bool _capture = false;
+
+void con_log(ConKind kind, const char* text) {
+    CON_LOCK();
+    ConLine& l = _ring[++_seq % CON_LINES];
+    l.seq      = _seq;
+    l.kind     = kind;
+    strncpy(l.text, text, CON_LINE_MAX - 1);
+    l.text[CON_LINE_MAX - 1] = '\0';
+    CON_UNLOCK();
+}
+
+void con_logf(ConKind kind, const char* fmt, ...) {
+    char    buf[CON_LINE_MAX];
+    va_list args;
+    va_start(args, fmt);
+    vsnprintf(buf, sizeof(buf), fmt, args);
+    va_end(args);
+    con_log(kind, buf);
+}
+
+uint32_t con_seq() {
+    return _seq;
+}
+
+bool con_get(uint32_t seq, ConLine& out) {
+    CON_LOCK();
+    bool ok = seq && seq <= _seq && _seq - seq < CON_LINES;
+    if (ok) {
+        out = _ring[seq % CON_LINES];
+    }
+    CON_UNLOCK();
+    return ok;
+}
+
+void con_capture_replies(bool on) {
+    _capture = on;
+}
+
+bool con_capturing_replies() {
+    return _capture;
+}
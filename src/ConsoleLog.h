@@ -0,0 +1,45 @@
+// Copyright (c) 2026 — FluidDial-CYD
+// Use of this source code is governed by a GPLv3 license.
+
+#pragma once
+#include <stdint.h>
+
+// ── Console response ring ────────────────────────────────────────────────────
+//
+// The last CON_LINES lines of controller conversation, for the MDI screen:
+// the lines it sent, their "ok" / "error:N", every [MSG:] the controller
+// volunteers, and — while con_capture_replies() is on — the other lines
+// handle_other() sees, which is where the output of "$$", "$#" or "$I" lands.
+//
+// Storage is a fixed array of fixed-size lines; a line longer than
+// CON_LINE_MAX is cut short.  Each line gets the next sequence number, so a
+// reader remembers the last number it drew and fetches only what is newer;
+// con_get() fails for a number that has already been overwritten.
+// con_log() may be called from either core.
+
+#define CON_LINES    32
+#define CON_LINE_MAX 48  // 38 characters fit the 230 px pane at text size 1
+
+enum ConKind : uint8_t {
+    CON_SENT = 0,  // "> G0 X10"
+    CON_OK,
+    CON_ERROR,
+    CON_MSG,       // [MSG:...]
+    CON_REPLY,     // any other line received while capturing
+    CON_NOTE,      // the pendant's own remarks ("3 lines not sent")
+};
+
+struct ConLine {
+    uint32_t seq;
+    ConKind  kind;
+    char     text[CON_LINE_MAX];
+};
+
+void con_log(ConKind kind, const char* text);
+void con_logf(ConKind kind, const char* fmt, ...);
+
+uint32_t con_seq();                          // newest line's number; 0 = none yet
+bool     con_get(uint32_t seq, ConLine& out);
+
+void con_capture_replies(bool on);
+bool con_capturing_replies();
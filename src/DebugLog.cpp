@@ -0,0 +1,443 @@
+// Copyright (c) 2026 — FluidDial-CYD
+// Use of this source code is governed by a GPLv3 license.
+
+// Deferred debug log.  See DebugLog.h.
+
+#include "DebugLog.h"
+#include "System.h"  // dbg_print() (host build)
+
+#include <stdio.h>
+#include <string.h>
+
+// ── Format scanning ──────────────────────────────────────────────────────────
+// Shared by the call site (to know what to copy) and the formatter (to know
+// what was copied), so the two can never disagree about a record's layout.
+
+enum ArgType : uint8_t { ARG_NONE = 0, ARG_INT, ARG_LL, ARG_DBL, ARG_STR, ARG_PTR };
+
+struct Spec {
+    const char* start;  // the '%'
+    const char* end;    // one past the conversion character
+    ArgType     type;   // ARG_NONE for "%%"
+    uint8_t     stars;  // '*' width / precision, each an int argument first
+};
+
+// Finds the next conversion at or after p.  False at the end of the format,
+// or at a conversion this doesn't know — the rest is then printed verbatim.
+static bool next_spec(const char* p, Spec& s) {
+    p = strchr(p, '%');
+    if (!p) return false;
+    s.start = p++;
+    s.stars = 0;
+    while (*p && strchr("-+ #0", *p)) ++p;
+    if (*p == '*') {
+        s.stars++;
+        ++p;
+    }
+    while (*p >= '0' && *p <= '9') ++p;
+    if (*p == '.') {
+        ++p;
+        if (*p == '*') {
+            s.stars++;
+            ++p;
+        }
+        while (*p >= '0' && *p <= '9') ++p;
+    }
+    int longs = 0;
+    while (*p && strchr("hlzjt", *p)) {
+        longs += *p == 'l';
+        ++p;
+    }
+    switch (*p) {
+        case 'd': case 'i': case 'u': case 'x': case 'X': case 'o': case 'c':
+            s.type = longs >= 2 ? ARG_LL : ARG_INT;  // long is 32 bits here
+            break;
+        case 'f': case 'F': case 'e': case 'E': case 'g': case 'G':
+            s.type = ARG_DBL;
+            break;
+        case 's':
+            s.type = ARG_STR;
+            break;
+        case 'p':
+            s.type = ARG_PTR;
+            break;
+        case '%':
+            s.type = ARG_NONE;
+            break;
+        default:
+            return false;
+    }
+    s.end = p + 1;
+    return true;
+}
+
+#ifdef ARDUINO
+
+#    include <Arduino.h>
+#    include <esp_timer.h>
+#    include <freertos/FreeRTOS.h>
+#    include <freertos/semphr.h>
+#    include <freertos/task.h>
+
+// Record: header, then the arguments in format order — 4 bytes per int or
+// pointer, 8 per long long or double, and a %s as a 1-byte length plus its
+// bytes.  Records are padded to 4 bytes and never wrap; a record with a null
+// format fills the space to the end of the ring.
+struct RecHdr {
+    uint16_t    len;  // whole record, padded
+    uint8_t     core;
+    uint8_t     flags;
+    uint32_t    us;   // esp_timer, low 32 bits
+    const char* fmt;
+};
+#    define REC_MAX 224
+
+struct Ring {
+    alignas(4) uint8_t buf[DBGLOG_RING_BYTES];
+    volatile uint32_t head;  // free-running; written by this core's producers
+    volatile uint32_t tail;  // free-running; written by the reader
+    uint32_t          dropped;
+};
+
+static Ring              _rings[portNUM_PROCESSORS];
+static SemaphoreHandle_t _readLock   = nullptr;
+static uint32_t          _records    = 0;
+static int               _highWater  = 0;
+static uint32_t          _reportedDrops = 0;
+
+// Builds the record on the caller's stack; returns its padded length.
+static int build(uint8_t* rec, const char* fmt, va_list args) {
+    int  n = sizeof(RecHdr);
+    Spec s;
+    for (const char* p = fmt; next_spec(p, s); p = s.end) {
+        for (int i = 0; i < s.stars; ++i) {
+            int v = va_arg(args, int);
+            if (n + 4 > REC_MAX) return -1;
+            memcpy(rec + n, &v, 4);
+            n += 4;
+        }
+        switch (s.type) {
+            case ARG_INT: {
+                int v = va_arg(args, int);
+                if (n + 4 > REC_MAX) return -1;
+                memcpy(rec + n, &v, 4);
+                n += 4;
+                break;
+            }
+            case ARG_PTR: {
+                void* v = va_arg(args, void*);
+                if (n + 4 > REC_MAX) return -1;
+                memcpy(rec + n, &v, 4);
+                n += 4;
+                break;
+            }
+            case ARG_LL: {
+                long long v = va_arg(args, long long);
+                if (n + 8 > REC_MAX) return -1;
+                memcpy(rec + n, &v, 8);
+                n += 8;
+                break;
+            }
+            case ARG_DBL: {
+                double v = va_arg(args, double);
+                if (n + 8 > REC_MAX) return -1;
+                memcpy(rec + n, &v, 8);
+                n += 8;
+                break;
+            }
+            case ARG_STR: {
+                const char* v   = va_arg(args, const char*);
+                size_t      len = v ? strnlen(v, DBGLOG_STR_MAX) : 0;
+                if (n + 1 + (int)len > REC_MAX) {
+                    len = REC_MAX > n + 1 ? REC_MAX - n - 1 : 0;
+                }
+                if (n + 1 > REC_MAX) return -1;
+                rec[n++] = (uint8_t)len;
+                memcpy(rec + n, v, len);
+                n += len;
+                break;
+            }
+            default:
+                break;
+        }
+    }
+    n = (n + 3) & ~3;
+    return n <= REC_MAX ? n : -1;
+}
+
+static void push(uint8_t* rec, int len, const char* fmt) {
+    RecHdr* h = (RecHdr*)rec;
+    h->len    = len;
+    h->flags  = 0;
+    h->us     = (uint32_t)esp_timer_get_time();
+    h->fmt    = fmt;
+
+    // Masking interrupts pins us to this core for the copy and keeps every
+    // other producer on it out; the other core has its own ring.
+    UBaseType_t irq  = portSET_INTERRUPT_MASK_FROM_ISR();
+    int         core = xPortGetCoreID();
+    Ring&       r    = _rings[core];
+    h->core          = core;
+    uint32_t head    = r.head;
+    uint32_t tail    = __atomic_load_n(&r.tail, __ATOMIC_ACQUIRE);
+    uint32_t off     = head % DBGLOG_RING_BYTES;
+    uint32_t pad     = DBGLOG_RING_BYTES - off < (uint32_t)len ? DBGLOG_RING_BYTES - off : 0;
+    uint32_t used    = head - tail;
+    if (used + pad + len > DBGLOG_RING_BYTES) {
+        r.dropped++;
+        portCLEAR_INTERRUPT_MASK_FROM_ISR(irq);
+        return;
+    }
+    if (pad) {
+        if (pad >= sizeof(RecHdr)) {  // shorter tails are skipped by size alone
+            RecHdr filler = { (uint16_t)pad, (uint8_t)core, 0, h->us, nullptr };
+            memcpy(r.buf + off, &filler, sizeof(filler));
+        }
+        head += pad;
+        off = 0;
+    }
+    memcpy(r.buf + off, rec, len);
+    used = head + len - tail;
+    if ((int)used > _highWater) _highWater = used;
+    __atomic_store_n(&r.head, head + len, __ATOMIC_RELEASE);
+    portCLEAR_INTERRUPT_MASK_FROM_ISR(irq);
+}
+
+static void vlog_one(const char* fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    dbg_vlog(fmt, args);
+    va_end(args);
+}
+
+void dbg_vlog(const char* fmt, va_list args) {
+    alignas(4) uint8_t rec[REC_MAX];
+    int     len = build(rec, fmt, args);
+    if (len < 0) {
+        // More arguments than a record holds — say so rather than lose it.
+        vlog_one("[dbglog: record too long] %.40s\r\n", fmt);
+        return;
+    }
+    push(rec, len, fmt);
+}
+
+void dbg_log_str(const char* fmt, const char* s) {
+    // dbg_print() of a long string: split into "%s" pieces so nothing is cut
+    // at DBGLOG_STR_MAX; the last piece carries the caller's format.
+    size_t len = strlen(s);
+    while (len > DBGLOG_STR_MAX) {
+        char piece[DBGLOG_STR_MAX + 1];
+        memcpy(piece, s, DBGLOG_STR_MAX);
+        piece[DBGLOG_STR_MAX] = '\0';
+        vlog_one("%s", piece);
+        s += DBGLOG_STR_MAX;
+        len -= DBGLOG_STR_MAX;
+    }
+    vlog_one(fmt, s);
+}
+
+// ── Reader ───────────────────────────────────────────────────────────────────
+
+static void emit(const char* s, size_t len) {
+#    ifdef DEBUG_TO_USB
+    debugPort.write((const uint8_t*)s, len);
+#    else
+    (void)s;
+    (void)len;
+#    endif
+}
+
+#    ifndef DBGLOG_BINARY
+// One spec at a time through snprintf: there's no portable way to rebuild a
+// va_list, but every spec takes at most two '*' ints and one value.
+static void format(const RecHdr* h, const uint8_t* a) {
+    char        out[256];
+    size_t      n = 0;
+    const char* p = h->fmt;
+    Spec        s;
+    auto        put = [&](const char* t, size_t len) {
+        if (n + len > sizeof(out) - 1) len = sizeof(out) - 1 - n;
+        memcpy(out + n, t, len);
+        n += len;
+    };
+    while (next_spec(p, s)) {
+        put(p, s.start - p);
+        char spec[16];
+        size_t specLen = s.end - s.start;
+        if (specLen >= sizeof(spec)) specLen = sizeof(spec) - 1;
+        memcpy(spec, s.start, specLen);
+        spec[specLen] = '\0';
+
+        int star[2] = { 0, 0 };
+        for (int i = 0; i < s.stars; ++i) {
+            memcpy(&star[i], a, 4);
+            a += 4;
+        }
+        char piece[DBGLOG_STR_MAX + 32];
+        int  len = 0;
+        switch (s.type) {
+            case ARG_PTR: {
+                void* v;
+                memcpy(&v, a, 4);
+                a += 4;
+                len = snprintf(piece, sizeof(piece), spec, v);
+                break;
+            }
+            case ARG_INT: {
+                int v;
+                memcpy(&v, a, 4);
+                a += 4;
+                len = s.stars == 2 ? snprintf(piece, sizeof(piece), spec, star[0], star[1], v)
+                    : s.stars == 1 ? snprintf(piece, sizeof(piece), spec, star[0], v)
+                                   : snprintf(piece, sizeof(piece), spec, v);
+                break;
+            }
+            case ARG_LL: {
+                long long v;
+                memcpy(&v, a, 8);
+                a += 8;
+                len = s.stars == 2 ? snprintf(piece, sizeof(piece), spec, star[0], star[1], v)
+                    : s.stars == 1 ? snprintf(piece, sizeof(piece), spec, star[0], v)
+                                   : snprintf(piece, sizeof(piece), spec, v);
+                break;
+            }
+            case ARG_DBL: {
+                double v;
+                memcpy(&v, a, 8);
+                a += 8;
+                len = s.stars == 2 ? snprintf(piece, sizeof(piece), spec, star[0], star[1], v)
+                    : s.stars == 1 ? snprintf(piece, sizeof(piece), spec, star[0], v)
+                                   : snprintf(piece, sizeof(piece), spec, v);
+                break;
+            }
+            case ARG_STR: {
+                char v[DBGLOG_STR_MAX + 1];
+                int  vl = *a++;
+                memcpy(v, a, vl);
+                v[vl] = '\0';
+                a += vl;
+                len = s.stars == 2 ? snprintf(piece, sizeof(piece), spec, star[0], star[1], v)
+                    : s.stars == 1 ? snprintf(piece, sizeof(piece), spec, star[0], v)
+                                   : snprintf(piece, sizeof(piece), spec, v);
+                break;
+            }
+            default:
+                piece[0] = '%';
+                len      = 1;
+                break;
+        }
+        if (len > (int)sizeof(piece) - 1) len = sizeof(piece) - 1;
+        if (len > 0) put(piece, len);
+        p = s.end;
+    }
+    put(p, strlen(p));
+    emit(out, n);
+}
+#    endif
+
+static void drain() {
+    for (;;) {
+        // Oldest record across the cores first, so interleaved lines from
+        // the two cores come out in the order they were logged.
+        const RecHdr* pick  = nullptr;
+        Ring*         pickR = nullptr;
+        for (int c = 0; c < portNUM_PROCESSORS; ++c) {
+            Ring&    r    = _rings[c];
+            uint32_t head = __atomic_load_n(&r.head, __ATOMIC_ACQUIRE);
+            if (r.tail == head) continue;
+            uint32_t      off = r.tail % DBGLOG_RING_BYTES;
+            const RecHdr* h   = (const RecHdr*)(r.buf + off);
+            if (DBGLOG_RING_BYTES - off < sizeof(RecHdr) || !h->fmt) {  // filler to the end
+                __atomic_store_n(&r.tail, r.tail + (DBGLOG_RING_BYTES - off), __ATOMIC_RELEASE);
+                --c;
+                continue;
+            }
+            if (!pick || (int32_t)(h->us - pick->us) < 0) {
+                pick  = h;
+                pickR = &r;
+            }
+        }
+        if (!pick) break;
+
+#    ifdef DBGLOG_BINARY
+        static const uint8_t sync[2] = { 0xFE, 0xED };
+        emit((const char*)sync, 2);
+        emit((const char*)pick, pick->len);
+#    else
+        format(pick, (const uint8_t*)(pick + 1));
+#    endif
+        _records++;
+        __atomic_store_n(&pickR->tail, pickR->tail + pick->len, __ATOMIC_RELEASE);
+    }
+
+    uint32_t drops = 0;
+    for (int c = 0; c < portNUM_PROCESSORS; ++c) {
+        drops += _rings[c].dropped;
+    }
+    if (drops != _reportedDrops) {
+        char msg[48];
+        int  n = snprintf(msg, sizeof(msg), "[dbglog: %u dropped]\r\n", (unsigned)(drops - _reportedDrops));
+        emit(msg, n);
+        _reportedDrops = drops;
+    }
+}
+
+static void dbg_log_task(void* /*param*/) {
+    for (;;) {
+        vTaskDelay(pdMS_TO_TICKS(DBGLOG_PERIOD_MS));
+        xSemaphoreTake(_readLock, portMAX_DELAY);
+        drain();
+        xSemaphoreGive(_readLock);
+    }
+}
+
+void dbg_log_start() {
+    if (_readLock) return;
+    _readLock = xSemaphoreCreateMutex();
+    // Unpinned, lowest application priority: it only ever runs when the
+    // tasks that log have nothing to do.
+    xTaskCreate(dbg_log_task, "DbgLog", 3072, nullptr, 1, nullptr);
+}
+
+void dbg_log_flush() {
+    if (_readLock) xSemaphoreTake(_readLock, portMAX_DELAY);
+    drain();
+    if (_readLock) xSemaphoreGive(_readLock);
+#    ifdef DEBUG_TO_USB
+    debugPort.flush();
+#    endif
+}
+
+void dbg_log_stats(DbgLogStats& out) {
+    out.records    = _records;
+    out.dropped    = 0;
+    for (int c = 0; c < portNUM_PROCESSORS; ++c) {
+        out.dropped += _rings[c].dropped;
+    }
+    out.high_water = _highWater;
+}
+
+#else  // !ARDUINO — SDL host build: format and print right here.
+
+void dbg_log_start() {}
+void dbg_log_flush() {}
+
+void dbg_vlog(const char* fmt, va_list args) {
+    char buf[192];
+    if (vsnprintf(buf, sizeof(buf), fmt, args) > 0) {
+        dbg_print(buf);
+    }
+}
+
+void dbg_log_str(const char* fmt, const char* s) {
+    dbg_print(s);
+    if (strcmp(fmt, "%s\r\n") == 0) {
+        dbg_print("\r\n");
+    }
+}
+
+void dbg_log_stats(DbgLogStats& out) {
+    out = {};
+}
+
+#endif  // ARDUINO
@@ -0,0 +1,47 @@
+// Copyright (c) 2026 — FluidDial-CYD
+// Use of this source code is governed by a GPLv3 license.
+
+#pragma once
+#include <stdarg.h>
+#include <stdint.h>
+
+// ── Deferred debug log ───────────────────────────────────────────────────────
+//
+// dbg_printf() / dbg_print() no longer format or touch the serial port on the
+// calling task.  The call site scans the format only far enough to know the
+// argument types and copies the format POINTER plus the raw arguments (and
+// the bytes of any %s) into a ring owned by the calling core.  Interrupts are
+// masked on that core for the copy, which serialises every producer there
+// without a lock shared with the other core; the reader advances its own
+// tail, so the two sides never wait on each other.
+//
+// A low-priority task merges both rings in timestamp order and formats each
+// record, or — with DBGLOG_BINARY — writes the record as-is in a frame that
+// scripts/dbglog_decode.py turns back into text using the firmware ELF (the
+// format pointer is the string's address in it).
+//
+// The call-site cost is the same whether or not DEBUG_TO_USB is set: release
+// builds push the same records, and only the task discards them instead of
+// printing.  So turning logging on no longer changes the timing of the code
+// being debugged.  A full ring drops the record and counts it.
+//
+// The SDL host build keeps the synchronous path.
+
+#define DBGLOG_RING_BYTES 2048  // per core
+#define DBGLOG_STR_MAX    96    // %s argument bytes kept
+#define DBGLOG_PERIOD_MS  20
+
+void dbg_log_start();
+void dbg_vlog(const char* fmt, va_list args);
+void dbg_log_str(const char* fmt, const char* s);  // fmt takes one %s: "%s" / "%s\r\n"
+
+// Format everything pending on the calling task — before a restart or deep
+// sleep, so the last lines make it out.
+void dbg_log_flush();
+
+struct DbgLogStats {
+    uint32_t records;
+    uint32_t dropped;
+    int      high_water;  // most ring bytes in use, either core
+};
+void dbg_log_stats(DbgLogStats& out);
@@ -280,6 +280,9 @@ void drawError() {
             drawCircle(120, 120, 95, 5, WHITE);
             centered_text("Error", 95, WHITE, MEDIUM);
             centered_text(decode_error_number(lastError), 140, WHITE, TINY);
+            if (*lastErrorLine) {
+                centered_text(lastErrorLine, 165, WHITE, TINY);
+            }
         } else {
             lastError = 0;
         }
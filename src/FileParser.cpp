@@ -3,7 +3,7 @@
 
 #include "FileParser.h"
 
-#include "Scene.h"  // current_scene->reDisplay()
+#include "Scene.h"  // notify_redisplay(), notify_files_list()
 #include "Menu.h"
 #include "GrblParserC.h"  // send_line()
 #include "HomingScene.h"  // set_axis_homed()
@@ -12,13 +12,52 @@
 #include <JsonListener.h>
 
 #include "MacroItem.h"
+#include "ConsoleLog.h"
 
 extern Menu macroMenu;
 
 fileinfo              fileInfo;
 std::vector<fileinfo> fileVector;
 
-JsonStreamingParser parser;
+// Scenes read fileVector, fileLines and macroMenu on the UI task.  With
+// USE_SCENE_TASKS this parser runs on the comms task (and the HTTP macro
+// fetch on the network worker), so each list is built privately here and the
+// finished one handed over under parser_data_lock(); parser_data_adopt() on
+// the UI task swaps it in.  The lock is only held for those swaps, never
+// while a scene draws.
+static std::vector<fileinfo>    _files;  // being parsed
+static std::vector<std::string> _lines;
+static std::vector<fileinfo>    _readyFiles;  // handed over, not yet adopted
+static std::vector<std::string> _readyLines;
+static bool                     _filesReady = false;
+static bool                     _linesReady = false;
+
+static void publish_files() {
+    parser_data_lock();
+    _readyFiles.swap(_files);
+    _filesReady = true;
+    parser_data_unlock();
+}
+
+static void publish_lines() {
+    parser_data_lock();
+    _readyLines.swap(_lines);
+    _linesReady = true;
+    parser_data_unlock();
+}
+
+// The reply parser exists only while a JSON reply is being parsed: made by
+// the first handle_json() and freed once the document is done (see
+// parser_parse_line), so its buffers aren't held between the few file and
+// macro requests a session makes.
+static JsonStreamingParser* _parser = nullptr;
+
+static JsonStreamingParser& json_parser() {
+    if (!_parser) {
+        _parser = new JsonStreamingParser();
+    }
+    return *_parser;
+}
 
 // This is necessary because of an annoying "feature" of JsonStreamingParser.
 // After it issues an endDocument, it sets its internal state to STATE_DONE,
@@ -64,13 +103,14 @@ class FilesListListener : public JsonListener {
 private:
     bool        haveNewFile;
     std::string current_key;
+    fileinfo    _entry;  // not fileInfo: FileSelectScene owns that one
 
 public:
     void whitespace(char c) override {}
 
     void startDocument() override {}
     void startArray() override {
-        fileVector.clear();
+        _files.clear();
         haveNewFile = false;
     }
     void startObject() override {}
@@ -84,43 +124,108 @@ public:
 
     void value(const char* value) override {
         if (current_key == "name") {
-            fileInfo.fileName = value;
+            _entry.fileName = value;
             return;
         }
         if (current_key == "size") {
-            fileInfo.fileSize = atoi(value);
-            //            fileInfo.isDir    = fileInfo.fileSize < 0;
+            _entry.fileSize = atoi(value);
+            //            _entry.isDir    = _entry.fileSize < 0;
         }
     }
 
+    //#define DEBUG_FILE_LIST
     void endArray() override {
-        std::sort(fileVector.begin(), fileVector.end(), fileinfoCompare);
-        current_scene->onFilesList();
+        std::sort(_files.begin(), _files.end(), fileinfoCompare);
+#ifdef DEBUG_FILE_LIST
+        int ix = 0;
+        for (auto const& vi : _files) {
+            dbg_printf("[%d] type: %s:\"%s\", size: %d\r\n", ix++, (vi.isDir()) ? "file" : "dir ", vi.fileName.c_str(), vi.fileSize);
+        }
+#endif
+        publish_files();
+        notify_files_list();
         g_json_accumulating = false;
-        parser.setListener(pInitialListener);
+        json_parser().setListener(pInitialListener);
     }
 
     void endObject() override {
         if (haveNewFile) {
-            fileVector.push_back(fileInfo);
+            _files.push_back(_entry);
             haveNewFile = false;
         }
     }
 
-    //#define DEBUG_FILE_LIST
     void endDocument() override {
-#ifdef DEBUG_FILE_LIST
-        int ix = 0;
-        for (auto const& vi : fileVector) {
-            dbg_printf("[%d] type: %s:\"%s\", size: %d\r\n", ix++, (vi.isDir()) ? "file" : "dir ", vi.fileName.c_str(), vi.fileSize);
-        }
-#endif
         init_listener();
     }
 } filesListListener;
 
 std::vector<Macro*> macros;
 
+// `macros` belongs to the parser; macroMenu is rebuilt from a copy on the UI
+// task (parser_data_adopt()) each time a macro list is delivered.
+struct MacroEntry {
+    std::string name;
+    std::string filename;
+};
+static std::vector<MacroEntry> _readyMacros;
+static bool                    _macrosReady = false;
+
+static void clear_macro_list() {
+    for (auto* m : macros) delete m;
+    macros.clear();
+}
+
+static void add_macro(const std::string& name, const std::string& filename, const std::string& target) {
+    macros.push_back(new Macro { name, filename, target });
+}
+
+static void publish_macros() {
+    std::vector<MacroEntry> list;
+    list.reserve(macros.size());
+    for (auto* m : macros) list.push_back({ m->name, m->filename });
+    parser_data_lock();
+    _readyMacros.swap(list);
+    _macrosReady = true;
+    parser_data_unlock();
+}
+
+// Every macro request ends in exactly one of these.
+static void macros_done() {
+    publish_macros();
+    notify_files_list();
+}
+static void macros_failed() {
+    publish_macros();
+    notify_error("No Macros");
+}
+
+void parser_data_adopt() {
+    std::vector<MacroEntry> macroList;
+    parser_data_lock();
+    if (_filesReady) {
+        fileVector.swap(_readyFiles);
+        _filesReady = false;
+    }
+    if (_linesReady) {
+        fileLines.swap(_readyLines);
+        _linesReady = false;
+    }
+    bool newMacros = _macrosReady;
+    if (newMacros) {
+        macroList.swap(_readyMacros);
+        _macrosReady = false;
+    }
+    parser_data_unlock();
+
+    if (newMacros) {
+        macroMenu.removeAllItems();
+        for (auto const& m : macroList) {
+            macroMenu.addItem(new MacroItem { m.name.c_str(), m.filename });
+        }
+    }
+}
+
 // Forward declaration needed by PreferencesListener::endObject()
 static void request_macro_list_wu3();
 
@@ -137,9 +242,7 @@ public:
 
     void startDocument() override {}
     void startArray() override {
-        macroMenu.removeAllItems();
-        for (auto* m : macros) delete m;
-        macros.clear();
+        clear_macro_list();
     }
     void startObject() override {
         _name.clear();
@@ -178,12 +281,11 @@ public:
         } else {
             return;
         }
-        macroMenu.addItem(new MacroItem { _name.c_str(), _filename });
-        macros.push_back(new Macro { _name, _filename, _target });
+        add_macro(_name, _filename, _target);
     }
 
     void endDocument() override {
-        current_scene->onFilesList();
+        macros_done();
         init_listener();
     }
 } macroLinesListener;
@@ -205,9 +307,7 @@ public:
 
     void startArray() override {
         _level = 0;
-        macroMenu.removeAllItems();
-        for (auto* m : macros) delete m;
-        macros.clear();
+        clear_macro_list();
     }
 
     void startObject() override {
@@ -245,8 +345,7 @@ public:
                 ok = true;
             }
             if (ok) {
-                macroMenu.addItem(new MacroItem { _name.c_str(), path });
-                macros.push_back(new Macro { _name, path, _target });
+                add_macro(_name, path, _target);
             }
         }
         --_level;
@@ -255,13 +354,13 @@ public:
     void endArray() override {
         if (g_http_macros_mode) return;  // HTTP fetch task handles completion
         if (macros.empty()) {
-            current_scene->onError("No Macros");
+            macros_failed();
         } else {
-            current_scene->onFilesList();
+            macros_done();
         }
         g_json_accumulating = false;
         parser_needs_reset  = true;  // same as preferencesListener — outer } will be discarded
-        parser.setListener(pInitialListener);
+        json_parser().setListener(pInitialListener);
     }
 
     void endDocument() override {}
@@ -296,9 +395,7 @@ public:
         ++_level;
         if (_level == 1) {
             // Entering the root preferences.json object — start with a clean macros list
-            macroMenu.removeAllItems();
-            for (auto* m : macros) delete m;
-            macros.clear();
+            clear_macro_list();
         }
         // Clear per-macro fields so a missing key can't bleed from the previous object
         if (_in_macros_section) {
@@ -356,8 +453,7 @@ public:
                 return;
             }
             if (!_name.empty()) {
-                macroMenu.addItem(new MacroItem { _name.c_str(), _filename });
-                macros.push_back(new Macro { _name, _filename, _target });
+                add_macro(_name, _filename, _target);
             }
             return;
         }
@@ -367,7 +463,7 @@ public:
             // preferences.json document fully parsed — deliver if we found macros,
             // otherwise fall back to the legacy macrocfg.json file.
             if (!macros.empty()) {
-                current_scene->onFilesList();
+                macros_done();
             } else {
                 schedule_action(request_macro_list_wu3);
             }
@@ -376,7 +472,7 @@ public:
             // (g_json_accumulating is now false) so initialListener.endObject()
             // never fires and parser_needs_reset stays false, corrupting the next request.
             parser_needs_reset = true;
-            parser.setListener(pInitialListener);
+            json_parser().setListener(pInitialListener);
         }
     }
 
@@ -418,9 +514,9 @@ void try_next_macro_file(JsonListener* listener) {
     if (listener == &macrocfgListener) {
         // macrocfg.json also failed — deliver what we have or report error
         if (!macros.empty()) {
-            current_scene->onFilesList();
+            macros_done();
         } else {
-            current_scene->onError("No Macros");
+            macros_failed();
         }
     }
 }
@@ -430,21 +526,16 @@ void request_macros() {
 
 #ifdef USE_WIFI
 #include "WiFiConnection.h"   // wifi_http_get()
+#include "NetWorker.h"
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
 
-static void clear_macro_list() {
-    macroMenu.removeAllItems();
-    for (auto* m : macros) delete m;
-    macros.clear();
-}
-
-// Fetch macros over HTTP (not the WebSocket) on a short-lived task.  FluidNC's
+// Fetch macros over HTTP (not the WebSocket) on the network worker.  FluidNC's
 // WebUI fetches files this way; it's reliable for the large preferences.json
 // that truncates/disconnects over the WebSocket's $File/SendJSON path.  The
 // HTTP body is the RAW file (no [JSON:]/envelope), so we feed it straight to
 // the macro listeners.  g_http_macros_mode makes the listeners only populate;
-// THIS task decides onFilesList()/onError() and the legacy fallback.
+// THIS job decides onFilesList()/onError() and the legacy fallback.
 // Fetch one JSON file over HTTP and parse it with `listener`, retrying the
 // whole GET a few times.  The HTTP connect intermittently fails or stalls when
 // FluidNC is busy servicing the WebSocket on the same port 80 — that race is
@@ -457,7 +548,7 @@ static void clear_macro_list() {
 volatile bool g_macros_http_served = false;
 
 static bool http_fetch_macros(const char* path, JsonListener* listener) {
-    for (int attempt = 0; attempt < 3 && macros.empty(); attempt++) {
+    for (int attempt = 0; attempt < 3 && macros.empty() && !net_job_should_stop(); attempt++) {
         if (attempt) {
             clear_macro_list();        // discard any partial parse from the failed try
             vTaskDelay(pdMS_TO_TICKS(400));   // give FluidNC time to free the socket
@@ -476,15 +567,17 @@ static bool http_fetch_macros(const char* path, JsonListener* listener) {
     return !macros.empty();
 }
 
-// Guards against a second fetch task spawning while one is already running
-// (rapid Refresh taps, or leaving and re-entering the Macros screen during the
-// multi-second retry window).  Two tasks would race on the shared `macros`
-// vector (one delete()s a Macro* the other dereferences) and fight over the
-// WS suspend/resume.  Set on the comms/UI thread before xTaskCreate; cleared by
-// the task as it exits.
+// Guards against a second fetch being queued while one is pending (rapid
+// Refresh taps, or leaving and re-entering the Macros screen during the
+// multi-second retry window).  Two fetches would race on the shared `macros`
+// vector and fight over the WS suspend/resume.  Set by the caller before
+// net_submit(); cleared by the completion.
 static volatile bool g_macros_fetch_active = false;
 
-static void fetch_macros_http_task(void* /*arg*/) {
+// Inside the macros screen's 35 s loading deadline.
+#define MACROS_FETCH_DEADLINE_MS 30000
+
+static bool fetch_macros_http_job(void* /*ctx*/) {
     g_http_macros_mode   = true;
     g_macros_http_served = false;
     clear_macro_list();
@@ -499,29 +592,32 @@ static void fetch_macros_http_task(void* /*arg*/) {
 
     // WebUI3 stores macros in preferences.json (settings.macros[]); fall back to
     // the legacy macrocfg.json (flat array) if preferences.json yields none.
-    if (!http_fetch_macros("/preferences.json", &preferencesListener)) {
+    if (!http_fetch_macros("/preferences.json", &preferencesListener) && !net_job_should_stop()) {
         clear_macro_list();
         http_fetch_macros("/macrocfg.json", &macrocfgListener);
     }
 
     wifi_ws_resume();   // hand the socket back to Core 0
     g_http_macros_mode = false;
+    return !macros.empty();
+}
+
+static void fetch_macros_http_done(void* /*ctx*/, NetJobResult result) {
     // ALWAYS deliver a terminal callback so the macros screen's "Loading…"
-    // clears — onFilesList() on success, onError() otherwise.
-    if (!macros.empty()) current_scene->onFilesList();
-    else                 current_scene->onError("No Macros");
+    // clears — onFilesList() on success, onError() otherwise (including a
+    // fetch that expired before the worker got to it).
+    if (result == NET_DONE) macros_done();
+    else                    macros_failed();
     g_macros_fetch_active = false;   // allow the next fetch
-    vTaskDelete(nullptr);
 }
 
 void request_macros_http() {
-    // Re-entrancy guard: ignore if a fetch is already running (see flag above).
+    // Re-entrancy guard: ignore if a fetch is already pending (see flag above).
     if (g_macros_fetch_active) return;
     g_macros_fetch_active = true;
-    // Generous stack: WiFiClient + a JsonStreamingParser instance.
-    if (xTaskCreate(fetch_macros_http_task, "macros_http", 16384,
-                    nullptr, 1, nullptr) != pdPASS) {
-        g_macros_fetch_active = false;   // spawn failed — don't latch the guard
+    if (!net_submit(NET_JOB_HTTP, fetch_macros_http_job, nullptr,
+                    MACROS_FETCH_DEADLINE_MS, fetch_macros_http_done)) {
+        g_macros_fetch_active = false;   // queue full — don't latch the guard
     }
 }
 #endif  // USE_WIFI
@@ -554,7 +650,7 @@ public:
             init_macro_parser();
             return;
         }
-        fileLines.clear();
+        _lines.clear();
         _in_array = true;
     }
     void endArray() override {
@@ -563,7 +659,7 @@ public:
             delete macro_parser;
             macro_parser = nullptr;
             g_json_accumulating = false;
-            parser.setListener(pInitialListener);
+            json_parser().setListener(pInitialListener);
         }
         // init_listener();
     }
@@ -583,7 +679,7 @@ public:
             return;
         }
         if (_in_array) {
-            fileLines.push_back(value);
+            _lines.push_back(value);
         }
         if (_key_is_firstline) {
             fileFirstLine = atoi(value);
@@ -591,8 +687,9 @@ public:
     }
 
     void endObject() override {
-        parser.setListener(pInitialListener);
-        current_scene->onFileLines(fileFirstLine, fileLines);
+        json_parser().setListener(pInitialListener);
+        publish_lines();
+        notify_file_lines(fileFirstLine, fileLines);  // adopted before the scene sees it
     }
     void endDocument() override {}
 } fileLinesListener;
@@ -661,7 +758,7 @@ public:
                 _status = value;
                 break;
             case ERROR:
-                current_scene->onError(value);
+                notify_error(value);
                 break;
         }
         _key = NONE;
@@ -683,16 +780,16 @@ public:
     void key(const char* key) override {
         // Keys whose value is handled by a different listener
         if (strcmp(key, "files") == 0) {
-            parser.setListener(&filesListListener);
+            json_parser().setListener(&filesListListener);
             return;
         }
         if (strcmp(key, "file_lines") == 0) {
-            parser.setListener(&fileLinesListener);
+            json_parser().setListener(&fileLinesListener);
             return;
         }
         if (strcmp(key, "result") == 0) {
             if (_file_listener) {
-                parser.setListener(_file_listener);
+                json_parser().setListener(_file_listener);
                 g_json_accumulating = true;  // subsequent raw lines come via handle_other
             }
             return;
@@ -726,8 +823,10 @@ JsonListener* pInitialListener = &initialListener;
 
 void init_listener() {
     g_json_accumulating = false;
-    parser.setListener(pInitialListener);
-    parser_needs_reset = true;
+    if (_parser) {
+        _parser->setListener(pInitialListener);
+    }
+    parser_needs_reset = true;  // handle_json() sets the listener on a new parser
 }
 
 void request_file_list(const char* dirname) {
@@ -741,7 +840,9 @@ void request_file_list(const char* dirname) {
 void init_file_list() {
     init_listener();
     request_file_list("/sd");
-    parser.reset();
+    if (_parser) {
+        _parser->reset();
+    }
 }
 
 void request_file_preview(const char* name, int firstline, int nlines) {
@@ -752,9 +853,16 @@ void request_file_preview(const char* name, int firstline, int nlines) {
 }
 
 void parser_parse_line(const char* line) {
-    char c;
+    JsonStreamingParser& p = json_parser();
+    char                 c;
     while ((c = *line++) != '\0') {
-        parser.parse(c);
+        p.parse(c);
+    }
+    // Document finished and nothing continuing it: the next handle_json()
+    // would reset the parser anyway, so give the memory back now.
+    if (parser_needs_reset && !g_json_accumulating) {
+        delete _parser;
+        _parser = nullptr;
     }
 }
 
@@ -778,8 +886,8 @@ void parser_parse_line(const char* line) {
 extern "C" void handle_json(const char* line) {
     if (parser_needs_reset) {
         parser_needs_reset = false;
-        parser.setListener(pInitialListener);
-        parser.reset();
+        json_parser().setListener(pInitialListener);
+        _parser->reset();
     }
     parser_parse_line(line);
 }
@@ -827,11 +935,14 @@ void handle_radio_mode(char* command, char* arguments) {
     wifi_mode = value;
     if (strcmp(value, "No Wifi") != 0) {
         parse_wifi(arguments);
-        current_scene->reDisplay();
+        notify_redisplay();
     }
 }
 
 extern "C" void handle_msg(char* command, char* arguments) {
+    if (strcmp(command, "JSON") != 0) {  // file listings aren't messages
+        con_logf(CON_MSG, *arguments ? "[MSG:%s:%s]" : "[MSG:%s]", command, arguments);
+    }
     if (strcmp(command, "Homed") == 0) {
         char c;
         while ((c = *arguments++) != '\0') {
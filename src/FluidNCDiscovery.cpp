@@ -0,0 +1,370 @@
+// Copyright (c) 2026 — FluidDial-CYD
+// Use of this source code is governed by a GPLv3 license.
+
+// FluidNC discovery and its cache.  See FluidNCDiscovery.h.
+
+#include "FluidNCDiscovery.h"
+
+#if defined(USE_WIFI) && defined(ARDUINO)
+
+#include "NetWorker.h"
+#include "System.h"  // dbg_printf
+#include "WiFiConnection.h"
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <Preferences.h>
+#include <mdns.h>
+#include <lwip/sockets.h>
+#include <freertos/FreeRTOS.h>
+#include <errno.h>
+
+#define DISC_PREFS "fncdisc"
+
+static portMUX_TYPE _discMux = portMUX_INITIALIZER_UNLOCKED;
+#define DISC_LOCK()   portENTER_CRITICAL(&_discMux)
+#define DISC_UNLOCK() portEXIT_CRITICAL(&_discMux)
+
+static FncHost           _hosts[DISC_MAX];
+static int               _count   = 0;
+static FncHost           _last    = {};
+static volatile bool     _running = false;
+static volatile uint32_t _rounds  = 0;
+static volatile uint32_t _lastMs  = 0;
+static bool              _probe   = false;  // the queued round may port-probe
+
+// ── mDNS ─────────────────────────────────────────────────────────────────────
+
+// A bare mdns_init() is enough for queries; the pendant doesn't advertise
+// itself (see wifi_poll()).  ESP_ERR_INVALID_STATE means already initialised.
+bool disc_mdns_ready() {
+    static bool _inited = false;
+    if (!_inited) {
+        esp_err_t e = mdns_init();
+        _inited     = (e == ESP_OK || e == ESP_ERR_INVALID_STATE);
+        dbg_printf("mdns_init: err=%d (%s)\n", (int)e, esp_err_to_name(e));
+    }
+    return _inited;
+}
+
+// ── Cache ────────────────────────────────────────────────────────────────────
+
+static void saveCache() {
+    FncHost hosts[DISC_MAX];
+    FncHost last;
+    DISC_LOCK();
+    int n = _count;
+    memcpy(hosts, _hosts, sizeof(hosts));
+    last = _last;
+    DISC_UNLOCK();
+
+    Preferences prefs;
+    prefs.begin(DISC_PREFS, false);
+    prefs.putUChar("count", (uint8_t)n);
+    if (n) {
+        prefs.putBytes("hosts", hosts, n * sizeof(FncHost));
+    } else {
+        prefs.remove("hosts");
+    }
+    prefs.putBytes("last", &last, sizeof(last));
+    prefs.end();
+}
+
+void disc_load() {
+    Preferences prefs;
+    prefs.begin(DISC_PREFS, true);
+    int n = prefs.getUChar("count", 0);
+    if (n > DISC_MAX) n = 0;
+    // A size mismatch means FncHost changed: start empty.
+    if (n && prefs.getBytesLength("hosts") == n * sizeof(FncHost)) {
+        prefs.getBytes("hosts", _hosts, n * sizeof(FncHost));
+        _count = n;
+    }
+    if (prefs.getBytesLength("last") == sizeof(FncHost)) {
+        prefs.getBytes("last", &_last, sizeof(_last));
+    }
+    prefs.end();
+    for (int i = 0; i < _count; i++) {
+        _hosts[i].name[DISC_NAME_MAX - 1] = '\0';
+        _hosts[i].ip[sizeof(_hosts[i].ip) - 1] = '\0';
+    }
+    _last.name[DISC_NAME_MAX - 1] = '\0';
+    _last.ip[sizeof(_last.ip) - 1] = '\0';
+    dbg_printf("Discovery: %d cached, last '%s' %s\n", _count, _last.name, _last.ip);
+}
+
+int disc_hosts(FncHost* out, int max) {
+    DISC_LOCK();
+    int n = _count < max ? _count : max;
+    memcpy(out, _hosts, n * sizeof(FncHost));
+    DISC_UNLOCK();
+    return n;
+}
+
+bool disc_find(const char* name, FncHost& out) {
+    bool found = false;
+    DISC_LOCK();
+    for (int i = 0; i < _count && !found; i++) {
+        if (strcasecmp(_hosts[i].name, name) == 0) {
+            out   = _hosts[i];
+            found = true;
+        }
+    }
+    DISC_UNLOCK();
+    return found;
+}
+
+bool disc_last_used(FncHost& out) {
+    DISC_LOCK();
+    out = _last;
+    DISC_UNLOCK();
+    return out.ip[0] != '\0';
+}
+
+void disc_note_connected(const char* ip) {
+    FncHost last = {};
+    strlcpy(last.ip, ip, sizeof(last.ip));
+    last.port = 80;
+    DISC_LOCK();
+    for (int i = 0; i < _count; i++) {
+        if (strcmp(_hosts[i].ip, ip) == 0) {
+            last = _hosts[i];
+            break;
+        }
+    }
+    // Same controller at the same address: keep the name learned earlier.
+    if (!last.name[0] && strcmp(_last.ip, ip) == 0) strlcpy(last.name, _last.name, sizeof(last.name));
+    last.age      = 0;
+    bool changed  = strcmp(last.ip, _last.ip) != 0 || strcmp(last.name, _last.name) != 0;
+    _last         = last;
+    DISC_UNLOCK();
+    if (changed) saveCache();
+}
+
+uint32_t disc_rounds() {
+    return _rounds;
+}
+
+uint32_t disc_last_ms() {
+    return _lastMs;
+}
+
+bool disc_running() {
+    return _running;
+}
+
+// ── Round ────────────────────────────────────────────────────────────────────
+
+struct Found {
+    FncHost hosts[DISC_MAX];
+    int     count;
+};
+
+static void addFound(Found& f, const char* name, const char* ip, uint16_t port, bool mdns) {
+    for (int i = 0; i < f.count; i++) {
+        if (strcmp(f.hosts[i].ip, ip) == 0) return;
+    }
+    if (f.count == DISC_MAX) return;
+    FncHost& h = f.hosts[f.count++];
+    h          = {};
+    strlcpy(h.name, name, sizeof(h.name));
+    strlcpy(h.ip, ip, sizeof(h.ip));
+    h.port = port;
+    h.mdns = mdns;
+}
+
+// GET [ESP800] and check the reply is FluidNC's; fills `name` from its
+// "hostname:" field when there is one.
+static bool verifyFluidNC(const char* ip, uint16_t port, char* name, size_t nameLen) {
+    IPAddress  addr;
+    WiFiClient client;
+    if (!addr.fromString(ip) || !client.connect(addr, port, DISC_VERIFY_MS)) return false;
+    client.printf("GET /command?plain=%%5BESP800%%5D HTTP/1.1\r\nHost: %s\r\nConnection: close\r\n\r\n", ip);
+
+    char     buf[640];
+    size_t   len      = 0;
+    uint32_t deadline = millis() + DISC_VERIFY_MS;
+    while (len < sizeof(buf) - 1 && (int32_t)(millis() - deadline) < 0 && !net_job_should_stop()) {
+        int n = client.available();
+        if (n > 0) {
+            len += client.read((uint8_t*)buf + len, min((size_t)n, sizeof(buf) - 1 - len));
+        } else if (!client.connected()) {
+            break;
+        } else {
+            delay(10);
+        }
+    }
+    client.stop();
+    buf[len] = '\0';
+    if (!strstr(buf, "FluidNC")) return false;
+
+    const char* h = strstr(buf, "hostname:");
+    if (h && name) {
+        h += strlen("hostname:");
+        size_t n = 0;
+        while (h[n] && h[n] != ' ' && h[n] != '#' && h[n] != '\r' && h[n] != '\n' && n < nameLen - 1) {
+            name[n] = h[n];
+            n++;
+        }
+        name[n] = '\0';
+    }
+    return true;
+}
+
+static void browseMdns(Found& f) {
+    if (!disc_mdns_ready()) return;
+    mdns_result_t* results = nullptr;
+    esp_err_t      err     = mdns_query_ptr("_http", "_tcp", DISC_MDNS_MS, 8, &results);
+    if (err != ESP_OK) {
+        dbg_printf("Discovery: mDNS browse err=%d\n", (int)err);
+        return;
+    }
+    for (mdns_result_t* r = results; r && !net_job_should_stop(); r = r->next) {
+        for (mdns_ip_addr_t* a = r->addr; a; a = a->next) {
+            if (a->addr.type != ESP_IPADDR_TYPE_V4) continue;
+            char ip[16];
+            IPAddress(a->addr.u_addr.ip4.addr).toString().toCharArray(ip, sizeof(ip));
+            char     name[DISC_NAME_MAX] = "";
+            uint16_t port                = r->port ? r->port : 80;
+            if (r->hostname) strlcpy(name, r->hostname, sizeof(name));
+            // The controller the link is up to is known to be FluidNC, and an
+            // HTTP request alongside its WebSocket can stall (see wifi_ws_suspend()).
+            FncHost last;
+            bool    linked = websocket_is_connected() && disc_last_used(last) && strcmp(last.ip, ip) == 0;
+            if (linked || verifyFluidNC(ip, port, name, sizeof(name))) addFound(f, name, ip, port, true);
+            break;  // one address per host
+        }
+    }
+    mdns_query_results_free(results);
+}
+
+// Connect-probes port 80 on every other host of the local /24, a batch of
+// non-blocking sockets at a time, then verifies the ones that accepted.
+static void probeSubnet(Found& f) {
+    IPAddress self = WiFi.localIP();
+    uint8_t   open[254];
+    int       nOpen = 0;
+
+    for (int first = 1; first < 255 && !net_job_should_stop(); first += DISC_PROBE_BATCH) {
+        int    fds[DISC_PROBE_BATCH];
+        int    hostOf[DISC_PROBE_BATCH];
+        int    n     = 0;
+        int    maxFd = -1;
+        fd_set pending;
+        FD_ZERO(&pending);
+        for (int h = first; h < first + DISC_PROBE_BATCH && h < 255; h++) {
+            if (h == self[3]) continue;
+            int s = socket(AF_INET, SOCK_STREAM, 0);
+            if (s < 0) break;
+            fcntl(s, F_SETFL, fcntl(s, F_GETFL, 0) | O_NONBLOCK);
+            sockaddr_in sa     = {};
+            sa.sin_family      = AF_INET;
+            sa.sin_port        = htons(80);
+            sa.sin_addr.s_addr = (uint32_t)IPAddress(self[0], self[1], self[2], h);
+            if (connect(s, (sockaddr*)&sa, sizeof(sa)) < 0 && errno != EINPROGRESS) {
+                close(s);
+                continue;
+            }
+            fds[n]    = s;
+            hostOf[n] = h;
+            n++;
+            FD_SET(s, &pending);
+            if (s > maxFd) maxFd = s;
+        }
+
+        uint32_t deadline = millis() + DISC_PROBE_MS;
+        int      left     = n;
+        while (left && (int32_t)(millis() - deadline) < 0) {
+            fd_set   wset = pending;
+            uint32_t wait = deadline - millis();
+            timeval  tv   = { 0, (long)(wait * 1000) };
+            if (select(maxFd + 1, nullptr, &wset, nullptr, &tv) <= 0) break;
+            for (int i = 0; i < n; i++) {
+                if (!FD_ISSET(fds[i], &wset)) continue;
+                int       err = 0;
+                socklen_t el  = sizeof(err);
+                getsockopt(fds[i], SOL_SOCKET, SO_ERROR, &err, &el);
+                if (err == 0) open[nOpen++] = (uint8_t)hostOf[i];
+                FD_CLR(fds[i], &pending);
+                left--;
+            }
+        }
+        for (int i = 0; i < n; i++) {
+            close(fds[i]);
+        }
+    }
+
+    dbg_printf("Discovery: %d host(s) with port 80 open\n", nOpen);
+    for (int i = 0; i < nOpen && !net_job_should_stop(); i++) {
+        char ip[16];
+        IPAddress(self[0], self[1], self[2], open[i]).toString().toCharArray(ip, sizeof(ip));
+        char name[DISC_NAME_MAX] = "";
+        if (verifyFluidNC(ip, 80, name, sizeof(name))) addFound(f, name, ip, 80, false);
+    }
+}
+
+// Seen hosts move to the front with age 0; the rest age by one round and
+// drop out after DISC_TTL_ROUNDS.
+static void merge(const Found& f) {
+    FncHost merged[DISC_MAX];
+    int     n = 0;
+    for (int i = 0; i < f.count; i++) {
+        merged[n++] = f.hosts[i];
+    }
+    DISC_LOCK();
+    for (int i = 0; i < _count && n < DISC_MAX; i++) {
+        FncHost h    = _hosts[i];
+        bool    seen = false;
+        for (int j = 0; j < f.count && !seen; j++) {
+            seen = strcmp(f.hosts[j].ip, h.ip) == 0 || (h.name[0] && strcasecmp(f.hosts[j].name, h.name) == 0);
+        }
+        if (seen || ++h.age > DISC_TTL_ROUNDS) continue;
+        merged[n++] = h;
+    }
+    memcpy(_hosts, merged, n * sizeof(FncHost));
+    _count = n;
+    // The last-used controller connected by address before a round named it.
+    for (int i = 0; i < f.count && !_last.name[0]; i++) {
+        if (strcmp(f.hosts[i].ip, _last.ip) == 0) strlcpy(_last.name, f.hosts[i].name, sizeof(_last.name));
+    }
+    DISC_UNLOCK();
+}
+
+static bool discoverJob(void* /*ctx*/) {
+    if (WiFi.status() != WL_CONNECTED) return false;
+    Found f = {};
+    browseMdns(f);
+    // Probing a whole /24 ties up the worker for seconds; a pendant that is
+    // already talking to its controller doesn't need it.
+    if (!f.count && _probe && !websocket_is_connected() && !net_job_should_stop()) probeSubnet(f);
+    if (net_job_should_stop()) return false;
+
+    dbg_printf("Discovery: %d FluidNC controller(s)\n", f.count);
+    for (int i = 0; i < f.count; i++) {
+        dbg_printf("  %s %s:%u %s\n", f.hosts[i].name, f.hosts[i].ip, f.hosts[i].port, f.hosts[i].mdns ? "mdns" : "probe");
+    }
+    merge(f);
+    saveCache();
+    return true;
+}
+
+static void discoverDone(void* /*ctx*/, NetJobResult result) {
+    if (result == NET_DONE) {
+        _lastMs = millis();
+        _rounds = _rounds + 1;
+    }
+    _running = false;
+}
+
+bool disc_start(bool probe) {
+    if (_running) return false;
+    _running = true;
+    _probe   = probe;
+    if (!net_submit(NET_JOB_DISCOVER, discoverJob, nullptr, DISC_DEADLINE_MS, discoverDone)) {
+        _running = false;
+        return false;
+    }
+    return true;
+}
+
+#endif  // USE_WIFI && ARDUINO
@@ -0,0 +1,71 @@
+// Copyright (c) 2026 — FluidDial-CYD
+// Use of this source code is governed by a GPLv3 license.
+
+#pragma once
+
+// ── FluidNC discovery ────────────────────────────────────────────────────────
+//
+// Finds FluidNC controllers on the LAN so a replaced controller or a new DHCP
+// lease doesn't mean re-entering the address in the setup portal.
+//
+// A discovery round runs as one job on the network worker:
+//   1. mDNS: browse _http._tcp (FluidNC advertises its WebUI there) and
+//      check each answer with [ESP800], which a FluidNC WebUI answers with
+//      "FW version: FluidNC … # hostname:<name>".  Other web servers on the
+//      LAN fail the check and are ignored.
+//   2. Fallback, only when mDNS found nothing and the pendant has no link:
+//      a TCP connect probe of port 80 across the local /24, DISC_PROBE_BATCH
+//      non-blocking sockets at a time, with the same [ESP800] check on every
+//      host that accepts.
+//
+// Results are kept in a small table cached in NVS ("fncdisc").  The pendant
+// has no wall clock, so an entry's TTL counts discovery rounds: one not seen
+// for DISC_TTL_ROUNDS rounds is dropped.  The controller the WebSocket last
+// connected to is remembered by name and address, so at the next boot it is
+// connected immediately while a round refreshes the table in the background;
+// WiFiConnection moves to the new address if it has changed.
+//
+// The table is read from Core 0 (wifi_poll) and Core 1 (the WiFi setup
+// screen) under a lock; only the worker writes it.  scripts/fake_fluidnc.py
+// is a stand-in controller (mDNS answer + [ESP800]) for trying this without
+// a machine on the bench.
+
+#ifdef USE_WIFI
+
+#include <stdint.h>
+
+#define DISC_MAX          6     // controllers kept
+#define DISC_NAME_MAX     32
+#define DISC_TTL_ROUNDS   8
+#define DISC_MDNS_MS      1500  // mDNS browse window
+#define DISC_VERIFY_MS    1200  // connect + [ESP800] reply, per candidate
+#define DISC_PROBE_MS     300   // connect window per probe batch
+#define DISC_PROBE_BATCH  8     // sockets; lwIP allows 16 and the link holds one
+#define DISC_DEADLINE_MS  25000
+
+struct FncHost {
+    char     name[DISC_NAME_MAX];  // FluidNC hostname, without ".local"
+    char     ip[16];
+    uint16_t port;                 // WebUI / WebSocket port
+    uint8_t  age;                  // rounds since last seen
+    bool     mdns;                 // found by mDNS (else by the port probe)
+};
+
+void disc_load();  // wifi_init(): restore the cache and the last-used host
+
+// Queue a round on the network worker.  `probe` allows the port-probe
+// fallback.  False if a round is already queued or running, or the queue is full.
+bool     disc_start(bool probe);
+bool     disc_running();
+uint32_t disc_rounds();   // rounds completed this boot
+uint32_t disc_last_ms();  // millis() when the last one completed
+
+int  disc_hosts(FncHost* out, int max);                  // most recently seen first
+bool disc_find(const char* name, FncHost& out);          // by name, case-insensitive
+bool disc_last_used(FncHost& out);                       // false before a first connect
+void disc_note_connected(const char* ip);                // WebSocket came up to `ip`
+
+// One mDNS stack for hostname lookups and discovery.  Idempotent.
+bool disc_mdns_ready();
+
+#endif  // USE_WIFI
@@ -11,6 +11,11 @@
 #include "Scene.h"
 #include "e4math.h"
 #include "HomingScene.h"
+#include "LinkRtt.h"
+#include "CommandQueue.h"
+#include "OverridePlanner.h"
+#include "WcsOffsets.h"
+#include "ConsoleLog.h"
 
 extern Scene statusScene;
 
@@ -36,6 +41,7 @@ std::string myModes = "no data";
 
 int      lastAlarm = 0;
 int      lastError = 0;
+char     lastErrorLine[64] = "";
 bool     inInches  = false;
 uint32_t errorExpire;
 
@@ -86,6 +92,10 @@ void set_disconnected_state() {
     // x1/a1.  (The next request sets parser_needs_reset itself.)
     g_expecting_json    = false;
     g_json_accumulating = false;
+    link_rtt_reset();
+    cmd_reset();
+    ovr_reset();
+    wcs_reset();
 }
 
 // clang-format off
@@ -117,6 +127,7 @@ const char* decode_error_number(int error_num) {
 }
 
 extern "C" void begin_status_report() {
+    link_rtt_probe_answered();
     myPercent = 0;
     myFileBuffer[0] = '\0';  // clear filename each status cycle; show_file repopulates if running
 }
@@ -134,6 +145,7 @@ extern "C" void show_file(const char* filename, file_percent_t percent) {
 extern "C" void show_overrides(override_percent_t feed_ovr, override_percent_t rapid_ovr, override_percent_t spindle_ovr) {
     myFro = feed_ovr;
     mySro = spindle_ovr;
+    ovr_reported(feed_ovr, spindle_ovr);
 }
 
 extern "C" void show_feed_spindle(uint32_t feedrate, uint32_t spindle_speed) {
@@ -161,6 +173,7 @@ volatile bool    g_calAllOk        = true;
 volatile int32_t g_calProbeXe4[8]  = { 0 };
 
 extern "C" void show_probe(const pos_t* axes, const bool probe_success, size_t n_axis) {
+    wcs_note_probe();  // a probe routine usually zeroes a WCS next
     if (!g_calCapture) return;
     if (!probe_success) g_calAllOk = false;
     if (g_calCount < 8 && n_axis > 0) {
@@ -248,33 +261,28 @@ void txLineUnlock() {
     if (_txLineMutex) xSemaphoreGiveRecursive(_txLineMutex);
 }
 
-void send_line(const char* s, int timeout) {
-    bool locked = txLineLock();
-    fnc_send_line(s, timeout);
-    if (locked) txLineUnlock();
-    dbg_println(s);
+// Queued, never waits: the line goes out as soon as the in-flight window has
+// room (CommandQueue.h).  Callers that care how it ended use cmd_submit().
+void send_line(const char* s) {
+    wcs_note_line(s);
+    cmd_submit(s);
 }
 
-// See FluidNCModel.h for the full rationale.  Sends the bytes directly via
-// the comms transport without touching fnc_send_line's _ackwait state so
-// callers can fire commands back-to-back without serializing on round-trip
-// latency.  Suitable for queued commands (jog, realtime overrides) where
-// FluidNC's planner / parser handles ordering and acks come asynchronously.
+// See FluidNCModel.h for the full rationale.  Goes through the command
+// queue behind any earlier lines, but once at the head it doesn't wait for
+// window room, so callers can fire commands back-to-back.  Suitable for
+// queued commands (jog, realtime overrides) where FluidNC's planner / parser
+// handles ordering and acks come asynchronously.
 //
 // Increments pending_nowait_sends so callers can implement their own
 // flow control (eg. jog handler skips events when the counter is high).
 void send_line_nowait(const char* s) {
-    bool locked = txLineLock();   // push the whole line atomically (no interleave)
-    const char* p = s;
-    while (*p) {
-        fnc_putchar((uint8_t)*p);
-        ++p;
+    wcs_note_line(s);
+    if (!cmd_submit_nowait(s)) {
+        return;  // queue full; logged there
     }
-    fnc_putchar('\n');
-    if (locked) txLineUnlock();
     pending_nowait_sends++;
     _last_nowait_activity = milliseconds();   // freshen the decay watchdog
-    dbg_println(s);
 }
 
 static void vsend_linef(const char* fmt, va_list va) {
@@ -289,11 +297,12 @@ void send_linef(const char* fmt, ...) {
     va_end(args);
 }
 
-// Non-blocking formatted send.  Same as send_linef() but routes through
-// send_line_nowait(), which does NOT spin on fnc_send_line's ack-wait.
+// Formatted send_line_nowait().  Goes out in order, without waiting for
+// window room.
 //
 // Used for file-list / macro / preview requests.  Those are issued from
-// scheduled actions that run on Core 1 (the UI loop).  fnc_send_line() begins
+// scheduled actions that run on Core 1 (the UI loop).  Historically
+// send_line() went through fnc_send_line(), which began
 // by spinning until the PREVIOUS command's "ok" arrives — and on Core 1
 // fnc_getchar() is gated to return nothing, so that spin can only end when
 // Core 0 happens to clear _ackwait or the (1 s) timeout expires.  If an "ok"
@@ -358,7 +367,7 @@ extern "C" void show_state(const char* state_string) {
         }
         state = new_state;
         if (state == Alarm && lastAlarm == 0) {  // alarm code not yet known
-            send_line("$A");                     // fetch the alarm code (async)
+            send_line("$A");                     // fetch the alarm code
             awaiting_alarm = true;
             // Do NOT return here.  Fall through to act_on_state_change() so the
             // pendant reflects the Alarm state IMMEDIATELY.  Previously we
@@ -375,6 +384,15 @@ extern "C" void show_state(const char* state_string) {
 }
 
 extern "C" void handle_other(char* line) {
+    // "Grbl 3.x [FluidNC v… ('$' for help)]": the controller restarted (a
+    // reset from anywhere — the WebUI, its own panic), so whatever it had
+    // buffered is gone and must not be waited for.
+    if (strncmp(line, "Grbl ", 5) == 0 && strstr(line, "FluidNC")) {
+        cmd_abort();
+        g_expecting_json    = false;
+        g_json_accumulating = false;
+    }
+
     // Multi-line JSON responses from $File/SendJSON: only the first line is wrapped in
     // [JSON:...]; subsequent content lines arrive here as bare text.  Route them back
     // into the streaming JSON parser while accumulation is active.
@@ -395,10 +413,19 @@ extern "C" void handle_other(char* line) {
         return;
     }
 
+    // The MDI screen is waiting on a reply ("$$", "$#", "$I", …): show it
+    // there too.  The line still goes through the parsers below.
+    if (con_capturing_replies()) {
+        con_log(CON_REPLY, line);
+    }
+
     if (*line == '$') {
         parse_dollar(line);
         return;
     }
+    if (wcs_parse_line(line)) {  // "$#" reply: [G54:...], [TLO:...]
+        return;
+    }
     int alarmlen = strlen("Active alarm: ");
     if (strncmp(line, "Active alarm: ", alarmlen) == 0) {
         lastAlarm = atoi(line + alarmlen);
@@ -411,9 +438,15 @@ extern "C" void handle_other(char* line) {
 }
 
 extern "C" void show_error(int error) {
+    // FluidNC answers lines in order, so the oldest one in flight is the one
+    // that failed.
+    cmd_acked(error, lastErrorLine, sizeof(lastErrorLine));
+    if (*lastErrorLine) {
+        dbg_printf("error:%d (%s) from \"%s\"\n", error, decode_error_number(error), lastErrorLine);
+    }
     errorExpire = milliseconds() + 1000;
     lastError   = error;
-    current_scene->reDisplay();
+    notify_redisplay();
 
     // If a file/macro request got an "error:" reply instead of JSON (eg.
     // $File/SendJSON returning IdleError when the machine isn't Idle/Alarm),
@@ -435,6 +468,7 @@ extern "C" void show_error(int error) {
     if (pending_nowait_sends > 0) {
         --pending_nowait_sends;
     }
+    link_rtt_line_acked();
 }
 
 extern "C" void show_timeout() {
@@ -442,10 +476,12 @@ extern "C" void show_timeout() {
 }
 
 extern "C" void show_ok() {
+    cmd_acked(0, nullptr, 0);
     _last_nowait_activity = milliseconds();
     if (pending_nowait_sends > 0) {
         --pending_nowait_sends;
     }
+    link_rtt_line_acked();
 }
 
 // Self-healing decay for pending_nowait_sends.  Call periodically from a
@@ -468,18 +504,18 @@ void nowait_pending_decay() {
         return;
     }
     if ((milliseconds() - _last_nowait_activity) >= 1000) {
-        --pending_nowait_sends;
+        --pending_nowait_sends;  // the send time is the command queue's to expire (cmd_poll)
         _last_nowait_activity = milliseconds();
     }
 }
 
 extern "C" void end_status_report() {
-    current_scene->onDROChange();
+    notify_dro_change();
 }
 
 extern "C" void show_alarm(int alarm) {
     lastAlarm = alarm;
-    current_scene->reDisplay();
+    notify_redisplay();
 }
 
 extern "C" void show_gcode_modes(struct gcode_modes* modes) {
@@ -500,46 +536,58 @@ extern "C" void show_gcode_modes(struct gcode_modes* modes) {
     }
 
     mySelectedTool = modes->tool;
-    current_scene->reDisplay();
+    notify_redisplay();
 }
 
-int disconnect_ms = 0;
-int next_ping_ms  = 0;
-
-// If we haven't heard from FluidNC in 4 seconds for some other reason,
-// send a status report request.
-const int ping_interval_ms = 4000;
-
-// If we haven't heard from FluidNC in 6 seconds for any reason, declare
-// FluidNC unresponsive.  After a ping, FluidNC has 2 seconds to respond.
-const int disconnect_interval_ms = 6000;
+// Link liveness, TCP style.  After link_probe_interval_ms() of RX silence a
+// '?' goes out; if nothing at all comes back within link_probe_timeout_ms() it
+// is re-sent with the timeout doubled, and after LINK_PROBE_RETRIES unanswered
+// re-sends the link is declared lost.  Both intervals follow the measured
+// status round trip (LinkRtt.h); until there are enough samples they stay
+// close to the old fixed 4 s ping / 6 s disconnect.  While lost, a probe still goes out
+// every link_probe_interval_ms() so the first reply brings the link back.
+static volatile int last_rx_ms  = 0;
+static int          probe_ms    = 0;  // when the outstanding probe went out
+static int          probe_tries = 0;  // 0 = none outstanding
 
 bool starting = true;
 
 void request_status_report() {
     fnc_putchar(0x11);           // XON; request software flow control
     fnc_realtime(StatusReport);  // Request fresh status
-    next_ping_ms = milliseconds() + ping_interval_ms;
+    link_rtt_probe_sent();
+}
+
+static void send_probe(int now) {
+    request_status_report();
+    probe_ms = now;
+    probe_tries++;
 }
 
 bool fnc_is_connected() {
     int now = milliseconds();
     if (starting) {
-        starting      = false;
-        disconnect_ms = now + (disconnect_interval_ms - ping_interval_ms);
-        request_status_report();  // sets next_ping_ms
-        return false;             // Do we need a value for "unknown"?
+        starting   = false;
+        last_rx_ms = now;
+        send_probe(now);
+        return false;  // Do we need a value for "unknown"?
     }
-    if ((now - disconnect_ms) >= 0) {
-        next_ping_ms  = now + ping_interval_ms;
-        disconnect_ms = now + disconnect_interval_ms;
-        return false;
+    if (probe_tries && (last_rx_ms - probe_ms) > 0) {
+        probe_tries = 0;  // heard something since the probe
+    }
+    if (!probe_tries) {
+        if ((now - last_rx_ms) >= link_probe_interval_ms()) {
+            send_probe(now);
+        }
+        return true;
     }
 
-    if ((now - next_ping_ms) >= 0) {
-        request_status_report();
+    bool lost = probe_tries > LINK_PROBE_RETRIES + 1;
+    int  wait = lost ? link_probe_interval_ms() : link_probe_timeout_ms() << (probe_tries - 1);
+    if ((now - probe_ms) >= wait) {
+        send_probe(now);
     }
-    return true;
+    return probe_tries <= LINK_PROBE_RETRIES + 1;
 }
 
 // Set true the first time ANY real byte arrives from FluidNC, on any
@@ -560,9 +608,13 @@ bool fnc_rx_ever_seen() {
     return _rx_ever_seen;
 }
 
+static volatile bool _rx_time_held = false;
+void hold_rx_time(bool hold) {
+    _rx_time_held = hold;
+}
+
 void update_rx_time() {
-    int now       = milliseconds();
-    next_ping_ms  = now + ping_interval_ms;
-    disconnect_ms = now + disconnect_interval_ms;
+    if (_rx_time_held) return;
+    last_rx_ms    = milliseconds();
     _rx_ever_seen = true;
 }
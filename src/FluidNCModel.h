@@ -41,20 +41,19 @@ extern uint32_t           myFeed;
 extern uint32_t           mySpeed;
 extern int                lastAlarm;
 extern int                lastError;
+extern char               lastErrorLine[64];  // the command lastError answered, "" if unknown
 extern uint32_t           errorExpire;
 extern bool               inInches;
 extern uint32_t           mySelectedTool;
 
 int num_digits();
 
-// Default ack-wait timeout: 1000 ms.  fnc_send_line() spins at the START of
-// every call waiting for the PREVIOUS command's "ok" reply.  Over WiFi/TCP
-// the round-trip is ~50 ms on a healthy LAN, so 1 s is still 20x headroom
-// for normal operation — but a stalled FluidNC reply path won't pile up
-// multi-second waits on each subsequent button press.
-void send_line(const char* s, int timeout = 1000);
+// Queue a line for FluidNC and return at once (CommandQueue.h).  Lines go
+// out in order as acks free room in the in-flight window; nothing waits for
+// the controller.  Use cmd_submit() directly to learn how a line ended.
+void send_line(const char* s);
 void send_linef(const char* fmt, ...);
-void send_linef_nowait(const char* fmt, ...);  // formatted, no ack-wait spin (UI-safe)
+void send_linef_nowait(const char* fmt, ...);  // formatted send_line_nowait()
 
 // Cross-core TX-line serialization.  fnc_init_tx_lock() must be called once at
 // boot (before the comms/UI tasks start).  txLineLock()/txLineUnlock() bracket
@@ -64,7 +63,8 @@ void fnc_init_tx_lock();
 bool txLineLock();   // true if acquired (bounded 1 s); only unlock when it did
 void txLineUnlock();
 
-// Send a line WITHOUT touching fnc_send_line's _ackwait machinery.
+// Send a line as soon as the lines queued before it have gone out, without
+// waiting for room in the command queue's in-flight window.
 //
 // Use this when:
 //   • The command goes into FluidNC's motion planner / command queue (jog,
@@ -73,18 +73,14 @@ void txLineUnlock();
 //     ack timing doesn't (eg. settings queries that populate state
 //     asynchronously via the parser).
 //
-// Why it matters: fnc_send_line() spins at the start of each call waiting
-// for the previous command's "ok".  Over a WiFi link with ~100 ms round
-// trips this turns rapid back-to-back jog commands into a stop-start
-// sequence — each $J= waits for the previous to fully ack before the next
-// is even sent, so FluidNC's planner never gets to chain moves together.
-// Bypassing the ack-wait lets the planner queue multiple jogs back-to-back
-// (deceleration ramps bridge them) for smooth continuous motion.
+// Why it matters: send_line() lines wait their turn in the command queue's
+// in-flight window.  Jog wants the opposite — every $J= on the wire at once
+// so FluidNC's planner can chain moves together (deceleration ramps bridge
+// them) for smooth continuous motion.
 //
-// FluidNC still sends "ok" for each command; the parser sees them and
-// clears _ackwait normally.  The next regular send_line() will see _ackwait
-// either already clear (fine) or set from some prior call (will wait for
-// the ack we expect — also fine).
+// FluidNC still sends "ok" for each command.  The line is queued like any
+// other (never overtaking earlier send_line()s) and holds a slot in the
+// queue's ack FIFO, so that "ok" is never credited to another line.
 void send_line_nowait(const char* s);
 
 // Counter of nowait sends that haven't been acked yet.  Incremented by
@@ -115,6 +111,7 @@ bool fnc_is_connected();
 void set_disconnected_state();
 
 void update_rx_time();
+void hold_rx_time(bool hold);  // while held, RX is not proof of life (CommsImpair outages)
 bool fnc_rx_ever_seen();   // true once any byte has arrived from FluidNC (any transport)
 
 extern pos_t toMm(pos_t position);
@@ -0,0 +1,563 @@
+// Copyright (c) 2026 — FluidDial-CYD
+// Use of this source code is governed by a GPLv3 license.
+
+// Pendant-side G-code streamer.  See GcodeStreamer.h.
+
+#include "GcodeStreamer.h"
+#include "FluidNCModel.h"  // state, fnc_realtime(), milliseconds()
+#include "CommandQueue.h"
+#include "WcsOffsets.h"    // wcs_note_line()
+#include "System.h"        // dbg_printf
+
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+#ifdef ARDUINO
+#    include <freertos/FreeRTOS.h>
+#    include <freertos/task.h>
+static portMUX_TYPE _streamMux = portMUX_INITIALIZER_UNLOCKED;
+#    define STREAM_LOCK()   portENTER_CRITICAL(&_streamMux)
+#    define STREAM_UNLOCK() portEXIT_CRITICAL(&_streamMux)
+#else
+#    define STREAM_LOCK()
+#    define STREAM_UNLOCK()
+#endif
+
+// Shared state, under the lock.  _session is bumped by every start, so the
+// reader and late acks can tell a stale stream from the current one.
+static StreamStatus      _st       = {};
+static volatile uint32_t _session  = 0;
+static volatile bool     _stopReq  = false;
+static uint32_t          _startMs  = 0;
+static uint32_t          _endMs    = 0;
+static uint32_t          _ackBytes = 0;
+static char              _path[sizeof(STREAM_DIR) + STREAM_PATH_MAX];
+
+// ── Read-ahead ring ──────────────────────────────────────────────────────────
+//
+// Blocks [_rHead, _rHead + _rFilled) hold the file in order.  The feeder
+// reads the head block from _rPos and frees it when done; the reader fills
+// the next free one.  Neither touches a block the other may be using, so only
+// the indices need the lock.
+
+static char _ring[STREAM_BLOCKS][STREAM_BLOCK];
+static int  _ringLen[STREAM_BLOCKS];
+static int  _rHead   = 0;
+static int  _rFilled = 0;
+static int  _rPos    = 0;  // feeder only
+static bool _rEof    = false;
+static bool _rError  = false;
+
+// Reader only.
+static FILE*    _file        = nullptr;
+static uint32_t _fileSession = 0;
+static char     _filePath[sizeof(_path)];  // _path as it was for _fileSession
+
+static void readAhead() {
+    STREAM_LOCK();
+    uint32_t session = _session;
+    bool     wanted  = _st.state == STREAM_OPENING || _st.state == STREAM_RUNNING;
+    if (wanted && _fileSession != session) {
+        memcpy(_filePath, _path, sizeof(_filePath));
+    }
+    STREAM_UNLOCK();
+
+    if (_file && (_fileSession != session || !wanted)) {
+        fclose(_file);
+        _file = nullptr;
+    }
+    if (!wanted) return;
+
+    if (_fileSession != session) {
+        _fileSession = session;
+        FILE*    f    = fopen(_filePath, "rb");
+        uint32_t size = 0;
+        if (f && fseek(f, 0, SEEK_END) == 0) {
+            long n = ftell(f);
+            size   = n > 0 ? (uint32_t)n : 0;
+            fseek(f, 0, SEEK_SET);
+        }
+        STREAM_LOCK();
+        bool current = _session == session && _st.state == STREAM_OPENING;
+        if (current) {
+            if (f) {
+                _st.fileBytes = size;
+                _st.state     = STREAM_RUNNING;
+                _startMs      = milliseconds();
+            } else {
+                _st.state   = STREAM_FAILED;
+                _st.message = "Can't open file";
+            }
+        }
+        STREAM_UNLOCK();
+        if (!f) {
+            dbg_printf("Stream: can't open %s\n", _filePath);
+            return;
+        }
+        if (!current) {
+            fclose(f);
+            return;
+        }
+        _file = f;
+    }
+
+    while (_file) {
+        STREAM_LOCK();
+        bool room = _session == session && _rFilled < STREAM_BLOCKS;
+        int  slot = (_rHead + _rFilled) % STREAM_BLOCKS;
+        STREAM_UNLOCK();
+        if (!room) return;
+
+        size_t n   = fread(_ring[slot], 1, STREAM_BLOCK, _file);
+        bool   end = n < STREAM_BLOCK;
+        bool   err = end && ferror(_file);
+        STREAM_LOCK();
+        if (_session == session) {
+            if (n) {
+                _ringLen[slot] = (int)n;
+                _rFilled++;
+            }
+            if (end) {
+                _rEof   = true;
+                _rError = err;
+            }
+        }
+        STREAM_UNLOCK();
+        if (end) {
+            fclose(_file);
+            _file = nullptr;
+        }
+    }
+}
+
+#ifdef ARDUINO
+static TaskHandle_t _reader = nullptr;
+
+static void stream_reader_task(void* /*param*/) {
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        readAhead();
+    }
+}
+
+static void wakeReader() {
+    if (!_reader) {
+        // Core 1, beside the UI: a flash read that stalls for a few ms costs
+        // the UI a frame at worst, never the comms task an ack.
+        if (xTaskCreatePinnedToCore(stream_reader_task, "StreamRead", 4096, nullptr, 1, &_reader, 1) != pdPASS) {
+            _reader = nullptr;
+            dbg_println("Stream: reader task start failed");
+            return;
+        }
+    }
+    xTaskNotifyGive(_reader);
+}
+#else
+// No tasks on the host: stream_poll() reads ahead itself.
+static void wakeReader() {}
+#endif
+
+// ── Line assembly (comms task) ───────────────────────────────────────────────
+
+enum LineResult { LINE_NONE, LINE_READY, LINE_TOO_LONG };
+
+static uint32_t _fedSession = 0;   // session the feeder state below belongs to
+static char     _line[CMD_LINE_MAX];
+static int      _lineLen  = 0;
+static uint32_t _lineNo   = 0;     // newlines seen so far
+static bool     _verbatim = false; // "$" line: sent as written
+static bool     _inParen  = false;
+static bool     _inSemi   = false;
+static bool     _overlong = false;
+static bool     _fedAll   = false;
+
+// A line cut out of the ring but not yet accepted by cmd_submit().
+static char     _held[CMD_LINE_MAX];
+static uint32_t _heldNo  = 0;
+static bool     _hasHeld = false;
+
+// Lines queued or in flight, for the error's line number and for stop.
+struct AheadLine {
+    cmd_handle_t handle;
+    uint32_t     lineNo;
+    uint8_t      len;
+};
+static AheadLine _ahead[STREAM_AHEAD];
+static int       _aheadCount = 0;
+
+static void endLine() {
+    _lineNo++;
+    _verbatim = false;
+    _inParen  = false;
+    _inSemi   = false;
+    _overlong = false;
+}
+
+static void takeLine(char* out, bool verbatim) {
+    if (verbatim) {
+        while (_lineLen && (_line[_lineLen - 1] == ' ' || _line[_lineLen - 1] == '\t')) {
+            _lineLen--;
+        }
+    }
+    _line[_lineLen] = '\0';
+    strcpy(out, _line);
+    _lineLen = 0;
+}
+
+// Cuts the next non-empty line out of the ring into `out`.  `consumed` counts
+// the file bytes used, comments and all.
+static LineResult nextLine(char* out, uint32_t& lineNo, uint32_t& consumed) {
+    for (;;) {
+        STREAM_LOCK();
+        bool have = _rFilled > 0;
+        bool eof  = _rEof;
+        STREAM_UNLOCK();
+
+        if (!have) {
+            if (eof) {
+                _fedAll = true;
+                if (_overlong) {
+                    lineNo = _lineNo + 1;
+                    endLine();
+                    return LINE_TOO_LONG;
+                }
+                if (_lineLen) {  // last line without a newline
+                    takeLine(out, _verbatim);
+                    lineNo = _lineNo + 1;
+                    endLine();
+                    return LINE_READY;
+                }
+            }
+            return LINE_NONE;
+        }
+
+        const char* b = _ring[_rHead];
+        int         n = _ringLen[_rHead];
+        while (_rPos < n) {
+            char c = b[_rPos++];
+            consumed++;
+            if (c == '\n') {
+                bool     ready    = _lineLen > 0;
+                bool     over     = _overlong;
+                bool     verbatim = _verbatim;
+                uint32_t no       = _lineNo + 1;
+                endLine();
+                if (over) {
+                    lineNo = no;
+                    return LINE_TOO_LONG;
+                }
+                if (ready) {
+                    takeLine(out, verbatim);
+                    lineNo = no;
+                    return LINE_READY;
+                }
+                continue;
+            }
+            if (c == '\r' || _inSemi || _overlong) {
+                continue;
+            }
+            if (!_verbatim) {
+                if (_inParen) {
+                    _inParen = c != ')';
+                    continue;
+                }
+                if (c == '(') {
+                    _inParen = true;
+                    continue;
+                }
+                if (c == ';') {
+                    _inSemi = true;
+                    continue;
+                }
+                // Spaces are only padding in G-code, and every byte saved
+                // is room in the controller's RX buffer.  '%' marks the
+                // start and end of a program.
+                if (c == ' ' || c == '\t' || c == '%') {
+                    continue;
+                }
+                if (_lineLen == 0 && c == '$') {
+                    _verbatim = true;  // settings and commands keep their spaces
+                }
+            }
+            if (_lineLen >= CMD_LINE_MAX - 1) {
+                _overlong = true;
+                _lineLen  = 0;
+                continue;
+            }
+            _line[_lineLen++] = c;
+        }
+
+        // Head block used up: hand it back to the reader.
+        STREAM_LOCK();
+        _rHead = (_rHead + 1) % STREAM_BLOCKS;
+        _rFilled--;
+        STREAM_UNLOCK();
+        _rPos = 0;
+        wakeReader();
+    }
+}
+
+// ── Feeding (comms task) ─────────────────────────────────────────────────────
+
+static void halt(StreamState end, const char* why) {
+    for (int i = 0; i < _aheadCount; ++i) {
+        cmd_cancel(_ahead[i].handle);  // unsent lines are withdrawn
+    }
+    _aheadCount = 0;
+    _hasHeld    = false;
+    cmd_set_window(CMD_WINDOW, CMD_WINDOW_BYTES);
+
+    STREAM_LOCK();
+    _st.state   = end;
+    _st.message = why;
+    _endMs      = milliseconds();
+    _stopReq    = false;
+    STREAM_UNLOCK();
+    wakeReader();  // closes the file
+    dbg_printf("Stream: %s: %s\n", _st.file, why);
+}
+
+static void lineDone(const CmdResult& r, void* ctx) {
+    if ((uint32_t)(uintptr_t)ctx != _session) return;
+
+    // Completions are dispatched in slot order, not wire order, so look the
+    // line up rather than popping the oldest.
+    AheadLine line = {};
+    bool      found = false;
+    for (int i = 0; i < _aheadCount; ++i) {
+        if (_ahead[i].handle == r.handle) {
+            line        = _ahead[i];
+            _ahead[i]   = _ahead[--_aheadCount];
+            found       = true;
+            break;
+        }
+    }
+    if (!found || _st.state != STREAM_RUNNING) return;
+
+    switch (r.status) {
+        case CMD_OK:
+            STREAM_LOCK();
+            _st.linesAcked++;
+            _ackBytes += line.len;
+            STREAM_UNLOCK();
+            break;
+        case CMD_ERROR:
+            STREAM_LOCK();
+            _st.errorLine = line.lineNo;
+            _st.errorCode = r.error;
+            STREAM_UNLOCK();
+            // Lines after it are already in the controller's buffer and
+            // would carry on without it; hold the machine.
+            fnc_realtime(FeedHold);
+            halt(STREAM_FAILED, "Error from controller");
+            break;
+        case CMD_LOST:
+            halt(STREAM_FAILED, state == Disconnected ? "Link lost" : "No reply from controller");
+            break;
+        default:
+            break;
+    }
+}
+
+void stream_poll() {
+#ifndef ARDUINO
+    readAhead();
+#endif
+    if (_st.state != STREAM_RUNNING) return;
+
+    if (_fedSession != _session) {
+        _fedSession = _session;
+        _rPos       = 0;
+        _lineLen    = 0;
+        _lineNo     = 0;
+        _verbatim   = false;
+        _inParen    = false;
+        _inSemi     = false;
+        _overlong   = false;
+        _fedAll     = false;
+        _hasHeld    = false;
+        _aheadCount = 0;
+        cmd_set_window(0, STREAM_RX_BYTES);  // character counting from here
+    }
+
+    if (_stopReq) {
+        fnc_realtime(FeedHold);
+        halt(STREAM_STOPPED, "Stopped");
+        return;
+    }
+    if (state == Alarm || state == ConfigAlarm || state == Critical) {
+        halt(STREAM_FAILED, "Stopped by alarm");
+        return;
+    }
+    if (state == Disconnected) {
+        halt(STREAM_FAILED, "Link lost");
+        return;
+    }
+    if (_rError) {
+        halt(STREAM_FAILED, "File read error");
+        return;
+    }
+
+    uint32_t consumed = 0;
+    uint32_t sent     = 0;
+    uint32_t lines    = 0;
+    while (_aheadCount < STREAM_AHEAD) {
+        if (!_hasHeld) {
+            LineResult r = nextLine(_held, _heldNo, consumed);
+            if (r == LINE_NONE) break;
+            if (r == LINE_TOO_LONG) {
+                STREAM_LOCK();
+                _st.errorLine = _heldNo;
+                _st.readBytes += consumed;
+                STREAM_UNLOCK();
+                halt(STREAM_FAILED, "Line too long");
+                return;
+            }
+            _hasHeld = true;
+        }
+        wcs_note_line(_held);
+        cmd_handle_t h = cmd_submit(_held, lineDone, (void*)(uintptr_t)_session);
+        if (!h) break;  // queue full for now: retry on the next pass
+        size_t len                 = strlen(_held) + 1;
+        _ahead[_aheadCount++]      = { h, _heldNo, (uint8_t)len };
+        _hasHeld                   = false;
+        sent += len;
+        lines++;
+    }
+
+    bool done = _fedAll && !_hasHeld && _aheadCount == 0;
+    STREAM_LOCK();
+    _st.readBytes += consumed;
+    _st.sentBytes += sent;
+    _st.linesSent += lines;
+    STREAM_UNLOCK();
+    if (done) {
+        halt(STREAM_DONE, "Finished");
+    }
+}
+
+// ── Control (any core) ───────────────────────────────────────────────────────
+
+bool stream_start(const char* name) {
+    const char* why = nullptr;
+    if (stream_active()) {
+        return false;
+    } else if (!name || !*name || strlen(name) >= STREAM_PATH_MAX) {
+        why = "Bad file name";
+    } else if (state != Idle) {
+        why = state == Disconnected ? "Not connected" : "Machine not idle";
+    }
+
+    STREAM_LOCK();
+    _session++;
+    _st            = {};
+    _st.message    = why ? why : "";
+    _st.state      = why ? STREAM_FAILED : STREAM_OPENING;
+    _ackBytes      = 0;
+    _stopReq       = false;
+    _rHead         = 0;
+    _rFilled       = 0;
+    _rEof          = false;
+    _rError        = false;
+    if (name) {
+        strncpy(_st.file, name, sizeof(_st.file) - 1);
+    }
+    if (!why) {
+        // Published with the session: the reader copies it under this lock.
+        snprintf(_path, sizeof(_path), "%s/%s", STREAM_DIR, name);
+    }
+    STREAM_UNLOCK();
+    if (why) {
+        return false;
+    }
+
+    dbg_printf("Stream: starting %s/%s\n", STREAM_DIR, name);
+    wakeReader();
+    return true;
+}
+
+void stream_stop() {
+    STREAM_LOCK();
+    if (_st.state == STREAM_OPENING) {
+        _st.state   = STREAM_STOPPED;
+        _st.message = "Stopped";
+    } else if (_st.state == STREAM_RUNNING) {
+        _stopReq = true;  // stream_poll() does the rest
+    }
+    STREAM_UNLOCK();
+    wakeReader();
+}
+
+bool stream_active() {
+    StreamState s = _st.state;
+    return s == STREAM_OPENING || s == STREAM_RUNNING;
+}
+
+int stream_percent() {
+    STREAM_LOCK();
+    uint32_t total = _st.fileBytes;
+    uint32_t done  = _st.readBytes;
+    StreamState s  = _st.state;
+    STREAM_UNLOCK();
+    if (s == STREAM_DONE) return 100;
+    if (!total) return 0;
+    return (int)((uint64_t)done * 100 / total);
+}
+
+void stream_status(StreamStatus& out) {
+    uint32_t now = milliseconds();
+    STREAM_LOCK();
+    out            = _st;
+    uint32_t acked = _ackBytes;
+    uint32_t start = _startMs;
+    uint32_t end   = _endMs;
+    STREAM_UNLOCK();
+
+    if (out.state == STREAM_RUNNING) {
+        out.elapsedMs = now - start;
+    } else if (out.state >= STREAM_DONE && out.fileBytes) {  // opened, then ended
+        out.elapsedMs = end - start;
+    }
+    if (out.elapsedMs) {
+        out.bytesPerSec = (uint32_t)((uint64_t)acked * 1000 / out.elapsedMs);
+        out.linesPerSec = (uint32_t)((uint64_t)out.linesAcked * 1000 / out.elapsedMs);
+    }
+}
+
+// ── File list ────────────────────────────────────────────────────────────────
+
+static bool streamable(const char* name) {
+    static const char* const exts[] = { ".nc", ".gcode", ".ngc", ".tap" };
+    const char*              dot    = strrchr(name, '.');
+    if (!dot) return false;
+    for (const char* ext : exts) {
+        if (strcasecmp(dot, ext) == 0) return true;
+    }
+    return false;
+}
+
+static int compareNames(const void* a, const void* b) {
+    return strcasecmp((const char*)a, (const char*)b);
+}
+
+int stream_list_files(char (*names)[STREAM_PATH_MAX], int max) {
+    DIR* dir = opendir(STREAM_DIR);
+    if (!dir) {
+        dbg_printf("Stream: can't list %s\n", STREAM_DIR);
+        return 0;
+    }
+    int n = 0;
+    for (struct dirent* e; n < max && (e = readdir(dir)) != nullptr;) {
+#ifdef DT_DIR  // MinGW's dirent has no d_type
+        if (e->d_type == DT_DIR) continue;
+#endif
+        if (!streamable(e->d_name) || strlen(e->d_name) >= STREAM_PATH_MAX) continue;
+        strcpy(names[n++], e->d_name);
+    }
+    closedir(dir);
+    qsort(names, n, STREAM_PATH_MAX, compareNames);
+    return n;
+}
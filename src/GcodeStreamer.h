@@ -0,0 +1,89 @@
+// Copyright (c) 2026 — FluidDial-CYD
+// Use of this source code is governed by a GPLv3 license.
+
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+// ── Pendant-side G-code streamer ─────────────────────────────────────────────
+//
+// Sends a G-code file stored on the pendant itself — LittleFS, or any other
+// VFS path such as a mounted SD card — to FluidNC line by line, the way a
+// PC sender does, instead of asking the controller to run a file from its
+// own SD card.
+//
+// Flow control is Grbl character counting.  While a stream runs, the command
+// queue's in-flight window is widened from CMD_WINDOW lines to every token
+// it has, so only the byte count limits it: lines go on the wire as long as
+// the bytes still awaiting an "ok" fit in STREAM_RX_BYTES, the controller's
+// serial RX buffer.  Short lines no longer wait a round trip each.
+//
+// The file is read ahead in STREAM_BLOCK chunks into a ring of STREAM_BLOCKS
+// by a small reader task off the comms core, so a slow flash read never holds
+// up the comms task — acks, status reports and the realtime bytes for feed
+// hold, jog cancel and overrides keep flowing.  stream_poll(), on the comms
+// task, cuts lines out of the ring (comments and blanks dropped, spaces
+// squeezed out of G-code), and keeps up to STREAM_AHEAD of them queued.
+//
+// The first "error:N" stops the stream with the file line that caused it;
+// an alarm or a lost link stop it too.  stream_stop() withdraws every line not
+// yet sent and sends a feed hold; lines already in the controller's buffer
+// stay there, so a reset (red button) is what clears them.
+//
+// stream_start() / stream_stop() / stream_status() may be called from any
+// core; stream_poll() belongs to the comms task.
+
+#ifdef ARDUINO
+#    define STREAM_DIR "/littlefs"  // LittleFS VFS mount point
+#else
+#    define STREAM_DIR "."
+#endif
+
+#define STREAM_BLOCK    512  // bytes per flash read
+#define STREAM_BLOCKS   4    // read-ahead ring: 2 KB
+#define STREAM_AHEAD    16   // lines queued or in flight at once
+#define STREAM_PATH_MAX 96
+#ifndef STREAM_RX_BYTES
+#    define STREAM_RX_BYTES 127  // Grbl's 128-byte RX buffer, less one
+#endif
+
+enum StreamState {
+    STREAM_IDLE = 0,  // nothing started since boot
+    STREAM_OPENING,   // waiting for the reader to open the file
+    STREAM_RUNNING,
+    STREAM_DONE,      // every line sent and acked
+    STREAM_STOPPED,   // stream_stop()
+    STREAM_FAILED,    // see StreamStatus::message
+};
+
+struct StreamStatus {
+    StreamState state;
+    char        file[STREAM_PATH_MAX];  // name as passed to stream_start()
+    const char* message;                // why it ended, or ""
+    uint32_t    fileBytes;              // file size
+    uint32_t    readBytes;              // file bytes consumed into lines
+    uint32_t    sentBytes;              // bytes queued to the controller
+    uint32_t    linesSent;
+    uint32_t    linesAcked;
+    uint32_t    errorLine;              // 1-based file line of the error, or 0
+    int         errorCode;              // FluidNC error:N, or 0
+    uint32_t    elapsedMs;
+    uint32_t    bytesPerSec;            // acked bytes over elapsedMs
+    uint32_t    linesPerSec;
+};
+
+// Starts streaming STREAM_DIR/name.  False if a stream is already running,
+// the link is down or the machine isn't Idle.
+bool stream_start(const char* name);
+// Withdraws the unsent lines and holds the machine.
+void stream_stop();
+bool stream_active();  // OPENING or RUNNING
+int  stream_percent();  // of the file read, 0..100
+void stream_status(StreamStatus& out);
+
+// Fills `names` with up to `max` streamable files (.nc .gcode .ngc .tap) in
+// STREAM_DIR, sorted; returns how many.
+int stream_list_files(char (*names)[STREAM_PATH_MAX], int max);
+
+// Comms task.
+void stream_poll();
@@ -4,6 +4,7 @@
 // System interface routines for the Arduino framework
 
 #include "System.h"
+#include "DebugLog.h"  // dbg_log_flush() before sleeping
 #include "CommsUart.h"   // init_fnc_uart()
 
 #define LGFX_USE_V1
@@ -619,6 +620,7 @@ void deep_sleep(int us) {
     if (us > 0) {
         esp_sleep_enable_timer_wakeup((uint64_t)us);
     }
+    dbg_log_flush();
     esp_deep_sleep_start();
     // Never returns — ESP32 resets on wakeup and boots normally.
 }
@@ -4,6 +4,7 @@
 // System interface routines for the Arduino framework
 
 #include "System.h"
+#include "DebugLog.h"  // dbg_log_flush() before sleeping
 #include "CommsUart.h"   // init_fnc_uart()
 #include "M5GFX.h"
 #include "Drawing.h"
@@ -116,13 +117,24 @@ bool screen_button_touched(bool pressed, int x, int y, int& button) {
 void update_events() {
     M5Dial.update();
 
+#ifndef USE_SCENE_TASKS
     auto ms = m5gfx::millis();
 
     // The red and green buttons are active low
     redButton.setRawState(ms, !m5gfx::gpio_in(RED_BUTTON_PIN));
     greenButton.setRawState(ms, !m5gfx::gpio_in(GREEN_BUTTON_PIN));
+#endif
 }
 
+#ifdef USE_SCENE_TASKS
+// The hardware task samples red/green itself, so they never change state in
+// redButton/greenButton above and switch_button_touched() only reports the dial.
+bool switch_button_down(int button) {
+    // The red and green buttons are active low
+    return !m5gfx::gpio_in(button == 0 ? RED_BUTTON_PIN : GREEN_BUTTON_PIN);
+}
+#endif
+
 void ackBeep() {
     speaker.tone(1800, 50);
 }
@@ -151,5 +163,6 @@ void deep_sleep(int us) {
     } else {
         // esp_sleep_disable_wakeup_source(ESP_SLEEP_WAKEUP_TIMER);
     }
+    dbg_log_flush();
     esp_deep_sleep_start();
 }
@@ -2,6 +2,7 @@
 // Use of this source code is governed by a GPLv3 license that can be found in the LICENSE file.
 
 #include "Scene.h"
+#include "CommandQueue.h"  // cmd_abort()
 #include "ConfigItem.h"
 
 extern Scene statusScene;
@@ -25,7 +26,7 @@ bool is_homed(int axis) {
 }
 void set_axis_homed(int axis) {
     homed_axes |= 1 << axis;
-    current_scene->reDisplay();
+    notify_redisplay();
 }
 
 void detect_homing_info() {
@@ -87,6 +88,7 @@ public:
     void onRedButtonPress() override {
         if (state == Homing || state == Alarm) {
             fnc_realtime(Reset);
+            cmd_abort();
         }
     }
 
@@ -0,0 +1,251 @@
+// Copyright (c) 2026 — FluidDial-CYD
+// Use of this source code is governed by a GPLv3 license.
+
+// Round-trip estimators for the FluidNC link.  See LinkRtt.h.
+
+#include "LinkRtt.h"
+#include "GrblParserC.h"  // milliseconds()
+#include "CommandQueue.h"  // CMD_TOKENS
+
+#include <string.h>
+
+#ifdef ARDUINO
+#    include <freertos/FreeRTOS.h>
+static portMUX_TYPE _rttMux = portMUX_INITIALIZER_UNLOCKED;
+#    define RTT_LOCK()   portENTER_CRITICAL(&_rttMux)
+#    define RTT_UNLOCK() portEXIT_CRITICAL(&_rttMux)
+#else
+#    define RTT_LOCK()
+#    define RTT_UNLOCK()
+#endif
+
+// Fallbacks before LINK_RTT_MIN_SAMPLES, and the clamps afterwards.  The
+// fallbacks stay close to the old fixed behaviour: 1 s ack wait, ping after
+// 4 s of silence, lost 1 s + 2 s after that (was 6 s in total).
+#define ACK_TIMEOUT_DEFAULT_MS    1000
+#define ACK_TIMEOUT_MIN_MS        250
+#define ACK_TIMEOUT_MAX_MS        2000
+#define PROBE_TIMEOUT_DEFAULT_MS  1000
+#define PROBE_TIMEOUT_MIN_MS      100
+#define PROBE_TIMEOUT_MAX_MS      2000
+#define PROBE_INTERVAL_DEFAULT_MS 4000
+#define PROBE_INTERVAL_MIN_MS     250
+
+// Halve the histogram this often so it follows the link as conditions change.
+#define HIST_DECAY_SAMPLES 256
+
+static int clampi(int v, int lo, int hi) {
+    return v < lo ? lo : v > hi ? hi : v;
+}
+
+static int bucket_of(uint32_t ms) {
+    int b = 0;
+    while (ms && b < LINK_RTT_BUCKETS - 1) {
+        ms >>= 1;
+        b++;
+    }
+    return b;
+}
+
+static int bucket_top(int b) {
+    return b ? (1 << b) - 1 : 0;
+}
+
+// ── Jacobson/Karels estimator + histogram ────────────────────────────────────
+// Fixed point as in the BSD stack: srtt8 = SRTT·8, rttvar4 = RTTVAR·4, so the
+// 1/8 and 1/4 gains are shifts and RTO = SRTT + 4·RTTVAR = srtt8/8 + rttvar4.
+
+struct RttEstimator {
+    int32_t  srtt8;
+    int32_t  rttvar4;
+    uint32_t samples;
+    uint16_t hist[LINK_RTT_BUCKETS];
+
+    void add(uint32_t ms) {
+        if (samples == 0) {
+            srtt8   = (int32_t)ms << 3;
+            rttvar4 = (int32_t)ms << 1;  // RTTVAR = R/2
+        } else {
+            int32_t err = (int32_t)ms - (srtt8 >> 3);
+            srtt8 += err;
+            if (err < 0) err = -err;
+            rttvar4 += err - (rttvar4 >> 2);
+        }
+        samples++;
+        hist[bucket_of(ms)]++;
+        if (samples % HIST_DECAY_SAMPLES == 0) {
+            for (int i = 0; i < LINK_RTT_BUCKETS; i++) {
+                hist[i] >>= 1;
+            }
+        }
+    }
+
+    int rto() const { return (srtt8 >> 3) + rttvar4; }
+
+    int percentile(int pct) const {
+        uint32_t total = 0;
+        for (int i = 0; i < LINK_RTT_BUCKETS; i++) {
+            total += hist[i];
+        }
+        if (total == 0) return 0;
+        uint32_t want = (total * pct + 99) / 100;
+        uint32_t seen = 0;
+        for (int i = 0; i < LINK_RTT_BUCKETS; i++) {
+            seen += hist[i];
+            if (seen >= want) return bucket_top(i);
+        }
+        return bucket_top(LINK_RTT_BUCKETS - 1);
+    }
+
+    // Timeout base: RTO, but never below what the histogram says the slow
+    // tail actually is — RTTVAR alone under-reacts to rare long stalls.
+    int worst() const {
+        int p99 = percentile(99);
+        int r   = rto();
+        return p99 > r ? p99 : r;
+    }
+};
+
+static RttEstimator _ack;
+static RttEstimator _status;
+
+// Derived values, recomputed on each sample so the hot paths just read an int.
+static volatile int _ackTimeout    = ACK_TIMEOUT_DEFAULT_MS;
+static volatile int _probeTimeout  = PROBE_TIMEOUT_DEFAULT_MS;
+static volatile int _probeInterval = PROBE_INTERVAL_DEFAULT_MS;
+
+// ── In-flight lines ──────────────────────────────────────────────────────────
+// FluidNC answers lines strictly in order, so a FIFO of send times pairs each
+// ok/error with its line.  The ring holds as many lines as the command queue
+// lets onto the wire.  Should it still fill, later lines are only counted:
+// their acks come after everything in the ring and give no sample, so an old
+// ack is never paired with a new send time.
+
+#define LINE_RING CMD_TOKENS
+static_assert(LINE_RING >= CMD_TOKENS, "every line in flight needs a send time");
+static uint32_t _lineSent[LINE_RING];
+static uint8_t  _lineHead     = 0;
+static uint8_t  _lineCount    = 0;
+static uint16_t _lineUnpaired = 0;  // sent behind a full ring
+
+// One '?' outstanding at a time.  Karn's rule: a probe that was re-sent is
+// ambiguous, so its answer gives no sample.
+static uint32_t _probeSent     = 0;
+static bool     _probeInFlight = false;
+static bool     _probeRetried  = false;
+
+void link_rtt_line_sent() {
+    uint32_t now = milliseconds();
+    RTT_LOCK();
+    if (_lineUnpaired || _lineCount == LINE_RING) {
+        _lineUnpaired++;  // keeps FIFO order: behind every timed line
+    } else {
+        _lineSent[(_lineHead + _lineCount) % LINE_RING] = now;
+        _lineCount++;
+    }
+    RTT_UNLOCK();
+}
+
+void link_rtt_line_acked() {
+    uint32_t now = milliseconds();
+    RTT_LOCK();
+    if (_lineCount == 0) {
+        if (_lineUnpaired) {
+            _lineUnpaired--;
+        }
+        RTT_UNLOCK();
+        return;
+    }
+    uint32_t sent = _lineSent[_lineHead];
+    _lineHead     = (_lineHead + 1) % LINE_RING;
+    _lineCount--;
+    _ack.add(now - sent);
+    int t = _ack.samples < LINK_RTT_MIN_SAMPLES ? ACK_TIMEOUT_DEFAULT_MS
+                                                 : clampi(2 * _ack.worst(), ACK_TIMEOUT_MIN_MS, ACK_TIMEOUT_MAX_MS);
+    RTT_UNLOCK();
+    _ackTimeout = t;
+}
+
+void link_rtt_line_lost() {
+    RTT_LOCK();
+    if (_lineCount) {
+        _lineHead = (_lineHead + 1) % LINE_RING;
+        _lineCount--;
+    } else if (_lineUnpaired) {
+        _lineUnpaired--;
+    }
+    RTT_UNLOCK();
+}
+
+void link_rtt_probe_sent() {
+    uint32_t now = milliseconds();
+    RTT_LOCK();
+    if (_probeInFlight) {
+        _probeRetried = true;
+    } else {
+        _probeSent     = now;
+        _probeInFlight = true;
+        _probeRetried  = false;
+    }
+    RTT_UNLOCK();
+}
+
+void link_rtt_probe_answered() {
+    uint32_t now = milliseconds();
+    RTT_LOCK();
+    if (!_probeInFlight) {
+        RTT_UNLOCK();
+        return;  // auto-report, not an answer
+    }
+    _probeInFlight = false;
+    if (_probeRetried) {
+        RTT_UNLOCK();
+        return;
+    }
+    _status.add(now - _probeSent);
+    bool warm = _status.samples >= LINK_RTT_MIN_SAMPLES;
+    int  t    = warm ? clampi(_status.worst(), PROBE_TIMEOUT_MIN_MS, PROBE_TIMEOUT_MAX_MS) : PROBE_TIMEOUT_DEFAULT_MS;
+    RTT_UNLOCK();
+    _probeTimeout  = t;
+    _probeInterval = warm ? clampi(2 * t, PROBE_INTERVAL_MIN_MS, PROBE_INTERVAL_DEFAULT_MS) : PROBE_INTERVAL_DEFAULT_MS;
+}
+
+void link_rtt_reset() {
+    RTT_LOCK();
+    _lineCount     = 0;
+    _lineUnpaired  = 0;
+    _probeInFlight = false;
+    RTT_UNLOCK();
+}
+
+int link_ack_timeout_ms() {
+    return _ackTimeout;
+}
+int link_probe_timeout_ms() {
+    return _probeTimeout;
+}
+int link_probe_interval_ms() {
+    return _probeInterval;
+}
+
+static bool snapshot(const RttEstimator& e, LinkRttStats& out) {
+    RTT_LOCK();
+    out.samples = e.samples;
+    out.srtt    = e.srtt8 >> 3;
+    out.rttvar  = e.rttvar4 >> 2;
+    out.rto     = e.rto();
+    memcpy(out.hist, e.hist, sizeof(out.hist));
+    RTT_UNLOCK();
+    RttEstimator copy = {};
+    memcpy(copy.hist, out.hist, sizeof(copy.hist));
+    out.p50 = copy.percentile(50);
+    out.p99 = copy.percentile(99);
+    return out.samples > 0;
+}
+
+bool link_rtt_ack_stats(LinkRttStats& out) {
+    return snapshot(_ack, out);
+}
+bool link_rtt_status_stats(LinkRttStats& out) {
+    return snapshot(_status, out);
+}
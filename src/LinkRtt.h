@@ -0,0 +1,54 @@
+// Copyright (c) 2026 — FluidDial-CYD
+// Use of this source code is governed by a GPLv3 license.
+
+#pragma once
+#include <stdint.h>
+
+// ── Link round-trip estimation ───────────────────────────────────────────────
+//
+// Two round-trip streams are measured on the live link:
+//   • ack     — line pushed (send_line / send_line_nowait) → its "ok"/"error:"
+//   • status  — '?' pushed → the next status report starts parsing
+// Each keeps a TCP-style smoothed estimate (SRTT, RTTVAR, RTO = SRTT +
+// 4·RTTVAR, RFC 6298) and a log2 histogram for percentiles.  The derived
+// timeouts replace the old fixed constants:
+//   link_ack_timeout_ms()    sizes the command queue's lost-ack expiry
+//                            (CommandQueue.h; was a fixed 1000 ms ack wait)
+//   link_probe_timeout_ms()  how long a '?' may go unanswered before it is
+//                            re-sent; fnc_is_connected() declares the link
+//                            lost after LINK_PROBE_RETRIES backed-off retries
+//   link_probe_interval_ms() how much RX silence before a '?' is sent
+// Until enough samples exist every value falls back to the old fixed one.
+// On a quiet LAN a dead link is noticed in a few hundred ms; on flaky WiFi the
+// variance term stretches the timeouts instead of false-triggering.
+//
+// Sent/answered hooks may be called from either core.
+
+#define LINK_RTT_MIN_SAMPLES 8
+#define LINK_RTT_BUCKETS     14  // 0, 1, 2-3, 4-7 … 2048-4095, 4096+ ms
+#define LINK_PROBE_RETRIES   1
+
+struct LinkRttStats {
+    uint32_t samples;
+    int      srtt;    // ms
+    int      rttvar;  // ms
+    int      rto;     // ms, unclamped
+    int      p50;     // ms, histogram bucket upper bound
+    int      p99;
+    uint16_t hist[LINK_RTT_BUCKETS];
+};
+
+void link_rtt_line_sent();       // a line went out expecting one ok/error
+void link_rtt_line_acked();      // ok or error: closes the oldest line
+void link_rtt_line_lost();       // the oldest line's ack is presumed lost
+void link_rtt_probe_sent();      // '?' went out
+void link_rtt_probe_answered();  // a status report began
+void link_rtt_reset();           // link dropped: forget everything in flight
+
+int link_ack_timeout_ms();
+int link_probe_timeout_ms();
+int link_probe_interval_ms();
+
+// Snapshots for diagnostics — false until the stream has any samples.
+bool link_rtt_ack_stats(LinkRttStats& out);
+bool link_rtt_status_stats(LinkRttStats& out);
@@ -0,0 +1,189 @@
+// Copyright (c) 2026 — FluidDial-CYD
+// Use of this source code is governed by a GPLv3 license.
+
+// Network worker task.  See NetWorker.h.
+
+#include "NetWorker.h"
+
+#ifdef USE_WIFI
+
+#include "System.h"  // dbg_printf
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+static portMUX_TYPE _netMux = portMUX_INITIALIZER_UNLOCKED;
+#define NET_LOCK()   portENTER_CRITICAL(&_netMux)
+#define NET_UNLOCK() portEXIT_CRITICAL(&_netMux)
+
+struct NetJob {
+    net_job_t   id;
+    NetJobKind  kind;
+    net_job_fn  fn;
+    net_done_fn done;
+    void*       ctx;
+    uint32_t    queuedMs;
+    uint32_t    deadlineMs;  // absolute; 0 = none
+    bool        cancelled;
+};
+
+static NetJob        _queue[NET_QUEUE_LEN];
+static int           _head    = 0;
+static int           _count   = 0;
+static NetJob        _running = {};  // id 0 while idle
+static net_job_t     _next    = 0;
+static TaskHandle_t  _task    = nullptr;
+static NetStats      _stats[NET_JOB_KINDS];
+
+static const char* const _kindNames[NET_JOB_KINDS] = { "dns", "http", "scan", "upload", "discover" };
+
+const char* net_kind_name(NetJobKind kind) {
+    return kind >= 0 && kind < NET_JOB_KINDS ? _kindNames[kind] : "?";
+}
+
+// Caller holds the lock.
+static bool expired(const NetJob& job, uint32_t now) {
+    return job.deadlineMs && (int32_t)(now - job.deadlineMs) >= 0;
+}
+
+static void finish(const NetJob& job, NetJobResult result, int runMs) {
+    NetStats& s = _stats[job.kind];
+    switch (result) {
+        case NET_FAILED:
+            s.failed++;
+            break;
+        case NET_CANCELLED:
+            s.cancelled++;
+            break;
+        case NET_EXPIRED:
+            s.expired++;
+            break;
+        default:
+            break;
+    }
+    if (runMs >= 0) {
+        s.last_ms = runMs;
+        s.avg_ms  = s.runs == 1 ? runMs : s.avg_ms + (runMs - s.avg_ms) / 8;
+        if (runMs > s.max_ms) s.max_ms = runMs;
+    }
+    if (job.done) {
+        job.done(job.ctx, result);
+    }
+}
+
+static void net_worker_task(void* /*param*/) {
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        for (;;) {
+            uint32_t now = millis();
+            NET_LOCK();
+            if (!_count) {
+                NET_UNLOCK();
+                break;
+            }
+            NetJob job = _queue[_head];
+            _head      = (_head + 1) % NET_QUEUE_LEN;
+            _count--;
+            bool skip = job.cancelled || expired(job, now);
+            if (!skip) {
+                _running = job;
+            }
+            NET_UNLOCK();
+
+            if (skip) {
+                finish(job, job.cancelled ? NET_CANCELLED : NET_EXPIRED, -1);
+                continue;
+            }
+
+            NetStats& s    = _stats[job.kind];
+            int       wait = (int)(now - job.queuedMs);
+            s.runs++;
+            if (wait > s.wait_max_ms) s.wait_max_ms = wait;
+
+            bool ok = job.fn(job.ctx);
+
+            uint32_t end = millis();
+            NET_LOCK();
+            bool cancelled = _running.cancelled;
+            bool late      = expired(_running, end);
+            _running.id    = 0;
+            NET_UNLOCK();
+            NetJobResult result = ok ? NET_DONE : cancelled ? NET_CANCELLED : late ? NET_EXPIRED : NET_FAILED;
+            finish(job, result, (int)(end - now));
+        }
+    }
+}
+
+void net_worker_start() {
+    if (_task) return;
+    // Core 0 with the WiFi driver and lwIP; same priority as the comms task,
+    // so a job that spins on a socket still round-robins with it.
+    if (xTaskCreatePinnedToCore(net_worker_task, "NetWorker", NET_STACK, nullptr, 1, &_task, 0) != pdPASS) {
+        _task = nullptr;
+        dbg_println("NetWorker: task start failed");
+    }
+}
+
+net_job_t net_submit(NetJobKind kind, net_job_fn fn, void* ctx, uint32_t deadline_ms, net_done_fn done) {
+    net_worker_start();
+    if (!_task) return 0;
+    uint32_t now = millis();
+    NET_LOCK();
+    if (_count == NET_QUEUE_LEN) {
+        NET_UNLOCK();
+        dbg_printf("NetWorker: queue full, %s job dropped\n", net_kind_name(kind));
+        return 0;
+    }
+    if (++_next == 0) {
+        _next = 1;
+    }
+    NetJob& job    = _queue[(_head + _count) % NET_QUEUE_LEN];
+    job.id         = _next;
+    job.kind       = kind;
+    job.fn         = fn;
+    job.done       = done;
+    job.ctx        = ctx;
+    job.queuedMs   = now;
+    job.deadlineMs = deadline_ms ? (now + deadline_ms) | 1 : 0;  // never 0 by wraparound
+    job.cancelled  = false;
+    _count++;
+    net_job_t id = job.id;
+    NET_UNLOCK();
+    xTaskNotifyGive(_task);
+    return id;
+}
+
+bool net_cancel(net_job_t id) {
+    if (!id) return false;
+    bool found = false;
+    NET_LOCK();
+    if (_running.id == id) {
+        _running.cancelled = true;
+        found              = true;
+    }
+    for (int i = 0; !found && i < _count; ++i) {
+        NetJob& job = _queue[(_head + i) % NET_QUEUE_LEN];
+        if (job.id == id) {
+            job.cancelled = true;  // the worker reports it as it comes up
+            found         = true;
+        }
+    }
+    NET_UNLOCK();
+    return found;
+}
+
+bool net_job_should_stop() {
+    if (!_task || xTaskGetCurrentTaskHandle() != _task) return false;
+    NET_LOCK();
+    bool stop = _running.id && (_running.cancelled || expired(_running, millis()));
+    NET_UNLOCK();
+    return stop;
+}
+
+bool net_stats(NetJobKind kind, NetStats& out) {
+    out = _stats[kind];
+    return out.runs || out.cancelled || out.expired;
+}
+
+#endif  // USE_WIFI
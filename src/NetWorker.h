@@ -0,0 +1,69 @@
+// Copyright (c) 2026 — FluidDial-CYD
+// Use of this source code is governed by a GPLv3 license.
+
+#pragma once
+
+// ── Network worker ───────────────────────────────────────────────────────────
+//
+// Blocking network calls — hostname resolution, HTTP file fetches, scans,
+// uploads, controller discovery — run one at a time on a single long-lived task on Core 0, fed from
+// a small FIFO.  Its stack is allocated once at startup, instead of a fresh
+// 4–16 KB task per request out of a heap that is tight by the time WiFi and
+// the display sprites are up, and a fetch never waits on task creation.
+//
+// A job is a plain function plus a context pointer.  Long jobs should poll
+// net_job_should_stop() between blocking steps (wifi_http_get() does) so a
+// cancel or an expired deadline ends them early; a job still queued when
+// cancelled, or when its deadline passes, never runs.  Either way `done` is
+// called exactly once, on the worker task, with how the job ended.
+//
+// Per-kind timing (queue wait and run time) is kept for the task monitor.
+
+#ifdef USE_WIFI
+
+#include <stdint.h>
+
+#define NET_QUEUE_LEN 6
+#define NET_STACK     16384  // WiFiClient + a JsonStreamingParser (macro fetch)
+
+enum NetJobKind { NET_JOB_DNS = 0, NET_JOB_HTTP, NET_JOB_SCAN, NET_JOB_UPLOAD, NET_JOB_DISCOVER, NET_JOB_KINDS };
+
+enum NetJobResult {
+    NET_DONE = 0,    // fn returned true
+    NET_FAILED,      // fn returned false
+    NET_CANCELLED,   // net_cancel()ed, queued or running
+    NET_EXPIRED,     // deadline passed, queued or running
+};
+
+typedef uint16_t net_job_t;  // 0 = not queued
+
+typedef bool (*net_job_fn)(void* ctx);
+typedef void (*net_done_fn)(void* ctx, NetJobResult result);
+
+void net_worker_start();  // idempotent; creates the task on first call
+
+// deadline_ms is relative to now; 0 = none.  Returns 0 if the queue is full.
+net_job_t net_submit(NetJobKind kind, net_job_fn fn, void* ctx,
+                     uint32_t deadline_ms = 0, net_done_fn done = nullptr);
+
+// False once the job has finished.
+bool net_cancel(net_job_t job);
+
+// For the running job: true once it was cancelled or ran past its deadline.
+// Always false outside the worker task.
+bool net_job_should_stop();
+
+struct NetStats {
+    uint32_t runs;       // jobs started
+    uint32_t failed;
+    uint32_t cancelled;
+    uint32_t expired;
+    int      wait_max_ms;
+    int      last_ms;    // run time
+    int      avg_ms;     // EWMA, 1/8
+    int      max_ms;
+};
+bool        net_stats(NetJobKind kind, NetStats& out);
+const char* net_kind_name(NetJobKind kind);
+
+#endif  // USE_WIFI
@@ -0,0 +1,192 @@
+// Copyright (c) 2026 — FluidDial-CYD
+// Use of this source code is governed by a GPLv3 license.
+
+// Feed / spindle override planner.  See OverridePlanner.h.
+
+#include "OverridePlanner.h"
+#include "GrblParserC.h"  // fnc_realtime(), milliseconds()
+#include "LinkRtt.h"
+#include "System.h"       // dbg_printf
+
+#ifdef ARDUINO
+#    include <freertos/FreeRTOS.h>
+static portMUX_TYPE _ovrMux = portMUX_INITIALIZER_UNLOCKED;
+#    define OVR_LOCK()   portENTER_CRITICAL(&_ovrMux)
+#    define OVR_UNLOCK() portEXIT_CRITICAL(&_ovrMux)
+#else
+#    define OVR_LOCK()
+#    define OVR_UNLOCK()
+#endif
+
+#define OVR_STATES     (OVR_MAX - OVR_MIN + 1)
+#define OVR_ACK_MIN_MS 300
+
+static const realtime_cmd_t _bytes[OVR_KINDS][5] = {
+    { FeedOvrReset, FeedOvrCoarsePlus, FeedOvrCoarseMinus, FeedOvrFinePlus, FeedOvrFineMinus },
+    { SpindleOvrReset, SpindleOvrCoarsePlus, SpindleOvrCoarseMinus, SpindleOvrFinePlus, SpindleOvrFineMinus },
+};
+
+static int clamp_pct(int pct) {
+    return pct < OVR_MIN ? OVR_MIN : pct > OVR_MAX ? OVR_MAX : pct;
+}
+
+int ovr_apply(int pct, OvrOp op) {
+    switch (op) {
+        case OVR_OP_RESET:
+            return 100;
+        case OVR_OP_COARSE_PLUS:
+            pct += 10;
+            break;
+        case OVR_OP_COARSE_MINUS:
+            pct -= 10;
+            break;
+        case OVR_OP_FINE_PLUS:
+            pct += 1;
+            break;
+        case OVR_OP_FINE_MINUS:
+            pct -= 1;
+            break;
+    }
+    return clamp_pct(pct);
+}
+
+// 191 states and five moves: a plain BFS is a few hundred steps, cheap enough
+// to rerun on every batch.
+int ovr_plan(int from, int to, OvrOp* ops, int max) {
+    from = clamp_pct(from);
+    to   = clamp_pct(to);
+    if (from == to) return 0;
+
+    uint8_t prevOp[OVR_STATES];
+    uint8_t prev[OVR_STATES];
+    uint8_t queue[OVR_STATES];
+    bool    seen[OVR_STATES] = { false };
+    int     head = 0, tail = 0;
+    queue[tail++]         = from - OVR_MIN;
+    seen[from - OVR_MIN]  = true;
+    while (head < tail && !seen[to - OVR_MIN]) {
+        int v = queue[head++] + OVR_MIN;
+        for (int op = 0; op < 5; ++op) {
+            int n = ovr_apply(v, (OvrOp)op) - OVR_MIN;
+            if (!seen[n]) {
+                seen[n]       = true;
+                prev[n]       = v - OVR_MIN;
+                prevOp[n]     = op;
+                queue[tail++] = n;
+            }
+        }
+    }
+
+    OvrOp path[OVR_STATES];  // walked back from `to`, so reversed
+    int   len = 0;
+    for (int n = to - OVR_MIN; n != from - OVR_MIN; n = prev[n]) {
+        path[len++] = (OvrOp)prevOp[n];
+    }
+    int count = len < max ? len : max;  // the rest gets replanned
+    for (int i = 0; i < count; ++i) {
+        ops[i] = path[len - 1 - i];
+    }
+    return count;
+}
+
+struct OvrEngine {
+    int      target   = -1;  // guarded by the lock
+    uint32_t startMs  = 0;   // when the current target was first set
+    int      reported = 100;
+    int      expected = -1;  // what the batch in flight should produce
+    uint32_t sentMs   = 0;
+    OvrStats stats    = {};
+};
+static OvrEngine _eng[OVR_KINDS];
+
+void ovr_set_target(OvrKind kind, int pct) {
+    uint32_t now = milliseconds();
+    OVR_LOCK();
+    if (_eng[kind].target < 0) {
+        _eng[kind].startMs = now;
+    }
+    _eng[kind].target = clamp_pct(pct);
+    OVR_UNLOCK();
+}
+
+int ovr_target(OvrKind kind) {
+    return _eng[kind].target;
+}
+
+void ovr_reported(int feed, int spindle) {
+    _eng[OVR_FEED].reported    = feed;
+    _eng[OVR_SPINDLE].reported = spindle;
+}
+
+void ovr_reset() {
+    OVR_LOCK();
+    for (int k = 0; k < OVR_KINDS; ++k) {
+        _eng[k].target   = -1;
+        _eng[k].expected = -1;
+    }
+    OVR_UNLOCK();
+}
+
+static int ack_timeout_ms() {
+    int t = 2 * link_probe_timeout_ms();
+    return t < OVR_ACK_MIN_MS ? OVR_ACK_MIN_MS : t;
+}
+
+static void poll_one(OvrKind kind, uint32_t now) {
+    OvrEngine& e        = _eng[kind];
+    int        reported = e.reported;
+
+    if (e.expected >= 0) {
+        if (reported != e.expected) {
+            if ((int32_t)(now - e.sentMs) < ack_timeout_ms()) {
+                return;  // batch still on its way
+            }
+            e.stats.replans++;
+            dbg_printf("Ovr: %s expected %d, reported %d - replanning\n",
+                       kind == OVR_FEED ? "feed" : "spindle", e.expected, reported);
+        }
+        e.expected = -1;
+    }
+
+    OVR_LOCK();
+    int      target  = e.target;
+    uint32_t startMs = e.startMs;
+    if (target >= 0 && reported == target) {
+        e.target = -1;
+    }
+    OVR_UNLOCK();
+    if (target < 0) return;
+
+    if (reported == target) {
+        int ms = (int)(now - startMs);
+        e.stats.changes++;
+        e.stats.last_ms = ms;
+        e.stats.avg_ms  = e.stats.changes == 1 ? ms : e.stats.avg_ms + (ms - e.stats.avg_ms) / 8;
+        if (ms > e.stats.max_ms) e.stats.max_ms = ms;
+        return;
+    }
+
+    OvrOp ops[OVR_PLAN_MAX];
+    int   n = ovr_plan(reported, target, ops, kind == OVR_SPINDLE ? OVR_SPINDLE_BURST : OVR_PLAN_MAX);
+    int   v = reported;
+    for (int i = 0; i < n; ++i) {
+        fnc_realtime(_bytes[kind][ops[i]]);
+        v = ovr_apply(v, ops[i]);
+    }
+    fnc_realtime(StatusReport);  // the acknowledgement
+    link_rtt_probe_sent();
+    e.stats.bytes += n;
+    e.expected = v;
+    e.sentMs   = now;
+}
+
+void ovr_poll() {
+    uint32_t now = milliseconds();
+    poll_one(OVR_FEED, now);
+    poll_one(OVR_SPINDLE, now);
+}
+
+bool ovr_stats(OvrKind kind, OvrStats& out) {
+    out = _eng[kind].stats;
+    return out.changes || out.replans;
+}
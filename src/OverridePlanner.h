@@ -0,0 +1,56 @@
+// Copyright (c) 2026 — FluidDial-CYD
+// Use of this source code is governed by a GPLv3 license.
+
+#pragma once
+#include <stdint.h>
+
+// ── Feed / spindle override planner ──────────────────────────────────────────
+//
+// FluidNC overrides are relative only: a reset-to-100 byte, ±10 % and ±1 %,
+// clamped to OVR_MIN..OVR_MAX.  To reach an absolute target the planner runs a
+// breadth-first search over those five moves from the last REPORTED value
+// (status "Ov:"), so the plan is the fewest bytes possible — clamping and the
+// reset included (195 → 200 is one +10, 100 → 10 is nine −10 … or whatever
+// is shorter).
+//
+// Bytes go out in batches, and the next batch waits until a status report
+// shows the value the previous batch should have produced (a '?' follows each
+// batch so that takes one round trip, not a report interval).  If it never
+// shows — a byte lost, or someone else moved the override — the plan is
+// redone from whatever was reported.  Feed batches carry the whole plan, so a
+// dial change lands in one report cycle; spindle batches are capped at
+// OVR_SPINDLE_BURST because every spindle override byte becomes a speed
+// command to a Modbus VFD, whose queue overflows when flooded.
+//
+// Targets may be set from either core; ovr_reported() and ovr_poll() run on
+// the comms task.
+
+#define OVR_MIN           10
+#define OVR_MAX           200
+#define OVR_SPINDLE_BURST 3
+#define OVR_PLAN_MAX      32
+
+enum OvrKind { OVR_FEED = 0, OVR_SPINDLE, OVR_KINDS };
+
+enum OvrOp : uint8_t { OVR_OP_RESET = 0, OVR_OP_COARSE_PLUS, OVR_OP_COARSE_MINUS, OVR_OP_FINE_PLUS, OVR_OP_FINE_MINUS };
+
+// Fewest ops taking `from` to `to`; returns the count (0 if already there).
+int ovr_plan(int from, int to, OvrOp* ops, int max);
+int ovr_apply(int pct, OvrOp op);
+
+void ovr_set_target(OvrKind kind, int pct);
+int  ovr_target(OvrKind kind);  // -1 when nothing is pending
+void ovr_reported(int feed, int spindle);
+void ovr_poll();
+void ovr_reset();               // link lost: forget targets and batches
+
+// Convergence: target set → status reports it.
+struct OvrStats {
+    uint32_t changes;   // targets reached
+    uint32_t bytes;     // override bytes sent
+    uint32_t replans;   // batches never acknowledged
+    int      last_ms;
+    int      avg_ms;    // EWMA, 1/8
+    int      max_ms;
+};
+bool ovr_stats(OvrKind kind, OvrStats& out);
@@ -3,6 +3,7 @@
 
 #include <string>
 #include "Scene.h"
+#include "CommandQueue.h"  // cmd_abort()
 #include "e4math.h"
 
 class ProbingScene : public Scene {
@@ -44,7 +45,8 @@ public:
     void onRedButtonPress() {
         // G38.2 G91 F80 Z-20 P8.00
         if (state == Cycle || state == Alarm) {
-            fnc_realtime(Reset);            
+            fnc_realtime(Reset);
+            cmd_abort();
             return;
         } else if (state == Idle) {
             int retract = _travel < 0 ? _retract : -_retract;
@@ -52,6 +54,7 @@ public:
             return;
         } else if (state == Hold || state == DoorClosed) {
             fnc_realtime(Reset);
+            cmd_abort();
         }
     }
 
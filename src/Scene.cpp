@@ -3,6 +3,11 @@
 
 #include "Scene.h"
 #include "System.h"
+#include "CommandQueue.h"
+#include "UiTimers.h"
+#ifdef USE_SCENE_TASKS
+#include "SceneTasks.h"
+#endif
 
 #ifndef ARDUINO
 #    include <sys/stat.h>
@@ -144,15 +149,21 @@ void dispatch_touch() {
     }
 }
 
-ActionHandler action = nullptr;
-
 void schedule_action(ActionHandler _action) {
-    action = _action;
+    ui_defer(_action);
 }
 
 void dispatch_events() {
+    // Lists the parser finished since the last pass (a scene may look at
+    // them from any handler below).
+    parser_data_adopt();
     update_events();
 
+#ifdef USE_SCENE_TASKS
+    // Encoder, red/green switches, parser notifications and the disconnect
+    // edge arrive through the scene event queue (SceneTasks.cpp).
+    scene_dispatch_queued();
+#else
     static int16_t oldEncoder   = 0;
     int16_t        newEncoder   = get_encoder();
     int16_t        encoderDelta = newEncoder - oldEncoder;
@@ -164,6 +175,7 @@ void dispatch_events() {
             current_scene->onEncoder(scaledDelta);
         }
     }
+#endif
 
     if (!ui_locked()) {
         bool pressed;
@@ -175,6 +187,12 @@ void dispatch_events() {
         dispatch_touch();
     }
 
+#ifndef USE_SCENE_TASKS
+    cmd_poll();  // the comms task does this when there is one
+#endif
+    cmd_dispatch();
+
+#ifndef USE_SCENE_TASKS
     if (!fnc_is_connected()) {
         if (state != Disconnected) {
             set_disconnected_state();
@@ -182,10 +200,8 @@ void dispatch_events() {
             activate_at_top_level(&menuScene);
         }
     }
-    if (action) {
-        action();
-        action = nullptr;
-    }
+#endif
+    ui_timers_run();
 }
 
 static const char* setting_name(const char* base_name, int axis) {
@@ -248,6 +264,30 @@ void Scene::background() {
     system_background();
 }
 
+#ifndef USE_SCENE_TASKS
+// Direct delivery: the parser and the scenes share one task.  The
+// USE_SCENE_TASKS versions live in SceneTasks.cpp.
 void act_on_state_change() {
     current_scene->onStateChange(previous_state);
 }
+void notify_redisplay() {
+    current_scene->reDisplay();
+}
+void notify_dro_change() {
+    current_scene->onDROChange();
+}
+void notify_files_list() {
+    parser_data_adopt();
+    current_scene->onFilesList();
+}
+void notify_file_lines(int firstline, const std::vector<std::string>& lines) {
+    parser_data_adopt();
+    current_scene->onFileLines(firstline, lines);
+}
+void notify_error(const char* errstr) {
+    parser_data_adopt();
+    current_scene->onError(errstr);
+}
+void parser_data_lock() {}
+void parser_data_unlock() {}
+#endif
@@ -105,7 +105,8 @@ void rotateNumberLoop(T& currentVal, T increment, T min, T max) {
 
 // schedule_action() defers a function call until the
 // event dispatcher loop runs.  That is useful for
-// avoiding recursion in FileParser.cpp
+// avoiding recursion in FileParser.cpp.  Calls queue
+// (UiTimers.h), so a second one doesn't replace the first.
 typedef void (*ActionHandler)(void);
 void schedule_action(ActionHandler action);
 
@@ -113,3 +114,21 @@ extern Scene* current_scene;
 
 void dispatch_events();
 void act_on_state_change();
+
+// Parser -> scene notifications.  FluidNC callbacks (FluidNCModel, FileParser,
+// ConfigItem, ...) use these instead of calling current_scene directly.  With
+// USE_SCENE_TASKS the parser runs on the comms task, so these queue the call
+// for the UI task (see SceneTasks.cpp); otherwise they call straight through.
+void notify_redisplay();
+void notify_dro_change();
+void notify_files_list();
+void notify_file_lines(int firstline, const std::vector<std::string>& lines);
+void notify_error(const char* errstr);
+
+// fileVector, fileLines and macroMenu belong to the UI task.  The parser
+// builds each list privately and hands the finished one over under this lock
+// (no-ops without USE_SCENE_TASKS); parser_data_adopt() (FileParser.cpp)
+// swaps it in on the UI task before a scene is told about it.
+void parser_data_lock();
+void parser_data_unlock();
+void parser_data_adopt();
@@ -0,0 +1,273 @@
+// Copyright (c) 2026 — FluidDial-CYD
+// Use of this source code is governed by a GPLv3 license.
+
+// Comms / hardware / UI task split for the legacy Scene UI.  See SceneTasks.h.
+
+#ifdef USE_SCENE_TASKS
+
+#include "SceneTasks.h"
+#include "System.h"
+#include "Scene.h"
+#include "FluidNCModel.h"
+#include "GrblParserC.h"  // collect(), poll_extra(), fnc_realtime()
+#include "Comms.h"
+#include "CommandQueue.h"
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/queue.h>
+
+// ── Scene event queue ────────────────────────────────────────────────────────
+// Comms task and hardware task → UI task.  Same shape as the new UI's HwEvent
+// queue, plus the parser callbacks that used to call current_scene directly.
+
+struct SceneEvent {
+    enum Type : uint8_t {
+        ENCODER,        // value unused — delta is taken from _encPending
+        BUTTON,         // button 0=red 2=green, pressed
+        STATE_CHANGE,   // value = previous state_t
+        REDISPLAY,
+        DRO_CHANGE,
+        FILES_LIST,
+        FILE_LINES,     // value = first line; lines are in _fileLines
+        ERROR,          // text
+        DISCONNECTED,   // comms task saw the link drop → back to the menu
+    } type;
+    uint8_t button;
+    bool    pressed;
+    int32_t value;
+    char    text[32];
+};
+
+static QueueHandle_t _sceneQueue = nullptr;
+
+// DRO/redisplay requests coalesce: one queued entry is enough because the
+// handler reads the model when it runs.  The UI clears the flag BEFORE calling
+// the scene, so a report arriving mid-redraw queues a fresh entry.
+static volatile bool _droPending       = false;
+static volatile bool _redisplayPending = false;
+
+// Encoder counts accumulate here; the queue only carries a wake-up, so a busy
+// UI can never drop counts to a full queue.
+static portMUX_TYPE     _encMux     = portMUX_INITIALIZER_UNLOCKED;
+static volatile int32_t _encPending = 0;
+
+// The global fileLines, which only the UI task changes (parser_data_adopt()).
+static const std::vector<std::string>* _fileLines = nullptr;
+
+// Held only for the vector swaps of a hand-over, so a spinlock will do.
+static portMUX_TYPE _parserDataMux = portMUX_INITIALIZER_UNLOCKED;
+
+void parser_data_lock() {
+    portENTER_CRITICAL(&_parserDataMux);
+}
+void parser_data_unlock() {
+    portEXIT_CRITICAL(&_parserDataMux);
+}
+
+static void post(SceneEvent::Type type, int32_t value = 0, const char* text = nullptr) {
+    if (!_sceneQueue) return;
+    SceneEvent ev = {};
+    ev.type  = type;
+    ev.value = value;
+    if (text) {
+        strncpy(ev.text, text, sizeof(ev.text) - 1);
+    }
+    if (xQueueSend(_sceneQueue, &ev, 0) != pdTRUE) {
+        dbg_printf("Scene queue full, dropped event %d\n", type);
+    }
+}
+
+// ── Parser-side hooks (Scene.h) ──────────────────────────────────────────────
+
+void act_on_state_change() {
+    post(SceneEvent::STATE_CHANGE, previous_state);
+}
+void notify_redisplay() {
+    if (_redisplayPending) return;
+    _redisplayPending = true;
+    post(SceneEvent::REDISPLAY);
+}
+void notify_dro_change() {
+    if (_droPending) return;
+    _droPending = true;
+    post(SceneEvent::DRO_CHANGE);
+}
+void notify_files_list() {
+    post(SceneEvent::FILES_LIST);
+}
+void notify_file_lines(int firstline, const std::vector<std::string>& lines) {
+    _fileLines = &lines;  // always the parser's fileLines, which outlives the event
+    post(SceneEvent::FILE_LINES, firstline);
+}
+void notify_error(const char* errstr) {
+    post(SceneEvent::ERROR, 0, errstr);
+}
+
+// ── UI task ──────────────────────────────────────────────────────────────────
+
+extern void dispatch_button(bool pressed, int button);
+
+void scene_dispatch_queued() {
+    SceneEvent ev;
+    while (xQueueReceive(_sceneQueue, &ev, 0) == pdTRUE) {
+        switch (ev.type) {
+            case SceneEvent::ENCODER: {
+                portENTER_CRITICAL(&_encMux);
+                int32_t delta = _encPending;
+                _encPending   = 0;
+                portEXIT_CRITICAL(&_encMux);
+                int scaled = delta ? current_scene->scale_encoder(delta) : 0;
+                if (scaled && !ui_locked()) {
+                    current_scene->onEncoder(scaled);
+                }
+                break;
+            }
+            case SceneEvent::BUTTON:
+                if (!ui_locked()) {
+                    dispatch_button(ev.pressed, ev.button);
+                }
+                break;
+            case SceneEvent::STATE_CHANGE:
+                current_scene->onStateChange((state_t)ev.value);
+                break;
+            case SceneEvent::REDISPLAY:
+                _redisplayPending = false;
+                current_scene->reDisplay();
+                break;
+            case SceneEvent::DRO_CHANGE:
+                _droPending = false;
+                current_scene->onDROChange();
+                break;
+            // The list may have been handed over after this pass began.
+            case SceneEvent::FILES_LIST:
+                parser_data_adopt();
+                current_scene->onFilesList();
+                break;
+            case SceneEvent::FILE_LINES:
+                parser_data_adopt();
+                current_scene->onFileLines(ev.value, *_fileLines);
+                break;
+            case SceneEvent::ERROR:
+                parser_data_adopt();
+                current_scene->onError(ev.text);
+                break;
+            case SceneEvent::DISCONNECTED: {
+                extern Scene menuScene;
+                activate_at_top_level(&menuScene);
+                break;
+            }
+        }
+    }
+}
+
+// ── Core 0: comms ────────────────────────────────────────────────────────────
+
+static void scene_comms_task(void* /*pvParameters*/) {
+    dbg_println("SceneComms task started on Core 0");
+    for (;;) {
+        comms_poll();
+
+        // Drain everything available, bounded so a burst can't hog the core.
+        // fnc_getchar() only hands out bytes on Core 0, which is why the
+        // parser has to live here.
+        int c;
+        int budget = 8192;
+        while (budget-- > 0 && (c = fnc_getchar()) >= 0) {
+            collect((uint8_t)c);
+        }
+        poll_extra();
+
+        // fnc_is_connected() also sends the periodic status ping.
+        if (!fnc_is_connected() && state != Disconnected) {
+            set_disconnected_state();
+            post(SceneEvent::DISCONNECTED);
+        }
+        nowait_pending_decay();
+        cmd_poll();
+        cmd_dispatch();
+
+        comms_wait_rx(2);  // wakes early on a complete UART line
+    }
+}
+
+// ── Core 1 (above loop()): red/green switches + encoder ─────────────────────
+
+static void scene_hw_task(void* /*pvParameters*/) {
+    dbg_println("SceneHw task started on Core 1");
+
+    static const int buttons[] = { 0, 2 };  // red, green (dial button stays with M5Dial.update())
+    bool          down[2]       = { false, false };
+    bool          lastRaw[2]    = { false, false };
+    unsigned long changedMs[2]  = { 0, 0 };
+    bool          jogAtPress[2] = { false, false };  // a jog was already running
+    bool          jogged[2]     = { false, false };  // this press started a jog
+    int16_t       lastEnc       = get_encoder();
+
+    for (;;) {
+        int16_t enc = get_encoder();
+        if (enc != lastEnc) {
+            int16_t delta = enc - lastEnc;
+            lastEnc       = enc;
+            portENTER_CRITICAL(&_encMux);
+            bool wake = (_encPending == 0);
+            _encPending += delta;
+            portEXIT_CRITICAL(&_encMux);
+            if (wake) {
+                post(SceneEvent::ENCODER);
+            }
+        }
+
+        unsigned long now = millis();
+        for (int i = 0; i < 2; i++) {
+            if (down[i]) {
+                if (state != Jog) {
+                    jogAtPress[i] = false;
+                } else if (!jogAtPress[i]) {
+                    jogged[i] = true;
+                }
+            }
+            bool raw = switch_button_down(buttons[i]);
+            if (raw != lastRaw[i]) {
+                lastRaw[i]   = raw;
+                changedMs[i] = now;
+            }
+            if (raw == down[i] || now - changedMs[i] < 30) {
+                continue;
+            }
+            down[i] = raw;
+
+            // Releasing a button whose press started a jog cancels it here,
+            // before the UI sees the event; the scene still gets the release
+            // and its own JogCancel is harmless.  A press that began while
+            // something else was jogging leaves that jog alone.
+            if (raw) {
+                jogAtPress[i] = state == Jog;
+                jogged[i]     = false;
+            } else {
+                if (jogged[i] && state == Jog) {
+                    fnc_realtime(JogCancel);
+                }
+                jogged[i] = false;
+            }
+
+            SceneEvent ev = {};
+            ev.type       = SceneEvent::BUTTON;
+            ev.button     = buttons[i];
+            ev.pressed    = raw;
+            xQueueSend(_sceneQueue, &ev, 0);
+        }
+
+        vTaskDelay(pdMS_TO_TICKS(2));
+    }
+}
+
+void scene_tasks_start() {
+    _sceneQueue = xQueueCreate(32, sizeof(SceneEvent));
+
+    xTaskCreatePinnedToCore(scene_comms_task, "SceneComms", 8192, nullptr, 1, nullptr, 0);
+    // Priority 2 (loop() is 1) so switch and encoder sampling preempts a redraw.
+    xTaskCreatePinnedToCore(scene_hw_task, "SceneHw", 4096, nullptr, 2, nullptr, 1);
+}
+
+#endif  // USE_SCENE_TASKS
@@ -0,0 +1,31 @@
+// Copyright (c) 2026 — FluidDial-CYD
+// Use of this source code is governed by a GPLv3 license.
+
+#pragma once
+
+// ── Task split for the legacy Scene UI (USE_SCENE_TASKS) ────────────────────
+//
+// The new CYD UI already runs comms and UI on separate cores.  The legacy
+// Scene UI (M5Dial) used to run fnc_poll() and dispatch_events() back to back
+// in loop(), so a slow redraw delayed status parsing and realtime commands.
+// With USE_SCENE_TASKS it uses the same topology:
+//
+//   Core 0  scene_comms_task  — comms_poll(), RX drain → GrblParserC, status
+//                               pings and the connected/disconnected edge.
+//   Core 1  scene_hw_task     — red/green switches and the encoder, one
+//                               priority above loop() so it preempts a redraw.
+//                               Feed hold (green in Cycle) and the button-jog
+//                               JogCancel are sent from here directly.
+//   Core 1  loop()            — dispatch_events(): touch, the dial button and
+//                               everything queued by the two tasks above.
+//
+// Parser callbacks never touch current_scene on Core 0; they call the
+// notify_*() / act_on_state_change() hooks (Scene.h), which queue the call
+// for the UI task.
+
+#ifdef USE_SCENE_TASKS
+
+void scene_tasks_start();       // from setup(), after the first scene is active
+void scene_dispatch_queued();   // from dispatch_events(), on the UI task
+
+#endif
@@ -2,6 +2,7 @@
 // Use of this source code is governed by a GPLv3 license that can be found in the LICENSE file.
 
 #include "Scene.h"
+#include "CommandQueue.h"  // cmd_abort()
 
 extern Scene menuScene;
 
@@ -64,6 +65,7 @@ public:
                     // Critical alarm that must be hard-cleared with a CTRL-X reset
                     // since streaming execution of GCode is blocked
                     fnc_realtime(Reset);
+                    cmd_abort();
                 } else {
                     // Non-critical alarm that can be soft-cleared
                     send_line("$X");
@@ -74,6 +76,7 @@ public:
             case Hold:
             case DoorClosed:
                 fnc_realtime(Reset);
+                cmd_abort();
                 break;
         }
     }
@@ -3,6 +3,7 @@
 
 #include "System.h"
 #include "FluidNCModel.h"
+#include "DebugLog.h"
 
 #if 0
 // Helpful for debugging touch development.
@@ -15,21 +16,17 @@ const char* M5TouchStateName(m5::touch_state_t state_num) {
 #endif
 
 void dbg_printf(const char* format, ...) {
-    // Route through dbg_print() — NOT vprintf().  vprintf writes to stdout, which
-    // on the ESP32 is UART0; on a wired pendant the FluidNC controller link is
-    // ALSO on UART0, so every dbg_printf() was injecting debug text straight into
-    // the control stream (bytes the controller reads as feed-override realtime
-    // commands → feed rate dropping mid-job).  dbg_print() honours DEBUG_TO_USB:
-    // it is a no-op in the shipped "nodebug" build, and in a debug build the
-    // controller is moved to UART1 so the USB/UART0 console is safe.
-    char buf[192];
+    // Never vprintf().  vprintf writes to stdout, which on the ESP32 is UART0;
+    // on a wired pendant the FluidNC controller link is ALSO on UART0, so every
+    // dbg_printf() was injecting debug text straight into the control stream
+    // (bytes the controller reads as feed-override realtime commands → feed
+    // rate dropping mid-job).  The deferred log (DebugLog.h) writes only to
+    // debugPort, and only with DEBUG_TO_USB, where the controller is moved to
+    // UART1 so the USB/UART0 console is safe.
     va_list args;
     va_start(args, format);
-    int n = vsnprintf(buf, sizeof(buf), format, args);
+    dbg_vlog(format, args);
     va_end(args);
-    if (n > 0) {
-        dbg_print(buf);
-    }
 }
 
 void dbg_print(const std::string& s) {
@@ -41,6 +38,5 @@ void dbg_println(const std::string& s) {
 }
 
 void dbg_println(const char* s) {
-    dbg_print(s);
-    dbg_print("\r\n");
+    dbg_log_str("%s\r\n", s);
 }
@@ -67,6 +67,11 @@ void system_background();
 bool screen_encoder(int x, int y, int& delta);
 bool screen_button_touched(bool pressed, int x, int y, int& button);
 bool switch_button_touched(bool& pressed, int& button);
+#ifdef USE_SCENE_TASKS
+// Raw, undebounced level of an external switch (0 = red, 2 = green).  Sampled
+// by the hardware task in SceneTasks.cpp, which owns those two buttons.
+bool switch_button_down(int button);
+#endif
 
 void deep_sleep(int us);
 
@@ -17,6 +17,11 @@
 #include "FluidNCModel.h"
 #include "NVS.h"
 #include "Comms.h"
+#include "CommsImpair.h"
+#include "DebugLog.h"
+#ifdef COMMS_CAPTURE
+#include "CommsCapture.h"
+#endif
 
 #include <Esp.h>  // ESP.restart()
 #include <freertos/FreeRTOS.h>
@@ -63,14 +68,50 @@ void ledcolor(int n) {
     digitalWrite(17, !(n & 4));
 }
 
+#ifndef COMMS_REPLAY_SPEED
+#    define COMMS_REPLAY_SPEED 100  // percent of the captured timing; 0 = flat out
+#endif
+
 extern "C" void poll_extra() {
+#if defined(COMMS_IMPAIR) || defined(COMMS_CAPTURE)
+    // Wrap on the first pass, after comms_init() has picked the backend the
+    // decorators have to wrap.  Impairment goes innermost so a capture
+    // records what the parser actually saw.
+    static bool wrapped = false;
+    if (!wrapped) {
+        wrapped = true;
+#    ifdef COMMS_IMPAIR
+        comms_impair(COMMS_IMPAIR);
+#    endif
+#    ifdef COMMS_CAPTURE
+        comms_record(true);
+#    endif
+    }
+#endif
 #ifdef DEBUG_TO_USB
     if (debugPort.available()) {
         char c = debugPort.read();
         if (c == 0x12) {  // CTRL-R
+            dbg_log_flush();
             ESP.restart();
             while (1) {}
         }
+#    ifdef COMMS_IMPAIR
+        if (c == 0x05) {  // CTRL-E: next link impairment profile
+            comms_impair((impair_profile() + 1) % impair_profile_count());
+            return;
+        }
+#    endif
+#    ifdef COMMS_CAPTURE
+        if (c == 0x17) {  // CTRL-W: write the capture ring to LittleFS
+            capture_save();
+            return;
+        }
+        if (c == 0x19) {  // CTRL-Y: replay the saved capture instead of the link
+            comms_replay(CAPTURE_PATH, COMMS_REPLAY_SPEED);
+            return;
+        }
+#    endif
         fnc_putchar(c);  // So you can type commands to FluidNC
     }
 #endif
@@ -93,6 +134,7 @@ extern void init_hardware();
 
 void init_system() {
     init_hardware();
+    dbg_log_start();  // lines logged so far are waiting in the ring
 
     if (!LittleFS.begin(FORMAT_LITTLEFS_IF_FAILED)) {
         dbg_println("LittleFS Mount Failed");
@@ -126,20 +168,13 @@ void delay_ms(uint32_t ms) {
     delay(ms);
 }
 
+// Both go through the deferred log in every build — see DebugLog.h.
 void dbg_write(uint8_t c) {
-#ifdef DEBUG_TO_USB
-    if (debugPort.availableForWrite() > 1) {
-        debugPort.write(c);
-    }
-#endif
+    dbg_printf("%c", c);
 }
 
 void dbg_print(const char* s) {
-#ifdef DEBUG_TO_USB
-    if (debugPort.availableForWrite() > strlen(s)) {
-        debugPort.print(s);
-    }
-#endif
+    dbg_log_str("%s", s);
 }
 
 nvs_handle_t nvs_init(const char* name) {
@@ -6,9 +6,12 @@
 // stdio.h must precede the include of M5Unified.h in System.h
 // in order for image files to work correctly
 #include "stdio.h"
+#include <stdlib.h>
 
 #include "System.h"
 #include "FluidNCModel.h"
+#include "CommsCapture.h"
+#include "CommsImpair.h"
 #include "M5GFX.h"
 #include "Drawing.h"
 #include "NVS.h"
@@ -250,23 +253,31 @@ HANDLE serial_open_com(char* portname) {  // Open COM port
 }
 
 extern char* comname;
+extern char* replayname;
+extern int   replayspeed;
 
 HANDLE hFNC;
 
+static void init_impair();
+
 void init_system() {
     lgfx::Panel_sdl::setup();
 
     auto cfg = M5.config();
     M5.begin(cfg);
 
-    hFNC = serial_open_com(comname);
-    if (hFNC == INVALID_HANDLE_VALUE) {
+    if (replayname) {
+        if (!replay_open(replayname, replayspeed)) {
+            exit(1);
+        }
+    } else if ((hFNC = serial_open_com(comname)) == INVALID_HANDLE_VALUE) {
         dbg_printf("Can't open %s\n", comname);
         exit(1);
 
     } else {
         serial_set_baud(hFNC, 115200);
     }
+    init_impair();
 
     // Make an offscreen canvas that can be copied to the screen all at once
     canvas.createSprite(display.width(), display.height());
@@ -287,11 +298,18 @@ void next_layout(int delta) {}
 
 void resetFlowControl() {}
 
-extern "C" void fnc_putchar(uint8_t c) {
+static void link_putchar(uint8_t c) {
+    if (replayname) {
+        replay_putchar(c);
+        return;
+    }
     serial_write(hFNC, &c, 1);
 }
 
-extern "C" int fnc_getchar() {
+static int link_getchar() {
+    if (replayname) {
+        return replay_getchar();
+    }
     char c;
     int  cnt = serial_timed_read_com(hFNC, &c, 1, 1);
     if (cnt > 0) {
@@ -304,6 +322,36 @@ extern "C" int fnc_getchar() {
     return -1;
 }
 
+// The link always goes through the impairment layer; profile 0 (the default)
+// is a passthrough.  FLUIDDIAL_IMPAIR=<index> picks another at startup.
+static void impair_down() {
+    hold_rx_time(true);
+}
+static void impair_up() {
+    hold_rx_time(false);
+}
+
+static void init_impair() {
+    impair_wrap(link_putchar, link_getchar);
+    impair_set_outage_hooks(impair_down, impair_up);
+    const char* env = getenv("FLUIDDIAL_IMPAIR");
+#ifdef COMMS_IMPAIR
+    impair_set_profile(env ? atoi(env) : COMMS_IMPAIR);
+#else
+    if (env) {
+        impair_set_profile(atoi(env));
+    }
+#endif
+}
+
+extern "C" void fnc_putchar(uint8_t c) {
+    impair_putchar(c);
+}
+
+extern "C" int fnc_getchar() {
+    return impair_getchar();
+}
+
 extern "C" void poll_extra() {}
 
 void dbg_write(uint8_t c) {
@@ -0,0 +1,286 @@
+// Copyright (c) 2026 — FluidDial-CYD
+// Use of this source code is governed by a GPLv3 license.
+
+// Per-task CPU and stack monitor.  See TaskMonitor.h.
+
+#ifdef ARDUINO
+
+#include "TaskMonitor.h"
+#include "System.h"
+#include "LinkRtt.h"
+#include "CommsUart.h"
+#include "OverridePlanner.h"
+#include "NetWorker.h"
+#include "DebugLog.h"
+#include "UiTimers.h"
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <esp_freertos_hooks.h>
+#include <string.h>
+
+#if configUSE_TRACE_FACILITY && configGENERATE_RUN_TIME_STATS
+#    define TM_RUNTIME_STATS 1
+#else
+#    define TM_RUNTIME_STATS 0
+#endif
+
+static portMUX_TYPE _tmMux = portMUX_INITIALIZER_UNLOCKED;
+
+static TaskStat _tasks[TASK_MONITOR_MAX_TASKS];
+static int      _nTasks = 0;
+
+static CoreLoad _cores[portNUM_PROCESSORS];
+static uint32_t _coreSum[portNUM_PROCESSORS];
+static uint32_t _windows = 0;
+
+#if !TM_RUNTIME_STATS
+// Without run-time stats, count idle-loop passes per core.  The hook returns
+// true, so the idle task WAITIs until the next interrupt and each pass is
+// roughly one wake-up.  The busiest-ever idle rate is taken as "100 % idle".
+static volatile uint32_t _idlePasses[portNUM_PROCESSORS];
+static uint32_t          _idleMax[portNUM_PROCESSORS];
+
+static bool idleHook0() {
+    _idlePasses[0]++;
+    return true;
+}
+#    if portNUM_PROCESSORS > 1
+static bool idleHook1() {
+    _idlePasses[1]++;
+    return true;
+}
+#    endif
+#endif
+
+// Caller holds _tmMux.  Keyed by name AND core: both idle tasks are "IDLE".
+static TaskStat* findOrAddTask(const char* name, int8_t core) {
+    for (int i = 0; i < _nTasks; i++) {
+        if (_tasks[i].core == core && strncmp(_tasks[i].name, name, sizeof(_tasks[i].name)) == 0) {
+            return &_tasks[i];
+        }
+    }
+    if (_nTasks >= TASK_MONITOR_MAX_TASKS) {
+        return nullptr;
+    }
+    TaskStat* t = &_tasks[_nTasks++];
+    strncpy(t->name, name, sizeof(t->name) - 1);
+    t->name[sizeof(t->name) - 1] = '\0';
+    t->minFreeStack              = UINT32_MAX;
+    t->core                      = core;
+    return t;
+}
+
+// Caller holds _tmMux.
+static void recordCore(int core, int busy) {
+    if (busy < 0) busy = 0;
+    if (busy > 100) busy = 100;
+    CoreLoad& c = _cores[core];
+    c.last      = busy;
+    if (_windows == 0 || busy < c.min) c.min = busy;
+    if (_windows == 0 || busy > c.max) c.max = busy;
+    _coreSum[core] += busy;
+    c.mean = _coreSum[core] / (_windows + 1);
+}
+
+#if configUSE_TRACE_FACILITY
+// Room for every task in the system — uxTaskGetSystemState() returns nothing
+// at all if the array is too small.  WiFi + Arduino runs about 20.
+#    define TM_STATUS_SLOTS 32
+static TaskStatus_t _status[TM_STATUS_SLOTS];
+static int8_t       _pct[TM_STATUS_SLOTS];
+#endif
+#if TM_RUNTIME_STATS
+static TaskHandle_t _lastHandle[TM_STATUS_SLOTS];
+static uint32_t     _lastRun[TM_STATUS_SLOTS];
+static uint32_t     _lastTotal = 0;
+#endif
+
+static void sample() {
+    int busy[portNUM_PROCESSORS] = {};
+
+#if configUSE_TRACE_FACILITY
+    uint32_t    totalRun = 0;
+    UBaseType_t n        = uxTaskGetSystemState(_status, TM_STATUS_SLOTS, &totalRun);
+#endif
+
+#if TM_RUNTIME_STATS
+    // Per-task share of the window, matched by handle against the last sample.
+    // Core busy % = 100 - that core's idle task share.
+    uint32_t window = totalRun - _lastTotal;
+    _lastTotal      = totalRun;
+    for (UBaseType_t i = 0; i < n; i++) {
+        uint32_t prev = _status[i].ulRunTimeCounter;
+        for (int j = 0; j < TM_STATUS_SLOTS; j++) {
+            if (_lastHandle[j] == _status[i].xHandle) {
+                prev = _lastRun[j];
+                break;
+            }
+        }
+        _pct[i] = window ? (int8_t)((uint64_t)(_status[i].ulRunTimeCounter - prev) * 100 / window) : -1;
+    }
+    for (int c = 0; c < portNUM_PROCESSORS; c++) {
+        TaskHandle_t idle = xTaskGetIdleTaskHandleForCPU(c);
+        busy[c]           = 100;
+        for (UBaseType_t i = 0; i < n; i++) {
+            if (_status[i].xHandle == idle && _pct[i] >= 0) busy[c] = 100 - _pct[i];
+        }
+    }
+    memset(_lastHandle, 0, sizeof(_lastHandle));
+    for (UBaseType_t i = 0; i < n; i++) {
+        _lastHandle[i] = _status[i].xHandle;
+        _lastRun[i]    = _status[i].ulRunTimeCounter;
+    }
+#else
+#    if configUSE_TRACE_FACILITY
+    memset(_pct, -1, sizeof(_pct));
+#    endif
+    for (int c = 0; c < portNUM_PROCESSORS; c++) {
+        uint32_t passes = _idlePasses[c];
+        _idlePasses[c]  = 0;
+        if (passes > _idleMax[c]) _idleMax[c] = passes;
+        busy[c] = _idleMax[c] ? 100 - (int)((uint64_t)passes * 100 / _idleMax[c]) : 0;
+    }
+#endif
+
+    portENTER_CRITICAL(&_tmMux);
+    for (int i = 0; i < _nTasks; i++) {
+        _tasks[i].alive = false;
+    }
+#if configUSE_TRACE_FACILITY
+    for (UBaseType_t i = 0; i < n; i++) {
+#    if configTASKLIST_INCLUDE_COREID
+        int8_t core = _status[i].xCoreID == tskNO_AFFINITY ? -1 : (int8_t)_status[i].xCoreID;
+#    else
+        int8_t core = -1;
+#    endif
+        TaskStat* t = findOrAddTask(_status[i].pcTaskName, core);
+        if (!t) continue;
+        t->alive = true;
+        t->cpu   = _pct[i];
+        if (_status[i].usStackHighWaterMark < t->minFreeStack) {
+            t->minFreeStack = _status[i].usStackHighWaterMark;  // bytes on ESP-IDF
+        }
+    }
+#endif
+    for (int c = 0; c < portNUM_PROCESSORS; c++) {
+        recordCore(c, busy[c]);
+    }
+    _windows++;
+    portEXIT_CRITICAL(&_tmMux);
+}
+
+static void report() {
+    CoreLoad c0, c1;
+    task_monitor_core(0, c0);
+#if portNUM_PROCESSORS > 1
+    task_monitor_core(1, c1);
+#else
+    c1 = c0;
+#endif
+    dbg_printf("CPU c0 %u%% (%u-%u avg %u)  c1 %u%% (%u-%u avg %u)%s\n",
+               c0.last, c0.min, c0.max, c0.mean, c1.last, c1.min, c1.max, c1.mean,
+               TM_RUNTIME_STATS ? "" : " est");
+
+    LinkRttStats a, st;
+    bool         haveAck    = link_rtt_ack_stats(a);
+    bool         haveStatus = link_rtt_status_stats(st);
+    if (haveAck || haveStatus) {
+        dbg_printf("RTT ack %d±%d p99 %d (%u) -> %d ms  status %d±%d p99 %d (%u) -> %d ms\n",
+                   a.srtt, a.rttvar, a.p99, (unsigned)a.samples, link_ack_timeout_ms(),
+                   st.srtt, st.rttvar, st.p99, (unsigned)st.samples, link_probe_timeout_ms());
+    }
+
+    OvrStats fo, so;
+    bool     haveFeed    = ovr_stats(OVR_FEED, fo);
+    bool     haveSpindle = ovr_stats(OVR_SPINDLE, so);
+    if (haveFeed || haveSpindle) {
+        dbg_printf("Ovr feed %d/%d/%d ms (%u, %u B, %u replans)  spindle %d/%d/%d ms (%u, %u B, %u replans)\n",
+                   fo.last_ms, fo.avg_ms, fo.max_ms, (unsigned)fo.changes, (unsigned)fo.bytes, (unsigned)fo.replans,
+                   so.last_ms, so.avg_ms, so.max_ms, (unsigned)so.changes, (unsigned)so.bytes, (unsigned)so.replans);
+    }
+
+    DbgLogStats ls;
+    dbg_log_stats(ls);
+    if (ls.dropped) {
+        dbg_printf("Log %u records, %u dropped, ring high water %d B\n",
+                   (unsigned)ls.records, (unsigned)ls.dropped, ls.high_water);
+    }
+
+    if (uint32_t po = uart_backend_pattern_overflows()) {
+        dbg_printf("UART line-end queue overflowed %u times\n", (unsigned)po);
+    }
+
+    UiTimerStats us;
+    ui_timers_stats(us);
+    dbg_printf("UI timers %d armed, %u fired  deferred %u (%u folded, %u dropped)\n",
+               us.armed, (unsigned)us.fired, (unsigned)us.deferred, (unsigned)us.folded, (unsigned)us.overflow);
+
+#ifdef USE_WIFI
+    for (int k = 0; k < NET_JOB_KINDS; k++) {
+        NetStats ns;
+        if (net_stats((NetJobKind)k, ns)) {
+            dbg_printf("Net %-6s %d/%d/%d ms wait<=%d (%u, %u failed, %u cancelled, %u expired)\n",
+                       net_kind_name((NetJobKind)k), ns.last_ms, ns.avg_ms, ns.max_ms, ns.wait_max_ms,
+                       (unsigned)ns.runs, (unsigned)ns.failed, (unsigned)ns.cancelled, (unsigned)ns.expired);
+        }
+    }
+#endif
+
+    TaskStat t[TASK_MONITOR_MAX_TASKS];
+    int      n = task_monitor_tasks(t, TASK_MONITOR_MAX_TASKS);
+    for (int i = 0; i < n; i++) {
+        dbg_printf("  %-16s core %2d  cpu %3d%%  stack free %5u%s\n",
+                   t[i].name, t[i].core, t[i].cpu, (unsigned)t[i].minFreeStack, t[i].alive ? "" : "  (exited)");
+    }
+}
+
+static void task_monitor_task(void* /*pvParameters*/) {
+    for (;;) {
+        vTaskDelay(pdMS_TO_TICKS(TASK_MONITOR_PERIOD_MS));
+        sample();
+        report();
+    }
+}
+
+void task_monitor_start() {
+#if !TM_RUNTIME_STATS
+    esp_register_freertos_idle_hook_for_cpu(idleHook0, 0);
+#    if portNUM_PROCESSORS > 1
+    esp_register_freertos_idle_hook_for_cpu(idleHook1, 1);
+#    endif
+#endif
+    // Unpinned, lowest application priority: it must never be the thing that
+    // shows up as load.  Its own stack is reported alongside the others.
+    xTaskCreate(task_monitor_task, "TaskMonitor", 4096, nullptr, 1, nullptr);
+}
+
+bool task_monitor_core(int core, CoreLoad& out) {
+    if (core < 0 || core >= portNUM_PROCESSORS) return false;
+    portENTER_CRITICAL(&_tmMux);
+    out       = _cores[core];
+    bool have = _windows > 0;
+    portEXIT_CRITICAL(&_tmMux);
+    return have;
+}
+
+int task_monitor_tasks(TaskStat* out, int max) {
+    portENTER_CRITICAL(&_tmMux);
+    int n = _nTasks < max ? _nTasks : max;
+    memcpy(out, _tasks, n * sizeof(TaskStat));
+    portEXIT_CRITICAL(&_tmMux);
+
+    // Insertion sort — a couple of dozen entries; tightest stack first.
+    for (int i = 1; i < n; i++) {
+        TaskStat t = out[i];
+        int      j = i - 1;
+        while (j >= 0 && out[j].minFreeStack > t.minFreeStack) {
+            out[j + 1] = out[j];
+            j--;
+        }
+        out[j + 1] = t;
+    }
+    return n;
+}
+
+#endif  // ARDUINO
@@ -0,0 +1,43 @@
+// Copyright (c) 2026 — FluidDial-CYD
+// Use of this source code is governed by a GPLv3 license.
+
+#pragma once
+#include <stdint.h>
+
+// ── Per-task CPU and stack monitor ───────────────────────────────────────────
+//
+// A low-priority task samples FreeRTOS every TASK_MONITOR_PERIOD_MS and keeps
+//   • per core: busy % of the last window, plus min / max / mean since boot
+//   • per task: lowest free stack ever seen (bytes), core, CPU % last window
+// A task that exits keeps its entry so its worst-case stack use is still
+// visible.  DNS lookups and macro fetches run as jobs on the NetWorker task,
+// so their stack use shows up there.  Each sample is also printed to the
+// debug port, which is what you want when right-sizing stack allocations.
+//
+// CPU figures come from FreeRTOS run-time stats when the SDK was built with
+// them; otherwise they are estimated from idle-hook wake-ups per core, and the
+// per-task CPU column reads -1.
+
+#define TASK_MONITOR_PERIOD_MS 5000
+#define TASK_MONITOR_MAX_TASKS 24
+
+struct CoreLoad {
+    uint8_t last;   // busy % over the most recent window
+    uint8_t min;
+    uint8_t max;
+    uint8_t mean;   // mean of all windows since boot
+};
+
+struct TaskStat {
+    char     name[16];
+    uint32_t minFreeStack;  // bytes; smallest high-water mark observed
+    int8_t   core;          // -1 = not pinned
+    int8_t   cpu;           // % of one core over the last window, -1 if unknown
+    bool     alive;         // false once the task has exited
+};
+
+void task_monitor_start();
+
+// Snapshots for the diagnostics screen — safe to call from any task.
+bool task_monitor_core(int core, CoreLoad& out);   // false before the first window
+int  task_monitor_tasks(TaskStat* out, int max);   // sorted by least free stack first
@@ -3,6 +3,7 @@
 
 #include "Text.h"
 #include <map>
+#include <cstring>
 
 const GFXfont* font[] = {
     // lgfx::v1::IFont* font[] = {
@@ -36,7 +37,49 @@ void centered_text(const char* msg, int y, int color, fontnum_t fontnum) {
     text(msg, canvas.width() / 2, y, color, fontnum);
 }
 
-void auto_text(const std::string& txt, int x, int y, int w, int color, fontnum_t fontnum, int datum, bool tryfonts, bool trimleft) {
+// ── Text-fit cache ──────────────────────────────────────────────────────────
+// auto_text() is called for the same labels on every redraw, and fitting one
+// costs a textWidth() per candidate font plus one per trimmed character.  The
+// result depends only on (text, width, starting font, tryfonts, trimleft), so
+// it is memoized in a small fixed table.  A 32-bit FNV-1a hash of those inputs
+// finds the candidate quickly; a hit is confirmed against the stored text and
+// parameters, so a collision can't return another label's fit.  Texts of
+// FIT_TEXT_MAX or more are not cached (rare, and just take the slow path).
+// Replacement is LRU.
+static const int FIT_CACHE_SIZE = 16;
+static const int FIT_TEXT_MAX   = 48;
+
+struct FitEntry {
+    uint32_t  key;
+    uint32_t  params;     // w, fontnum, tryfonts, trimleft as fit_params() packs them
+    uint16_t  len;        // input length
+    uint16_t  width;      // pixel width of the fitted text in its font
+    fontnum_t fontnum;    // font actually chosen
+    uint32_t  lastUse;    // LRU stamp; 0 = empty slot
+    char      input[FIT_TEXT_MAX];
+    char      fitted[FIT_TEXT_MAX];
+};
+
+static FitEntry _fitCache[FIT_CACHE_SIZE];
+static uint32_t _fitClock;
+
+static uint32_t fit_params(int w, fontnum_t fontnum, bool tryfonts, bool trimleft) {
+    return (uint32_t)(w & 0xffff) | ((uint32_t)fontnum << 16) | ((uint32_t)tryfonts << 24) | ((uint32_t)trimleft << 25);
+}
+
+static uint32_t fit_key(const std::string& txt, uint32_t params) {
+    uint32_t h = 2166136261u;
+    for (unsigned char c : txt) {
+        h = (h ^ c) * 16777619u;
+    }
+    for (int i = 0; i < 4; i++) {
+        h = (h ^ ((params >> (i * 8)) & 0xff)) * 16777619u;
+    }
+    return h;
+}
+
+// Pick the font and trimmed text for txt in width w (the uncached layout).
+static fontnum_t fit_text(const std::string& txt, int w, fontnum_t fontnum, bool tryfonts, bool trimleft, std::string& s) {
     bool doesnotfit = true;
     while (true) {  // forever loop
         int f = fontnum;
@@ -51,10 +94,13 @@ void auto_text(const std::string& txt, int x, int y, int w, int color, fontnum_t
         }
     }
 
-    std::string s(txt);
+    s = txt;
 
     if (doesnotfit) {
-        int dotswidth = canvas.textWidth(" ...");
+        // Measure in the font the text will be drawn in, not whatever font
+        // the canvas was last left with — the result is then a pure function
+        // of the inputs, which is what makes it cacheable.
+        int dotswidth = canvas.textWidth(" ...", font[fontnum]);
 
         while (s.length() > 4) {
             if (trimleft) {
@@ -62,7 +108,7 @@ void auto_text(const std::string& txt, int x, int y, int w, int color, fontnum_t
             } else {
                 s.erase(s.length() - 1);
             }
-            if (canvas.textWidth(s.c_str()) + dotswidth <= w) {
+            if (canvas.textWidth(s.c_str(), font[fontnum]) + dotswidth <= w) {
                 if (trimleft) {
                     s.insert(0, "... ");
                 } else {
@@ -72,8 +118,46 @@ void auto_text(const std::string& txt, int x, int y, int w, int color, fontnum_t
             }
         }
     }
+    return fontnum;
+}
+
+text_fit_t auto_text_fit(const std::string& txt, int w, fontnum_t fontnum, bool tryfonts, bool trimleft) {
+    uint32_t params = fit_params(w, fontnum, tryfonts, trimleft);
+    uint32_t key    = fit_key(txt, params);
+
+    FitEntry* victim = &_fitCache[0];
+    for (auto& e : _fitCache) {
+        if (e.lastUse && e.key == key && e.params == params && e.len == txt.length() &&
+            memcmp(e.input, txt.data(), e.len) == 0) {
+            e.lastUse = ++_fitClock;
+            return { e.fontnum, e.fitted, e.width };
+        }
+        if (e.lastUse < victim->lastUse) {
+            victim = &e;
+        }
+    }
 
-    text(s, x, y, color, fontnum, datum);
+    static std::string s;  // holds an uncacheable (over-long) result until the next call
+    fontnum   = fit_text(txt, w, fontnum, tryfonts, trimleft, s);
+    int width = canvas.textWidth(s.c_str(), font[fontnum]);
+
+    if (txt.length() >= FIT_TEXT_MAX || s.length() >= FIT_TEXT_MAX) {
+        return { fontnum, s.c_str(), width };
+    }
+    victim->key     = key;
+    victim->params  = params;
+    victim->len     = txt.length();
+    victim->width   = width;
+    victim->fontnum = fontnum;
+    victim->lastUse = ++_fitClock;
+    memcpy(victim->input, txt.data(), txt.length());
+    memcpy(victim->fitted, s.c_str(), s.length() + 1);
+    return { fontnum, victim->fitted, width };
+}
+
+void auto_text(const std::string& txt, int x, int y, int w, int color, fontnum_t fontnum, int datum, bool tryfonts, bool trimleft) {
+    text_fit_t fit = auto_text_fit(txt, w, fontnum, tryfonts, trimleft);
+    text(fit.text, x, y, color, fit.fontnum, datum);
 }
 void auto_text(const std::string& txt, Point xy, int w, int color, fontnum_t fontnum, int datum, bool tryfonts, bool trimleft) {
     Point dispxy = xy.to_display();
@@ -15,6 +15,17 @@ enum fontnum_t {
     MEDIUM_MONO = 4,
 };
 
+// Layout chosen by auto_text(): the font, the (possibly " ..."-trimmed) text and
+// its pixel width.  Results are memoized, so repeat calls for the same label are
+// cheap.  text points into the cache and is valid until the next auto_text call.
+struct text_fit_t {
+    fontnum_t   fontnum;
+    const char* text;
+    int         width;
+};
+
+text_fit_t auto_text_fit(const std::string& txt, int w, fontnum_t fontnum = MEDIUM, bool tryfonts = true, bool trimleft = false);
+
 // adjusts text to fit in (w) display area. reduces font size until it. tryfonts::false just uses fontnum
 void auto_text(const std::string& txt,
                int                x,
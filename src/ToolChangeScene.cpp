@@ -3,6 +3,7 @@
 
 #include <string>
 #include "Scene.h"
+#include "CommandQueue.h"  // cmd_abort()
 #include "e4math.h"
 
 class ToolChangeScene : public Scene {
@@ -37,6 +38,7 @@ public:
             case Hold:
             case Cycle:
                 fnc_realtime(Reset);
+                cmd_abort();
                 break;
 
             default:
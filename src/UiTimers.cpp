@@ -0,0 +1,304 @@
+// Copyright (c) 2026 — FluidDial-CYD
+// Use of this source code is governed by a GPLv3 license.
+
+// UI timer wheel and deferred-action queue.  See UiTimers.h.
+
+#include "UiTimers.h"
+#include "System.h"       // dbg_printf
+#include "GrblParserC.h"  // milliseconds()
+
+#ifdef ARDUINO
+#    include <freertos/FreeRTOS.h>
+static portMUX_TYPE _deferMux = portMUX_INITIALIZER_UNLOCKED;
+#    define DEFER_LOCK()   portENTER_CRITICAL(&_deferMux)
+#    define DEFER_UNLOCK() portEXIT_CRITICAL(&_deferMux)
+#else
+#    define DEFER_LOCK()
+#    define DEFER_UNLOCK()
+#endif
+
+// ── Wheel ────────────────────────────────────────────────────────────────────
+// Level 0 holds timers due within 64 ticks, one slot per tick.  Level 1 slots
+// span 64 ticks and level 2 slots 64² ticks; when level 0 wraps, the level 1
+// slot whose span starts now is emptied back into the wheel (and level 2's
+// likewise when level 1 wraps), so every timer reaches level 0 before it is
+// due.  A timer further out than the wheel reaches parks in the last level 2
+// slot and is placed again when that slot cascades.
+
+#define LVL_BITS  6
+#define LVL_SIZE  (1 << LVL_BITS)
+#define LVL_MASK  (LVL_SIZE - 1)
+#define LEVELS    3
+#define WHEEL_MAX ((1UL << (LVL_BITS * LEVELS)) - 1)  // ticks
+
+static UiTimer* _slots[LEVELS * LVL_SIZE];
+static uint64_t _occupied[LEVELS];  // bit per non-empty slot
+static uint32_t _tick    = 0;       // every timer due at or before this has fired
+static bool     _started = false;
+static int      _armed   = 0;
+static uint32_t _fired   = 0;
+
+// The tick clock advances by whole ticks of elapsed milliseconds and keeps
+// the remainder, so it runs straight through the 32-bit millisecond wrap
+// (milliseconds() / UI_TICK_MS would jump back at 49.7 days).
+static uint32_t _clockTick = 0;
+static uint32_t _clockMs   = 0;  // milliseconds() at _clockTick
+
+static uint32_t now_tick() {
+    uint32_t steps = ((uint32_t)milliseconds() - _clockMs) / UI_TICK_MS;
+    _clockTick += steps;
+    _clockMs += steps * UI_TICK_MS;
+    return _clockTick;
+}
+
+// Milliseconds since the current tick began, 0..UI_TICK_MS-1.
+static uint32_t tick_phase_ms() {
+    return (uint32_t)milliseconds() - _clockMs;
+}
+
+static void start() {
+    if (!_started) {
+        _clockMs = (uint32_t)milliseconds();
+        _tick    = now_tick();
+        _started = true;
+    }
+}
+
+static void link(UiTimer* t) {
+    uint32_t d   = t->due - _tick;
+    uint32_t pos = t->due;
+    int      lvl;
+    if ((int32_t)d < LVL_SIZE) {  // includes 0: put back by a cascade this tick
+        lvl = 0;
+    } else if (d < (1UL << (2 * LVL_BITS))) {
+        lvl = 1;
+    } else {
+        lvl = 2;
+        if (d > WHEEL_MAX) {
+            pos = _tick + WHEEL_MAX;
+        }
+    }
+    int       idx  = (pos >> (lvl * LVL_BITS)) & LVL_MASK;
+    int       slot = lvl * LVL_SIZE + idx;
+    UiTimer*& head = _slots[slot];
+    t->next        = head;
+    t->pprev       = &head;
+    if (head) {
+        head->pprev = &t->next;
+    }
+    head    = t;
+    t->slot = slot;
+    _occupied[lvl] |= 1ULL << idx;
+    _armed++;
+}
+
+static void unlink(UiTimer* t) {
+    *t->pprev = t->next;
+    if (t->next) {
+        t->next->pprev = t->pprev;
+    }
+    t->next  = nullptr;
+    t->pprev = nullptr;
+    // Bit set ⇔ slot non-empty, so this is also right for a node taken off a
+    // detached list whose slot has since been refilled or left empty.
+    if (!_slots[t->slot]) {
+        _occupied[t->slot / LVL_SIZE] &= ~(1ULL << (t->slot % LVL_SIZE));
+    }
+    _armed--;
+}
+
+// Takes a whole slot's list off the wheel.  The nodes stay linked to each
+// other through `list`, so a callback can still cancel one that hasn't fired.
+static void detach(int slot, UiTimer*& list) {
+    list = _slots[slot];
+    if (list) {
+        _slots[slot] = nullptr;
+        list->pprev  = &list;
+        _occupied[slot / LVL_SIZE] &= ~(1ULL << (slot % LVL_SIZE));
+    }
+}
+
+static void cascade(int lvl) {
+    UiTimer* list;
+    detach(lvl * LVL_SIZE + ((_tick >> (lvl * LVL_BITS)) & LVL_MASK), list);
+    while (list) {
+        UiTimer* t = list;
+        unlink(t);
+        link(t);
+    }
+}
+
+void ui_timer_arm(UiTimer& t, uint32_t delay_ms, UiTimerFn fn, void* ctx, uint32_t period_ms) {
+    start();
+    if (t.pprev) {
+        unlink(&t);
+    }
+    uint32_t now = now_tick();
+    t.due        = now + (tick_phase_ms() + delay_ms + UI_TICK_MS - 1) / UI_TICK_MS;  // never early
+    if ((int32_t)(t.due - now) < 1) {
+        t.due = now + 1;
+    }
+    t.period     = period_ms ? (period_ms + UI_TICK_MS - 1) / UI_TICK_MS : 0;
+    t.fn         = fn;
+    t.ctx        = ctx;
+    link(&t);
+}
+
+void ui_timer_cancel(UiTimer& t) {
+    if (t.pprev) {
+        unlink(&t);
+    }
+}
+
+// ── Deferred actions ─────────────────────────────────────────────────────────
+
+static UiDeferFn _defer[UI_DEFER_SLOTS];
+static int       _deferHead  = 0;
+static int       _deferCount = 0;
+static uint32_t  _deferred   = 0;
+static uint32_t  _folded     = 0;
+static uint32_t  _overflow   = 0;
+
+void ui_defer(UiDeferFn fn) {
+    DEFER_LOCK();
+    for (int i = 0; i < _deferCount; i++) {
+        if (_defer[(_deferHead + i) % UI_DEFER_SLOTS] == fn) {
+            _folded++;
+            DEFER_UNLOCK();
+            return;
+        }
+    }
+    if (_deferCount == UI_DEFER_SLOTS) {
+        _overflow++;
+        DEFER_UNLOCK();
+        dbg_println("UiTimers: deferred queue full, action dropped");
+        return;
+    }
+    _defer[(_deferHead + _deferCount) % UI_DEFER_SLOTS] = fn;
+    _deferCount++;
+    _deferred++;
+    DEFER_UNLOCK();
+}
+
+// Runs what was queued when it started; anything deferred meanwhile waits
+// for the next pass, so an action that defers itself can't spin here.
+static bool run_deferred() {
+    DEFER_LOCK();
+    int n = _deferCount;
+    DEFER_UNLOCK();
+    for (int i = 0; i < n; i++) {
+        DEFER_LOCK();
+        UiDeferFn fn = _defer[_deferHead];
+        _deferHead   = (_deferHead + 1) % UI_DEFER_SLOTS;
+        _deferCount--;
+        DEFER_UNLOCK();
+        fn();
+    }
+    return n != 0;
+}
+
+// ── Running ──────────────────────────────────────────────────────────────────
+
+bool ui_timers_run() {
+    start();
+    uint32_t target = now_tick();
+    while ((int32_t)(target - _tick) > 0) {
+        if (!_armed) {
+            _tick = target;
+            break;
+        }
+        if (!_occupied[0]) {
+            // Nothing on level 0: skip straight to the next cascade point.
+            uint32_t boundary = (_tick | LVL_MASK) + 1;
+            if ((int32_t)(target - boundary) < 0) {
+                _tick = target;
+                break;
+            }
+            _tick = boundary - 1;
+        }
+        _tick++;
+        if (!(_tick & LVL_MASK)) {
+            if (!((_tick >> LVL_BITS) & LVL_MASK)) {
+                cascade(2);
+            }
+            cascade(1);
+        }
+        UiTimer* list;
+        detach(_tick & LVL_MASK, list);
+        while (list) {
+            UiTimer* t = list;
+            unlink(t);
+            if ((int32_t)(t->due - _tick) > 0) {  // parked beyond the wheel
+                link(t);
+                continue;
+            }
+            if (t->period) {
+                // Missed periods while the loop was busy are dropped, not
+                // replayed back to back.
+                t->due += t->period;
+                if ((int32_t)(t->due - target) <= 0) {
+                    t->due = target + t->period;
+                }
+                link(t);
+            }
+            _fired++;
+            t->fn(t->ctx);
+        }
+    }
+    return run_deferred();
+}
+
+// Smallest k in 1..64 such that bit (from + k) mod 64 is set, or 0.
+static int next_set(uint64_t bits, int from) {
+    if (!bits) {
+        return 0;
+    }
+    int r = (from + 1) & LVL_MASK;
+    if (r) {
+        bits = (bits >> r) | (bits << (LVL_SIZE - r));
+    }
+    return __builtin_ctzll(bits) + 1;
+}
+
+uint32_t ui_timers_idle_ms(uint32_t cap_ms) {
+    DEFER_LOCK();
+    bool pending = _deferCount != 0;
+    DEFER_UNLOCK();
+    if (pending) {
+        return 0;
+    }
+    if (!_armed) {
+        return cap_ms;
+    }
+    uint32_t next = 0;
+    bool     have = false;
+    for (int lvl = 0; lvl < LEVELS; lvl++) {
+        int      shift = lvl * LVL_BITS;
+        uint32_t base  = _tick >> shift;
+        int      k     = next_set(_occupied[lvl], base & LVL_MASK);
+        if (k) {
+            uint32_t t = (base + k) << shift;  // when that slot fires or cascades
+            if (!have || (int32_t)(t - next) < 0) {
+                next = t;
+                have = true;
+            }
+        }
+    }
+    int32_t ticks = (int32_t)(next - now_tick());
+    if (ticks <= 0) {
+        return 0;
+    }
+    int32_t ms = ticks * UI_TICK_MS - (int32_t)tick_phase_ms();
+    if (ms <= 0) {
+        return 0;
+    }
+    return (uint32_t)ms < cap_ms ? (uint32_t)ms : cap_ms;
+}
+
+void ui_timers_stats(UiTimerStats& out) {
+    out.armed    = _armed;
+    out.fired    = _fired;
+    out.deferred = _deferred;
+    out.folded   = _folded;
+    out.overflow = _overflow;
+}
@@ -0,0 +1,73 @@
+// Copyright (c) 2026 — FluidDial-CYD
+// Use of this source code is governed by a GPLv3 license.
+
+#pragma once
+#include <stdint.h>
+
+// ── UI timers and deferred actions ───────────────────────────────────────────
+//
+// UI deadlines — the periodic sprite refresh, the screen-sleep timeout, the
+// "Loading…" safety deadlines — are UiTimers on a hierarchical timer wheel
+// (three levels of 64 slots, 10 ms per tick, ~43 min of range) instead of
+// millis() stamps re-checked on every pass.  Arming and cancelling unlink or
+// link one node, so re-arming on every touch costs the same as a store; only
+// timers that are actually due are visited.
+//
+// A UiTimer is owned by the caller (usually a static or a member of a screen
+// state struct) and must stay put while armed.  Zero-initialised is
+// disarmed.  Timers belong to the UI task: arm, cancel and run them only
+// from there.  The callback runs from ui_timers_run(), already disarmed for
+// a one-shot timer, so it may re-arm itself.
+//
+// ui_defer() queues a plain function to run on the UI task after the current
+// pass — it replaces the single schedule_action() slot, where a second call
+// before the first ran simply overwrote it.  It may be called from either
+// core.  Deferring a function that is already queued is folded into the
+// pending call rather than queued twice; distinct functions run in order.
+// Because of that folding the queue only fills if UI_DEFER_SLOTS different
+// functions are pending at once; that is logged and counted.
+
+#define UI_TICK_MS     10
+#define UI_DEFER_SLOTS 16
+
+typedef void (*UiTimerFn)(void* ctx);
+typedef void (*UiDeferFn)(void);
+
+struct UiTimer {
+    UiTimer*  next;
+    UiTimer** pprev;   // nullptr while disarmed
+    uint32_t  due;     // tick
+    uint32_t  period;  // ticks; 0 = one-shot
+    UiTimerFn fn;
+    void*     ctx;
+    uint8_t   slot;    // wheel slot holding it, for the occupancy bitmap
+};
+
+// (Re)arm `t` to call fn(ctx) after delay_ms, then every period_ms if that
+// is non-zero.  Re-arming an armed timer moves it.
+void ui_timer_arm(UiTimer& t, uint32_t delay_ms, UiTimerFn fn, void* ctx = nullptr, uint32_t period_ms = 0);
+void ui_timer_cancel(UiTimer& t);
+
+inline bool ui_timer_armed(const UiTimer& t) {
+    return t.pprev != nullptr;
+}
+
+void ui_defer(UiDeferFn fn);
+
+// Fires every timer that is due, then runs the deferred queue.  Returns true
+// if a deferred action ran.
+bool ui_timers_run();
+
+// Milliseconds until the UI task next has timer work, at most cap_ms; 0 when
+// some is already due or deferred.  A timer on an outer wheel level reports
+// the time until it cascades, so the answer may be early, never late.
+uint32_t ui_timers_idle_ms(uint32_t cap_ms);
+
+struct UiTimerStats {
+    int      armed;
+    uint32_t fired;
+    uint32_t deferred;
+    uint32_t folded;    // ui_defer() of a function already pending
+    uint32_t overflow;  // ui_defer() with the queue full — dropped
+};
+void ui_timers_stats(UiTimerStats& out);
@@ -0,0 +1,230 @@
+// Copyright (c) 2026 — FluidDial-CYD
+// Use of this source code is governed by a GPLv3 license.
+
+// Work-offset table and its "$#" refresh.  See WcsOffsets.h.
+
+#include "WcsOffsets.h"
+#include "FluidNCModel.h"  // state, milliseconds()
+#include "CommandQueue.h"
+#include "System.h"        // dbg_printf
+
+#include <string.h>
+
+#ifdef ARDUINO
+#    include <freertos/FreeRTOS.h>
+static portMUX_TYPE _wcsMux = portMUX_INITIALIZER_UNLOCKED;
+#    define WCS_LOCK()   portENTER_CRITICAL(&_wcsMux)
+#    define WCS_UNLOCK() portEXIT_CRITICAL(&_wcsMux)
+#else
+#    define WCS_LOCK()
+#    define WCS_UNLOCK()
+#endif
+
+#define WCS_RETRY_MS 1000  // after a "$#" that failed or lost its ack
+
+static const char* const _names[WCS_COUNT] = {
+    "G54", "G55", "G56", "G57", "G58", "G59", "G59.1", "G59.2", "G59.3", "G28", "G30", "G92", "TLO",
+};
+
+static WcsOffset         _table[WCS_COUNT];
+static volatile uint32_t _generation = 0;
+static volatile bool     _wanted     = true;   // first query once connected
+static volatile bool     _inFlight   = false;
+static uint32_t          _retryAt    = 0;
+
+const char* wcs_name(int id) {
+    return (id >= 0 && id < WCS_COUNT) ? _names[id] : "";
+}
+
+bool wcs_get(int id, WcsOffset& out) {
+    if (id < 0 || id >= WCS_COUNT) {
+        return false;
+    }
+    WCS_LOCK();
+    out = _table[id];
+    WCS_UNLOCK();
+    return out.valid;
+}
+
+uint32_t wcs_generation() {
+    return _generation;
+}
+
+void wcs_invalidate() {
+    _wanted = true;
+}
+
+void wcs_note_probe() {
+    if (!_inFlight) {  // the "$#" reply itself repeats the last [PRB:]
+        _wanted = true;
+    }
+}
+
+void wcs_reset() {
+    WCS_LOCK();
+    for (auto& e : _table) {
+        e.valid = false;
+    }
+    WCS_UNLOCK();
+    _generation++;
+    _inFlight = false;
+    _wanted   = true;  // asked for again once the link is back
+}
+
+// ── Outgoing lines ───────────────────────────────────────────────────────────
+
+// G-word value ×10 (G92.1 → 921) for the words that change an offset.
+static bool moves_offset(int g) {
+    switch (g) {
+        case 100:  // G10 L2 / L20
+        case 920:  // G92
+        case 921:
+        case 922:
+        case 923:
+        case 281:  // G28.1
+        case 301:  // G30.1
+        case 431:  // G43.1
+        case 490:  // G49
+            return true;
+        default:
+            return false;
+    }
+}
+
+void wcs_note_line(const char* line) {
+    const char* p = line;
+    while (*p == ' ') p++;
+    if (*p == '$') {
+        return;  // settings and $J= jogs
+    }
+    while (*p && *p != ';') {
+        if (*p == '(') {
+            while (*p && *p != ')') p++;
+            if (*p) p++;
+            continue;
+        }
+        if (*p != 'G' && *p != 'g') {
+            p++;
+            continue;
+        }
+        p++;
+        while (*p == ' ') p++;
+        int g = 0;
+        while (*p >= '0' && *p <= '9') g = g * 10 + (*p++ - '0');
+        g *= 10;
+        if (*p == '.') {
+            p++;
+            if (*p >= '0' && *p <= '9') g += *p++ - '0';
+            while (*p >= '0' && *p <= '9') p++;
+        }
+        if (moves_offset(g)) {
+            _wanted = true;
+            return;
+        }
+    }
+}
+
+// ── Incoming "$#" lines ──────────────────────────────────────────────────────
+
+// "-12.3456" → -123456, rounding past the fourth decimal.
+static const char* parse_e4(const char* p, int32_t& out) {
+    bool neg = false;
+    if (*p == '-' || *p == '+') neg = *p++ == '-';
+    if (!(*p >= '0' && *p <= '9') && *p != '.') {
+        return nullptr;
+    }
+    int32_t v = 0;
+    while (*p >= '0' && *p <= '9') v = v * 10 + (*p++ - '0');
+    int frac = 0;
+    if (*p == '.') {
+        p++;
+        for (; *p >= '0' && *p <= '9'; p++) {
+            if (frac < 4) {
+                v = v * 10 + (*p - '0');
+                frac++;
+            } else if (frac == 4) {
+                if (*p >= '5') v++;
+                frac++;
+            }
+        }
+    }
+    for (; frac < 4; frac++) v *= 10;
+    out = neg ? -v : v;
+    return p;
+}
+
+bool wcs_parse_line(const char* line) {
+    if (*line != '[') {
+        return false;
+    }
+    const char* colon = strchr(line, ':');
+    if (!colon) {
+        return false;
+    }
+    size_t len = colon - (line + 1);
+    int    id  = -1;
+    for (int i = 0; i < WCS_COUNT; i++) {
+        if (strlen(_names[i]) == len && strncmp(line + 1, _names[i], len) == 0) {
+            id = i;
+            break;
+        }
+    }
+    if (id < 0) {
+        return false;
+    }
+
+    WcsOffset   e = {};
+    const char* p = colon + 1;
+    while (e.n < WCS_AXES) {
+        p = parse_e4(p, e.e4[e.n]);
+        if (!p) {
+            return true;  // ours, but garbled: leave the old entry
+        }
+        e.n++;
+        if (*p != ',') break;
+        p++;
+    }
+    e.valid = true;
+
+    WCS_LOCK();
+    WcsOffset& cur     = _table[id];
+    bool       changed = !cur.valid || cur.n != e.n || memcmp(cur.e4, e.e4, sizeof(e.e4)) != 0;
+    cur                = e;
+    WCS_UNLOCK();
+    if (changed) {
+        _generation++;
+    }
+    return true;
+}
+
+// ── Refresh ──────────────────────────────────────────────────────────────────
+
+static void query_done(const CmdResult& r, void* /*ctx*/) {
+    _inFlight = false;
+    if (r.status != CMD_OK) {
+        dbg_printf("WCS: $# failed (%d)\n", (int)r.status);
+        _wanted  = true;
+        _retryAt = milliseconds() + WCS_RETRY_MS;
+    }
+}
+
+void wcs_poll() {
+    if (!_wanted || _inFlight) {
+        return;
+    }
+    if (state != Idle && state != Alarm) {
+        return;  // after the motion, not in the middle of it
+    }
+    if (cmd_queued() || cmd_in_flight()) {
+        return;  // let the lines that moved an offset land first
+    }
+    if ((int32_t)(milliseconds() - _retryAt) < 0) {
+        return;
+    }
+    _wanted   = false;
+    _inFlight = true;
+    if (!cmd_submit("$#", query_done)) {
+        _inFlight = false;
+        _wanted   = true;
+    }
+}
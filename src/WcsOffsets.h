@@ -0,0 +1,65 @@
+// Copyright (c) 2026 — FluidDial-CYD
+// Use of this source code is governed by a GPLv3 license.
+
+#pragma once
+#include <stdint.h>
+
+// ── Work-offset table ────────────────────────────────────────────────────────
+//
+// A local copy of the controller's coordinate-system parameters — G54…G59,
+// G59.1…G59.3 where the firmware has them, the G28/G30 stored positions,
+// the G92 offset and the tool length offset — so screens can show any of
+// them without a round trip.
+//
+// The table is filled by one "$#" query.  Its reply lines
+// ("[G54:1.000,2.000,0.000]", "[TLO:0.000]") are parsed one at a time as
+// handle_other() hands them over; nothing is buffered.  A refresh is wanted
+// on connect, whenever the pendant itself sends a line that changes an
+// offset (G10, G92*, G28.1, G30.1, G43.1, G49 — send_line() and
+// send_line_nowait() watch for them) and when a probe completes.  The query
+// goes out from wcs_poll() once the command queue has drained and the
+// machine is Idle or Alarm, so a probe routine that ends in G10 L20 costs a
+// single "$#" after its last line, and the result is the controller's own.
+//
+// Values are mm in e4 fixed point, as reported.  Written on the comms core,
+// read anywhere through wcs_get().
+
+#define WCS_AXES 6
+
+enum wcs_id_t {
+    WCS_G54 = 0,
+    WCS_G55,
+    WCS_G56,
+    WCS_G57,
+    WCS_G58,
+    WCS_G59,
+    WCS_G59_1,
+    WCS_G59_2,
+    WCS_G59_3,
+    WCS_G28,
+    WCS_G30,
+    WCS_G92,
+    WCS_TLO,
+    WCS_COUNT
+};
+
+struct WcsOffset {
+    bool    valid;  // reported since connect
+    int     n;      // values reported (TLO has one)
+    int32_t e4[WCS_AXES];
+};
+
+const char* wcs_name(int id);  // "G54" … "TLO"
+
+// Copies one entry.  False if it hasn't been reported.
+bool wcs_get(int id, WcsOffset& out);
+
+// Bumped whenever any entry changes, so a screen can redraw only then.
+uint32_t wcs_generation();
+
+void wcs_invalidate();                   // ask for a refresh
+void wcs_note_line(const char* line);    // outgoing line: refresh if it moves an offset
+void wcs_note_probe();                   // a [PRB:] report arrived
+bool wcs_parse_line(const char* line);   // incoming "[Gxx:...]"; true if consumed
+void wcs_poll();                         // comms task: send "$#" when it's due
+void wcs_reset();                        // link lost: forget everything
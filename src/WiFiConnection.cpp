@@ -35,7 +35,10 @@
 #ifdef ARDUINO
 
 #include "WiFiConnection.h"
+#include "FluidNCDiscovery.h"
 #include "FluidNCModel.h"
+#include "LinkRtt.h"
+#include "NetWorker.h"
 #include "System.h"
 
 // Boot-stage tracker (RTC memory) — defined in ardmain.cpp.  Updated at key
@@ -51,6 +54,7 @@ extern uint32_t rtcLastBootStage;
 #include <WebSocketsClient.h>
 #include <HTTPClient.h>   // file fetch (macros) over plain HTTP, like FluidNC's WebUI
 #include <functional>
+#include <new>      // std::nothrow
 #include <mdns.h>   // mdns_query_a() — ESP-IDF multicast DNS
 
 // ─── Configuration ────────────────────────────────────────────────────────────
@@ -78,9 +82,13 @@ extern uint32_t rtcLastBootStage;
 #define TX_BUF_SIZE             512
 #define WIFI_RETRY_DELAY_MS     15000    // Retry WiFi.begin() after a failure
 #define DNS_RETRY_DELAY_MS      5000     // Retry hostname resolution after a failure
+#define DNS_DEADLINE_MS         15000    // Give up on a resolve still queued / running
+#define DISC_FAILOVER_MS        8000     // No link this long → follow a moved controller
+#define DISC_REFRESH_MS         60000    // …and rerun discovery no more often than this
 #define WS_RECONNECT_MS         2000     // Library auto-reconnect interval
 #define WS_PING_INTERVAL_MS     10000    // Library-level WebSocket PING
-#define WS_PONG_TIMEOUT_MS      3000     // Wait this long for PONG
+#define WS_PONG_TIMEOUT_MS      3000     // Wait this long for PONG (ceiling)
+#define WS_PONG_TIMEOUT_MIN_MS  1000     // Floor once the link RTT is known
 #define WS_PONG_MISSES          2        // Disconnect after this many missed pongs
 //
 // Connection-health detection is OWNED BY THE LIBRARY.  The WebSocket
@@ -108,7 +116,6 @@ extern uint32_t rtcLastBootStage;
 
 // ─── Globals ──────────────────────────────────────────────────────────────────
 
-static WebSocketsClient _wsClient;
 static bool             _ws_client_inited = false;   // onEvent registered, etc.
 static bool             _ws_begin_called  = false;   // begin() called → loop() active
 static bool             _shutting_down    = false;   // power-off: stop servicing WS
@@ -116,8 +123,14 @@ static volatile bool    _ws_suspend_req   = false;   // request: close WS, stop
 static volatile bool    _ws_suspended     = false;   // ack: WS is closed (set by Core 0)
 static char             _fluidnc_remote_ip[40] = {};
 
-static WebServer        httpServer(80);
-static DNSServer        dnsServer;
+// Captive-portal servers — only exist while the AP is up.  Created by
+// wifi_start_ap_setup(); freed by wifi_poll() on Core 0 once AP mode ends, so
+// they are never deleted under a handleClient() running there.
+struct Portal {
+    WebServer http{80};
+    DNSServer dns;
+};
+static Portal* _portal = nullptr;
 
 static bool _ap_mode            = false;
 static bool _ws_connected       = false;   // FluidNC WebSocket up
@@ -134,7 +147,6 @@ static uint8_t          _handshake_timeout_count = 0;
 
 // RX ring buffer — filled by the WebSocket event callback (TEXT/BIN frames),
 // drained by ws_getchar() ← fnc_getchar().  Both run on Core 0.
-static uint8_t _rx_buf[RX_BUF_SIZE];
 static int     _rx_head = 0;
 static int     _rx_tail = 0;
 // Spinlock guarding _rx_head / _rx_tail.
@@ -152,7 +164,6 @@ static portMUX_TYPE _rx_mux = portMUX_INITIALIZER_UNLOCKED;
 // TX line-assembly buffer — used ONLY on Core 0 inside tx_drain() to
 // accumulate a g-code / $ command line up to its terminating '\n' before
 // handing it to the WebSocket library.  Never touched off Core 0.
-static uint8_t _tx_buf[TX_BUF_SIZE];
 static int     _tx_len = 0;
 
 // ── TX ring buffer (CRITICAL for correctness) ────────────────────────────────
@@ -178,11 +189,23 @@ static int     _tx_len = 0;
 // RX-ring design and makes the WebSocket client strictly single-threaded —
 // exactly the contract the library requires.
 #define TX_RING_SIZE            1024
-static uint8_t _tx_ring[TX_RING_SIZE];
 static int     _tx_ring_head = 0;
 static int     _tx_ring_tail = 0;
 static portMUX_TYPE _tx_mux = portMUX_INITIALIZER_UNLOCKED;
 
+// The WebSocket client and the three buffers above, in one allocation made
+// the first time STA mode starts (ws_link_alloc).  A UART pendant, or one
+// sitting in the setup portal, never pays for them; once made it stays for
+// the session — the rings are touched from both cores and the client is
+// needed again after every reconnect.
+struct WsLink {
+    WebSocketsClient ws;
+    uint8_t          rx[RX_BUF_SIZE];
+    uint8_t          txRing[TX_RING_SIZE];
+    uint8_t          txBuf[TX_BUF_SIZE];
+};
+static WsLink* _link = nullptr;
+
 // Timestamp of the last frame received over the WebSocket.  Kept for
 // diagnostics / future debug display only; the library's PING/PONG
 // heartbeat owns "is the link alive?" detection.
@@ -196,6 +219,12 @@ static volatile bool _dns_ok          = false;
 static char          _dns_result_str[40] = {};
 static uint32_t      _dns_retry_at    = 0;
 
+// Discovery follow-up (see FluidNCDiscovery.h).  _target_ms is when the
+// WebSocket was last pointed somewhere; 0 = nowhere yet this association.
+static uint32_t      _target_ms       = 0;
+static char          _pick_ip[16];             // wifi_choose_controller(), for Core 0
+static volatile bool _pick_pending    = false;
+
 static bool is_dotted_decimal(const char* s) {
     for (const char* p = s; *p; p++) {
         if (!((*p >= '0' && *p <= '9') || *p == '.')) return false;
@@ -206,24 +235,17 @@ static bool is_dotted_decimal(const char* s) {
 // Resolve a hostname to IPv4.  Uses mdns_query_a() for *.local names and
 // unicast DNS (WiFi.hostByName) for everything else.
 //
-// The mDNS stack is initialised lazily on first use.  We deliberately do NOT
-// call MDNS.begin() (which advertises the pendant as "fluiddial.local" and
-// spawns a responder task that was implicated in post-connect crashes).  A
-// bare mdns_init() is enough to let mdns_query_a() work safely.
+// The mDNS stack is initialised lazily on first use (disc_mdns_ready(), shared
+// with discovery).  We deliberately do NOT call MDNS.begin() (which advertises
+// the pendant as "fluiddial.local" and spawns a responder task that was
+// implicated in post-connect crashes).  A bare mdns_init() is enough to let
+// mdns_query_a() work safely.
 static bool resolve_host_strict(const char* host, IPAddress& out) {
     size_t len    = strlen(host);
     const char* dot_local = ".local";
     size_t dl_len = strlen(dot_local);
     if (len > dl_len && strcasecmp(host + len - dl_len, dot_local) == 0) {
-        // One-shot mDNS init.  esp_err_t==ESP_ERR_INVALID_STATE means it was
-        // already initialised, which is fine.
-        static bool _mdns_inited = false;
-        if (!_mdns_inited) {
-            esp_err_t e = mdns_init();
-            _mdns_inited = (e == ESP_OK || e == ESP_ERR_INVALID_STATE);
-            dbg_printf("mdns_init: err=%d (%s)\n", (int)e, esp_err_to_name(e));
-            if (!_mdns_inited) return false;
-        }
+        if (!disc_mdns_ready()) return false;
 
         char base[64];
         size_t base_len = len - dl_len;
@@ -242,14 +264,19 @@ static bool resolve_host_strict(const char* host, IPAddress& out) {
     return WiFi.hostByName(host, out) == 1;
 }
 
-static void dnsResolveTask(void* /*param*/) {
+// Runs on the network worker.  The mDNS query is bounded at 2 s; unicast DNS
+// by lwIP's own timeout — the deadline is only a backstop for the queue.
+static bool dnsResolveJob(void* /*ctx*/) {
     IPAddress ip;
     bool ok = resolve_host_strict(_active_cfg.fluidnc_ip, ip);
     if (ok) ip.toString().toCharArray(_dns_result_str, sizeof(_dns_result_str));
-    _dns_ok        = ok;
-    _dns_done      = true;   // written last — signals main task
+    return ok;
+}
+
+static void dnsResolveDone(void* /*ctx*/, NetJobResult result) {
+    _dns_ok        = result == NET_DONE;
+    _dns_done      = true;   // written last — signals wifi_poll()
     _dns_resolving = false;
-    vTaskDelete(nullptr);
 }
 
 static void start_dns_resolve() {
@@ -257,10 +284,9 @@ static void start_dns_resolve() {
     _dns_ok        = false;
     _dns_resolving = true;
     dbg_printf("Resolving hostname (async): %s\n", _active_cfg.fluidnc_ip);
-    BaseType_t ok = xTaskCreate(dnsResolveTask, "dns_resolve", 4096, nullptr, 1, nullptr);
-    if (ok != pdPASS) {
+    if (!net_submit(NET_JOB_DNS, dnsResolveJob, nullptr, DNS_DEADLINE_MS, dnsResolveDone)) {
         _dns_resolving  = false;
-        _wifi_error_msg = "DNS resolve task start failed";
+        _wifi_error_msg = "DNS resolve could not start";
     }
 }
 
@@ -306,6 +332,7 @@ static void onWsEvent(WStype_t type, uint8_t* payload, size_t length) {
             _ws_connected    = true;
             _last_rx_byte_ms = millis();
             rtcLastBootStage = 9;       // stage 9: WebSocket handshake complete
+            disc_note_connected(_fluidnc_remote_ip);   // next boot connects here first
             // Belt-and-braces: also clear pending_nowait_sends on the connect
             // edge.  WStype_DISCONNECTED already does this, but if the
             // library reconnected silently (eg. PING/PONG miss → automatic
@@ -318,6 +345,18 @@ static void onWsEvent(WStype_t type, uint8_t* payload, size_t length) {
             // to the next real command — turning eg. "$H\n" into
             // "$J=G91X1F1000$H\n" and corrupting both.
             _tx_len = 0;
+            link_rtt_reset();
+            // Re-arm the heartbeat with a pong timeout sized from the status
+            // RTT measured so far (it survives reconnects): 4x the probe
+            // timeout, 1..3 s.  The ping interval stays fixed — fast
+            // link-loss detection is fnc_is_connected()'s job, and the
+            // library heartbeat is only the socket-teardown backstop.
+            {
+                int pong = 4 * link_probe_timeout_ms();
+                if (pong < WS_PONG_TIMEOUT_MIN_MS) pong = WS_PONG_TIMEOUT_MIN_MS;
+                if (pong > WS_PONG_TIMEOUT_MS) pong = WS_PONG_TIMEOUT_MS;
+                _link->ws.enableHeartbeat(WS_PING_INTERVAL_MS, pong, WS_PONG_MISSES);
+            }
             // Kick FluidNC with '?' so the first status report lands quickly.
             // Enqueue it on the TX ring rather than calling _wsClient.sendBIN()
             // directly here: this handler runs INSIDE _wsClient.loop(), and
@@ -393,25 +432,40 @@ static void onWsEvent(WStype_t type, uint8_t* payload, size_t length) {
     }
 }
 
+// First STA start only.  Reports the heap it took, the counterpart of
+// wifi_unallocated_bytes().
+static bool ws_link_alloc() {
+    if (_link) return true;
+    uint32_t before = ESP.getFreeHeap();
+    _link           = new (std::nothrow) WsLink();
+    if (!_link) {
+        dbg_printf("WiFi: no memory for the WebSocket link (%u B)\n", (unsigned)sizeof(WsLink));
+        return false;
+    }
+    dbg_printf("WiFi: WebSocket link allocated, %u B (free heap %u -> %u)\n",
+               (unsigned)sizeof(WsLink), (unsigned)before, (unsigned)ESP.getFreeHeap());
+    return true;
+}
+
 static void ws_client_init_once() {
     if (_ws_client_inited) return;
-    _wsClient.onEvent(onWsEvent);
+    _link->ws.onEvent(onWsEvent);
     // Library will auto-retry the connect every WS_RECONNECT_MS while
     // disconnected — replaces the manual _tcp_next_try_ms loop from the
     // old Telnet code.
-    _wsClient.setReconnectInterval(WS_RECONNECT_MS);
+    _link->ws.setReconnectInterval(WS_RECONNECT_MS);
     // Heartbeat: WebSocket-level PING/PONG.  If FluidNC's TCP stack wedges
     // (peer crashed without FIN, planner jammed, etc.) the library drops
     // the connection in roughly WS_PING_INTERVAL_MS + WS_PONG_MISSES *
     // WS_PONG_TIMEOUT_MS = ~16 s, which is much faster than the kernel
     // KEEPALIVE timeout we used to wait for.
-    _wsClient.enableHeartbeat(WS_PING_INTERVAL_MS, WS_PONG_TIMEOUT_MS, WS_PONG_MISSES);
+    _link->ws.enableHeartbeat(WS_PING_INTERVAL_MS, WS_PONG_TIMEOUT_MS, WS_PONG_MISSES);
     _ws_client_inited = true;
 }
 
 static void ws_disconnect_socket() {
     if (_ws_begin_called) {
-        _wsClient.disconnect();
+        _link->ws.disconnect();
         _ws_begin_called = false;
     }
     _ws_connected        = false;
@@ -422,6 +476,7 @@ static void ws_disconnect_socket() {
 // Returns true on "begin scheduled" — actual connection completes
 // asynchronously and surfaces via the WStype_CONNECTED event.
 static bool ws_socket_begin(const char* host) {
+    if (!_link) return false;
     ws_client_init_once();
     IPAddress ip;
     if (!ip.fromString(host)) {
@@ -433,7 +488,7 @@ static bool ws_socket_begin(const char* host) {
     // begin() schedules the connect.  The library's loop() drives the
     // socket forward; we'll get WStype_CONNECTED when the handshake
     // completes or it'll keep retrying on reconnect interval.
-    _wsClient.begin(host, FLUIDNC_WS_PORT, FLUIDNC_WS_PATH);
+    _link->ws.begin(host, FLUIDNC_WS_PORT, FLUIDNC_WS_PATH);
     _ws_begin_called = true;
     _last_rx_byte_ms = millis();
     return true;
@@ -443,6 +498,128 @@ static void ws_socket_target(const char* host) {
     strncpy(_fluidnc_remote_ip, host, sizeof(_fluidnc_remote_ip) - 1);
     _fluidnc_remote_ip[sizeof(_fluidnc_remote_ip) - 1] = '\0';
     ws_socket_begin(host);
+    _target_ms = millis();
+}
+
+// ─── Controller selection (discovery) ─────────────────────────────────────────
+
+// The configured hostname without ".local" — the name discovery files it under.
+static void config_host_name(char* out, size_t len) {
+    strlcpy(out, _active_cfg.fluidnc_ip, len);
+    size_t n = strlen(out);
+    if (n > 6 && strcasecmp(out + n - 6, ".local") == 0) out[n - 6] = '\0';
+}
+
+// Controllers seen in the latest discovery round.
+static int fresh_hosts(FncHost* out, int max) {
+    FncHost all[DISC_MAX];
+    int     n     = disc_hosts(all, DISC_MAX);
+    int     fresh = 0;
+    for (int i = 0; i < n && fresh < max; i++) {
+        if (all[i].age == 0) out[fresh++] = all[i];
+    }
+    return fresh;
+}
+
+// The controller discovery says the pendant should be talking to, if it knows:
+//   • configured hostname  → that name
+//   • configured IP        → the last-used controller's name, if it was at that IP
+//   • blank ("find it")    → the last-used controller, else the only one seen;
+//                            with several the operator picks on the setup screen
+static bool discovered_controller(FncHost& out) {
+    FncHost last;
+    bool    haveLast = disc_last_used(last);
+    char    name[DISC_NAME_MAX];
+    if (!_active_cfg.fluidnc_ip[0]) {
+        if (haveLast && last.name[0]) return disc_find(last.name, out);
+        FncHost seen[2];
+        if (fresh_hosts(seen, 2) != 1) return false;
+        out = seen[0];
+        return true;
+    }
+    if (is_dotted_decimal(_active_cfg.fluidnc_ip)) {
+        return haveLast && last.name[0] && strcmp(last.ip, _active_cfg.fluidnc_ip) == 0 && disc_find(last.name, out);
+    }
+    config_host_name(name, sizeof(name));
+    return disc_find(name, out);
+}
+
+// WiFi just came up: point the WebSocket at the controller straight away —
+// the configured IP, or the cached address of the configured / last-used
+// controller — and start a discovery round to refresh the cache behind it.
+// Only a hostname nobody has cached yet waits on a lookup.
+static void connect_controller() {
+    FncHost h;
+    FncHost last;
+    bool    haveLast = disc_last_used(last);
+    char    name[DISC_NAME_MAX];
+    if (_active_cfg.fluidnc_ip[0] && is_dotted_decimal(_active_cfg.fluidnc_ip)) {
+        ws_socket_target(_active_cfg.fluidnc_ip);
+    } else if (_active_cfg.fluidnc_ip[0]) {
+        config_host_name(name, sizeof(name));
+        bool cached = disc_find(name, h);
+        if (!cached && haveLast && strcasecmp(last.name, name) == 0) {
+            h      = last;
+            cached = true;
+        }
+        if (cached) {
+            dbg_printf("Controller %s: cached at %s\n", _active_cfg.fluidnc_ip, h.ip);
+            ws_socket_target(h.ip);
+        } else if (!_dns_resolving) {
+            _dns_retry_at = 0;
+            start_dns_resolve();
+        }
+    } else if (haveLast) {
+        dbg_printf("Controller: last used %s %s\n", last.name, last.ip);
+        ws_socket_target(last.ip);
+    }
+    disc_start(true);
+}
+
+// No link yet: once a discovery round has seen the controller somewhere else
+// (new DHCP lease, replaced board under the same hostname), follow it.  A
+// link still down after DISC_FAILOVER_MS asks for a fresh round, at most
+// every DISC_REFRESH_MS.
+static void follow_controller() {
+    if (_ws_connected || _dns_resolving) return;
+    if (_pick_pending) {
+        dbg_printf("Controller: picked %s\n", _pick_ip);
+        ws_disconnect_socket();
+        _wifi_error_msg = nullptr;
+        ws_socket_target(_pick_ip);
+        _pick_pending = false;
+        return;
+    }
+    uint32_t now = millis();
+    if (_target_ms && now - _target_ms < DISC_FAILOVER_MS) return;
+
+    FncHost h;
+    if (disc_rounds() && discovered_controller(h) && h.age == 0 && strcmp(h.ip, _fluidnc_remote_ip) != 0) {
+        dbg_printf("Controller %s moved: %s -> %s\n", h.name, _fluidnc_remote_ip[0] ? _fluidnc_remote_ip : "-", h.ip);
+        ws_disconnect_socket();
+        _dns_retry_at   = 0;
+        _wifi_error_msg = nullptr;
+        ws_socket_target(h.ip);
+        return;
+    }
+    if (!_target_ms && !_active_cfg.fluidnc_ip[0] && disc_rounds()) {
+        FncHost seen[2];
+        _wifi_error_msg = fresh_hosts(seen, 2) ? "Pick a FluidNC below" : "No FluidNC found";
+    }
+    if (!disc_running() && (!disc_rounds() || now - disc_last_ms() >= DISC_REFRESH_MS)) disc_start(true);
+}
+
+int wifi_controller_choices(FncHost* out, int max) {
+    FncHost last;
+    if (_active_cfg.fluidnc_ip[0] || _target_ms || _pick_pending || disc_last_used(last)) return 0;
+    int n = fresh_hosts(out, max);
+    return n > 1 ? n : 0;
+}
+
+void wifi_choose_controller(const char* ip) {
+    if (_pick_pending) return;
+    strlcpy(_pick_ip, ip, sizeof(_pick_ip));
+    _pick_pending = true;  // follow_controller() on Core 0 connects
 }
 
 static const char* wifi_status_name(wl_status_t status) {
@@ -476,7 +653,7 @@ static inline void rx_push(uint8_t c) {
     portENTER_CRITICAL(&_rx_mux);
     int next = (_rx_head + 1) % RX_BUF_SIZE;
     if (next != _rx_tail) {
-        _rx_buf[_rx_head] = c;
+        _link->rx[_rx_head] = c;
         _rx_head          = next;
     }
     portEXIT_CRITICAL(&_rx_mux);
@@ -487,7 +664,7 @@ static inline int rx_pop() {
     int result = -1;
     portENTER_CRITICAL(&_rx_mux);
     if (_rx_head != _rx_tail) {
-        result   = (unsigned char)_rx_buf[_rx_tail];
+        result   = (unsigned char)_link->rx[_rx_tail];
         _rx_tail = (_rx_tail + 1) % RX_BUF_SIZE;
     }
     portEXIT_CRITICAL(&_rx_mux);
@@ -500,10 +677,11 @@ static inline int rx_pop() {
 // makes the multi-producer case safe.
 
 static inline void tx_ring_push(uint8_t c) {
+    if (!_link) return;  // portal / not configured — nowhere to send it
     portENTER_CRITICAL(&_tx_mux);
     int next = (_tx_ring_head + 1) % TX_RING_SIZE;
     if (next != _tx_ring_tail) {
-        _tx_ring[_tx_ring_head] = c;
+        _link->txRing[_tx_ring_head] = c;
         _tx_ring_head           = next;
     }
     // If the ring is full we drop the byte.  At 1 KB this only happens if
@@ -517,7 +695,7 @@ static inline int tx_ring_pop() {
     int result = -1;
     portENTER_CRITICAL(&_tx_mux);
     if (_tx_ring_head != _tx_ring_tail) {
-        result        = (unsigned char)_tx_ring[_tx_ring_tail];
+        result        = (unsigned char)_link->txRing[_tx_ring_tail];
         _tx_ring_tail = (_tx_ring_tail + 1) % TX_RING_SIZE;
     }
     portEXIT_CRITICAL(&_tx_mux);
@@ -564,7 +742,7 @@ int ws_getchar() {
     if (xPortGetCoreID() == 0 && _ws_connected && !_pumping) {
         _pumping = true;
         tx_drain();          // ship any queued command bytes
-        _wsClient.loop();    // pull any pending frames into the ring (onWsEvent)
+        _link->ws.loop();    // pull any pending frames into the ring (onWsEvent)
         _pumping = false;
         c = rx_pop();
     }
@@ -574,7 +752,7 @@ int ws_getchar() {
 // tx_drain (CORE 0 ONLY): pull every queued byte out of the TX ring and feed
 // it through the same framing logic the old ws_putchar used — realtime bytes
 // go out as their own 1-byte BIN frame immediately; everything else is
-// accumulated into _tx_buf until '\n' (or buffer-full) and sent as one BIN
+// accumulated into the link's txBuf until '\n' (or buffer-full) and sent as one BIN
 // frame.  Called from wifi_poll() right after _wsClient.loop(), so all
 // _wsClient.send*() calls happen on the same task as loop().
 //
@@ -605,7 +783,7 @@ static void tx_drain() {
         // JSON line — FluidNC pauses JSON output until it arrives, so it
         // must never be dropped or delayed behind a partial line.
         if (b == 0x18 || (b >= 0x80 && b <= 0x9F) || (b >= 0xB0 && b <= 0xB3)) {
-            _wsClient.sendBIN(&b, 1);
+            _link->ws.sendBIN(&b, 1);
             continue;
         }
         // ASCII realtime commands ('?', '!', '~').  These MUST be extracted even
@@ -618,13 +796,13 @@ static void tx_drain() {
         // pulling them out here (leaving the buffered line intact) is correct and
         // is what lets the line reassemble cleanly.
         if (b == '?' || b == '!' || b == '~') {
-            _wsClient.sendBIN(&b, 1);
+            _link->ws.sendBIN(&b, 1);
             continue;
         }
         // All other bytes: buffer until '\n', then send as one BIN frame.
-        _tx_buf[_tx_len++] = b;
+        _link->txBuf[_tx_len++] = b;
         if (b == '\n' || _tx_len >= TX_BUF_SIZE - 1) {
-            _wsClient.sendBIN(_tx_buf, _tx_len);
+            _link->ws.sendBIN(_link->txBuf, _tx_len);
             _tx_len = 0;
         }
     }
@@ -685,8 +863,8 @@ static const char SETUP_HTML[] = R"HTML(
     <button type="button" class="eye-btn" id="eyeBtn" onclick="togglePass()">&#x1F441;</button>
   </div>
   <label>FluidNC Address (IP or hostname)</label>
-  <input type="text" name="ip" placeholder="192.168.1.100 or fluidnc.local"
-         autocomplete="off" required value="%IP_VAL%">
+  <input type="text" name="ip" placeholder="blank = find it on the network"
+         autocomplete="off" value="%IP_VAL%">
   <button type="submit">Save &amp; Connect</button>
 </form>
 <p class="note">The pendant will restart and connect automatically.</p>
@@ -770,13 +948,13 @@ static void handleRoot() {
     String page = SETUP_HTML;
     page.replace("%SSID_VAL%", cfg.valid ? htmlEscape(String(cfg.ssid)) : "");
     page.replace("%IP_VAL%",   cfg.valid ? htmlEscape(String(cfg.fluidnc_ip)) : "");
-    httpServer.send(200, "text/html", page);
+    _portal->http.send(200, "text/html", page);
 }
 
 static void handleSave() {
-    String ssid = httpServer.arg("ssid");
-    String pass = httpServer.arg("pass");
-    String ip   = httpServer.arg("ip");
+    String ssid = _portal->http.arg("ssid");
+    String pass = _portal->http.arg("pass");
+    String ip   = _portal->http.arg("ip");
 
     // Trim SSID and IP — leading/trailing whitespace there is never meaningful
     // and is almost always an accidental copy-paste artefact.
@@ -801,8 +979,8 @@ static void handleSave() {
     }
     ip = cleanIp;
 
-    if (ssid.length() == 0 || ip.length() == 0) {
-        httpServer.send(400, "text/plain", "SSID and IP are required");
+    if (ssid.length() == 0) {
+        _portal->http.send(400, "text/plain", "SSID is required");
         return;
     }
 
@@ -813,7 +991,7 @@ static void handleSave() {
                ssid.length(), pass.length(), ip.c_str());
 
     wifi_save_config(ssid.c_str(), pass.c_str(), ip.c_str());
-    httpServer.send(200, "text/html", SAVED_HTML);
+    _portal->http.send(200, "text/html", SAVED_HTML);
     delay(2000);
     ESP.restart();
 }
@@ -839,13 +1017,13 @@ static void handleScan() {
     }
     json += "]";
     WiFi.scanDelete();
-    httpServer.sendHeader("Cache-Control", "no-cache");
-    httpServer.send(200, "application/json", json);
+    _portal->http.sendHeader("Cache-Control", "no-cache");
+    _portal->http.send(200, "application/json", json);
 }
 
 static void handleNotFound() {
-    httpServer.sendHeader("Location", "http://192.168.4.1/", true);
-    httpServer.send(302, "text/plain", "");
+    _portal->http.sendHeader("Location", "http://192.168.4.1/", true);
+    _portal->http.send(302, "text/plain", "");
 }
 
 // ─── Public API ───────────────────────────────────────────────────────────────
@@ -878,7 +1056,8 @@ WiFiConfig wifi_load_config() {
     String ip   = prefs.isKey("ip")   ? prefs.getString("ip",   "") : "";
     prefs.end();
 
-    if (ssid.length() > 0 && ip.length() > 0) {
+    // A blank FluidNC address means "find it" (see FluidNCDiscovery.h).
+    if (ssid.length() > 0) {
         dbg_printf("NVS: ssid='%s' ip='%s'\n", ssid.c_str(), ip.c_str());
         strncpy(cfg.ssid,       ssid.c_str(), sizeof(cfg.ssid)       - 1);
         strncpy(cfg.password,   pass.c_str(), sizeof(cfg.password)   - 1);
@@ -911,25 +1090,47 @@ void wifi_start_ap_setup() {
     WiFi.softAP(WIFI_AP_SSID, (strlen(WIFI_AP_PASS) ? WIFI_AP_PASS : nullptr));
     delay(100);   // let the AP interface + DHCP server settle before clients join
 
-    dnsServer.start(53, "*", apIP);
-
-    httpServer.on("/",                         HTTP_GET,  handleRoot);
-    httpServer.on("/generate_204",             HTTP_GET,  handleRoot);
-    httpServer.on("/hotspot-detect.html",      HTTP_GET,  handleRoot);
-    httpServer.on("/ncsi.txt",                 HTTP_GET,  handleRoot);
-    httpServer.on("/fwlink",                   HTTP_GET,  handleRoot);
-    httpServer.on("/scan",                     HTTP_GET,  handleScan);
-    httpServer.on("/save",                     HTTP_POST, handleSave);
-    httpServer.onNotFound(handleNotFound);
-    httpServer.begin();
+    if (!_portal) {
+        uint32_t before = ESP.getFreeHeap();
+        _portal         = new (std::nothrow) Portal();
+        if (!_portal) {
+            dbg_println("WiFi: no memory for the setup portal");
+            return;
+        }
+        dbg_printf("WiFi: setup portal allocated, %u B (free heap %u -> %u)\n",
+                   (unsigned)sizeof(Portal), (unsigned)before, (unsigned)ESP.getFreeHeap());
+    }
+    _portal->dns.start(53, "*", apIP);
+
+    _portal->http.on("/",                         HTTP_GET,  handleRoot);
+    _portal->http.on("/generate_204",             HTTP_GET,  handleRoot);
+    _portal->http.on("/hotspot-detect.html",      HTTP_GET,  handleRoot);
+    _portal->http.on("/ncsi.txt",                 HTTP_GET,  handleRoot);
+    _portal->http.on("/fwlink",                   HTTP_GET,  handleRoot);
+    _portal->http.on("/scan",                     HTTP_GET,  handleScan);
+    _portal->http.on("/save",                     HTTP_POST, handleSave);
+    _portal->http.onNotFound(handleNotFound);
+    _portal->http.begin();
 
     dbg_printf("AP started — SSID: %s  IP: %s\n",
                WIFI_AP_SSID, WiFi.softAPIP().toString().c_str());
 }
 
+// Core 0 (wifi_poll) only — see Portal.
+static void portal_free() {
+    _portal->http.stop();
+    _portal->dns.stop();
+    delete _portal;
+    _portal = nullptr;
+    dbg_printf("WiFi: setup portal freed, %u B (free heap %u)\n",
+               (unsigned)sizeof(Portal), (unsigned)ESP.getFreeHeap());
+}
+
 void wifi_stop_ap_and_restart() {
-    httpServer.stop();
-    dnsServer.stop();
+    if (_portal) {
+        _portal->http.stop();
+        _portal->dns.stop();
+    }
     WiFi.softAPdisconnect(true);
     _ap_mode = false;
     delay(300);
@@ -937,10 +1138,10 @@ void wifi_stop_ap_and_restart() {
 }
 
 void wifi_stop_ap() {
-    httpServer.stop();
-    dnsServer.stop();
-    WiFi.softAPdisconnect(true);
+    // Called from the setup screen on Core 1: the servers are stopped and
+    // freed by wifi_poll() once it sees AP mode has ended.
     _ap_mode            = false;
+    WiFi.softAPdisconnect(true);
     _wifi_stack_started = false;
     wifi_init(false);  // re-enter STA mode without triggering AP again
 }
@@ -956,9 +1157,13 @@ bool websocket_is_connected() {
 // has actually closed the socket, so the caller knows the port is free before it
 // dials.  Safe to call from any task: only wifi_poll() (Core 0) ever touches the
 // socket.  ALWAYS pair with wifi_ws_resume().
+void wifi_ws_request_suspend() {
+    _ws_suspend_req = true;
+}
+
 void wifi_ws_suspend() {
     if (!_ws_begin_called && !_ws_suspended) { _ws_suspended = false; }
-    _ws_suspend_req = true;
+    wifi_ws_request_suspend();
     uint32_t t0 = millis();
     while (!_ws_suspended && (millis() - t0) < 1500) delay(5);
 }
@@ -1023,8 +1228,8 @@ int wifi_http_get(const char* path,
                 if (c != '\r' && out.length() < 256) out += c;
             } else if (!client.connected() && client.available() == 0) {
                 return out.length() > 0;        // EOF
-            } else if ((millis() - last) > (uint32_t)timeout_ms) {
-                return false;                    // stalled
+            } else if ((millis() - last) > (uint32_t)timeout_ms || net_job_should_stop()) {
+                return false;                    // stalled, or cancelled
             } else {
                 delay(2);
             }
@@ -1066,8 +1271,8 @@ int wifi_http_get(const char* path,
                 if (n > 0) { on_chunk(buf, (size_t)n); received += n; last = millis(); }
             } else if (!client.connected()) {
                 break;                           // clean EOF (Connection: close)
-            } else if ((millis() - last) > (uint32_t)timeout_ms) {
-                break;                           // stalled — take what we got
+            } else if ((millis() - last) > (uint32_t)timeout_ms || net_job_should_stop()) {
+                break;                           // stalled or cancelled — take what we got
             } else {
                 delay(2);
             }
@@ -1083,7 +1288,7 @@ void wifi_graceful_disconnect() {
     // safe to touch _wsClient here (we're not inside _wsClient.loop()).
     _shutting_down = true;            // wifi_poll() will now skip all WS service
     if (_ws_begin_called) {
-        _wsClient.disconnect();       // emits a WebSocket CLOSE frame to FluidNC
+        _link->ws.disconnect();       // emits a WebSocket CLOSE frame to FluidNC
         _ws_begin_called = false;
     }
     _ws_connected = false;
@@ -1105,6 +1310,11 @@ const bool wifi_not_ready() {
 const char* wifi_last_error() { return _wifi_error_msg; }
 
 WiFiConfig wifi_active_config() { return _active_cfg; }
+const char* wifi_fluidnc_target() { return _fluidnc_remote_ip; }
+
+size_t wifi_unallocated_bytes() {
+    return (_link ? 0 : sizeof(WsLink)) + (_portal ? 0 : sizeof(Portal));
+}
 
 int wifi_signal_bars() {
     if (!wifi_is_connected()) return 0;
@@ -1135,6 +1345,10 @@ void wifi_init(bool auto_ap) {
         }
         return;
     }
+    if (!ws_link_alloc()) {
+        _wifi_error_msg = "Out of memory";
+        return;
+    }
 
     _wifi_stack_started      = true;
     _active_cfg              = cfg;
@@ -1149,6 +1363,12 @@ void wifi_init(bool auto_ap) {
     _wifi_connect_start_ms   = 0;
     _handshake_timeout_count = 0;
     _dns_retry_at            = 0;
+    _target_ms               = 0;
+    disc_load();
+
+    // DNS, HTTP fetches and discovery run here; its stack comes out of the heap now,
+    // before the WiFi driver and the sprites have fragmented it.
+    net_worker_start();
 
     static bool _event_registered = false;
     if (!_event_registered) {
@@ -1212,6 +1432,7 @@ void wifi_init(bool auto_ap) {
 }
 
 void wifi_poll() {
+    if (_portal && !_ap_mode) portal_free();
     if (!_wifi_stack_started) return;
     if (_shutting_down) return;   // power-off in progress: don't reopen the WS
 
@@ -1223,7 +1444,7 @@ void wifi_poll() {
     if (_ws_suspend_req) {
         if (!_ws_suspended) {
             if (_ws_begin_called) {
-                _wsClient.disconnect();
+                _link->ws.disconnect();
                 _ws_begin_called = false;
             }
             _ws_connected = false;
@@ -1237,12 +1458,14 @@ void wifi_poll() {
         if (_fluidnc_remote_ip[0]) {
             ws_socket_begin(_fluidnc_remote_ip);
             _last_rx_byte_ms = millis();
+            _target_ms       = millis();
         }
     }
 
     if (_ap_mode) {
-        dnsServer.processNextRequest();
-        httpServer.handleClient();
+        if (!_portal) return;
+        _portal->dns.processNextRequest();
+        _portal->http.handleClient();
         return;
     }
 
@@ -1404,7 +1627,7 @@ void wifi_poll() {
     // "fluiddial.local".  That advertiser kept a background task alive and
     // showed up as a crash source a few seconds after WiFi associated.
     // Hostname *lookups* for FluidNC's "*.local" address still work — they
-    // go through mdns_query_a() in dnsResolveTask, which is independent of
+    // go through mdns_query_a() in dnsResolveJob, which is independent of
     // the local mDNS responder.  The pendant simply isn't discoverable by
     // name from other devices, which it never needed to be.
     if (now_connected && !_wifi_was_connected) {
@@ -1412,19 +1635,15 @@ void wifi_poll() {
         dbg_printf("WiFi connected — IP: %s  free_heap=%u\n",
                    WiFi.localIP().toString().c_str(),
                    (unsigned)ESP.getFreeHeap());
-        if (is_dotted_decimal(_active_cfg.fluidnc_ip)) {
-            rtcLastBootStage = 8;     // stage 8: ws_socket_target about to be called
-            ws_socket_target(_active_cfg.fluidnc_ip);
-            // stage 9 is now set inside onWsEvent on WStype_CONNECTED.
-        } else if (!_dns_resolving) {
-            _dns_retry_at = 0;
-            start_dns_resolve();
-        }
+        rtcLastBootStage = 8;     // stage 8: ws_socket_target about to be called
+        connect_controller();
+        // stage 9 is now set inside onWsEvent on WStype_CONNECTED.
     }
     // WiFi just dropped — tear down WebSocket.
     if (!now_connected && _wifi_was_connected) {
         ws_disconnect_socket();
-        _dns_done = false;
+        _dns_done  = false;
+        _target_ms = 0;
         set_disconnected_state();
         dbg_println("WiFi lost");
     }
@@ -1446,6 +1665,8 @@ void wifi_poll() {
         }
     }
 
+    if (now_connected) follow_controller();
+
     // DNS retry.
     if (_dns_retry_at && !_dns_resolving && !_ws_begin_called && now_connected
         && millis() >= _dns_retry_at) {
@@ -1488,7 +1709,7 @@ void wifi_poll() {
     //     200 ms when idle.  Adding our own 500 ms poll on top was just
     //     extra round-trips for no benefit.
     if (_ws_begin_called && now_connected) {
-        _wsClient.loop();
+        _link->ws.loop();
         // Drain any command bytes queued by ws_putchar() (from either core)
         // and send them HERE, on Core 0, alongside loop().  This is the only
         // place _wsClient.send*() is ever called from the steady state, which
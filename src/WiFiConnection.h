@@ -15,12 +15,13 @@
 #ifdef USE_WIFI
 
 #include <stdint.h>
+#include <stddef.h>
 #include <functional>
 
 struct WiFiConfig {
     char ssid[64];
     char password[64];
-    char fluidnc_ip[40];
+    char fluidnc_ip[40];   // "" = find it (FluidNCDiscovery.h)
     bool valid;
 };
 
@@ -44,6 +45,15 @@ const char* wifi_status_str();    // Human-readable status for UI display
 const bool  wifi_not_ready();     // true while WiFi or TCP not yet established
 const char* wifi_last_error();    // Last human-readable error ("Check password" etc.)
 int         wifi_signal_bars();   // 0–4 signal-strength bars (0 = not connected)
+const char* wifi_fluidnc_target(); // Address the WebSocket is pointed at ("" = none yet)
+
+// No address configured and no controller used before, but discovery found
+// several: the ones seen in the latest round, for the setup screen to offer.
+// 0 when there is nothing to choose.  wifi_choose_controller() is the
+// operator's pick (Core 1); it is remembered once the WebSocket comes up.
+struct FncHost;
+int  wifi_controller_choices(FncHost* out, int max);
+void wifi_choose_controller(const char* ip);
 
 // ── AP setup portal ────────────────────────────────────────────────────────────
 void wifi_start_ap_setup();       // Start captive-portal AP "FluidDial"
@@ -53,8 +63,9 @@ void wifi_stop_ap();              // Stop AP without restarting (go back to sett
 // Plain HTTP GET of a FluidNC filesystem file (e.g. "/preferences.json"),
 // streamed to on_chunk.  Used to fetch macros over HTTP instead of the
 // WebSocket (which truncates large $File/SendJSON replies).  Call from a
-// dedicated task — it blocks until the transfer completes.  Returns the HTTP
-// status (200 = OK) or a negative setup error.
+// network worker job — it blocks until the transfer completes, a stall, or
+// the job is cancelled.  Returns the HTTP status (200 = OK) or a negative
+// setup error.
 int wifi_http_get(const char* path,
                   std::function<void(const uint8_t*, size_t)> on_chunk,
                   int timeout_ms = 5000);
@@ -64,6 +75,7 @@ int wifi_http_get(const char* path,
 // Core 0 has closed the socket; resume() lets Core 0 reopen it.  Always pair.
 void wifi_ws_suspend();
 void wifi_ws_resume();
+void wifi_ws_request_suspend();  // non-blocking suspend(), for Core 0 callers
 
 // Graceful shutdown for power-off / sleep.  Sends a WebSocket CLOSE frame so
 // FluidNC frees the channel slot immediately (instead of waiting for its own
@@ -80,6 +92,11 @@ void       wifi_save_config(const char* ssid, const char* password, const char*
 WiFiConfig wifi_load_config();
 WiFiConfig wifi_active_config();   // Config loaded at wifi_init() time (no NVS read)
 
+// Bytes of WebSocket link + setup portal not currently allocated — both are
+// created on first use (STA start / AP start) rather than at boot, so a UART
+// pendant keeps all of it for sprites.
+size_t     wifi_unallocated_bytes();
+
 // ── Transport primitives used by Comms.cpp's WiFi dispatcher ───────────────────
 void ws_putchar(uint8_t c);  // Send one byte to FluidNC via TCP
 int  ws_getchar();           // Pop one byte from TCP RX ring buffer (-1 if empty)
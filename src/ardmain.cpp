@@ -6,6 +6,10 @@
 #include "FluidNCModel.h"   // fnc_init_tx_lock()
 #include "Scene.h"
 #include "AboutScene.h"
+#include "TaskMonitor.h"
+#ifdef USE_SCENE_TASKS
+#include "SceneTasks.h"
+#endif
 
 #ifdef USE_NEW_UI
 #include "CNC_Pendant_UI.h"
@@ -196,6 +200,7 @@ void setup() {
         nullptr,
         1                  // Core 1 — alongside the Arduino loop task
     );
+    task_monitor_start();  // per-task CPU + stack high-water, every 5 s
 
     dbg_printf("FluidNC Pendant with new UI %s\n", git_info);
 #else
@@ -205,6 +210,15 @@ void setup() {
 
     extern Scene* initMenus();
     activate_scene(initMenus());
+
+#ifdef USE_SCENE_TASKS
+    // Parser on Core 0, switches/encoder above loop() on Core 1 — see SceneTasks.h.
+    // Both the comms task (connect-time queries) and scenes send lines now, so
+    // they need the same TX-line lock as the new UI.
+    fnc_init_tx_lock();
+    scene_tasks_start();
+    task_monitor_start();
+#endif
 #endif
 
     fnc_realtime(StatusReport);  // Kick FluidNC into action
@@ -215,6 +229,9 @@ void loop() {
     // Hardware (UART, encoder, buttons) runs on Core 0 in pendant_hw_task()
 #ifdef USE_NEW_UI
     loop_pendant();
+#elif defined(USE_SCENE_TASKS)
+    dispatch_events();  // Parser runs in scene_comms_task; this is UI only
+    delay_ms(1);        // let IDLE_1 feed the watchdog between passes
 #else
     fnc_poll();         // Handle messages from FluidNC
     dispatch_events();  // Handle dial, touch, buttons
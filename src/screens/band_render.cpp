@@ -0,0 +1,69 @@
+// Copyright (c) 2026 — FluidDial-CYD
+// Use of this source code is governed by a GPLv3 license.
+
+// Banded full-screen renderer.  See band_render.h.
+
+#include "band_render.h"
+
+LovyanGFX* gfx = &display;
+
+// Two strips, ping-ponged: one renders while the other is on the DMA wire.
+// Static so the 15 KB is reserved at link time and never fragments the heap.
+alignas(4) static uint16_t _bandBuf[2][BAND_W * BAND_ROWS];
+
+static LGFX_Sprite _band;
+static int         _bandTop  = -1;  // first row of the strip being drawn; -1 outside a pass
+static uint16_t*   _bandCurr = nullptr;
+
+bool bandRendering() {
+    return _bandTop >= 0;
+}
+
+uint16_t* bandStrip(int& top) {
+    top = _bandTop;
+    return _bandTop >= 0 ? _bandCurr : nullptr;
+}
+
+void gfxSetClip(int x, int y, int w, int h) {
+    if (_bandTop < 0) {
+        gfx->setClipRect(x, y, w, h);
+        return;
+    }
+    int y0 = y > _bandTop ? y : _bandTop;
+    int y1 = (y + h < _bandTop + BAND_ROWS) ? y + h : _bandTop + BAND_ROWS;
+    gfx->setClipRect(x, y0, w, y1 > y0 ? y1 - y0 : 0);
+}
+
+void gfxClearClip() {
+    if (_bandTop < 0) {
+        gfx->clearClipRect();
+    } else {
+        gfx->setClipRect(0, _bandTop, BAND_W, BAND_ROWS);
+    }
+}
+
+void bandRender(void (*draw)()) {
+    if (_bandTop >= 0) {  // nested: already drawing into a strip
+        draw();
+        return;
+    }
+    display.startWrite();
+    for (int top = 0, half = 0; top < BAND_H; top += BAND_ROWS, half ^= 1) {
+        uint16_t* buf = _bandBuf[half];
+        // Base the sprite `top` rows before the strip so it spans the full
+        // screen's coordinates; the clip keeps every write inside buf.
+        // The half being reused was pushed two strips ago, and each
+        // pushImageDMA waits for the transfer before it, so it is free.
+        _band.setBuffer(buf - top * BAND_W, BAND_W, BAND_H);
+        _bandTop  = top;
+        _bandCurr = buf;
+        _band.setClipRect(0, top, BAND_W, BAND_ROWS);
+        gfx = &_band;
+        draw();
+        gfx = &display;
+        display.pushImageDMA(0, top, BAND_W, BAND_ROWS, (const lgfx::swap565_t*)buf);
+    }
+    _bandTop = -1;
+    display.waitDMA();
+    display.endWrite();
+}
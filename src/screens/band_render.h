@@ -0,0 +1,43 @@
+// Copyright (c) 2026 — FluidDial-CYD
+// Use of this source code is governed by a GPLv3 license.
+
+#pragma once
+#include "../System.h"
+
+// ── Banded full-screen rendering ─────────────────────────────────────────────
+//
+// Screen code draws through `gfx`, never `display` directly.  Outside a band
+// pass gfx IS the panel, so incremental updates (panel sprites, value fields)
+// go straight to it as before.
+//
+// bandRender(draw) repaints the whole screen without drawing on the visible
+// panel: gfx is pointed at a 240×BAND_ROWS RGB565 strip that addresses the
+// full 240×320 coordinate space but is clipped to its own rows, draw() runs
+// once per strip, and each finished strip is DMA-pushed while the next one
+// renders into the other half of the buffer.  The old screen is replaced
+// strip by strip, top to bottom, with no black frame or half-drawn widgets
+// in between, in a fixed 2×7.5 KB instead of a 150 KB full-screen sprite.
+//
+// A draw function passed here therefore runs several times per redraw and
+// must be repeatable: draw from state, don't consume it.  Sprites pushed
+// with pushSprite(gfx, ...) land in the strip like any other draw call.
+// Panel-only calls — brightness, rotation, touch — stay on `display`.
+
+#define BAND_W    240
+#define BAND_H    320
+#define BAND_ROWS 16
+
+extern LovyanGFX* gfx;
+
+void bandRender(void (*draw)());
+bool bandRendering();
+
+// The strip being drawn, as BAND_W×BAND_ROWS pixels in the panel's byte order
+// (swapped RGB565), with `top` set to its first screen row.  nullptr outside
+// a band pass.
+uint16_t* bandStrip(int& top);
+
+// Clip rectangle on gfx.  During a band pass it is intersected with the
+// current strip, and clearing it restores the strip's own clip.
+void gfxSetClip(int x, int y, int w, int h);
+void gfxClearClip();
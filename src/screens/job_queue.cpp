@@ -0,0 +1,361 @@
+// Copyright (c) 2026 — FluidDial-CYD
+// Use of this source code is governed by a GPLv3 license.
+
+// Pendant-local job queue.  See job_queue.h.
+
+#include "pendant_shared.h"
+#include "job_queue.h"
+#include "screen_macros.h"  // macroCommand()
+#include "../CommandQueue.h"
+#include <Preferences.h>
+
+extern Preferences preferences;
+
+#define JOBQ_POLL_MS 250  // state sample while a step runs
+
+static QueuedJob      _jobs[JOBQ_MAX];
+static int            _count      = 0;
+static JobQueuePhase  _phase      = JQ_STOPPED;
+static JobQueuePolicy _policy     = JQ_POLICY_CONFIRM;
+static const char*    _message    = "";
+static uint32_t       _generation = 0;
+static bool           _pausing    = false;
+static bool           _macroDone  = false;  // head job's macro already ran
+static uint32_t       _countdownEnd = 0;
+static UiTimer        _pollTimer    = {};
+static UiTimer        _autoTimer    = {};
+
+// Step tracking.  _step tags each sent line so a late ack from an abandoned
+// step is ignored.  _sawBusy / _sawAlarm are also set from Core 0.
+static uint32_t      _step    = 0;
+static bool          _acked   = false;
+static bool          _ackLost = false;
+static uint32_t      _ackedAt = 0;
+static volatile bool _sawBusy  = false;
+static volatile bool _sawAlarm = false;
+
+static void changed() {
+    _generation++;
+}
+
+static void stop(const char* why);
+
+// ── Persistence ──────────────────────────────────────────────────────────────
+
+static void save() {
+    preferences.begin("jobq", false);
+    preferences.putUChar("policy", (uint8_t)_policy);
+    preferences.putUChar("count", (uint8_t)_count);
+    if (_count) {
+        preferences.putBytes("jobs", _jobs, _count * sizeof(QueuedJob));
+    } else {
+        preferences.remove("jobs");
+    }
+    preferences.end();
+}
+
+void jobQueueLoad() {
+    preferences.begin("jobq", true);
+    _policy = preferences.getUChar("policy", JQ_POLICY_CONFIRM) == JQ_POLICY_AUTO ? JQ_POLICY_AUTO : JQ_POLICY_CONFIRM;
+    int n   = preferences.getUChar("count", 0);
+    if (n > JOBQ_MAX) n = 0;
+    // A size mismatch means the entry layout changed: start empty.
+    if (n && preferences.getBytesLength("jobs") == n * sizeof(QueuedJob)) {
+        preferences.getBytes("jobs", _jobs, n * sizeof(QueuedJob));
+        for (int i = 0; i < n; i++) {
+            _jobs[i].file[JOBQ_FILE_MAX - 1]            = '\0';
+            _jobs[i].macroName[JOBQ_MACRO_NAME_MAX - 1] = '\0';
+            _jobs[i].macroPath[JOBQ_MACRO_PATH_MAX - 1] = '\0';
+        }
+        _count = n;
+    }
+    preferences.end();
+    _phase   = JQ_STOPPED;
+    _message = _count ? "Restored - press Start" : "";
+    changed();
+}
+
+// ── Accessors ────────────────────────────────────────────────────────────────
+
+int jobQueueCount() {
+    return _count;
+}
+const QueuedJob& jobQueueAt(int i) {
+    return _jobs[i];
+}
+JobQueuePhase jobQueuePhase() {
+    return _phase;
+}
+JobQueuePolicy jobQueuePolicy() {
+    return _policy;
+}
+const char* jobQueueMessage() {
+    return _message;
+}
+bool jobQueuePausing() {
+    return _pausing;
+}
+uint32_t jobQueueGeneration() {
+    return _generation;
+}
+
+int jobQueueCountdownS() {
+    if (_phase != JQ_COUNTDOWN) return 0;
+    int32_t left = (int32_t)(_countdownEnd - (uint32_t)milliseconds());
+    return left > 0 ? (left + 999) / 1000 : 0;
+}
+
+bool jobQueueRunning() {
+    return _phase == JQ_MACRO || _phase == JQ_JOB;
+}
+
+// ── Editing ──────────────────────────────────────────────────────────────────
+
+bool jobQueueAdd(const char* file) {
+    if (_count >= JOBQ_MAX || !file || !*file) return false;
+    QueuedJob& j = _jobs[_count++];
+    j            = QueuedJob();
+    strlcpy(j.file, file, sizeof(j.file));
+    if (_phase == JQ_STOPPED && strcmp(_message, "Queue finished") == 0) _message = "";
+    save();
+    changed();
+    return true;
+}
+
+void jobQueueRemove(int i) {
+    if (i < 0 || i >= _count || (i == 0 && jobQueueRunning())) return;
+    memmove(&_jobs[i], &_jobs[i + 1], (_count - i - 1) * sizeof(QueuedJob));
+    _count--;
+    if (i == 0) {
+        _macroDone = false;
+        if (_count == 0 && (_phase == JQ_CONFIRM || _phase == JQ_COUNTDOWN)) stop("");
+    }
+    save();
+    changed();
+}
+
+void jobQueueMoveUp(int i) {
+    if (i <= 0 || i >= _count || (i == 1 && jobQueueRunning())) return;
+    QueuedJob t  = _jobs[i - 1];
+    _jobs[i - 1] = _jobs[i];
+    _jobs[i]     = t;
+    if (i == 1) _macroDone = false;
+    save();
+    changed();
+}
+
+void jobQueueCycleMacro(int i) {
+    if (i < 0 || i >= _count || (i == 0 && jobQueueRunning())) return;
+    QueuedJob& j = _jobs[i];
+    // Find the current macro in the loaded list; step to the next, or to
+    // none past the end.  An unknown (renamed, not yet loaded) macro steps
+    // to the first.
+    int cur = -1;
+    for (int m = 0; m < pendantMacros.count; m++) {
+        if (pendantMacros.filename[m] == j.macroPath) {
+            cur = m;
+            break;
+        }
+    }
+    int next = j.macroPath[0] && cur < 0 ? 0 : cur + 1;
+    if (next < pendantMacros.count) {
+        strlcpy(j.macroName, pendantMacros.content[next].c_str(), sizeof(j.macroName));
+        strlcpy(j.macroPath, pendantMacros.filename[next].c_str(), sizeof(j.macroPath));
+    } else {
+        j.macroName[0] = '\0';
+        j.macroPath[0] = '\0';
+    }
+    if (i == 0) _macroDone = false;
+    save();
+    changed();
+}
+
+void jobQueueTogglePolicy() {
+    _policy = _policy == JQ_POLICY_AUTO ? JQ_POLICY_CONFIRM : JQ_POLICY_AUTO;
+    if (_phase == JQ_COUNTDOWN && _policy == JQ_POLICY_CONFIRM) {
+        ui_timer_cancel(_autoTimer);
+        _phase = JQ_CONFIRM;
+    }
+    save();
+    changed();
+}
+
+// ── Steps ────────────────────────────────────────────────────────────────────
+
+static void stop(const char* why) {
+    ui_timer_cancel(_pollTimer);
+    ui_timer_cancel(_autoTimer);
+    _phase   = JQ_STOPPED;
+    _pausing = false;
+    _message = why;
+    _step++;  // orphan any ack still to come
+    dbg_printf("JobQ: stopped: %s\n", why);
+    changed();
+}
+
+static void stepAcked(const CmdResult& r, void* ctx) {
+    if ((uint32_t)(uintptr_t)ctx != _step || !jobQueueRunning()) return;
+    if (r.status == CMD_ERROR || r.status == CMD_CANCELLED) {
+        stop(_phase == JQ_MACRO ? "Macro failed" : "Job failed to start");
+        return;
+    }
+    _acked   = true;
+    _ackLost = r.status == CMD_LOST;
+    _ackedAt = (uint32_t)milliseconds();
+}
+
+static void stepCheck();
+static void pollStep(void* /*ctx*/) {
+    stepCheck();
+}
+
+static void startStep(JobQueuePhase phase) {
+    const QueuedJob& j = _jobs[0];
+    char             cmd[CMD_LINE_MAX];
+    if (phase == JQ_MACRO) {
+        macroCommand(j.macroPath, cmd, sizeof(cmd));
+    } else {
+        snprintf(cmd, sizeof(cmd), "$SD/Run=%s", j.file);
+    }
+    _acked    = false;
+    _ackLost  = false;
+    _sawBusy  = false;
+    _sawAlarm = false;
+    _phase    = phase;
+    _message  = "";
+    _step++;
+    wcs_note_line(cmd);
+    if (!cmd_submit(cmd, stepAcked, (void*)(uintptr_t)_step)) {
+        stop("Command queue full");
+        return;
+    }
+    dbg_printf("JobQ: %s\n", cmd);
+    ui_timer_arm(_pollTimer, JOBQ_POLL_MS, pollStep, nullptr, JOBQ_POLL_MS);
+    changed();
+}
+
+static void startHead() {
+    if (_jobs[0].macroPath[0] && !_macroDone) {
+        startStep(JQ_MACRO);
+    } else {
+        startStep(JQ_JOB);
+    }
+}
+
+static void autoStart(void* /*ctx*/) {
+    if (_phase == JQ_COUNTDOWN) jobQueueConfirm();
+}
+
+static void stepDone() {
+    ui_timer_cancel(_pollTimer);
+    if (_phase == JQ_MACRO) {
+        _macroDone = true;
+        if (_pausing) {
+            stop("Paused");
+            return;
+        }
+        startStep(JQ_JOB);
+        return;
+    }
+
+    // The job is finished: drop it.  Files can set offsets too.
+    dbg_printf("JobQ: finished %s\n", _jobs[0].file);
+    memmove(&_jobs[0], &_jobs[1], (_count - 1) * sizeof(QueuedJob));
+    _count--;
+    _macroDone = false;
+    save();
+    wcs_invalidate();
+
+    if (_count == 0) {
+        stop("Queue finished");
+    } else if (_pausing) {
+        stop("Paused");
+    } else if (_policy == JQ_POLICY_AUTO) {
+        _phase        = JQ_COUNTDOWN;
+        _countdownEnd = (uint32_t)milliseconds() + JOBQ_AUTO_DELAY_MS;
+        ui_timer_arm(_autoTimer, JOBQ_AUTO_DELAY_MS, autoStart);
+        changed();
+    } else {
+        _phase = JQ_CONFIRM;
+        changed();
+    }
+}
+
+static void stepCheck() {
+    if (!jobQueueRunning()) return;
+    if (!pendantConnected || state == Disconnected) {
+        stop("Link lost");
+        return;
+    }
+    if (_sawAlarm || state == Alarm || state == ConfigAlarm || state == Critical) {
+        stop("Stopped by alarm");
+        return;
+    }
+    if (state != Idle) {
+        _sawBusy = true;
+        return;
+    }
+    if (_sawBusy) {
+        stepDone();
+    } else if (_acked && (uint32_t)milliseconds() - _ackedAt >= JOBQ_SETTLE_MS) {
+        // Never left Idle.  If the ack itself went missing we can't tell
+        // whether it ran, so keep the job rather than skip it.
+        if (_ackLost) {
+            stop("No reply from controller");
+        } else {
+            stepDone();
+        }
+    }
+}
+
+bool jobQueueStart() {
+    if (jobQueueRunning()) return false;
+    if (_count == 0) {
+        _message = "Queue is empty";
+        changed();
+        return false;
+    }
+    if (!pendantConnected) {
+        _message = "Not connected";
+        changed();
+        return false;
+    }
+    if (state != Idle) {
+        _message = "Machine not idle";
+        changed();
+        return false;
+    }
+    ui_timer_cancel(_autoTimer);
+    _pausing = false;
+    startHead();
+    return jobQueueRunning();
+}
+
+void jobQueuePause() {
+    if (jobQueueRunning()) {
+        _pausing = !_pausing;  // a second press takes it back
+        changed();
+        return;
+    }
+    if (_phase == JQ_CONFIRM || _phase == JQ_COUNTDOWN) stop("Paused");
+}
+
+bool jobQueueConfirm() {
+    if (_phase != JQ_CONFIRM && _phase != JQ_COUNTDOWN) return false;
+    if (!jobQueueStart()) {
+        stop(_message);
+    }
+    return true;
+}
+
+// ── Core 0 ───────────────────────────────────────────────────────────────────
+
+void jobQueueStateChange(state_t /*old_state*/) {
+    if (!jobQueueRunning()) return;
+    if (state == Alarm || state == ConfigAlarm || state == Critical) {
+        _sawAlarm = true;
+    } else if (state != Idle && state != Disconnected) {
+        _sawBusy = true;
+    }
+    ui_defer(stepCheck);
+}
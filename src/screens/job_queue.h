@@ -0,0 +1,90 @@
+// Copyright (c) 2026 — FluidDial-CYD
+// Use of this source code is governed by a GPLv3 license.
+
+#pragma once
+#include "../FluidNCModel.h"  // state_t
+
+// ── Pendant-local job queue ──────────────────────────────────────────────────
+//
+// An ordered list of SD files to run back to back, each optionally preceded
+// by one of the controller's macros (tool change, probe Z, …).  The head of
+// the list is the job that is running or runs next; a job is dropped from
+// the list once it has finished, so the list is always the work still to do.
+//
+// Each step — the macro, then the file — is one line (the macro's command,
+// then $SD/Run=<file>; only SD files are queued) sent through the command
+// queue.  A step is over when the machine has left Idle since it was sent
+// and is back in Idle; the edge is reported by PendantScene::onStateChange() (jobQueueStateChange())
+// and confirmed by a slow poll of `state` while a step runs, since a short
+// cycle can fall between two state callbacks.  A step that never leaves Idle
+// (a macro that only sets an offset, a file with no motion) is over once it
+// has been acked and the machine has stayed Idle for JOBQ_SETTLE_MS.
+//
+// Between jobs the confirmation policy decides: CONFIRM waits for the green
+// button (or Start on the queue screen); AUTO counts down JOBQ_AUTO_DELAY_MS
+// so the operator can still Pause before the spindle starts.  An error ack,
+// an alarm or a lost link stops the queue with the job left at the head.
+//
+// The list and the policy are kept in NVS ("jobq") and survive a reboot, but
+// a restored queue is always stopped: it never starts a job by itself after
+// power-up.  Everything here runs on the UI core (Core 1) except
+// jobQueueStateChange(), which only sets flags and defers the work.
+
+#define JOBQ_MAX            10
+#define JOBQ_FILE_MAX       64
+#define JOBQ_MACRO_NAME_MAX 32
+#define JOBQ_MACRO_PATH_MAX 96
+#define JOBQ_AUTO_DELAY_MS  10000
+#define JOBQ_SETTLE_MS      2000
+
+struct QueuedJob {
+    char file[JOBQ_FILE_MAX];             // SD file name, as in the SD Card list
+    char macroName[JOBQ_MACRO_NAME_MAX];  // "" = no macro before this job
+    char macroPath[JOBQ_MACRO_PATH_MAX];  // /sd/…, /localfs/… or cmd:…
+};
+
+enum JobQueuePhase {
+    JQ_STOPPED,    // waiting for Start
+    JQ_CONFIRM,    // a job finished; the next waits for green / Start
+    JQ_COUNTDOWN,  // AUTO: the next starts when the countdown runs out
+    JQ_MACRO,      // the head job's macro is running
+    JQ_JOB,        // the head job is running
+};
+
+enum JobQueuePolicy {
+    JQ_POLICY_CONFIRM = 0,
+    JQ_POLICY_AUTO,
+};
+
+void jobQueueLoad();   // setup: restore the list from NVS
+
+int              jobQueueCount();
+const QueuedJob& jobQueueAt(int i);
+JobQueuePhase    jobQueuePhase();
+JobQueuePolicy   jobQueuePolicy();
+const char*      jobQueueMessage();     // why it last stopped, or ""
+int              jobQueueCountdownS();  // seconds left in JQ_COUNTDOWN
+bool             jobQueueRunning();     // JQ_MACRO or JQ_JOB
+bool             jobQueuePausing();     // Pause pressed while a step runs
+
+// Bumped on every change to the list or the phase, so screens can redraw
+// only then.
+uint32_t jobQueueGeneration();
+
+// Editing.  The head entry can't be changed while it is running.
+bool jobQueueAdd(const char* file);
+void jobQueueRemove(int i);
+void jobQueueMoveUp(int i);
+void jobQueueCycleMacro(int i);  // none → each loaded macro in turn → none
+void jobQueueTogglePolicy();
+
+// Start (or resume) with the head job.  False, with jobQueueMessage() set,
+// if the machine can't take it now.
+bool jobQueueStart();
+// Stop once the running step finishes; stop at once when waiting.
+void jobQueuePause();
+// Green button: starts the next job if one is waiting.  True if consumed.
+bool jobQueueConfirm();
+
+// Core 0, from PendantScene::onStateChange().
+void jobQueueStateChange(state_t old_state);
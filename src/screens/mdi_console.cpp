@@ -0,0 +1,207 @@
+// Copyright (c) 2026 — FluidDial-CYD
+// Use of this source code is governed by a GPLv3 license.
+
+// MDI history and send pipeline.  See mdi_console.h.
+
+#include "pendant_shared.h"
+#include "mdi_console.h"
+#include "job_queue.h"  // jobQueueRunning()
+#include "../CommandQueue.h"
+#include "../GcodeStreamer.h"  // stream_active()
+#include "../ConsoleLog.h"
+#include <Preferences.h>
+
+extern Preferences preferences;
+
+static char _history[MDI_HISTORY][MDI_INPUT_MAX];
+static int  _historyCount = 0;
+
+// The snippet going out.  _lines point into _text; _snippet tags each
+// submitted line so an ack from an earlier snippet is ignored.
+static char         _text[MDI_INPUT_MAX];
+static const char*  _lines[MDI_LINES_MAX];
+static int8_t       _result[MDI_LINES_MAX];  // cmd_status_t, -1 until it completes
+static int          _error[MDI_LINES_MAX];
+static int          _lineCount = 0;
+static int          _submitted = 0;
+static int          _done      = 0;
+static int          _logged    = 0;  // results logged, in order
+static int          _unsent    = 0;  // dropped after an error
+static uint32_t     _snippet   = 0;
+
+// ── History ──────────────────────────────────────────────────────────────────
+
+static void saveHistory() {
+    preferences.begin("mdi", false);
+    preferences.putUChar("count", (uint8_t)_historyCount);
+    if (_historyCount) {
+        preferences.putBytes("hist", _history, _historyCount * MDI_INPUT_MAX);
+    } else {
+        preferences.remove("hist");
+    }
+    preferences.end();
+}
+
+void mdiLoad() {
+    preferences.begin("mdi", true);
+    int n = preferences.getUChar("count", 0);
+    if (n > MDI_HISTORY) n = 0;
+    // A size mismatch means MDI_INPUT_MAX changed: start empty.
+    if (n && preferences.getBytesLength("hist") == (size_t)n * MDI_INPUT_MAX) {
+        preferences.getBytes("hist", _history, n * MDI_INPUT_MAX);
+        for (int i = 0; i < n; i++) {
+            _history[i][MDI_INPUT_MAX - 1] = '\0';
+        }
+        _historyCount = n;
+    }
+    preferences.end();
+}
+
+int mdiHistoryCount() {
+    return _historyCount;
+}
+
+const char* mdiHistoryAt(int i) {
+    return (i >= 0 && i < _historyCount) ? _history[i] : "";
+}
+
+// Moves `snippet` to the front, dropping an older copy or the oldest entry.
+static void remember(const char* snippet) {
+    if (_historyCount && strcmp(_history[0], snippet) == 0) return;
+    int drop = _historyCount < MDI_HISTORY ? _historyCount : MDI_HISTORY - 1;
+    for (int i = 0; i < _historyCount; i++) {
+        if (strcmp(_history[i], snippet) == 0) {
+            drop = i;
+            break;
+        }
+    }
+    memmove(_history[1], _history[0], drop * MDI_INPUT_MAX);
+    strlcpy(_history[0], snippet, MDI_INPUT_MAX);
+    if (drop == _historyCount) _historyCount++;
+    saveHistory();
+}
+
+// ── Pipeline ─────────────────────────────────────────────────────────────────
+
+bool mdiBusy() {
+    return _done < _lineCount;
+}
+
+int mdiRemaining() {
+    return _lineCount - _done;
+}
+
+static void logResults() {
+    while (_logged < _submitted && _result[_logged] >= 0) {
+        int i = _logged++;
+        switch (_result[i]) {
+            case CMD_OK:
+                con_log(CON_OK, "ok");
+                break;
+            case CMD_ERROR:
+                if (_lineCount > 1) con_logf(CON_ERROR, "error:%d line %d %s", _error[i], i + 1, decode_error_number(_error[i]));
+                else                con_logf(CON_ERROR, "error:%d %s", _error[i], decode_error_number(_error[i]));
+                break;
+            default:
+                con_log(CON_ERROR, "no reply");
+                break;
+        }
+    }
+    if (!mdiBusy()) {
+        con_capture_replies(false);
+        if (_unsent) {
+            con_logf(CON_NOTE, "%d line%s not sent", _unsent, _unsent == 1 ? "" : "s");
+            _unsent = 0;
+        }
+    }
+}
+
+static void pump();
+
+static void lineDone(const CmdResult& r, void* ctx) {
+    uint32_t tag = (uint32_t)(uintptr_t)ctx;
+    int      i   = tag & 0xff;
+    if ((tag >> 8) != (_snippet & 0xffffff) || i >= _submitted || _result[i] >= 0) return;
+
+    _result[i] = (int8_t)r.status;
+    _error[i]  = r.error;
+    _done++;
+    if (r.status != CMD_OK && _lineCount > _submitted) {
+        // Lines already submitted run regardless; stop feeding the rest.
+        _unsent    = _lineCount - _submitted;
+        _lineCount = _submitted;
+    }
+    logResults();
+    pump();
+}
+
+static void pump() {
+    while (_submitted < _lineCount && _submitted - _done < MDI_WINDOW) {
+        const char* line = _lines[_submitted];
+        void*       ctx  = (void*)(uintptr_t)(((_snippet & 0xffffff) << 8) | (uint32_t)_submitted);
+        wcs_note_line(line);
+        if (!cmd_submit(line, lineDone, ctx)) {
+            _unsent    = _lineCount - _submitted;
+            _lineCount = _submitted;
+            con_log(CON_NOTE, "Command queue full");
+            break;
+        }
+        con_logf(CON_SENT, "> %s", line);
+        _result[_submitted++] = -1;
+    }
+    logResults();
+}
+
+bool mdiSend(const char* snippet) {
+    if (mdiBusy()) {
+        con_logf(CON_NOTE, "Busy: %d line%s still going", mdiRemaining(), mdiRemaining() == 1 ? "" : "s");
+        return false;
+    }
+    if (!pendantConnected) {
+        con_log(CON_NOTE, "Not connected");
+        return false;
+    }
+    // Lines typed here would land between a job's lines: a streamed file,
+    // the job queue, or an $SD/Run the status report shows.
+    if (stream_active() || jobQueueRunning() || pendantMachine.currentFile.length()) {
+        con_log(CON_NOTE, "Busy: a job is running");
+        return false;
+    }
+
+    // Split into lines, trimmed; blank lines are skipped.
+    strlcpy(_text, snippet, sizeof(_text));
+    int   n = 0;
+    char* p = _text;
+    while (*p) {
+        char* end = strchr(p, '\n');
+        char* next = end ? end + 1 : p + strlen(p);
+        if (end) *end = '\0';
+        while (*p == ' ') p++;
+        size_t len = strlen(p);
+        while (len && p[len - 1] == ' ') p[--len] = '\0';
+        if (len) {
+            if (n == MDI_LINES_MAX) {
+                con_logf(CON_NOTE, "More than %d lines", MDI_LINES_MAX);
+                return false;
+            }
+            if (len >= CMD_LINE_MAX) {
+                con_logf(CON_NOTE, "Line %d is too long", n + 1);
+                return false;
+            }
+            _lines[n++] = p;
+        }
+        p = next;
+    }
+    if (!n) return false;
+
+    remember(snippet);
+    _snippet++;
+    _lineCount = n;
+    _submitted = 0;
+    _done      = 0;
+    _logged    = 0;
+    _unsent    = 0;
+    con_capture_replies(true);
+    pump();
+    return true;
+}
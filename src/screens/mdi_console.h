@@ -0,0 +1,36 @@
+// Copyright (c) 2026 — FluidDial-CYD
+// Use of this source code is governed by a GPLv3 license.
+
+#pragma once
+
+// ── MDI: typed commands, their history and the send pipeline ────────────────
+//
+// A snippet is one or more lines typed on the MDI screen.  mdiSend() splits
+// it, then keeps at most MDI_WINDOW of its lines in the command queue at a
+// time — the next line is submitted as each one completes — so a short
+// program goes out back to back instead of waiting a round trip per line,
+// and a long one can't take every command slot from the rest of the UI.
+// Each line is echoed to the console ring as it is submitted and its
+// "ok" / "error:N" is logged when it completes, in snippet order.  The first
+// error ends the snippet: lines already submitted still run, as they would
+// from any streamer, but no more are sent.  While lines are outstanding the
+// console also captures plain reply lines (the output of "$$", "$#" …).
+//
+// Sent snippets go to a most-recent-first history of MDI_HISTORY entries,
+// kept in NVS ("mdi").  Everything here runs on the UI core (Core 1).
+
+#define MDI_INPUT_MAX 160  // one snippet, lines separated by '\n'
+#define MDI_LINES_MAX 16
+#define MDI_WINDOW    4
+#define MDI_HISTORY   12
+
+void mdiLoad();  // setup: restore the history from NVS
+
+int         mdiHistoryCount();
+const char* mdiHistoryAt(int i);  // 0 = most recent
+
+// False (with a console note) if there is nothing to send, a snippet is still
+// going out, or the controller isn't connected.
+bool mdiSend(const char* snippet);
+bool mdiBusy();
+int  mdiRemaining();  // lines not yet completed
@@ -8,6 +8,11 @@
 #include "../cnc_pendant_config.h"
 #include "../System.h"
 #include "../FluidNCModel.h"
+#include "../UiTimers.h"
+#include "../WcsOffsets.h"
+#include "screen_layout.h"
+#include "band_render.h"
+#include "screen_chrome.h"
 #include <freertos/FreeRTOS.h>
 #include <freertos/semphr.h>
 #include <freertos/queue.h>
@@ -88,7 +93,9 @@ enum PendantScreen {
     PSCREEN_SPINDLE_CONTROL,
     PSCREEN_MACROS,
     PSCREEN_SD_CARD,
+    PSCREEN_JOB_QUEUE,        // SD files run back to back (reached from SD Card)
     PSCREEN_FLUIDNC,
+    PSCREEN_MDI,              // typed commands (reached from FluidNC)
     PSCREEN_WIFI_SETUP,
     PSCREEN_SLEEP            // hidden — display-blank after idle; touch-to-wake (not a menu item)
 };
@@ -184,6 +191,7 @@ struct JogState {
     int          selectedIncrement = 1;     // index within the active increment set
     bool         fineIncrements    = true;  // true=fine set, false=coarse; triple-tap rightmost button
     bool         speedDialMode     = false; // true = encoder adjusts jog speed, not axis
+    bool         padMode           = false; // true = XY touch joystick replaces home/axis/increment rows
     int          jogSpeedMm        = 5000;  // mm/min cap, step 100 (used to limit $J feed rate)
     int          jogSpeedIn        = 200;   // ipm cap,    step  10
     int          maxFeedRate       = 10000; // mm/min cap, updated from $110 on entry
@@ -217,8 +225,10 @@ struct SDCardState {
     bool   loading       = false;
     bool   pendingRun    = false;  // true = file selected, awaiting Load/Run confirmation
     String loadedFile    = "";     // set by Load; green button sends run command
+    bool   loadedLocal   = false;  // loadedFile is on the pendant: green streams it
+    bool   local         = false;  // list shows the pendant's own files (GcodeStreamer)
     bool   loadFailed    = false;  // request didn't complete in time → show retry hint
-    unsigned long loadStartMs = 0; // millis() when the current request was issued (UI deadline)
+    UiTimer loadDeadline  = {};    // armed while a list request is outstanding (UI deadline)
 };
 
 struct MacroState {
@@ -231,14 +241,14 @@ struct MacroState {
     bool   pendingRun  = false;
     bool   cacheValid  = false; // true after first successful load; skip re-fetch on re-entry
     bool   loadFailed  = false; // fetch finished/aborted with no macros → show retry hint
-    unsigned long loadStartMs = 0;  // millis() when the current fetch began (UI deadline)
+    UiTimer loadDeadline = {};  // armed while a fetch is outstanding (UI deadline)
 };
 
 struct SpindleState {
     int  selectedPreset = 1;     // 0=25%, 1=50%, 2=100% of max
     bool directionFwd   = true;
     bool dialMode       = false; // true = encoder adjusts RPM in 1000 RPM steps
-    int  targetRPM      = 0;     // RPM selected by user via preset or dial (sent on Start)
+    int  targetRPM      = 0;     // RPM selected by user via preset or dial (sent on Start, then live)
 };
 
 struct FeedsState {
@@ -248,8 +258,10 @@ struct FeedsState {
 };
 
 struct ProbingState {
-    String selectedCoordSystem = "G54";
-    int    selectedCoordIndex  = 0;
+    String   selectedCoordSystem = "G54";
+    int      selectedCoordIndex  = 0;
+    bool     showOffsets         = false;  // offset table replaces the two position panels
+    uint32_t drawnOffsetsGen     = 0;      // wcs_generation() the table was drawn at
 };
 
 // ===== v2.0.0 Probe State =====
@@ -310,7 +322,7 @@ struct ProbeV2State {
     //   0 = idle, 1 = running (probing), 2 = result/confirm, 3 = error
     int   calState   = 0;
     float calResult  = 0.0f;       // measured deflection (mm), pending Apply
-    unsigned long calStartMs = 0;  // millis() at run start — for timeout
+    UiTimer calDeadline = {};      // armed at run start — safety timeout
     // focusedField: screen-relative index of the field the dial currently adjusts.
     // -1 = no field focused.
     int  focusedField   = -1;
@@ -351,35 +363,51 @@ extern LGFX_Sprite spriteValueDisplay;
 extern LGFX_Sprite spriteStatusBar;
 extern LGFX_Sprite spriteFileDisplay;
 
-// Allocate a persistent 8-bit panel sprite (depth set BEFORE createSprite()).
-// Now used ONLY for the large, BLACK-filled list sprites (macros / SD file
-// lists, 230×200) and the black-filled probing-work panels: black (0x0000) is
-// identical in 8- and 16-bit, so there's no rgb332 colour tint, and 8-bit halves
-// the RAM of a buffer that would be ~92 KB at 16-bit (and wouldn't fit on WiFi).
-// The near-neutral grey panels use the 16-bit beginPanelSprite() scratch instead
-// (8-bit crushed their blue → greenish).  If minHeap > 0 and free heap is below
-// it, or the allocation fails, returns false and leaves the sprite empty —
-// callers then fall back to direct drawing (flicker but accurate, never blank).
+// Allocate a persistent 4-bit palette panel sprite (depth set BEFORE
+// createSprite()).  The palette is the exact set of theme colours, so the
+// macros / SD file lists (230×200) cost ~23 KB with no rgb332 tint, and
+// pushSprite() expands palette → RGB565 on the way to the display.  If
+// minHeap > 0 and free heap is below it, or the allocation fails, returns false
+// and leaves the sprite empty — callers then fall back to direct drawing
+// (flicker but accurate, never blank).
 bool allocPanelSprite(LGFX_Sprite& s, int w, int h, uint32_t minHeap = 0);
 
+// 2-bit variant for single-ink readouts (probing-work position panels): the
+// palette is { COLOR_BACKGROUND, COLOR_DARKER_BG, COLOR_GRAY_TEXT, ink }.
+bool allocMonoPanelSprite(LGFX_Sprite& s, int w, int h, uint16_t ink, uint32_t minHeap = 0);
+
+// Draw colour for a panel target.  Palette sprites take a palette INDEX, not
+// RGB565, so every colour drawn through a panel target goes through this:
+//   g->setTextColor(panelInk(g, COLOR_CYAN));
+// Returns the colour unchanged when g is the display (direct-draw fallback).
+uint32_t panelInk(const LovyanGFX* g, uint16_t color);
+
 // Release all four shared panel sprites.  Call at the top of every enter*()
 // so a screen only needs to allocate the ones it uses, and can't inherit
 // another screen's buffers.
 void releasePanelSprites();
 
-// Shared-scratch panel sprite: every panel on a screen draws into ONE 16-bit
-// scratch buffer that grows to the largest panel and is then reused with no
-// per-frame alloc/free churn.  endPanelSprite() pushes only the panel's w×h
+// Shared-scratch panel sprite: every panel on a screen draws into ONE 4-bit
+// palette scratch buffer that grows to the largest panel and is then reused
+// with no per-frame alloc/free churn.  endPanelSprite() pushes only the panel's w×h
 // region (via a destination clip rect).  Released by releasePanelSprites().
 //   int ox, oy;
 //   LovyanGFX* g = beginPanelSprite(230, 65, ox, oy, 5, 140);
-//   ... draw via g at (ox+.., oy+..) ...
+//   ... draw via g at (ox+.., oy+..), colours via panelInk(g, ..) ...
 //   endPanelSprite(230, 65, 5, 140);   // same w,h,px,py
-// On allocation failure g is &display and (ox,oy)=(px,py) so drawing lands at
+// On allocation failure g is gfx and (ox,oy)=(px,py) so drawing lands at
 // the correct on-screen spot (direct-draw fallback — never blank).
 LovyanGFX* beginPanelSprite(int w, int h, int& ox, int& oy, int px, int py);
 void       endPanelSprite(int w, int h, int px, int py);
 
+// Layout-table forms: the panel rect comes from the screen's UiWidget entry.
+inline LovyanGFX* beginPanelSprite(const UiWidget& w, int& ox, int& oy) {
+    return beginPanelSprite(w.w, w.h, ox, oy, w.x, w.y);
+}
+inline void endPanelSprite(const UiWidget& w) {
+    endPanelSprite(w.w, w.h, w.x, w.y);
+}
+
 // ===== FreeRTOS Sync Objects (defined in CNC_Pendant_UI.cpp) =====
 extern SemaphoreHandle_t stateMutex;
 extern QueueHandle_t     hwEventQueue;
@@ -398,19 +426,29 @@ extern volatile bool pendantSynced;
 // ===== Helper Functions (defined in CNC_Pendant_UI.cpp) =====
 bool   isTouchInBounds(int tx, int ty, int x, int y, int w, int h);
 void   drawRoundRect(int x, int y, int w, int h, int r, uint16_t color);
-void   drawButton(int x, int y, int w, int h, String text, uint16_t bgColor, uint16_t textColor, int textSize = 2);
-void   drawMultiLineButton(int x, int y, int w, int h, String line1, String line2, uint16_t bgColor, uint16_t textColor, int textSize = 1);
-void   drawTitle(String title);
-void   drawInfoBox(int x, int y, int w, int h, String label, String value, uint16_t valueColor = COLOR_ORANGE);
+void   drawButton(int x, int y, int w, int h, const char* text, uint16_t bgColor, uint16_t textColor, int textSize = 2);
+void   drawMultiLineButton(int x, int y, int w, int h, const char* line1, const char* line2, uint16_t bgColor, uint16_t textColor, int textSize = 1);
+void   drawTitle(const char* title);
+void   drawTitleBar(const char* title);    // static part: bar + text
+void   drawTitleIcons();                   // WiFi / battery overlays
+void   drawInfoBox(int x, int y, int w, int h, const char* label, const char* value, uint16_t valueColor = COLOR_ORANGE);
+void   uiDrawButton(const UiWidget& w, uint16_t bgColor, uint16_t textColor, int textSize = 2);  // one- or two-line
 void   drawCurrentPendantScreen();
 void   navigateTo(PendantScreen next);
 
+// Copy a shared String field into a caller-owned fixed buffer (truncating).
+// Screens snapshot state under stateMutex this way instead of by String
+// assignment, so a steady-state redraw never touches the heap.
+inline void copyStr(char* dst, size_t n, const String& src) {
+    strlcpy(dst, src.c_str(), n);
+}
+
 // ===== Alarm Description Helper =====
 // Returns a short human-readable description for FluidNC/GRBL alarm codes.
 // Status strings from FluidNC look like "Alarm:1", "Alarm:2", etc.
-inline String alarmDescription(const String& status) {
-    if (!status.startsWith("Alarm:")) return "";
-    int code = status.substring(6).toInt();
+inline const char* alarmDescription(const char* status) {
+    if (strncmp(status, "Alarm:", 6) != 0) return "";
+    int code = atoi(status + 6);
     switch (code) {
         case 1:  return "Hard limit triggered";
         case 2:  return "Soft limit exceeded";
@@ -0,0 +1,195 @@
+// Copyright (c) 2026 — FluidDial-CYD
+// Use of this source code is governed by a GPLv3 license.
+
+// Cached screen chrome.  See screen_chrome.h.
+//
+// Encoding, per band strip, pixels in row-major order: one byte per run,
+// palette index in the high nibble and run length 1..15 in the low nibble;
+// a low nibble of 0 means the next byte holds length - 16 (16..271).  Runs
+// never cross a strip boundary, so each strip decodes on its own.
+
+#include "pendant_shared.h"
+#include "screen_chrome.h"
+#include <stdlib.h>
+
+#define CHROME_SLOTS      8
+#define CHROME_BUDGET     (24 * 1024)  // bytes of encoded chrome kept
+#define CHROME_ENTRY_MAX  (12 * 1024)  // busier than this isn't worth caching
+#define CHROME_MIN_HEAP   40000        // don't start an encode below this
+#define CHROME_COLOURS    16
+#define CHROME_STRIPS     (BAND_H / BAND_ROWS)
+#define CHROME_RUN_MAX    (15 + 256)
+
+struct ChromeEntry {
+    ChromeFn chrome;  // nullptr = free slot
+    uint32_t key;
+    uint32_t used;    // LRU stamp
+    uint8_t* data;
+    uint16_t size;
+    uint16_t strip[CHROME_STRIPS + 1];  // offset of each strip's runs; [n] = size
+    uint16_t pal[CHROME_COLOURS];       // swapped RGB565, as in the strip
+    uint8_t  nPal;
+};
+
+static ChromeEntry _slots[CHROME_SLOTS];
+static uint32_t    _clock = 0;
+static size_t      _bytes = 0;
+
+// The entry being encoded, one strip per band pass.
+static ChromeEntry _build;
+static size_t      _buildCap  = 0;
+static int         _buildNext = -1;  // top row of the strip expected next; -1 = idle
+
+static void freeBuild() {
+    free(_build.data);
+    _build.data = nullptr;
+    _buildCap   = 0;
+    _buildNext  = -1;
+}
+
+static void freeSlot(ChromeEntry& e) {
+    _bytes -= e.size;
+    free(e.data);
+    e = ChromeEntry();
+}
+
+void dropChromeCache() {
+    for (auto& e : _slots) {
+        if (e.chrome) freeSlot(e);
+    }
+    freeBuild();
+}
+
+static ChromeEntry* find(ChromeFn chrome, uint32_t key) {
+    for (auto& e : _slots) {
+        if (e.chrome == chrome && e.key == key) return &e;
+    }
+    return nullptr;
+}
+
+// ── Encode ───────────────────────────────────────────────────────────────────
+
+static bool put(uint8_t b) {
+    if (_build.size >= _buildCap) {
+        size_t   cap = _buildCap ? _buildCap * 2 : 2048;
+        if (cap > CHROME_ENTRY_MAX) cap = CHROME_ENTRY_MAX;
+        if (cap <= _build.size) return false;            // over the entry limit
+        uint8_t* p = (uint8_t*)realloc(_build.data, cap);
+        if (!p) return false;
+        _build.data = p;
+        _buildCap   = cap;
+    }
+    _build.data[_build.size++] = b;
+    return true;
+}
+
+static int colourIndex(uint16_t c) {
+    for (int i = 0; i < _build.nPal; i++) {
+        if (_build.pal[i] == c) return i;
+    }
+    if (_build.nPal == CHROME_COLOURS) return -1;        // not flat chrome
+    _build.pal[_build.nPal] = c;
+    return _build.nPal++;
+}
+
+static bool encodeStrip(int s, const uint16_t* px) {
+    _build.strip[s] = _build.size;
+    const int n = BAND_W * BAND_ROWS;
+    for (int i = 0; i < n;) {
+        uint16_t c   = px[i];
+        int      run = 1;
+        while (i + run < n && px[i + run] == c && run < CHROME_RUN_MAX) run++;
+        int idx = colourIndex(c);
+        if (idx < 0) return false;
+        bool ok = run < 16 ? put((idx << 4) | run)
+                           : put(idx << 4) && put(run - 16);
+        if (!ok) return false;
+        i += run;
+    }
+    return true;
+}
+
+// The last strip is in: shrink the buffer to fit and move the entry into a
+// slot, evicting the least recently used until it fits the budget.
+static void commitBuild() {
+    _build.strip[CHROME_STRIPS] = _build.size;
+    uint8_t* p = (uint8_t*)realloc(_build.data, _build.size);
+    if (p) _build.data = p;
+
+    ChromeEntry* slot = nullptr;
+    for (;;) {
+        slot = nullptr;
+        for (auto& e : _slots) {
+            if (!e.chrome) { slot = &e; break; }
+        }
+        if (slot && _bytes + _build.size <= CHROME_BUDGET) break;
+        ChromeEntry* lru = nullptr;
+        for (auto& e : _slots) {
+            if (e.chrome && (!lru || (int32_t)(e.used - lru->used) < 0)) lru = &e;
+        }
+        if (!lru) break;                                 // alone over budget
+        freeSlot(*lru);
+    }
+    if (!slot || _bytes + _build.size > CHROME_BUDGET) {
+        freeBuild();
+        return;
+    }
+    _build.used = ++_clock;
+    *slot       = _build;
+    _bytes += _build.size;
+    dbg_printf("Chrome: cached %u B, %d colours (%u B total)\n",
+               (unsigned)slot->size, slot->nPal, (unsigned)_bytes);
+    _build.data = nullptr;                               // now owned by the slot
+    freeBuild();
+}
+
+// ── Decode ───────────────────────────────────────────────────────────────────
+
+static void decodeStrip(const ChromeEntry& e, int s, uint16_t* out) {
+    const uint8_t* p   = e.data + e.strip[s];
+    const uint8_t* end = e.data + e.strip[s + 1];
+    while (p < end) {
+        uint8_t  b = *p++;
+        int      n = b & 0x0F;
+        if (!n) n = *p++ + 16;
+        uint16_t c = e.pal[b >> 4];
+        while (n--) *out++ = c;
+    }
+}
+
+// ── Entry point ──────────────────────────────────────────────────────────────
+
+void drawChrome(ChromeFn chrome, uint32_t key) {
+    int       top;
+    uint16_t* strip = bandStrip(top);
+    if (!strip) {
+        chrome();
+        return;
+    }
+    int s = top / BAND_ROWS;
+
+    ChromeEntry* e = find(chrome, key);
+    if (e) {
+        if (s == 0) e->used = ++_clock;
+        decodeStrip(*e, s, strip);
+        return;
+    }
+
+    chrome();
+
+    if (s == 0) {
+        freeBuild();
+        if (ESP.getFreeHeap() < CHROME_MIN_HEAP) return;
+        _build        = ChromeEntry();
+        _build.chrome = chrome;
+        _build.key    = key;
+        _buildNext    = 0;
+    }
+    if (_buildNext != top || _build.chrome != chrome || _build.key != key) return;
+    if (!encodeStrip(s, strip)) {
+        freeBuild();
+        return;
+    }
+    _buildNext = top + BAND_ROWS;
+    if (_buildNext >= BAND_H) commitBuild();
+}
@@ -0,0 +1,40 @@
+// Copyright (c) 2026 — FluidDial-CYD
+// Use of this source code is governed by a GPLv3 license.
+
+#pragma once
+#include <stdint.h>
+
+// ── Cached screen chrome ─────────────────────────────────────────────────────
+//
+// A screen's static layer — background, title bar, captions, button faces,
+// probe diagrams — is drawn by a chrome function and only changes with a
+// little state (axis count, probe type, boss shape).  drawChrome() renders
+// it once, keeps it as a palettized run-length image, and on every later
+// full redraw copies each band strip straight out of the cache instead of
+// replaying the primitives; the screen then draws only its dynamic panels
+// on top.
+//
+//   static void drawJogHomingChrome() { gfx->fillScreen(...); drawTitleBar(...); ... }
+//   void drawJogHomingScreen() {
+//       drawChrome(drawJogHomingChrome, pendantMachine.numAxes | (pendantJog.padMode ? 0x100 : 0));
+//       ...dynamic widgets...
+//   }
+//
+// The entry is keyed by (chrome, key): `key` must capture every bit of state
+// the chrome function reads.  The chrome function must paint every pixel of
+// the screen (start with fillScreen) and draw nothing that changes at run
+// time — that belongs after drawChrome().
+//
+// The cache is built during a band pass (band_render.h), strip by strip, so
+// the first visit to a screen costs one extra encode and never a full-frame
+// buffer.  Chrome with more than 16 colours (anti-aliased art) isn't cached;
+// flat chrome is mostly long runs and a few KB a screen, kept in a 24 KB
+// LRU budget.  Outside a band pass drawChrome() just calls the chrome
+// function.
+
+typedef void (*ChromeFn)();
+
+void drawChrome(ChromeFn chrome, uint32_t key = 0);
+
+// Frees every cached layer, e.g. before a screen that needs the heap.
+void dropChromeCache();
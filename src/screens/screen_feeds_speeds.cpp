@@ -2,6 +2,46 @@
 #include "screen_feeds_speeds.h"
 #include "screen_probe.h"   // PROBE_* colours — shared adjustable-field style
 
+// ── Layout ──────────────────────────────────────────────────────────────────
+// Each override block is a 3+3 grid: 50/75/100 on the top row, 125 / DIAL / 150
+// on the bottom row.  Preset index i (0=50% … 4=150%) maps to a widget through
+// kFeedPresetIds / kSpindlePresetIds.
+enum FeedsWidget : uint8_t {
+    FS_TOP,
+    FS_FEED_50, FS_FEED_75, FS_FEED_100, FS_FEED_125, FS_FEED_DIAL, FS_FEED_150,
+    FS_SPIN_50, FS_SPIN_75, FS_SPIN_100, FS_SPIN_125, FS_SPIN_DIAL, FS_SPIN_150,
+    FS_MAIN_MENU,
+    FS_COUNT
+};
+
+static constexpr UiWidget kFeedsLayout[] = {
+    { FS_TOP,         5,  40, 230, 35, nullptr,     nullptr },
+    { FS_FEED_50,     5,  95,  72, 37, "50%",       nullptr },
+    { FS_FEED_75,    83,  95,  72, 37, "75%",       nullptr },
+    { FS_FEED_100,  161,  95,  72, 37, "100%",      nullptr },
+    { FS_FEED_125,    5, 137,  72, 37, "125%",      nullptr },
+    { FS_FEED_DIAL,  83, 137,  72, 37, nullptr,     nullptr },
+    { FS_FEED_150,  161, 137,  72, 37, "150%",      nullptr },
+    { FS_SPIN_50,     5, 194,  72, 37, "50%",       nullptr },
+    { FS_SPIN_75,    83, 194,  72, 37, "75%",       nullptr },
+    { FS_SPIN_100,  161, 194,  72, 37, "100%",      nullptr },
+    { FS_SPIN_125,    5, 236,  72, 37, "125%",      nullptr },
+    { FS_SPIN_DIAL,  83, 236,  72, 37, nullptr,     nullptr },
+    { FS_SPIN_150,  161, 236,  72, 37, "150%",      nullptr },
+    { FS_MAIN_MENU,   5, 280, 230, 40, "Main Menu", nullptr },
+};
+static_assert(uiIdsMatchIndex(kFeedsLayout, FS_COUNT), "kFeedsLayout must be in FeedsWidget order");
+static constexpr UiLayout kFeeds = uiLayout(kFeedsLayout);
+
+static const uint8_t kFeedPresetIds[]    = { FS_FEED_50, FS_FEED_75, FS_FEED_100, FS_FEED_125, FS_FEED_150 };
+static const uint8_t kSpindlePresetIds[] = { FS_SPIN_50, FS_SPIN_75, FS_SPIN_100, FS_SPIN_125, FS_SPIN_150 };
+static const int     kPresetPcts[]       = { 50, 75, 100, 125, 150 };
+
+// Selection currently painted on screen, so a preset change only repaints the
+// old and new buttons instead of the whole row.
+static int _drawnFeedSel    = -1;
+static int _drawnSpindleSel = -1;
+
 // Adjustable-field style matching probeDrawKVTouch(), rendered into a panel
 // sprite `g` (these readouts update live, so they composite off-screen to stay
 // flicker-free).  Label on top, large value + unit below; the border and value
@@ -10,31 +50,31 @@ static void drawDialField(LovyanGFX* g, int ox, int oy, int w, int h,
                           int value, uint16_t valColor, bool active) {
     uint16_t bg  = active ? PROBE_SEL_BG   : PROBE_BG_SCREEN;
     uint16_t bdr = active ? PROBE_C_YELLOW : PROBE_C_TAPBDR;
-    g->fillRect(ox, oy, w, h, COLOR_BACKGROUND);   // clear corners to screen bg
-    g->fillRoundRect(ox, oy, w, h, 2, bg);
-    g->drawRoundRect(ox, oy, w, h, 2, bdr);
+    g->fillRect(ox, oy, w, h, panelInk(g, COLOR_BACKGROUND));   // clear corners to screen bg
+    g->fillRoundRect(ox, oy, w, h, 2, panelInk(g, bg));
+    g->drawRoundRect(ox, oy, w, h, 2, panelInk(g, bdr));
 
     g->setTextSize(1);
-    g->setTextColor(active ? COLOR_WHITE : PROBE_C_LBLUE);
+    g->setTextColor(panelInk(g, active ? COLOR_WHITE : PROBE_C_LBLUE));
     g->setCursor(ox + 3, oy + 2);
     g->print("DIAL");
 
     char vbuf[8];
     snprintf(vbuf, sizeof(vbuf), "%d", value);
     g->setTextSize(2);
-    g->setTextColor(active ? PROBE_C_YELLOW : valColor);
+    g->setTextColor(panelInk(g, active ? PROBE_C_YELLOW : valColor));
     g->setCursor(ox + 3, oy + 11);
     g->print(vbuf);
 
     g->setTextSize(1);
-    g->setTextColor(PROBE_C_DIMBLUE);
+    g->setTextColor(panelInk(g, PROBE_C_DIMBLUE));
     int16_t vw = g->textWidth(vbuf) * 2;
     g->setCursor(ox + 3 + vw + 1, oy + 14);
     g->print("%");
 }
 
 void enterFeedsSpeeds() {
-    // Each panel uses a transient 16-bit sprite (see the update*() functions).
+    // Each panel uses the shared 4-bit panel scratch (see the update*() functions).
     releasePanelSprites();
 }
 
@@ -43,46 +83,55 @@ void exitFeedsSpeeds() {
     releasePanelSprites();
 }
 
-void drawFeedsSpeedsScreen() {
-    display.fillScreen(COLOR_BACKGROUND);
-    drawTitle("FEEDS & SPEEDS");
-
-    updateFeedsSpeedsTopDisplay();
-
-    display.setTextColor(COLOR_GRAY_TEXT);
-    display.setTextSize(1);
-    display.setCursor(5, 83);
-    display.print("FEED OVERRIDE");
+// Index of preset widget `id` within its row (0=50% … 4=150%), or -1.
+static int presetIndex(const uint8_t* ids, uint8_t id) {
+    for (int i = 0; i < 5; i++) {
+        if (ids[i] == id) return i;
+    }
+    return -1;
+}
 
-    String pcts[] = { "50%", "75%", "100%", "125%", "150%" };
-    for (int i = 0; i < 3; i++) {
-        uint16_t bg = (i == pendantFeeds.selectedFeedOverride) ? COLOR_ORANGE : COLOR_BUTTON_GRAY;
-        drawButton(5 + i * 78, 95, 72, 37, pcts[i], bg, COLOR_WHITE, 2);
+static void drawFeedsWidget(uint8_t id) {
+    int i;
+    switch (id) {
+        case FS_TOP:       updateFeedsSpeedsTopDisplay();  return;
+        case FS_FEED_DIAL: updateFeedOverrideDisplay();    return;
+        case FS_SPIN_DIAL: updateSpindleOverrideDisplay(); return;
+        case FS_MAIN_MENU: uiDrawButton(kFeedsLayout[id], COLOR_BLUE, COLOR_WHITE, 2); return;
     }
-    uint16_t bg3 = (3 == pendantFeeds.selectedFeedOverride) ? COLOR_ORANGE : COLOR_BUTTON_GRAY;
-    drawButton(5, 137, 72, 37, pcts[3], bg3, COLOR_WHITE, 2);
-    display.fillRoundRect(83, 137, 72, 37, 2, COLOR_BACKGROUND);
-    updateFeedOverrideDisplay();
-    uint16_t bg4 = (4 == pendantFeeds.selectedFeedOverride) ? COLOR_ORANGE : COLOR_BUTTON_GRAY;
-    drawButton(161, 137, 72, 37, pcts[4], bg4, COLOR_WHITE, 2);
-
-    display.setTextColor(COLOR_GRAY_TEXT);
-    display.setTextSize(1);
-    display.setCursor(5, 182);
-    display.print("SPINDLE OVERRIDE");
-
-    for (int i = 0; i < 3; i++) {
-        uint16_t bg = (i == pendantFeeds.selectedSpindleOverride) ? COLOR_ORANGE : COLOR_BUTTON_GRAY;
-        drawButton(5 + i * 78, 194, 72, 37, pcts[i], bg, COLOR_WHITE, 2);
+    if ((i = presetIndex(kFeedPresetIds, id)) >= 0) {
+        uiDrawButton(kFeedsLayout[id], i == pendantFeeds.selectedFeedOverride ? COLOR_ORANGE : COLOR_BUTTON_GRAY,
+                     COLOR_WHITE, 2);
+    } else if ((i = presetIndex(kSpindlePresetIds, id)) >= 0) {
+        uiDrawButton(kFeedsLayout[id], i == pendantFeeds.selectedSpindleOverride ? COLOR_ORANGE : COLOR_BUTTON_GRAY,
+                     COLOR_WHITE, 2);
+    }
+}
+
+// Repaint every widget marked via uiMarkDirty() since the last flush.
+static void flushFeedsDirty() {
+    uint32_t dirty = uiTakeDirty();
+    while (dirty) {
+        drawFeedsWidget((uint8_t)__builtin_ctz(dirty));
+        dirty &= dirty - 1;
     }
-    uint16_t bg3s = (3 == pendantFeeds.selectedSpindleOverride) ? COLOR_ORANGE : COLOR_BUTTON_GRAY;
-    drawButton(5, 236, 72, 37, pcts[3], bg3s, COLOR_WHITE, 2);
-    display.fillRoundRect(83, 236, 72, 37, 2, COLOR_BACKGROUND);
-    updateSpindleOverrideDisplay();
-    uint16_t bg4s = (4 == pendantFeeds.selectedSpindleOverride) ? COLOR_ORANGE : COLOR_BUTTON_GRAY;
-    drawButton(161, 236, 72, 37, pcts[4], bg4s, COLOR_WHITE, 2);
-
-    drawButton(5, 280, 230, 40, "Main Menu", COLOR_BLUE, COLOR_WHITE, 2);
+}
+
+void drawFeedsSpeedsScreen() {
+    gfx->fillScreen(COLOR_BACKGROUND);
+    drawTitle("FEEDS & SPEEDS");
+
+    gfx->setTextColor(COLOR_GRAY_TEXT);
+    gfx->setTextSize(1);
+    gfx->setCursor(5, 83);
+    gfx->print("FEED OVERRIDE");
+    gfx->setCursor(5, 182);
+    gfx->print("SPINDLE OVERRIDE");
+
+    uiTakeDirty();   // full repaint below supersedes anything pending
+    for (uint8_t id = 0; id < FS_COUNT; id++) drawFeedsWidget(id);
+    _drawnFeedSel    = pendantFeeds.selectedFeedOverride;
+    _drawnSpindleSel = pendantFeeds.selectedSpindleOverride;
 }
 
 void updateFeedsSpeedsTopDisplay() {
@@ -95,32 +144,32 @@ void updateFeedsSpeedsTopDisplay() {
     xSemaphoreGive(stateMutex);
 
     int ox, oy;
-    LovyanGFX* g = beginPanelSprite(230, 35, ox, oy, 5, 40);
-    g->fillRect(ox, oy, 230, 35, COLOR_BACKGROUND);
+    LovyanGFX* g = beginPanelSprite(kFeedsLayout[FS_TOP], ox, oy);
+    g->fillRect(ox, oy, 230, 35, panelInk(g, COLOR_BACKGROUND));
 
     // Feed box
-    g->fillRoundRect(ox + 0, oy + 0, 112, 35, 5, COLOR_DARKER_BG);
-    g->setTextColor(COLOR_GRAY_TEXT);
+    g->fillRoundRect(ox + 0, oy + 0, 112, 35, 5, panelInk(g, COLOR_DARKER_BG));
+    g->setTextColor(panelInk(g, COLOR_GRAY_TEXT));
     g->setTextSize(1);
     g->setCursor(ox + 5, oy + 3);
     g->print("FEED");
-    g->setTextColor(COLOR_ORANGE);
+    g->setTextColor(panelInk(g, COLOR_ORANGE));
     g->setTextSize(2);
     g->setCursor(ox + 5, oy + 13);
     g->print(feedRate);
 
     // Spindle box
-    g->fillRoundRect(ox + 118, oy + 0, 112, 35, 5, COLOR_DARKER_BG);
-    g->setTextColor(COLOR_GRAY_TEXT);
+    g->fillRoundRect(ox + 118, oy + 0, 112, 35, 5, panelInk(g, COLOR_DARKER_BG));
+    g->setTextColor(panelInk(g, COLOR_GRAY_TEXT));
     g->setTextSize(1);
     g->setCursor(ox + 123, oy + 3);
     g->print("SPINDLE");
-    g->setTextColor(COLOR_GREEN);
+    g->setTextColor(panelInk(g, COLOR_GREEN));
     g->setTextSize(2);
     g->setCursor(ox + 123, oy + 13);
     g->print(spindleRPM);
 
-    endPanelSprite(230, 35, 5, 40);
+    endPanelSprite(kFeedsLayout[FS_TOP]);
 }
 
 void updateFeedOverrideDisplay() {
@@ -133,9 +182,9 @@ void updateFeedOverrideDisplay() {
 
     int ox, oy;
     bool active = (pendantFeeds.dialMode == 1);
-    LovyanGFX* g = beginPanelSprite(72, 37, ox, oy, 83, 137);
+    LovyanGFX* g = beginPanelSprite(kFeedsLayout[FS_FEED_DIAL], ox, oy);
     drawDialField(g, ox, oy, 72, 37, fro, COLOR_ORANGE, active);
-    endPanelSprite(72, 37, 83, 137);
+    endPanelSprite(kFeedsLayout[FS_FEED_DIAL]);
 }
 
 void updateSpindleOverrideDisplay() {
@@ -148,43 +197,34 @@ void updateSpindleOverrideDisplay() {
 
     int ox, oy;
     bool active = (pendantFeeds.dialMode == 2);
-    LovyanGFX* g = beginPanelSprite(72, 37, ox, oy, 83, 236);
+    LovyanGFX* g = beginPanelSprite(kFeedsLayout[FS_SPIN_DIAL], ox, oy);
     drawDialField(g, ox, oy, 72, 37, sro, COLOR_GREEN, active);
-    endPanelSprite(72, 37, 83, 236);
+    endPanelSprite(kFeedsLayout[FS_SPIN_DIAL]);
 }
 
 void redrawFeedOverrideButtons() {
     if (currentPendantScreen != PSCREEN_FEEDS_SPEEDS) return;
-    String pcts[] = { "50%", "75%", "100%", "125%", "150%" };
-    for (int i = 0; i < 3; i++) {
-        uint16_t bg = (i == pendantFeeds.selectedFeedOverride) ? COLOR_ORANGE : COLOR_BUTTON_GRAY;
-        drawButton(5 + i * 78, 95, 72, 37, pcts[i], bg, COLOR_WHITE, 2);
-    }
-    uint16_t bg3 = (3 == pendantFeeds.selectedFeedOverride) ? COLOR_ORANGE : COLOR_BUTTON_GRAY;
-    drawButton(5, 137, 72, 37, pcts[3], bg3, COLOR_WHITE, 2);
-    uint16_t bg4 = (4 == pendantFeeds.selectedFeedOverride) ? COLOR_ORANGE : COLOR_BUTTON_GRAY;
-    drawButton(161, 137, 72, 37, pcts[4], bg4, COLOR_WHITE, 2);
-    updateFeedOverrideDisplay();
+    int sel = pendantFeeds.selectedFeedOverride;
+    if (_drawnFeedSel >= 0 && _drawnFeedSel < 5) uiMarkDirty(kFeedPresetIds[_drawnFeedSel]);
+    if (sel >= 0 && sel < 5) uiMarkDirty(kFeedPresetIds[sel]);
+    uiMarkDirty(FS_FEED_DIAL);
+    flushFeedsDirty();
+    _drawnFeedSel = sel;
 }
 
 void redrawSpindleOverrideButtons() {
     if (currentPendantScreen != PSCREEN_FEEDS_SPEEDS) return;
-    String pcts[] = { "50%", "75%", "100%", "125%", "150%" };
-    for (int i = 0; i < 3; i++) {
-        uint16_t bg = (i == pendantFeeds.selectedSpindleOverride) ? COLOR_ORANGE : COLOR_BUTTON_GRAY;
-        drawButton(5 + i * 78, 194, 72, 37, pcts[i], bg, COLOR_WHITE, 2);
-    }
-    uint16_t bg3s = (3 == pendantFeeds.selectedSpindleOverride) ? COLOR_ORANGE : COLOR_BUTTON_GRAY;
-    drawButton(5, 236, 72, 37, pcts[3], bg3s, COLOR_WHITE, 2);
-    uint16_t bg4s = (4 == pendantFeeds.selectedSpindleOverride) ? COLOR_ORANGE : COLOR_BUTTON_GRAY;
-    drawButton(161, 236, 72, 37, pcts[4], bg4s, COLOR_WHITE, 2);
-    updateSpindleOverrideDisplay();
+    int sel = pendantFeeds.selectedSpindleOverride;
+    if (_drawnSpindleSel >= 0 && _drawnSpindleSel < 5) uiMarkDirty(kSpindlePresetIds[_drawnSpindleSel]);
+    if (sel >= 0 && sel < 5) uiMarkDirty(kSpindlePresetIds[sel]);
+    uiMarkDirty(FS_SPIN_DIAL);
+    flushFeedsDirty();
+    _drawnSpindleSel = sel;
 }
 
-// Request a feed/spindle override %.  The actual real-time bytes are emitted by a
-// paced coarse+fine stepper in the periodic loop (see CNC_Pendant_UI.cpp) — not a
-// tight burst — so a Modbus VFD isn't flooded and FluidNC's task watchdog can't
-// be starved.  The stepper anchors off the reported value (no reset-to-100%).
+// Request a feed/spindle override %.  The real-time bytes are planned and paced
+// by OverridePlanner.cpp from the periodic loop — fewest bytes from the reported
+// value, spindle batches small enough that a Modbus VFD isn't flooded.
 static void applyFeedOverride(int targetPct) {
     if (!pendantConnected) return;
     overrideSetFeedTarget(targetPct);
@@ -196,83 +236,39 @@ static void applySpindleOverride(int targetPct) {
 }
 
 void handleFeedsSpeedsTouch(int x, int y) {
-    int pcts[] = { 50, 75, 100, 125, 150 };
-
-    // ── Feed override preset buttons ─────────────────────────────────────
-    for (int i = 0; i < 3; i++) {
-        if (isTouchInBounds(x, y, 5 + i * 78, 95, 72, 37)) {
-            pendantFeeds.dialMode             = 0;
-            pendantFeeds.selectedFeedOverride = i;
-            applyFeedOverride(pcts[i]);   // readout tracks the live reported ramp
-            redrawFeedOverrideButtons();
-            updateSpindleOverrideDisplay();  // deactivate spindle dial visual
+    int id = uiHitTest(kFeeds, x, y);
+    if (id < 0) return;
+
+    switch (id) {
+        // ── Override readout buttons (centre of row 2) ───────────────────────
+        case FS_FEED_DIAL:
+            pendantFeeds.dialMode = (pendantFeeds.dialMode == 1) ? 0 : 1;  // toggle; deselects spindle
+            updateFeedOverrideDisplay();
+            updateSpindleOverrideDisplay();
+            return;
+        case FS_SPIN_DIAL:
+            pendantFeeds.dialMode = (pendantFeeds.dialMode == 2) ? 0 : 2;  // toggle; deselects feed
+            updateSpindleOverrideDisplay();
+            updateFeedOverrideDisplay();
+            return;
+        case FS_MAIN_MENU:
+            currentPendantScreen = PSCREEN_MAIN_MENU;
             return;
-        }
-    }
-    if (isTouchInBounds(x, y, 5, 137, 72, 37)) {
-        pendantFeeds.dialMode             = 0;
-        pendantFeeds.selectedFeedOverride = 3;
-        applyFeedOverride(125);
-        redrawFeedOverrideButtons();
-        updateSpindleOverrideDisplay();
-        return;
-    }
-
-    // ── Feed override readout button (centre of row 2) ───────────────────
-    if (isTouchInBounds(x, y, 83, 137, 72, 37)) {
-        pendantFeeds.dialMode = (pendantFeeds.dialMode == 1) ? 0 : 1;  // toggle; deselects spindle
-        updateFeedOverrideDisplay();
-        updateSpindleOverrideDisplay();
-        return;
     }
 
-    if (isTouchInBounds(x, y, 161, 137, 72, 37)) {
+    // ── Preset buttons ───────────────────────────────────────────────────
+    int i;
+    if ((i = presetIndex(kFeedPresetIds, id)) >= 0) {
         pendantFeeds.dialMode             = 0;
-        pendantFeeds.selectedFeedOverride = 4;
-        applyFeedOverride(150);
+        pendantFeeds.selectedFeedOverride = i;
+        applyFeedOverride(kPresetPcts[i]);   // readout tracks the live reported ramp
         redrawFeedOverrideButtons();
-        updateSpindleOverrideDisplay();
-        return;
-    }
-
-    // ── Spindle override preset buttons ──────────────────────────────────
-    for (int i = 0; i < 3; i++) {
-        if (isTouchInBounds(x, y, 5 + i * 78, 194, 72, 37)) {
-            pendantFeeds.dialMode                = 0;
-            pendantFeeds.selectedSpindleOverride = i;
-            applySpindleOverride(pcts[i]);   // readout tracks the live reported ramp
-            redrawSpindleOverrideButtons();
-            updateFeedOverrideDisplay();  // deactivate feed dial visual
-            return;
-        }
-    }
-    if (isTouchInBounds(x, y, 5, 236, 72, 37)) {
+        updateSpindleOverrideDisplay();      // deactivate spindle dial visual
+    } else if ((i = presetIndex(kSpindlePresetIds, id)) >= 0) {
         pendantFeeds.dialMode                = 0;
-        pendantFeeds.selectedSpindleOverride = 3;
-        applySpindleOverride(125);
+        pendantFeeds.selectedSpindleOverride = i;
+        applySpindleOverride(kPresetPcts[i]);   // readout tracks the live reported ramp
         redrawSpindleOverrideButtons();
-        updateFeedOverrideDisplay();
-        return;
-    }
-
-    // ── Spindle override readout button (centre of row 2) ────────────────
-    if (isTouchInBounds(x, y, 83, 236, 72, 37)) {
-        pendantFeeds.dialMode = (pendantFeeds.dialMode == 2) ? 0 : 2;  // toggle; deselects feed
-        updateSpindleOverrideDisplay();
-        updateFeedOverrideDisplay();
-        return;
-    }
-
-    if (isTouchInBounds(x, y, 161, 236, 72, 37)) {
-        pendantFeeds.dialMode                = 0;
-        pendantFeeds.selectedSpindleOverride = 4;
-        applySpindleOverride(150);
-        redrawSpindleOverrideButtons();
-        updateFeedOverrideDisplay();
-        return;
-    }
-
-    if (isTouchInBounds(x, y, 5, 280, 230, 40)) {
-        currentPendantScreen = PSCREEN_MAIN_MENU;
+        updateFeedOverrideDisplay();            // deactivate feed dial visual
     }
 }
@@ -5,8 +5,25 @@
 
 extern Preferences preferences;
 
+// ── Layout ──────────────────────────────────────────────────────────────────
+// The whole CONNECTION panel is a touch target (→ WiFi Setup).
+enum FluidNCWidget : uint8_t {
+    FN_VERSION, FN_CONNECTION, FN_RESOURCES, FN_MAIN_MENU, FN_MDI, FN_STATUS, FN_COUNT
+};
+
+static constexpr UiWidget kFluidNCLayout[] = {
+    { FN_VERSION,      5,  40, 230, 60, nullptr,     nullptr },
+    { FN_CONNECTION,   5, 108, 230, 70, nullptr,     nullptr },
+    { FN_RESOURCES,    5, 186, 230, 70, nullptr,     nullptr },
+    { FN_MAIN_MENU,    5, 272,  72, 40, "Main Menu", nullptr },
+    { FN_MDI,         83, 272,  72, 40, "MDI",       nullptr },
+    { FN_STATUS,     161, 272,  74, 40, "Status",    nullptr },
+};
+static_assert(uiIdsMatchIndex(kFluidNCLayout, FN_COUNT), "kFluidNCLayout must be in FluidNCWidget order");
+static constexpr UiLayout kFluidNC = uiLayout(kFluidNCLayout);
+
 void enterFluidNC() {
-    // Both panels use transient 16-bit sprites (see updateFluidNCDisplay).
+    // Both panels use the shared 4-bit panel scratch (see updateFluidNCDisplay).
     releasePanelSprites();
 }
 
@@ -31,85 +48,84 @@ void exitFluidNC() {
 // area blank — which made the FluidNC screen look mostly empty.
 void updateFluidNCDisplay() {
     // Snapshot dynamic values under mutex
-    String fluidDialVer, fluidNCVer, connStatus, dispRotation, baudRate, ip, ssid;
+    char fluidDialVer[24] = "", fluidNCVer[24] = "", connStatus[24] = "", dispRotation[16] = "", ip[20] = "", ssid[36] = "";
     bool connected = pendantConnected;
 
     if (xSemaphoreTake(stateMutex, pdMS_TO_TICKS(5)) == pdTRUE) {
-        fluidDialVer = pendantMachine.fluidDialVersion;
-        fluidNCVer   = pendantMachine.fluidNCVersion;
-        connStatus   = pendantMachine.connectionStatus;
-        dispRotation = pendantMachine.displayRotation;
-        baudRate     = pendantMachine.baudRate;
-        ip           = pendantMachine.ipAddress;
-        ssid         = pendantMachine.wifiSSID;
+        copyStr(fluidDialVer, sizeof(fluidDialVer), pendantMachine.fluidDialVersion);
+        copyStr(fluidNCVer, sizeof(fluidNCVer), pendantMachine.fluidNCVersion);
+        copyStr(connStatus, sizeof(connStatus), pendantMachine.connectionStatus);
+        copyStr(dispRotation, sizeof(dispRotation), pendantMachine.displayRotation);
+        copyStr(ip, sizeof(ip), pendantMachine.ipAddress);
+        copyStr(ssid, sizeof(ssid), pendantMachine.wifiSSID);
         xSemaphoreGive(stateMutex);
     }
 
     // ── Panel 1: Version / Network (sprite pushed at 5, 40) ─────────────────
     {
         int ox, oy;
-        LovyanGFX* g = beginPanelSprite(230, 60, ox, oy, 5, 40);
-        g->fillRect(ox, oy, 230, 60, COLOR_BACKGROUND);        // black corners
-        g->fillRoundRect(ox, oy, 230, 60, 5, COLOR_DARKER_BG); // rounded panel
+        LovyanGFX* g = beginPanelSprite(kFluidNCLayout[FN_VERSION], ox, oy);
+        g->fillRect(ox, oy, 230, 60, panelInk(g, COLOR_BACKGROUND));        // black corners
+        g->fillRoundRect(ox, oy, 230, 60, 5, panelInk(g, COLOR_DARKER_BG)); // rounded panel
 
-        g->setTextColor(COLOR_GRAY_TEXT); g->setTextSize(1);
+        g->setTextColor(panelInk(g, COLOR_GRAY_TEXT)); g->setTextSize(1);
         g->setCursor(ox + 5, oy + 5);  g->print("FluidDial-CYD");
-        g->setTextColor(COLOR_GREEN);
+        g->setTextColor(panelInk(g, COLOR_GREEN));
         g->setCursor(ox + 5, oy + 17); g->print(fluidDialVer);
 
-        g->setTextColor(COLOR_GRAY_TEXT);
+        g->setTextColor(panelInk(g, COLOR_GRAY_TEXT));
         g->setCursor(ox + 5, oy + 35);  g->print("FluidNC");
-        g->setTextColor(COLOR_GREEN);
+        g->setTextColor(panelInk(g, COLOR_GREEN));
         g->setCursor(ox + 5, oy + 47); g->print(fluidNCVer);
 
-        g->setTextColor(COLOR_GRAY_TEXT);
+        g->setTextColor(panelInk(g, COLOR_GRAY_TEXT));
         g->setCursor(ox + 115, oy + 5);  g->print("IP ADDRESS");
-        g->setTextColor(COLOR_CYAN);
-        g->setCursor(ox + 115, oy + 17); g->print(ip.length() ? ip : "---");
+        g->setTextColor(panelInk(g, COLOR_CYAN));
+        g->setCursor(ox + 115, oy + 17); g->print(ip[0] ? ip : "---");
 
-        g->setTextColor(COLOR_GRAY_TEXT);
+        g->setTextColor(panelInk(g, COLOR_GRAY_TEXT));
         g->setCursor(ox + 115, oy + 35);  g->print("WIFI SSID");
-        g->setTextColor(COLOR_CYAN);
-        g->setCursor(ox + 115, oy + 47); g->print(ssid.length() ? ssid : "---");
+        g->setTextColor(panelInk(g, COLOR_CYAN));
+        g->setCursor(ox + 115, oy + 47); g->print(ssid[0] ? ssid : "---");
 
-        endPanelSprite(230, 60, 5, 40);
+        endPanelSprite(kFluidNCLayout[FN_VERSION]);
     }
 
     // ── Panel 2: Resources (sprite pushed at 5, 186) ────────────────────────
     {
         int ox, oy;
-        LovyanGFX* g = beginPanelSprite(230, 70, ox, oy, 5, 186);
-        g->fillRect(ox, oy, 230, 70, COLOR_BACKGROUND);        // black corners
-        g->fillRoundRect(ox, oy, 230, 70, 5, COLOR_DARKER_BG); // rounded panel
+        LovyanGFX* g = beginPanelSprite(kFluidNCLayout[FN_RESOURCES], ox, oy);
+        g->fillRect(ox, oy, 230, 70, panelInk(g, COLOR_BACKGROUND));        // black corners
+        g->fillRoundRect(ox, oy, 230, 70, 5, panelInk(g, COLOR_DARKER_BG)); // rounded panel
 
-        g->setTextColor(COLOR_GRAY_TEXT); g->setTextSize(1);
+        g->setTextColor(panelInk(g, COLOR_GRAY_TEXT)); g->setTextSize(1);
         g->setCursor(ox + 5, oy + 5); g->print("FREE HEAP");
-        g->setTextColor(COLOR_ORANGE); g->setTextSize(2);
+        g->setTextColor(panelInk(g, COLOR_ORANGE)); g->setTextSize(2);
         g->setCursor(ox + 5, oy + 20);
         g->print(ESP.getFreeHeap() / 1024);
         g->print(" KB");
 
-        g->setTextColor(COLOR_GRAY_TEXT); g->setTextSize(1);
+        g->setTextColor(panelInk(g, COLOR_GRAY_TEXT)); g->setTextSize(1);
         g->setCursor(ox + 115, oy + 5); g->print("STATUS");
-        g->setTextColor(connected ? COLOR_GREEN : COLOR_RED);
+        g->setTextColor(panelInk(g, connected ? COLOR_GREEN : COLOR_RED));
         g->setCursor(ox + 115, oy + 20); g->print(connStatus);
 
-        g->setTextColor(COLOR_GRAY_TEXT);
+        g->setTextColor(panelInk(g, COLOR_GRAY_TEXT));
         g->setCursor(ox + 5, oy + 48); g->print("ROTATION");
-        g->setTextColor(COLOR_CYAN);
+        g->setTextColor(panelInk(g, COLOR_CYAN));
         g->setCursor(ox + 5, oy + 58); g->print(dispRotation);
 
-        g->setTextColor(COLOR_GRAY_TEXT);
+        g->setTextColor(panelInk(g, COLOR_GRAY_TEXT));
         g->setCursor(ox + 115, oy + 48); g->print("Jog Dial");
-        g->setTextColor(COLOR_CYAN);
+        g->setTextColor(panelInk(g, COLOR_CYAN));
         g->setCursor(ox + 115, oy + 58); g->print("Rotate");
 
-        endPanelSprite(230, 70, 5, 186);
+        endPanelSprite(kFluidNCLayout[FN_RESOURCES]);
     }
 }
 
 void drawFluidNCScreen() {
-    display.fillScreen(COLOR_BACKGROUND);
+    gfx->fillScreen(COLOR_BACKGROUND);
     drawTitle("FLUIDNC");
 
     // Connection panel — static content, drawn once directly.
@@ -117,33 +133,35 @@ void drawFluidNCScreen() {
     // transport-config / WiFi-status screen.  Tappable on both UART and WiFi
     // pendants because the setup screen is also where the transport override
     // lives (in case autodetect picked the wrong mode for the hardware).
-    display.fillRoundRect(5, 108, 230, 70, 5, COLOR_DARKER_BG);
-    display.drawRoundRect(5, 108, 230, 70, 5, COLOR_CYAN);  // tappable hint
+    const UiWidget& conn = kFluidNCLayout[FN_CONNECTION];
+    gfx->fillRoundRect(conn.x, conn.y, conn.w, conn.h, 5, COLOR_DARKER_BG);
+    gfx->drawRoundRect(conn.x, conn.y, conn.w, conn.h, 5, COLOR_CYAN);     // tappable hint
 
 #ifdef USE_WIFI
     // Affordance text in the top-right reflects what the user gets on tap:
     // "WiFi >" when WiFi is live, "Setup >" when UART is live.
     bool wifiMode = (comms_active_mode() == COMMS_MODE_WIFI);
     const char* hint = wifiMode ? "WiFi >" : "Setup >";
-    display.setTextColor(COLOR_CYAN); display.setTextSize(1);
-    display.setCursor(240 - 5 - display.textWidth(hint), 113);
-    display.print(hint);
+    gfx->setTextColor(COLOR_CYAN); gfx->setTextSize(1);
+    gfx->setCursor(240 - 5 - gfx->textWidth(hint), 113);
+    gfx->print(hint);
 #endif
 
-    display.setTextColor(COLOR_GRAY_TEXT); display.setTextSize(1);
-    display.setCursor(10, 113); display.print("CONNECTION");
+    gfx->setTextColor(COLOR_GRAY_TEXT); gfx->setTextSize(1);
+    gfx->setCursor(10, 113); gfx->print("CONNECTION");
 
-    display.setTextColor(COLOR_GRAY_TEXT); display.setTextSize(1);
-    display.setCursor(10, 130); display.print("Baud:");
-    display.setTextColor(COLOR_ORANGE); display.setTextSize(2);
-    display.setCursor(100, 127); display.print(pendantMachine.baudRate);
-    display.setTextColor(COLOR_GRAY_TEXT); display.setTextSize(1);
-    display.setCursor(10, 148); display.print("Port:");
-    display.setTextColor(COLOR_CYAN); display.setTextSize(1);
-    display.setCursor(10, 160); display.print(pendantMachine.port);
+    gfx->setTextColor(COLOR_GRAY_TEXT); gfx->setTextSize(1);
+    gfx->setCursor(10, 130); gfx->print("Baud:");
+    gfx->setTextColor(COLOR_ORANGE); gfx->setTextSize(2);
+    gfx->setCursor(100, 127); gfx->print(pendantMachine.baudRate);
+    gfx->setTextColor(COLOR_GRAY_TEXT); gfx->setTextSize(1);
+    gfx->setCursor(10, 148); gfx->print("Port:");
+    gfx->setTextColor(COLOR_CYAN); gfx->setTextSize(1);
+    gfx->setCursor(10, 160); gfx->print(pendantMachine.port);
 
-    drawButton(5,   272, 112, 40, "Main Menu", COLOR_BLUE,        COLOR_WHITE, 2);
-    drawButton(123, 272, 112, 40, "Status",    COLOR_BLUE,        COLOR_WHITE, 2);
+    uiDrawButton(kFluidNCLayout[FN_MAIN_MENU], COLOR_BLUE,        COLOR_WHITE, 1);
+    uiDrawButton(kFluidNCLayout[FN_MDI],       COLOR_DARK_GREEN,  COLOR_WHITE, 2);
+    uiDrawButton(kFluidNCLayout[FN_STATUS],    COLOR_BLUE,        COLOR_WHITE, 2);
 
     // Dynamic panels drawn via sprites (no flicker)
     updateFluidNCDisplay();
@@ -152,12 +170,11 @@ void drawFluidNCScreen() {
 void handleFluidNCTouch(int x, int y) {
     // Just assign — handlePendantTouch() observes the change and runs navigateTo() once.
     // Calling navigateTo() here would cause a double exit/enter cycle.
-    if (isTouchInBounds(x, y, 5, 272, 112, 40)) {
-        currentPendantScreen = PSCREEN_MAIN_MENU;
-    } else if (isTouchInBounds(x, y, 123, 272, 112, 40)) {
-        currentPendantScreen = PSCREEN_STATUS;
-    } else if (isTouchInBounds(x, y, 5, 108, 230, 70)) {
-        // Entire CONNECTION panel → WiFi Setup
-        currentPendantScreen = PSCREEN_WIFI_SETUP;
+    switch (uiHitTest(kFluidNC, x, y)) {
+        case FN_MAIN_MENU:  currentPendantScreen = PSCREEN_MAIN_MENU;  break;
+        case FN_MDI:        currentPendantScreen = PSCREEN_MDI;        break;
+        case FN_STATUS:     currentPendantScreen = PSCREEN_STATUS;     break;
+        case FN_CONNECTION: currentPendantScreen = PSCREEN_WIFI_SETUP; break;  // entire panel
+        default:            break;
     }
 }
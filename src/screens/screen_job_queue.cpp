@@ -0,0 +1,296 @@
+#include "pendant_shared.h"
+#include "screen_job_queue.h"
+#include "screen_macros.h"  // requestMacros()
+#include "job_queue.h"
+
+// ── Layout ──────────────────────────────────────────────────────────────────
+// Queue state line on top, four job rows (36 px, 40 px pitch), then the
+// edit row acting on the selected job and the run controls.
+enum JobQueueWidget : uint8_t {
+    JQW_STATE, JQW_LIST, JQW_UP, JQW_MACRO, JQW_REMOVE, JQW_BACK, JQW_POLICY, JQW_RUN, JQW_COUNT
+};
+
+static constexpr UiWidget kJobQueueLayout[] = {
+    { JQW_STATE,    5,  40, 230,  34, nullptr,   nullptr },
+    { JQW_LIST,     5,  78, 230, 156, nullptr,   nullptr },
+    { JQW_UP,       5, 242,  72,  36, "Up",      nullptr },
+    { JQW_MACRO,   83, 242,  72,  36, "Macro",   nullptr },
+    { JQW_REMOVE, 161, 242,  74,  36, "Remove",  nullptr },
+    { JQW_BACK,     5, 282,  72,  36, "SD Card", nullptr },
+    { JQW_POLICY,  83, 282,  72,  36, nullptr,   nullptr },
+    { JQW_RUN,    161, 282,  74,  36, nullptr,   nullptr },
+};
+static_assert(uiIdsMatchIndex(kJobQueueLayout, JQW_COUNT), "kJobQueueLayout must be in JobQueueWidget order");
+static constexpr UiLayout kJobQueue = uiLayout(kJobQueueLayout);
+
+#define JQ_ROWS      4
+#define JQ_ROW_PITCH 40
+
+static int         _selected = 0;
+static int         _scroll   = 0;
+static const char* _hint     = "";   // one-off note from the last tap, e.g. no macros
+
+// Last-rendered snapshot; the 100 ms tick repaints only when it changes.
+struct JobQueueRenderState {
+    bool        valid;
+    uint32_t    generation;
+    int         selected;
+    int         scroll;
+    int         countdown;
+    bool        macrosLoading;
+    const char* hint;
+};
+static JobQueueRenderState _lastRender = {};
+
+static void clampSelection() {
+    int n = jobQueueCount();
+    if (_selected >= n) _selected = n - 1;
+    if (_selected < 0) _selected = 0;
+    if (_selected < _scroll) _scroll = _selected;
+    if (_selected >= _scroll + JQ_ROWS) _scroll = _selected - JQ_ROWS + 1;
+    if (_scroll > n - JQ_ROWS) _scroll = n > JQ_ROWS ? n - JQ_ROWS : 0;
+}
+
+void enterJobQueue() {
+    releasePanelSprites();
+    _hint             = "";
+    _lastRender.valid = false;
+    clampSelection();
+
+    // The Macro button cycles through the controller's macros.  Fetch them
+    // now if the Macros screen hasn't yet; onFilesList() routes the reply
+    // here as it does for that screen.
+    if (!pendantMacros.cacheValid && !pendantMacros.loading && pendantConnected) {
+        requestMacros();
+    }
+}
+
+void exitJobQueue() {
+    releasePanelSprites();
+}
+
+static void drawJobQueueChrome() {
+    gfx->fillScreen(COLOR_BACKGROUND);
+    drawTitleBar("JOB QUEUE");
+    uiDrawButton(kJobQueueLayout[JQW_UP],     COLOR_BUTTON_GRAY, COLOR_WHITE, 2);
+    uiDrawButton(kJobQueueLayout[JQW_MACRO],  COLOR_BUTTON_GRAY, COLOR_WHITE, 2);
+    uiDrawButton(kJobQueueLayout[JQW_REMOVE], COLOR_BUTTON_GRAY, COLOR_WHITE, 1);
+    uiDrawButton(kJobQueueLayout[JQW_BACK],   COLOR_BLUE,        COLOR_WHITE, 1);
+}
+
+// Policy and Start/Pause faces change with the queue, so they're drawn
+// outside the cached chrome and again whenever the queue changes.
+static void drawRunControls() {
+    const UiWidget& pol = kJobQueueLayout[JQW_POLICY];
+    drawMultiLineButton(pol.x, pol.y, pol.w, pol.h, "Next job:",
+                        jobQueuePolicy() == JQ_POLICY_AUTO ? "Auto" : "Confirm",
+                        COLOR_BUTTON_GRAY, COLOR_WHITE, 1);
+
+    const UiWidget& run   = kJobQueueLayout[JQW_RUN];
+    JobQueuePhase   phase = jobQueuePhase();
+    if (jobQueueRunning()) {
+        if (jobQueuePausing()) drawButton(run.x, run.y, run.w, run.h, "Resume", COLOR_DARK_GREEN, COLOR_WHITE, 1);
+        else                   drawButton(run.x, run.y, run.w, run.h, "Pause",  COLOR_ORANGE,     COLOR_WHITE, 2);
+    } else if (phase == JQ_COUNTDOWN) {
+        drawButton(run.x, run.y, run.w, run.h, "Pause", COLOR_ORANGE, COLOR_WHITE, 2);
+    } else {
+        drawButton(run.x, run.y, run.w, run.h, "Start", COLOR_DARK_GREEN, COLOR_WHITE, 2);
+    }
+}
+
+static void drawStateLine() {
+    char line1[48];
+    char line2[48];
+    uint16_t ink = COLOR_CYAN;
+    line2[0]     = '\0';
+
+    int n = jobQueueCount();
+    switch (jobQueuePhase()) {
+        case JQ_MACRO:
+            snprintf(line1, sizeof(line1), "Macro: %s", jobQueueAt(0).macroName);
+            snprintf(line2, sizeof(line2), "then %s", jobQueueAt(0).file);
+            break;
+        case JQ_JOB:
+            snprintf(line1, sizeof(line1), "Running %s", jobQueueAt(0).file);
+            snprintf(line2, sizeof(line2), "%d left after this", n - 1);
+            break;
+        case JQ_CONFIRM:
+            ink = COLOR_GREEN;
+            snprintf(line1, sizeof(line1), "Job done - green starts next");
+            snprintf(line2, sizeof(line2), "%d left", n);
+            break;
+        case JQ_COUNTDOWN:
+            ink = COLOR_GREEN;
+            snprintf(line1, sizeof(line1), "Next job in %d s", jobQueueCountdownS());
+            snprintf(line2, sizeof(line2), "Pause to hold it");
+            break;
+        default:
+            if (*jobQueueMessage()) {
+                ink = COLOR_ORANGE;
+                snprintf(line1, sizeof(line1), "%s", jobQueueMessage());
+            } else {
+                ink = COLOR_GRAY_TEXT;
+                snprintf(line1, sizeof(line1), n ? "Stopped" : "Empty");
+            }
+            snprintf(line2, sizeof(line2), "%d job%s queued", n, n == 1 ? "" : "s");
+            break;
+    }
+    if (jobQueuePausing()) {
+        snprintf(line2, sizeof(line2), "Stops after this step");
+    }
+    if (*_hint) {
+        snprintf(line2, sizeof(line2), "%s", _hint);
+    }
+
+    int ox, oy;
+    LovyanGFX* g = beginPanelSprite(kJobQueueLayout[JQW_STATE], ox, oy);
+    g->fillRoundRect(ox, oy, 230, 34, 5, panelInk(g, COLOR_DARKER_BG));
+    g->setTextSize(1);
+    g->setTextColor(panelInk(g, ink));
+    g->setCursor(ox + 5, oy + 5);
+    g->print(line1);
+    g->setTextColor(panelInk(g, COLOR_GRAY_TEXT));
+    g->setCursor(ox + 5, oy + 20);
+    g->print(line2);
+    endPanelSprite(kJobQueueLayout[JQW_STATE]);
+}
+
+static void drawJobList() {
+    int ox, oy;
+    LovyanGFX* g = beginPanelSprite(kJobQueueLayout[JQW_LIST], ox, oy);
+    g->fillRect(ox, oy, 230, 156, panelInk(g, COLOR_BACKGROUND));
+    g->setTextSize(1);
+
+    int n = jobQueueCount();
+    if (n == 0) {
+        g->setTextColor(panelInk(g, COLOR_GRAY_TEXT));
+        g->setCursor(ox + 15, oy + 60);
+        g->print("Queue is empty.");
+        g->setCursor(ox + 15, oy + 78);
+        g->print("Add files on the SD Card screen.");
+    }
+
+    bool running = jobQueueRunning();
+    for (int i = 0; i < JQ_ROWS; i++) {
+        int idx = i + _scroll;
+        if (idx >= n) break;
+        const QueuedJob& j = jobQueueAt(idx);
+
+        uint16_t bg = COLOR_BUTTON_GRAY;
+        if (idx == 0 && running)   bg = COLOR_DARK_GREEN;
+        else if (idx == _selected) bg = COLOR_BUTTON_ACTIVE;
+        int y = oy + i * JQ_ROW_PITCH;
+        g->fillRoundRect(ox, y, 230, 36, 8, panelInk(g, bg));
+
+        char line[48];
+        snprintf(line, sizeof(line), "%d. %s", idx + 1, j.file);
+        g->setTextColor(panelInk(g, COLOR_WHITE));
+        g->setCursor(ox + 5, y + (j.macroName[0] ? 6 : 14));
+        g->print(line);
+        if (j.macroName[0]) {
+            snprintf(line, sizeof(line), "first: %s", j.macroName);
+            g->setTextColor(panelInk(g, COLOR_CYAN));
+            g->setCursor(ox + 15, y + 21);
+            g->print(line);
+        }
+    }
+    endPanelSprite(kJobQueueLayout[JQW_LIST]);
+}
+
+void updateJobQueueDisplay() {
+    if (currentPendantScreen != PSCREEN_JOB_QUEUE) return;
+
+    clampSelection();
+    JobQueueRenderState cur = {
+        /*valid*/         true,
+        /*generation*/    jobQueueGeneration(),
+        /*selected*/      _selected,
+        /*scroll*/        _scroll,
+        /*countdown*/     jobQueueCountdownS(),
+        /*macrosLoading*/ pendantMacros.loading,
+        /*hint*/          _hint,
+    };
+    if (_lastRender.valid &&
+        _lastRender.generation    == cur.generation &&
+        _lastRender.selected      == cur.selected &&
+        _lastRender.scroll        == cur.scroll &&
+        _lastRender.countdown     == cur.countdown &&
+        _lastRender.macrosLoading == cur.macrosLoading &&
+        _lastRender.hint          == cur.hint) {
+        return;
+    }
+    bool controls = !_lastRender.valid || _lastRender.generation != cur.generation;
+    _lastRender   = cur;
+
+    drawStateLine();
+    drawJobList();
+    if (controls) drawRunControls();
+}
+
+void drawJobQueueScreen() {
+    drawChrome(drawJobQueueChrome);
+    drawTitleIcons();
+    _lastRender.valid = false;
+    updateJobQueueDisplay();
+}
+
+void handleJobQueueEncoder(int delta) {
+    _selected += delta;
+    _hint = "";
+    clampSelection();
+    updateJobQueueDisplay();
+}
+
+void handleJobQueueTouch(int x, int y) {
+    int hit = uiHitTest(kJobQueue, x, y);
+    if (hit != JQW_STATE) _hint = "";
+
+    switch (hit) {
+        case JQW_LIST: {
+            int idx = _scroll + (y - kJobQueueLayout[JQW_LIST].y) / JQ_ROW_PITCH;
+            if (idx < jobQueueCount()) _selected = idx;
+            break;
+        }
+        case JQW_UP:
+            if (_selected > 0 && !(_selected == 1 && jobQueueRunning())) {
+                jobQueueMoveUp(_selected);
+                _selected--;
+            }
+            break;
+        case JQW_MACRO:
+            if (_selected == 0 && jobQueueRunning()) {
+                _hint = "Can't change the running job";
+            } else if (pendantMacros.count == 0 && jobQueueCount()) {
+                if (!pendantMacros.cacheValid && !pendantMacros.loading && pendantConnected) requestMacros();
+                _hint = pendantMacros.loading ? "Macros still loading" : "No macros loaded";
+            } else {
+                jobQueueCycleMacro(_selected);
+            }
+            break;
+        case JQW_REMOVE:
+            if (_selected == 0 && jobQueueRunning()) {
+                _hint = "Can't remove the running job";
+            } else {
+                jobQueueRemove(_selected);
+            }
+            break;
+        case JQW_BACK:
+            currentPendantScreen = PSCREEN_SD_CARD;
+            return;
+        case JQW_POLICY:
+            jobQueueTogglePolicy();
+            break;
+        case JQW_RUN:
+            if (jobQueueRunning() || jobQueuePhase() == JQ_COUNTDOWN) {
+                jobQueuePause();
+            } else if (jobQueuePhase() == JQ_CONFIRM) {
+                jobQueueConfirm();
+            } else {
+                jobQueueStart();
+            }
+            break;
+        default:
+            return;
+    }
+    updateJobQueueDisplay();
+}
@@ -0,0 +1,7 @@
+#pragma once
+void enterJobQueue();
+void exitJobQueue();
+void drawJobQueueScreen();
+void updateJobQueueDisplay();     // sprite refresh — called by updateCurrentScreenSprites()
+void handleJobQueueTouch(int x, int y);
+void handleJobQueueEncoder(int delta);  // dial moves the selection
@@ -1,6 +1,7 @@
 #include "pendant_shared.h"
 #include "screen_jog_homing.h"
 #include "screen_probe.h"   // probeDrawKVTouch — shared adjustable-field style
+#include "../LinkRtt.h"      // segment length follows the measured ack RTT
 
 // ===== Increment sets =====
 struct IncrementSet {
@@ -48,6 +49,144 @@ static const int SPD_H = 40;
 static int           incTapCount = 0;
 static unsigned long incTapMs    = 0;
 
+// ===== XY touch joystick =====
+// Tapping the DRO swaps the home / axis / increment rows for a pad.  The drag
+// vector from the pad centre is the XY jog direction and its length the speed
+// (quadratic, so the middle of the pad is for creeping up on an edge; the rim
+// is the Speed cap).  Motion is streamed as short G91 $J= segments, one every
+// segment time, each covering exactly that much travel at the current speed —
+// so FluidNC's planner holds only what the link latency needs and a change of
+// direction shows up a couple of segments later.  Lifting the finger sends
+// JogCancel on that same pass, which also flushes whatever was queued.
+static const int   PAD_X = 5, PAD_Y = 100, PAD_W = 230, PAD_H = 170;
+static const int   PAD_CX = PAD_X + PAD_W / 2, PAD_CY = PAD_Y + PAD_H / 2;
+static const int   PAD_R        = 78;     // full speed at this drag length
+static const int   PAD_KNOB_R   = 12;
+static const float PAD_DEAD     = 0.12f;  // inner fraction of the radius that doesn't move
+static const int   PAD_AHEAD    = 3;      // $J= lines awaiting their ok
+static const int   PAD_SEG_MS   = 80;     // shortest segment
+static const int   PAD_SEG_MAX  = 200;
+
+static bool          padDragging = false;
+static bool          padMoved    = false;  // a segment went out during this drag
+static unsigned long padLastSeg  = 0;
+static unsigned long padLastDraw = 0;
+static int           padKnobX    = PAD_CX, padKnobY = PAD_CY;
+static float         padPredMm[2];         // MPos including segments sent
+
+static void drawJogPad(int kx, int ky) {
+    gfx->fillRoundRect(PAD_X, PAD_Y, PAD_W, PAD_H, 6, COLOR_DARKER_BG);
+    gfx->drawRoundRect(PAD_X, PAD_Y, PAD_W, PAD_H, 6, COLOR_GRAY_TEXT);
+    gfx->drawFastHLine(PAD_X + 8, PAD_CY, PAD_W - 16, COLOR_BUTTON_GRAY);
+    gfx->drawFastVLine(PAD_CX, PAD_Y + 8, PAD_H - 16, COLOR_BUTTON_GRAY);
+    gfx->drawCircle(PAD_CX, PAD_CY, PAD_R, COLOR_BUTTON_GRAY);
+    gfx->drawCircle(PAD_CX, PAD_CY, (int)(PAD_R * PAD_DEAD), COLOR_BUTTON_GRAY);
+    gfx->setTextSize(1);
+    gfx->setTextColor(COLOR_GRAY_TEXT);
+    gfx->setCursor(PAD_CX + 4, PAD_Y + 6);
+    gfx->print("+Y");
+    gfx->setCursor(PAD_X + PAD_W - 18, PAD_CY + 4);
+    gfx->print("+X");
+    gfx->setCursor(PAD_X + 6, PAD_Y + PAD_H - 12);
+    gfx->print("XY PAD - tap DRO for axis jog");
+    gfx->fillCircle(kx, ky, PAD_KNOB_R, padDragging ? COLOR_ORANGE : COLOR_GRAY_TEXT);
+}
+
+// Clamp one axis of a segment so the predicted MPos stays inside the homed
+// travel envelope — same envelope and margin as the dial jog.  Unknown
+// travel / $23, or Alarm, leaves it to FluidNC's own soft limits.
+static float padClampMm(int axis, float distMm) {
+    if (pendantJog.maxTravel[axis] <= 0 || pendantJog.homingDirMask < 0 ||
+        pendantMachine.status.startsWith("Alarm")) {
+        return distMm;
+    }
+    bool  homesNeg = (pendantJog.homingDirMask >> axis) & 1;
+    float travel   = (float)pendantJog.maxTravel[axis];
+    float lo       = (homesNeg ? 0.0f : -travel) + 0.5f;
+    float hi       = (homesNeg ? travel : 0.0f) - 0.5f;
+    float to       = constrain(padPredMm[axis] + distMm, lo, hi);
+    float d        = to - padPredMm[axis];
+    return (d * distMm > 0.0f) ? d : 0.0f;  // only ever shorten, never reverse
+}
+
+static void padStop() {
+    if (padMoved) {
+        fnc_realtime(JogCancel);
+    }
+    padDragging = false;
+    padMoved    = false;
+}
+
+bool jogPadTouch(bool touched, int x, int y) {
+    if (currentPendantScreen != PSCREEN_JOG_HOMING || !pendantJog.padMode) return false;
+
+    if (!touched) {
+        if (!padDragging) return false;
+        padStop();
+        padKnobX = PAD_CX;
+        padKnobY = PAD_CY;
+        drawJogPad(padKnobX, padKnobY);
+        return true;
+    }
+    if (!padDragging) {
+        if (!isTouchInBounds(x, y, PAD_X, PAD_Y, PAD_W, PAD_H)) return false;
+        padDragging = true;
+        padMoved    = false;
+        padLastSeg  = 0;
+        float k     = pendantMachine.inInches ? 25.4f : 1.0f;
+        padPredMm[0] = pendantMachine.workX * k;   // MPos
+        padPredMm[1] = pendantMachine.workY * k;
+    }
+
+    float vx  = (float)(x - PAD_CX) / PAD_R;
+    float vy  = (float)(PAD_CY - y) / PAD_R;       // screen down is machine −Y
+    float mag = sqrtf(vx * vx + vy * vy);
+    if (mag > 1.0f) {
+        vx /= mag;
+        vy /= mag;
+        mag = 1.0f;
+    }
+
+    unsigned long now = millis();
+    int           kx  = PAD_CX + (int)(vx * PAD_R);
+    int           ky  = PAD_CY - (int)(vy * PAD_R);
+    if ((abs(kx - padKnobX) > 2 || abs(ky - padKnobY) > 2) && now - padLastDraw >= 40) {
+        padKnobX    = kx;
+        padKnobY    = ky;
+        padLastDraw = now;
+        drawJogPad(kx, ky);
+    }
+
+    if (!pendantConnected || mag < PAD_DEAD) return true;
+
+    // Segment time: long enough that PAD_AHEAD lines cover an ack round trip.
+    LinkRttStats rtt;
+    int          segMs = PAD_SEG_MS;
+    if (link_rtt_ack_stats(rtt) && rtt.srtt / (PAD_AHEAD - 1) > segMs) {
+        segMs = min(rtt.srtt / (PAD_AHEAD - 1), PAD_SEG_MAX);
+    }
+    if (padLastSeg && now - padLastSeg < (unsigned long)segMs) return true;
+    if (pending_nowait_sends >= PAD_AHEAD) return true;
+
+    float capMm   = pendantMachine.inInches ? pendantJog.jogSpeedIn * 25.4f : (float)pendantJog.jogSpeedMm;
+    capMm         = min(capMm, (float)pendantJog.maxFeedRate);
+    float s       = (mag - PAD_DEAD) / (1.0f - PAD_DEAD);
+    float feed    = max(capMm * s * s, 10.0f);      // mm/min
+    float stepMm  = feed * segMs / 60000.0f;
+    float dx      = padClampMm(0, stepMm * vx / mag);
+    float dy      = padClampMm(1, stepMm * vy / mag);
+    if (fabsf(dx) < 0.001f && fabsf(dy) < 0.001f) return true;  // pinned at the envelope
+
+    char cmd[64];
+    snprintf(cmd, sizeof(cmd), "$J=G91 G21 X%.3f Y%.3f F%d", dx, dy, (int)feed);
+    send_line_nowait(cmd);
+    padPredMm[0] += dx;
+    padPredMm[1] += dy;
+    padLastSeg = now;
+    padMoved   = true;
+    return true;
+}
+
 // ===== Helpers =====
 
 void redrawJogSpeedButton() {
@@ -85,12 +224,13 @@ void enterJogHoming() {
 
     // $110/$130-$133 are cached on connect — no UART query here.
 
-    // The big DRO uses a transient 16-bit panel (see updateJogAxisDisplay); the
+    // The big DRO uses a shared 4-bit panel scratch (see updateJogAxisDisplay); the
     // direct-draw fallback keeps it from ever being blank under heap pressure.
     releasePanelSprites();
 }
 
 void exitJogHoming() {
+    if (padDragging) padStop();
     releasePanelSprites();
 }
 
@@ -100,52 +240,79 @@ void exitJogHoming() {
 // can refresh when the selected axis changes (A → "deg", X/Y/Z → "mm"/"in")
 // without a full-screen redraw.
 static void redrawJogIncrementLabel() {
-    display.fillRect(5, 219, 230, 9, COLOR_BACKGROUND);   // clear the old text row
-    display.setTextSize(1);
-    display.setCursor(5, 219);
+    if (pendantJog.padMode) return;
+    gfx->fillRect(5, 219, 230, 9, COLOR_BACKGROUND);      // clear the old text row
+    gfx->setTextSize(1);
+    gfx->setCursor(5, 219);
     if (pendantMachine.status.startsWith("Alarm")) {
-        display.setTextColor(TFT_RED);
-        display.print("JOG INCREMENT  *** " + pendantMachine.status + " ***");
+        gfx->setTextColor(TFT_RED);
+        gfx->print("JOG INCREMENT  *** ");
+        gfx->print(pendantMachine.status);
+        gfx->print(" ***");
     } else {
-        display.setTextColor(COLOR_GRAY_TEXT);
+        gfx->setTextColor(COLOR_GRAY_TEXT);
         // A axis (rotary) → label the increments in degrees, not mm/in.
-        String unitStr = (pendantJog.selectedAxis == 3) ? "deg"
-                                                        : (pendantMachine.inInches ? "in" : "mm");
-        String modeStr = pendantJog.fineIncrements ? " — fine" : " — coarse";
-        display.print("JOG INCREMENT (" + unitStr + ")" + modeStr);
+        const char* unitStr = (pendantJog.selectedAxis == 3) ? "deg"
+                                                             : (pendantMachine.inInches ? "in" : "mm");
+        const char* modeStr = pendantJog.fineIncrements ? " — fine" : " — coarse";
+        char        label[40];
+        snprintf(label, sizeof(label), "JOG INCREMENT (%s)%s", unitStr, modeStr);
+        gfx->print(label);
     }
 }
 
-void drawJogHomingScreen() {
-    display.fillScreen(COLOR_BACKGROUND);
-    drawTitle("JOG & HOMING");
+// Everything but the DRO, speed button, selections and increment row.
+static void drawJogHomingChrome() {
+    gfx->fillScreen(COLOR_BACKGROUND);
+    drawTitleBar("JOG & HOMING");
 
-    display.fillRoundRect(5, 40, 230, 55, 5, COLOR_DARKER_BG);
-    updateJogAxisDisplay();
+    gfx->fillRoundRect(5, 40, 230, 55, 5, COLOR_DARKER_BG);
+
+    // Bottom row: Main Menu | Speed | Work Area
+    drawButton(5,   SPD_Y, 73, SPD_H, "Main Menu", COLOR_BLUE, COLOR_WHITE, 1);
+    drawButton(162, SPD_Y, 73, SPD_H, "Work Area", COLOR_BLUE, COLOR_WHITE, 1);
+
+    if (pendantJog.padMode) return;
 
-    String axisNames[] = { "X", "Y", "Z", "A" };
     int numAx = pendantMachine.numAxes;
-    int btnW  = 230 / numAx;
 
-    display.setTextColor(COLOR_GRAY_TEXT);
-    display.setTextSize(1);
-    display.setCursor(5, 103);
-    display.print("HOME");
+    gfx->setTextColor(COLOR_GRAY_TEXT);
+    gfx->setTextSize(1);
+    gfx->setCursor(5, 103);
+    gfx->print("HOME");
 
     {
         const int HW = 57;
-        String homeNames[4] = { "X", "Y", "Z", numAx < 4 ? "ALL" : "A" };
-        int    numHome       = (numAx < 4) ? numAx + 1 : 4;
+        const char* homeNames[4] = { "X", "Y", "Z", numAx < 4 ? "ALL" : "A" };
+        int         numHome      = (numAx < 4) ? numAx + 1 : 4;
         for (int i = 0; i < numHome; i++) {
             int sz = (i == numAx && numAx < 4) ? 2 : 3;
             drawButton(5 + i * HW, 115, HW - 4, 38, homeNames[i], COLOR_DARK_GREEN, COLOR_WHITE, sz);
         }
     }
 
-    display.setTextColor(COLOR_GRAY_TEXT);
-    display.setTextSize(1);
-    display.setCursor(5, 161);
-    display.print("JOG AXIS");
+    gfx->setTextColor(COLOR_GRAY_TEXT);
+    gfx->setTextSize(1);
+    gfx->setCursor(5, 161);
+    gfx->print("JOG AXIS");
+    gfx->setCursor(125, 161);
+    gfx->print("tap DRO for XY pad");
+}
+
+void drawJogHomingScreen() {
+    drawChrome(drawJogHomingChrome, pendantMachine.numAxes | (pendantJog.padMode ? 0x100 : 0));
+    drawTitleIcons();
+    updateJogAxisDisplay();
+    redrawJogSpeedButton();
+
+    if (pendantJog.padMode) {
+        drawJogPad(padKnobX, padKnobY);
+        return;
+    }
+
+    const char* const axisNames[] = { "X", "Y", "Z", "A" };
+    int numAx = pendantMachine.numAxes;
+    int btnW  = 230 / numAx;
 
     for (int i = 0; i < numAx; i++) {
         // Deselect all axis buttons when in speed dial mode
@@ -161,11 +328,6 @@ void drawJogHomingScreen() {
         uint16_t bg = (i == pendantJog.selectedIncrement) ? COLOR_ORANGE : COLOR_BUTTON_GRAY;
         drawButton(5 + i * 56, 231, 52, 38, incs.labels[i], bg, COLOR_WHITE, 2);
     }
-
-    // Bottom row: Main Menu | Speed | Work Area
-    drawButton(5,   SPD_Y, 73, SPD_H, "Main Menu", COLOR_BLUE, COLOR_WHITE, 1);
-    redrawJogSpeedButton();
-    drawButton(162, SPD_Y, 73, SPD_H, "Work Area", COLOR_BLUE, COLOR_WHITE, 1);
 }
 
 // ===== Sprite update =====
@@ -173,15 +335,15 @@ void drawJogHomingScreen() {
 // Tiny degree "°" glyph drawn from two concentric rings — font-independent, so
 // it works regardless of whether the active font carries a degree character.
 static void drawDegreeIcon(LovyanGFX* g, int x, int y, uint16_t color) {
-    g->drawCircle(x, y, 3, color);
-    g->drawCircle(x, y, 2, color);
+    g->drawCircle(x, y, 3, panelInk(g, color));
+    g->drawCircle(x, y, 2, panelInk(g, color));
 }
 
 void updateJogAxisDisplay() {
     if (currentPendantScreen != PSCREEN_JOG_HOMING) return;
 
     // Snapshot under the lock; skip the frame if briefly held.  Panel is
-    // 230 x 55, pushed at (5, 40); shared 16-bit scratch, direct-draw fallback.
+    // 230 x 55, pushed at (5, 40); shared 4-bit scratch, direct-draw fallback.
     // Jog & Homing shows MACHINE coordinates (workX/Y/Z/A = MPos) — homing and
     // travel-limit reasoning are all in machine space.  (posX/Y/Z are work coords.)
     float px, py, pz, pa;
@@ -192,33 +354,65 @@ void updateJogAxisDisplay() {
 
     int ox, oy;
     LovyanGFX* g = beginPanelSprite(230, 55, ox, oy, 5, 40);
-    g->fillRect(ox, oy, 230, 55, COLOR_DARKER_BG);
+    g->fillRect(ox, oy, 230, 55, panelInk(g, COLOR_DARKER_BG));
 
     if (pendantJog.speedDialMode) {
         // Speed dial mode — show jog speed prominently
-        g->setTextColor(COLOR_GREEN);
+        g->setTextColor(panelInk(g, COLOR_GREEN));
         g->setTextSize(1);
         int16_t lw = g->textWidth("JOG SPEED");
         g->setCursor(ox + 115 - lw / 2, oy + 5);
         g->print("JOG SPEED");
 
-        String speedStr = pendantMachine.inInches
-            ? "F:" + String(pendantJog.jogSpeedIn) + " ipm"
-            : "F:" + String(pendantJog.jogSpeedMm) + " mm/m";
+        char speedStr[20];
+        if (pendantMachine.inInches) snprintf(speedStr, sizeof(speedStr), "F:%d ipm", pendantJog.jogSpeedIn);
+        else                         snprintf(speedStr, sizeof(speedStr), "F:%d mm/m", pendantJog.jogSpeedMm);
         g->setTextSize(2);
-        int16_t sw = g->textWidth(speedStr.c_str());
+        int16_t sw = g->textWidth(speedStr);
         g->setCursor(ox + 115 - sw / 2, oy + 20);
         g->print(speedStr);
 
-        g->setTextColor(COLOR_GRAY_TEXT);
+        g->setTextColor(panelInk(g, COLOR_GRAY_TEXT));
         g->setTextSize(1);
         int16_t hw = g->textWidth("Select an axis to jog");
         g->setCursor(ox + 115 - hw / 2, oy + 42);
         g->print("Select an axis to jog");
+    } else if (pendantJog.padMode) {
+        // XY pad — both pad axes large, the rest small on the right
+        bool inAlarm = pendantMachine.status.startsWith("Alarm");
+        int  dec     = pendantMachine.inInches ? 4 : 2;
+        char valBuf[12], buf[24];
+        g->setTextColor(panelInk(g, inAlarm ? TFT_RED : COLOR_GREEN));
+        g->setTextSize(2);
+        dtostrf(px, 1, dec, valBuf);
+        snprintf(buf, sizeof(buf), "X %s", valBuf);
+        g->setCursor(ox + 5, oy + 6);
+        g->print(buf);
+        dtostrf(py, 1, dec, valBuf);
+        snprintf(buf, sizeof(buf), "Y %s", valBuf);
+        g->setCursor(ox + 5, oy + 30);
+        g->print(buf);
+
+        g->setTextColor(panelInk(g, COLOR_GRAY_TEXT));
+        g->setTextSize(1);
+        g->setCursor(ox + 160, oy + 8);
+        g->print(inAlarm ? pendantMachine.status.c_str() : (pendantMachine.inInches ? "in" : "mm"));
+        if (pendantMachine.numAxes > 2) {
+            dtostrf(pz, 1, 2, valBuf);
+            snprintf(buf, sizeof(buf), "Z:%s", valBuf);
+            g->setCursor(ox + 160, oy + 24);
+            g->print(buf);
+        }
+        if (pendantMachine.numAxes > 3) {
+            dtostrf(pa, 1, 2, valBuf);
+            snprintf(buf, sizeof(buf), "A:%s", valBuf);
+            g->setCursor(ox + 160, oy + 38);
+            g->print(buf);
+        }
     } else {
-        String axisNames[] = { "X", "Y", "Z", "A" };
-        float  positions[] = { px, py, pz, pa };
-        bool   inAlarm     = pendantMachine.status.startsWith("Alarm");
+        const char* const axisNames[] = { "X", "Y", "Z", "A" };
+        float             positions[] = { px, py, pz, pa };
+        bool              inAlarm     = pendantMachine.status.startsWith("Alarm");
 
         // While homing, the big DRO shows the axis being homed (pendantJog.homingAxis);
         // otherwise it shows the user's jog-button selection (selectedAxis).  When
@@ -238,17 +432,17 @@ void updateJogAxisDisplay() {
         char mainLine[32];
         if (inAlarm) {
             snprintf(mainLine, sizeof(mainLine), "%s %s %s",
-                     axisNames[dispAxis].c_str(), posBuf, pendantMachine.status.c_str());
+                     axisNames[dispAxis], posBuf, pendantMachine.status.c_str());
         } else if (isAAxis) {
             // No text unit — a degree icon is overlaid after the value below.
             snprintf(mainLine, sizeof(mainLine), "%s %s",
-                     axisNames[dispAxis].c_str(), posBuf);
+                     axisNames[dispAxis], posBuf);
         } else {
             snprintf(mainLine, sizeof(mainLine), "%s %s %s",
-                     axisNames[dispAxis].c_str(), posBuf,
+                     axisNames[dispAxis], posBuf,
                      pendantMachine.inInches ? "in" : "mm");
         }
-        g->setTextColor(inAlarm ? TFT_RED : COLOR_GREEN);
+        g->setTextColor(panelInk(g, inAlarm ? TFT_RED : COLOR_GREEN));
         g->setTextSize(3);
         g->setCursor(ox + 5, oy + 5);
         g->print(mainLine);
@@ -260,7 +454,7 @@ void updateJogAxisDisplay() {
         }
 
         // Non-selected axes in a small row underneath
-        g->setTextColor(COLOR_GRAY_TEXT);
+        g->setTextColor(panelInk(g, COLOR_GRAY_TEXT));
         g->setTextSize(1);
         int numAx      = pendantMachine.numAxes;
         int colSpacing = (numAx > 1) ? 230 / (numAx - 1) : 230;
@@ -270,7 +464,7 @@ void updateJogAxisDisplay() {
             char valBuf[10];
             dtostrf(positions[i], 1, 2, valBuf);
             char buf[16];
-            snprintf(buf, sizeof(buf), "%s:%s", axisNames[i].c_str(), valBuf);
+            snprintf(buf, sizeof(buf), "%s:%s", axisNames[i], valBuf);
             g->setCursor(ox + col, oy + 38);
             g->print(buf);
             col += colSpacing;
@@ -284,7 +478,11 @@ void updateJogAxisDisplay() {
 
 void redrawJogAxisButtons() {
     if (currentPendantScreen != PSCREEN_JOG_HOMING) return;
-    String axisNames[] = { "X", "Y", "Z", "A" };
+    if (pendantJog.padMode) {
+        updateJogAxisDisplay();
+        return;
+    }
+    const char* const axisNames[] = { "X", "Y", "Z", "A" };
     int numAx = pendantMachine.numAxes;
     int btnW  = 230 / numAx;
     for (int i = 0; i < numAx; i++) {
@@ -296,7 +494,7 @@ void redrawJogAxisButtons() {
 }
 
 void redrawJogIncrementButtons() {
-    if (currentPendantScreen != PSCREEN_JOG_HOMING) return;
+    if (currentPendantScreen != PSCREEN_JOG_HOMING || pendantJog.padMode) return;
     IncrementSet incs = currentIncrements();
     for (int i = 0; i < 4; i++) {
         uint16_t bg = (i == pendantJog.selectedIncrement) ? COLOR_ORANGE : COLOR_BUTTON_GRAY;
@@ -310,11 +508,18 @@ void handleJogHomingTouch(int x, int y) {
     int numAx = pendantMachine.numAxes;
     int btnW  = 230 / numAx;
 
+    // DRO — toggles the XY pad in place of the home / axis / increment rows
+    if (isTouchInBounds(x, y, 5, 40, 230, 55)) {
+        pendantJog.padMode = !pendantJog.padMode;
+        drawCurrentPendantScreen();
+        return;
+    }
+
     // Home buttons — always 4 at fixed 57px width
-    {
+    if (!pendantJog.padMode) {
         const int HW = 57;
-        String homeNames[4] = { "X", "Y", "Z", numAx < 4 ? "ALL" : "A" };
-        int    numHome       = (numAx < 4) ? numAx + 1 : 4;
+        const char* homeNames[4] = { "X", "Y", "Z", numAx < 4 ? "ALL" : "A" };
+        int         numHome      = (numAx < 4) ? numAx + 1 : 4;
         for (int i = 0; i < numHome; i++) {
             if (isTouchInBounds(x, y, 5 + i * HW, 115, HW - 4, 38)) {
                 int sz = (i == numAx && numAx < 4) ? 2 : 3;
@@ -329,8 +534,8 @@ void handleJogHomingTouch(int x, int y) {
                     // it through whichever axis is actively homing.
                     pendantJog.homingAxis = 0;
                 } else {
-                    String axisNames[] = { "X", "Y", "Z", "A" };
-                    snprintf(cmd, sizeof(cmd), "$H%s", axisNames[i].c_str());
+                    const char* const axisNames[] = { "X", "Y", "Z", "A" };
+                    snprintf(cmd, sizeof(cmd), "$H%s", axisNames[i]);
                     send_line(cmd);
                     // Show the axis being homed in the big DRO.  This uses the
                     // transient homingAxis, NOT selectedAxis — so once homing
@@ -345,7 +550,7 @@ void handleJogHomingTouch(int x, int y) {
     }
 
     // Axis selection — also exits speed dial mode
-    for (int i = 0; i < numAx; i++) {
+    for (int i = 0; !pendantJog.padMode && i < numAx; i++) {
         if (isTouchInBounds(x, y, 5 + i * btnW, 173, btnW - 4, 38)) {
             pendantJog.speedDialMode = false;
             pendantJog.selectedAxis  = i;
@@ -358,7 +563,7 @@ void handleJogHomingTouch(int x, int y) {
     }
 
     // Increment selection — triple-tap button 3 (rightmost) toggles fine/coarse set
-    {
+    if (!pendantJog.padMode) {
         for (int i = 0; i < 4; i++) {
             if (isTouchInBounds(x, y, 5 + i * 56, 231, 52, 38)) {
                 if (i == 3) {
@@ -376,7 +581,7 @@ void handleJogHomingTouch(int x, int y) {
                         IncrementSet incs = currentIncrements();
                         pendantJog.increment = incs.values[pendantJog.selectedIncrement];
                         saveJogPrefs();
-                        drawJogHomingScreen();  // full redraw to update label
+                        drawCurrentPendantScreen();  // full redraw to update label
                         return;
                     }
                 } else {
@@ -8,3 +8,4 @@ void redrawJogIncrementButtons();
 void redrawJogSpeedButton();
 void requestJogConfig();
 void handleJogHomingTouch(int x, int y);
+bool jogPadTouch(bool touched, int x, int y);  // every loop pass; true = consumed
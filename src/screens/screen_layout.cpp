@@ -0,0 +1,69 @@
+// Copyright (c) 2026 — FluidDial-CYD
+// Use of this source code is governed by a GPLv3 license.
+
+// ── Layout hit grid + dirty tracking ─────────────────────────────────────────
+//
+// The 240×320 panel is cut into 8-px row and column bands.  Each band holds a
+// bitmask of the widgets that overlap it, so a touch is resolved by ANDing one
+// row mask with one column mask and bounds-checking the (usually single)
+// candidate — constant time regardless of widget count.  Only one screen is
+// active at a time, so one grid (~280 B) is shared and rebuilt on the first hit
+// test after a screen change.
+
+#include "screen_layout.h"
+
+static const int SCREEN_W = 240;
+static const int SCREEN_H = 320;
+static const int BAND     = 8;
+
+static const UiWidget* _gridFor = nullptr;
+static uint32_t        _rowBands[SCREEN_H / BAND];
+static uint32_t        _colBands[SCREEN_W / BAND];
+static uint32_t        _dirty;
+
+static bool inWidget(const UiWidget& w, int x, int y) {
+    return x >= w.x && x <= w.x + w.w && y >= w.y && y <= w.y + w.h;
+}
+
+static void markBands(uint32_t* bands, int nBands, int from, int to, uint32_t bit) {
+    // Inclusive far edge, matching isTouchInBounds().
+    int first = from / BAND;
+    int last  = to / BAND;
+    if (first < 0) first = 0;
+    if (last >= nBands) last = nBands - 1;
+    for (int b = first; b <= last; b++) bands[b] |= bit;
+}
+
+static void buildGrid(const UiLayout& layout) {
+    for (auto& b : _rowBands) b = 0;
+    for (auto& b : _colBands) b = 0;
+    for (uint8_t i = 0; i < layout.count; i++) {
+        const UiWidget& w   = layout.widgets[i];
+        uint32_t        bit = 1u << i;
+        markBands(_rowBands, SCREEN_H / BAND, w.y, w.y + w.h, bit);
+        markBands(_colBands, SCREEN_W / BAND, w.x, w.x + w.w, bit);
+    }
+    _gridFor = layout.widgets;
+}
+
+int uiHitTest(const UiLayout& layout, int x, int y) {
+    if (_gridFor != layout.widgets) buildGrid(layout);
+    if (x < 0 || y < 0 || x >= SCREEN_W || y >= SCREEN_H) return -1;
+    uint32_t candidates = _rowBands[y / BAND] & _colBands[x / BAND];
+    while (candidates) {
+        int i = __builtin_ctz(candidates);
+        if (inWidget(layout.widgets[i], x, y)) return layout.widgets[i].id;
+        candidates &= candidates - 1;
+    }
+    return -1;
+}
+
+void uiMarkDirty(uint8_t id) {
+    if (id < UI_MAX_WIDGETS) _dirty |= 1u << id;
+}
+
+uint32_t uiTakeDirty() {
+    uint32_t d = _dirty;
+    _dirty     = 0;
+    return d;
+}
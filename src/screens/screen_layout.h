@@ -0,0 +1,64 @@
+// Copyright (c) 2026 — FluidDial-CYD
+// Use of this source code is governed by a GPLv3 license.
+
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+// ── Declarative screen layouts ───────────────────────────────────────────────
+//
+// A screen describes its fixed widgets (buttons, readout panels) in ONE
+// constexpr table, indexed by a per-screen enum:
+//
+//   enum MainMenuWidget : uint8_t { MM_STATUS, MM_JOG, ..., MM_COUNT };
+//   static constexpr UiWidget kMainMenuLayout[] = {
+//       { MM_STATUS, 5,  40, 230, 65, nullptr, nullptr },
+//       { MM_JOG,    5, 115, 112, 47, "Jog",   nullptr },
+//       ...
+//   };
+//
+// The same table then drives
+//   • drawing        — uiDrawButton(w, ...), beginPanelSprite(w, ox, oy)
+//   • touch dispatch — uiHitTest(layout, x, y) → widget id, O(1) via a band grid
+//   • partial redraw — uiMarkDirty(id) / uiTakeDirty() bitmask of stale widgets
+// so coordinates live in exactly one place instead of being repeated in the
+// draw and touch functions.
+//
+// simulator/sync.py parses these tables and regenerates simulator/js/layouts.js
+// (JSON), so the sim's touch rectangles come from the firmware.  Keep every
+// entry on one line with plain integer literals and string literals so the
+// parser can read it.  Screens whose geometry depends on runtime state (axis
+// count, probe mode) still compute their rectangles in code.
+
+struct UiWidget {
+    uint8_t     id;       // == index in the table (checked by uiIdsMatchIndex)
+    int16_t     x, y, w, h;
+    const char* label;    // button text; nullptr for panels / readouts
+    const char* label2;   // second line of a two-line button, else nullptr
+};
+
+struct UiLayout {
+    const UiWidget* widgets;
+    uint8_t         count;
+};
+
+// Widget ids double as bit positions in the hit grid and dirty masks.
+static const int UI_MAX_WIDGETS = 32;
+
+constexpr bool uiIdsMatchIndex(const UiWidget* w, size_t n, size_t i = 0) {
+    return i == n || (w[i].id == i && uiIdsMatchIndex(w, n, i + 1));
+}
+
+template <size_t N>
+constexpr UiLayout uiLayout(const UiWidget (&w)[N]) {
+    static_assert(N <= UI_MAX_WIDGETS, "layout has more widgets than the hit grid can index");
+    return UiLayout { w, (uint8_t)N };
+}
+
+// Id of the widget under (x, y), or -1.  Same inclusive bounds as
+// isTouchInBounds().  The band grid is rebuilt when the layout changes.
+int uiHitTest(const UiLayout& layout, int x, int y);
+
+// Dirty-widget tracking for the active screen.
+void     uiMarkDirty(uint8_t id);
+uint32_t uiTakeDirty();   // returns the pending mask and clears it
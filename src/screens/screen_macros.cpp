@@ -8,6 +8,23 @@
 // Forward declaration for the dirty-state tracker (defined below).
 static void invalidateMacrosRender();
 
+// UI safety deadline: the HTTP fetch job always delivers a terminal
+// onFilesList()/onError() callback, but if it ever hangs, this guarantees
+// "Loading…" can't spin forever.  35 s exceeds the fetch job's own 30 s
+// network-worker deadline (3 tries × 2 files × 5 s ≈ 30 s).
+#define MACROS_LOAD_DEADLINE_MS 35000
+
+static void macrosLoadExpired(void* /*ctx*/) {
+    if (!pendantMacros.loading) return;
+    pendantMacros.loading    = false;
+    pendantMacros.loadFailed = true;
+    updateMacrosFileList();
+}
+
+void armMacrosLoadDeadline() {
+    ui_timer_arm(pendantMacros.loadDeadline, MACROS_LOAD_DEADLINE_MS, macrosLoadExpired);
+}
+
 void enterMacros() {
     releasePanelSprites();
 
@@ -28,9 +45,9 @@ void enterMacros() {
         if (pendantConnected) requestMacros();
     }
 
-    // Flicker-free list sprite, now 8-bit (~46 KB, was ~92 KB) so it allocates
-    // far more often; direct-draw fallback when heap is tight.
-    allocPanelSprite(spriteFileDisplay, 230, 200, 60000);
+    // Flicker-free list sprite, 4-bit palette (~23 KB, was ~46 KB at 8-bit) so
+    // it allocates far more often; direct-draw fallback when heap is tight.
+    allocPanelSprite(spriteFileDisplay, 230, 200, 40000);
 }
 
 void exitMacros() {
@@ -51,11 +68,31 @@ static void refreshMacros() {
     if (pendantConnected) requestMacros();
 }
 
-// Truncate macro name to fit one button-width line at textSize 1 (~36 chars)
-static String macroLabel(int displayIndex) {
-    String label = pendantMacros.content[displayIndex];
-    if (label.length() > 36) label = label.substring(0, 33) + "...";
-    return label;
+// Truncate macro name to fit one button-width line at textSize 1 (~36 chars).
+// Formats into the caller's buffer (>= 37 bytes) — no per-frame allocation.
+static const char* macroLabel(int displayIndex, char* buf, size_t n) {
+    const String& label = pendantMacros.content[displayIndex];
+    if (label.length() > 36) snprintf(buf, n, "%.33s...", label.c_str());
+    else                     strlcpy(buf, label.c_str(), n);
+    return buf;
+}
+
+// The line that runs a macro, from the filename prefix set by FileParser.
+// Also used by the job queue for the macro before a job.
+void macroCommand(const char* fn, char* cmd, size_t n) {
+    if (strncmp(fn, "/sd/", 4) == 0) {
+        // SD file: strip /sd/ prefix for $SD/Run
+        snprintf(cmd, n, "$SD/Run=%s", fn + 4);
+    } else if (strncmp(fn, "/localfs/", 9) == 0) {
+        // Local flash file
+        snprintf(cmd, n, "$Localfs/Run=%s", fn + 9);
+    } else if (strncmp(fn, "cmd:", 4) == 0) {
+        // Raw UART command
+        snprintf(cmd, n, "%s", fn + 4);
+    } else {
+        // Unknown — send as-is
+        snprintf(cmd, n, "%s", fn);
+    }
 }
 
 // Snapshot of last-rendered state.  See screen_sd_card.cpp for rationale —
@@ -83,17 +120,6 @@ static void invalidateMacrosRender() { _lastMacrosRender.valid = false; }
 void updateMacrosFileList() {
     if (currentPendantScreen != PSCREEN_MACROS) return;
 
-    // UI safety deadline: the HTTP fetch task always delivers a terminal
-    // onFilesList()/onError() callback, but if it ever hangs (or its task
-    // dies), this guarantees "Loading…" can't spin forever.  35 s comfortably
-    // exceeds the worst-case retry budget in fetch_macros_http_task
-    // (3 tries × 2 files × 5 s ≈ 30 s).
-    if (pendantMacros.loading && pendantMacros.loadStartMs != 0 &&
-        (millis() - pendantMacros.loadStartMs) > 35000) {
-        pendantMacros.loading    = false;
-        pendantMacros.loadFailed = true;
-    }
-
     MacrosRenderState cur = {
         /*valid*/        true,
         /*connected*/    pendantConnected,
@@ -118,32 +144,32 @@ void updateMacrosFileList() {
 
     const bool hasSprite = spriteFileDisplay.getBuffer() != nullptr;
     LovyanGFX* g = hasSprite ? (LovyanGFX*)&spriteFileDisplay
-                             : (LovyanGFX*)&display;
+                             : gfx;
     // Sprite is pushed at (5, 40); direct-draw uses absolute screen coords.
     const int ox = hasSprite ? 0 : 5;
     const int oy = hasSprite ? 0 : 40;
 
     if (hasSprite) {
-        spriteFileDisplay.fillSprite(COLOR_BACKGROUND);
+        spriteFileDisplay.fillSprite(panelInk(g, COLOR_BACKGROUND));
     } else {
-        display.fillRect(5, 40, 230, 200, COLOR_BACKGROUND);
+        gfx->fillRect(5, 40, 230, 200, COLOR_BACKGROUND);
     }
 
     if (pendantMacros.loading) {
-        g->setTextColor(COLOR_GRAY_TEXT);
+        g->setTextColor(panelInk(g, COLOR_GRAY_TEXT));
         g->setTextSize(2);
         g->setCursor(ox + 45, oy + 100);
         g->print(pendantConnected ? "Loading..." : "Not connected.");
     } else if (pendantMacros.loadFailed) {
-        g->setTextColor(COLOR_ORANGE);
+        g->setTextColor(panelInk(g, COLOR_ORANGE));
         g->setTextSize(1);
         g->setCursor(ox + 15, oy + 90);
         g->print("Couldn't load macros.");
-        g->setTextColor(COLOR_GRAY_TEXT);
+        g->setTextColor(panelInk(g, COLOR_GRAY_TEXT));
         g->setCursor(ox + 15, oy + 108);
         g->print("Tap Refresh to try again.");
     } else if (pendantMacros.count == 0) {
-        g->setTextColor(COLOR_GRAY_TEXT);
+        g->setTextColor(panelInk(g, COLOR_GRAY_TEXT));
         g->setTextSize(1);
         g->setCursor(ox + 15, oy + 90);
         g->print("No macros found.");
@@ -162,19 +188,20 @@ void updateMacrosFileList() {
             } else {
                 bg = COLOR_BUTTON_GRAY;
             }
-            g->fillRoundRect(ox, oy + i * 40, 230, 36, 8, bg);
-            g->setTextColor(COLOR_WHITE);
+            g->fillRoundRect(ox, oy + i * 40, 230, 36, 8, panelInk(g, bg));
+            g->setTextColor(panelInk(g, COLOR_WHITE));
             g->setTextSize(1);
             g->setCursor(ox + 5, oy + 12 + i * 40);
-            g->print(macroLabel(displayIndex));
+            char label[40];
+            g->print(macroLabel(displayIndex, label, sizeof(label)));
         }
     }
 
-    if (hasSprite) spriteFileDisplay.pushSprite(5, 40);
+    if (hasSprite) spriteFileDisplay.pushSprite(gfx, 5, 40);
 }
 
 void drawMacrosScreen() {
-    display.fillScreen(COLOR_BACKGROUND);
+    gfx->fillScreen(COLOR_BACKGROUND);
     drawTitle("MACROS");
 
     // Full redraw — invalidate the dirty cache so the file-list area paints.
@@ -202,7 +229,7 @@ void handleMacrosTouch(int x, int y) {
             if (displayIndex < pendantMacros.count) {
                 pendantMacros.selected   = displayIndex;
                 pendantMacros.pendingRun = true;
-                drawMacrosScreen();
+                drawCurrentPendantScreen();
             }
             return;
         }
@@ -221,7 +248,7 @@ void handleMacrosTouch(int x, int y) {
     if (isTouchInBounds(x, y, 83, 242, 72, 36)) {
         if (pendantConnected) {
             refreshMacros();
-            drawMacrosScreen();
+            drawCurrentPendantScreen();
         }
         return;
     }
@@ -240,27 +267,14 @@ void handleMacrosTouch(int x, int y) {
         // Cancel
         if (isTouchInBounds(x, y, 5, 282, 110, 36)) {
             pendantMacros.pendingRun = false;
-            drawMacrosScreen();
+            drawCurrentPendantScreen();
             return;
         }
-        // Run — dispatch based on filename prefix set by FileParser
+        // Run
         if (isTouchInBounds(x, y, 121, 282, 114, 36)) {
             if (pendantConnected && pendantMacros.selected >= 0) {
-                String fn = pendantMacros.filename[pendantMacros.selected];
-                char   cmd[128];
-                if (fn.startsWith("/sd/")) {
-                    // SD file: strip /sd/ prefix for $SD/Run
-                    snprintf(cmd, sizeof(cmd), "$SD/Run=%s", fn.c_str() + 4);
-                } else if (fn.startsWith("/localfs/")) {
-                    // Local flash file
-                    snprintf(cmd, sizeof(cmd), "$Localfs/Run=%s", fn.c_str() + 9);
-                } else if (fn.startsWith("cmd:")) {
-                    // Raw UART command
-                    snprintf(cmd, sizeof(cmd), "%s", fn.c_str() + 4);
-                } else {
-                    // Unknown — send as-is
-                    snprintf(cmd, sizeof(cmd), "%s", fn.c_str());
-                }
+                char cmd[128];
+                macroCommand(pendantMacros.filename[pendantMacros.selected].c_str(), cmd, sizeof(cmd));
                 send_line(cmd);
                 pendantMacros.pendingRun = false;
                 currentPendantScreen = PSCREEN_STATUS;
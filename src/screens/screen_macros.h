@@ -1,7 +1,11 @@
 #pragma once
+#include <stddef.h>
+
 void enterMacros();
 void exitMacros();
 void drawMacrosScreen();
 void updateMacrosFileList();   // sprite refresh — called by updateCurrentScreenSprites()
 void handleMacrosTouch(int x, int y);
+void macroCommand(const char* filename, char* cmd, size_t n);  // line that runs a macro (/sd/, /localfs/, cmd:)
+void armMacrosLoadDeadline();  // requestMacros() starts the "Loading…" deadline
 extern void requestMacros();  // defined in CNC_Pendant_UI.cpp
@@ -1,9 +1,35 @@
 #include "pendant_shared.h"
 #include "screen_main_menu.h"
 
+// ── Layout ──────────────────────────────────────────────────────────────────
+// Status bar on top, then a 2×4 grid of navigation buttons (112×47, 52 px pitch).
+enum MainMenuWidget : uint8_t {
+    MM_STATUS_BAR, MM_JOG, MM_WORK_AREA, MM_FEEDS, MM_SPINDLE, MM_MACROS, MM_SD_CARD, MM_PROBE, MM_STATUS, MM_COUNT
+};
+
+static constexpr UiWidget kMainMenuLayout[] = {
+    { MM_STATUS_BAR,   5,  40, 230, 65, nullptr,     nullptr },
+    { MM_JOG,          5, 115, 112, 47, "Jog",       nullptr },
+    { MM_WORK_AREA,  123, 115, 112, 47, "Work Area", nullptr },
+    { MM_FEEDS,        5, 167, 112, 47, "Feeds &",   "Speeds" },
+    { MM_SPINDLE,    123, 167, 112, 47, "Spindle",   "Control" },
+    { MM_MACROS,       5, 219, 112, 47, "Macros",    nullptr },
+    { MM_SD_CARD,    123, 219, 112, 47, "SD Card",   nullptr },
+    { MM_PROBE,        5, 271, 112, 47, "Probe",     nullptr },
+    { MM_STATUS,     123, 271, 112, 47, "Status",    nullptr },
+};
+static_assert(uiIdsMatchIndex(kMainMenuLayout, MM_COUNT), "kMainMenuLayout must be in MainMenuWidget order");
+static constexpr UiLayout kMainMenu = uiLayout(kMainMenuLayout);
+
+// Screen each navigation button opens (indexed by widget id).
+static const PendantScreen kMainMenuTargets[MM_COUNT] = {
+    PSCREEN_MAIN_MENU,    PSCREEN_JOG_HOMING, PSCREEN_PROBING_WORK, PSCREEN_FEEDS_SPEEDS, PSCREEN_SPINDLE_CONTROL,
+    PSCREEN_MACROS,       PSCREEN_SD_CARD,    PSCREEN_PROBE,        PSCREEN_STATUS,
+};
+
 void enterMainMenu() {
-    // Status bar uses a TRANSIENT 16-bit panel (see updateMainMenuDisplay) so it
-    // renders true colour and only one buffer is live at a time.
+    // Status bar uses the shared 4-bit panel scratch (see updateMainMenuDisplay)
+    // so it renders exact theme colours and only one buffer is live at a time.
     releasePanelSprites();
 }
 
@@ -11,26 +37,23 @@ void exitMainMenu() {
     releasePanelSprites();
 }
 
-void drawMainMenu() {
-    display.fillScreen(COLOR_BACKGROUND);
-    drawTitle("MAIN MENU");
+static void drawMainMenuChrome() {
+    gfx->fillScreen(COLOR_BACKGROUND);
+    drawTitleBar("MAIN MENU");
 
     // Draw static background for status display area
-    display.fillRoundRect(5, 40, 230, 65, 5, COLOR_DARKER_BG);
-    updateMainMenuDisplay();
+    const UiWidget& bar = kMainMenuLayout[MM_STATUS_BAR];
+    gfx->fillRoundRect(bar.x, bar.y, bar.w, bar.h, 5, COLOR_DARKER_BG);
 
-    int btnY   = 115;
-    int btnH   = 47;
-    int btnGap = 52;
+    for (uint8_t id = MM_JOG; id < MM_COUNT; id++) {
+        uiDrawButton(kMainMenuLayout[id], COLOR_BLUE, COLOR_WHITE, 2);
+    }
+}
 
-    drawButton(5, btnY, 112, btnH, "Jog", COLOR_BLUE, COLOR_WHITE, 2);
-    drawButton(123, btnY, 112, btnH, "Work Area", COLOR_BLUE, COLOR_WHITE, 2);
-    drawMultiLineButton(5, btnY + btnGap, 112, btnH, "Feeds &", "Speeds", COLOR_BLUE, COLOR_WHITE, 2);
-    drawMultiLineButton(123, btnY + btnGap, 112, btnH, "Spindle", "Control", COLOR_BLUE, COLOR_WHITE, 2);
-    drawButton(5, btnY + btnGap * 2, 112, btnH, "Macros", COLOR_BLUE, COLOR_WHITE, 2);
-    drawButton(123, btnY + btnGap * 2, 112, btnH, "SD Card", COLOR_BLUE, COLOR_WHITE, 2);
-    drawButton(5, btnY + btnGap * 3, 112, btnH, "Probe", COLOR_BLUE, COLOR_WHITE, 2);
-    drawButton(123, btnY + btnGap * 3, 112, btnH, "Status", COLOR_BLUE, COLOR_WHITE, 2);
+void drawMainMenu() {
+    drawChrome(drawMainMenuChrome);
+    drawTitleIcons();
+    updateMainMenuDisplay();
 }
 
 void updateMainMenuDisplay() {
@@ -38,17 +61,17 @@ void updateMainMenuDisplay() {
 
     // Snapshot under the lock first; skip the frame if it's briefly held rather
     // than read the status String unlocked (a concurrent realloc on Core 0 would
-    // corrupt the heap).
-    String statusStr;
+    // corrupt the heap).  Copied into a stack buffer — no per-frame allocation.
+    char statusStr[24];
     if (xSemaphoreTake(stateMutex, pdMS_TO_TICKS(5)) != pdTRUE) return;
-    statusStr = pendantMachine.status;
+    copyStr(statusStr, sizeof(statusStr), pendantMachine.status);
     xSemaphoreGive(stateMutex);
 
     int ox, oy;
-    LovyanGFX* g = beginPanelSprite(230, 65, ox, oy, 5, 40);
-    g->fillRect(ox, oy, 230, 65, COLOR_DARKER_BG);
+    LovyanGFX* g = beginPanelSprite(kMainMenuLayout[MM_STATUS_BAR], ox, oy);
+    g->fillRect(ox, oy, 230, 65, panelInk(g, COLOR_DARKER_BG));
 
-    if (!pendantSynced || statusStr == "N/C" || statusStr.length() == 0) {
+    if (!pendantSynced || strcmp(statusStr, "N/C") == 0 || statusStr[0] == '\0') {
         // Power-up / reconnect, two phases so the user knows what's happening:
         //   "Connecting" — link not yet established (WiFi assoc / WS handshake
         //                  or UART not yet responding)
@@ -56,22 +79,22 @@ void updateMainMenuDisplay() {
         // Size 3 so the 10-char "Connecting" fits the 230 px bar.  Same for
         // WiFi and wired.
         const char* phase = pendantConnected ? "Syncing" : "Connecting";
-        g->setTextColor(COLOR_GRAY_TEXT);
+        g->setTextColor(panelInk(g, COLOR_GRAY_TEXT));
         g->setTextSize(1);
         int16_t lw = g->textWidth("STATUS");
         g->setCursor(ox + 115 - lw / 2, oy + 8);
         g->print("STATUS");
-        g->setTextColor(COLOR_ORANGE);
+        g->setTextColor(panelInk(g, COLOR_ORANGE));
         g->setTextSize(3);
         int16_t cw = g->textWidth(phase);
         g->setCursor(ox + 115 - cw / 2, oy + 30);
         g->print(phase);
-    } else if (statusStr.startsWith("Alarm")) {
+    } else if (strncmp(statusStr, "Alarm", 5) == 0) {
         // Alarm: description on label line, "ALARM" in red on status line
-        String desc = alarmDescription(statusStr);
-        g->setTextColor(TFT_RED);
+        const char* desc = alarmDescription(statusStr);
+        g->setTextColor(panelInk(g, TFT_RED));
         g->setTextSize(1);
-        int16_t dw = g->textWidth(desc.c_str());
+        int16_t dw = g->textWidth(desc);
         g->setCursor(ox + 115 - dw / 2, oy + 8);
         g->print(desc);
         g->setTextSize(4);
@@ -79,32 +102,22 @@ void updateMainMenuDisplay() {
         g->setCursor(ox + 115 - sw / 2, oy + 26);
         g->print("ALARM");
     } else {
-        g->setTextColor(COLOR_GRAY_TEXT);
+        g->setTextColor(panelInk(g, COLOR_GRAY_TEXT));
         g->setTextSize(1);
         int16_t labelWidth = g->textWidth("STATUS");
         g->setCursor(ox + 115 - labelWidth / 2, oy + 8);
         g->print("STATUS");
-        g->setTextColor(COLOR_CYAN);
+        g->setTextColor(panelInk(g, COLOR_CYAN));
         g->setTextSize(4);
-        int16_t statusWidth = g->textWidth(statusStr.c_str());
+        int16_t statusWidth = g->textWidth(statusStr);
         g->setCursor(ox + 115 - statusWidth / 2, oy + 26);
         g->print(statusStr);
     }
 
-    endPanelSprite(230, 65, 5, 40);
+    endPanelSprite(kMainMenuLayout[MM_STATUS_BAR]);
 }
 
 void handleMainMenuTouch(int x, int y) {
-    int btnY   = 115;
-    int btnH   = 47;
-    int btnGap = 52;
-
-    if      (isTouchInBounds(x, y, 5,   btnY,              112, btnH)) currentPendantScreen = PSCREEN_JOG_HOMING;
-    else if (isTouchInBounds(x, y, 123, btnY,              112, btnH)) currentPendantScreen = PSCREEN_PROBING_WORK;
-    else if (isTouchInBounds(x, y, 5,   btnY + btnGap,     112, btnH)) currentPendantScreen = PSCREEN_FEEDS_SPEEDS;
-    else if (isTouchInBounds(x, y, 123, btnY + btnGap,     112, btnH)) currentPendantScreen = PSCREEN_SPINDLE_CONTROL;
-    else if (isTouchInBounds(x, y, 5,   btnY + btnGap * 2, 112, btnH)) currentPendantScreen = PSCREEN_MACROS;
-    else if (isTouchInBounds(x, y, 123, btnY + btnGap * 2, 112, btnH)) currentPendantScreen = PSCREEN_SD_CARD;
-    else if (isTouchInBounds(x, y, 5,   btnY + btnGap * 3, 112, btnH)) currentPendantScreen = PSCREEN_PROBE;
-    else if (isTouchInBounds(x, y, 123, btnY + btnGap * 3, 112, btnH)) currentPendantScreen = PSCREEN_STATUS;
+    int id = uiHitTest(kMainMenu, x, y);
+    if (id > MM_STATUS_BAR) currentPendantScreen = kMainMenuTargets[id];
 }
@@ -0,0 +1,283 @@
+#include "pendant_shared.h"
+#include "screen_mdi.h"
+#include "mdi_console.h"
+#include "../ConsoleLog.h"
+
+// ── Layout ──────────────────────────────────────────────────────────────────
+// Response pane on top, the line being typed, then a 6×5 keypad (35×28 keys,
+// 39 / 31 px pitch): digits on the left, a page of letters on the right and
+// the edit / send row at the bottom.
+enum MdiWidget : uint8_t {
+    MDW_PANE, MDW_INPUT, MDW_KEYS, MDW_COUNT
+};
+
+static constexpr UiWidget kMdiLayout[] = {
+    { MDW_PANE,   5,  40, 230,  92, nullptr, nullptr },
+    { MDW_INPUT,  5, 136, 230,  24, nullptr, nullptr },
+    { MDW_KEYS,   5, 164, 230, 154, nullptr, nullptr },
+};
+static_assert(uiIdsMatchIndex(kMdiLayout, MDW_COUNT), "kMdiLayout must be in MdiWidget order");
+static constexpr UiLayout kMdi = uiLayout(kMdiLayout);
+
+#define MDI_KEY_W     35
+#define MDI_KEY_H     28
+#define MDI_KEY_PITCH_X 39
+#define MDI_KEY_PITCH_Y 31
+#define MDI_PANE_ROWS 9
+#define MDI_ROW_PITCH 10
+#define MDI_COLS      37  // characters shown per pane / input line
+
+static const char* const kDigits[4][3] = {
+    { "7", "8", "9" }, { "4", "5", "6" }, { "1", "2", "3" }, { "-", "0", "." },
+};
+static const char* const kLetters[2][4][3] = {
+    { { "G", "M", "X" }, { "Y", "Z", "F" }, { "S", "T", "P" }, { "I", "J", "K" } },
+    { { "$", "=", "H" }, { "R", "L", "A" }, { "B", "C", "D" }, { "N", "/", "Clr" } },
+};
+enum { KEY_PAGE, KEY_SPACE, KEY_NEWLINE, KEY_DEL, KEY_BACK, KEY_SEND };
+
+static int  _page = 0;
+static char _input[MDI_INPUT_MAX];
+static int  _len = 0;
+static char _draft[MDI_INPUT_MAX];  // what was typed before the dial went into history
+static int  _histPos = -1;          // -1 = the draft
+
+// Pane: newest line drawn, so a refresh fetches only what's newer.
+static uint32_t _shownSeq  = 0;
+static bool     _paneValid = false;
+
+// Input line: repainted when it changes or the send state does.
+static bool _inputDirty     = true;
+static int  _lastRemaining  = -1;
+
+void enterMdi() {
+    releasePanelSprites();
+    // The pane keeps its pixels between frames so new lines can scroll in;
+    // 4-bit, 230 × 92 / 2 ≈ 10.6 KB.  Without it the pane repaints whole.
+    allocPanelSprite(spriteFileDisplay, 230, 92, 30000);
+    _paneValid  = false;
+    _inputDirty = true;
+}
+
+void exitMdi() {
+    releasePanelSprites();
+}
+
+static void keyRect(int row, int col, int& x, int& y) {
+    x = kMdiLayout[MDW_KEYS].x + col * MDI_KEY_PITCH_X;
+    y = kMdiLayout[MDW_KEYS].y + row * MDI_KEY_PITCH_Y;
+}
+
+static void drawMdiChrome() {
+    gfx->fillScreen(COLOR_BACKGROUND);
+    drawTitleBar("MDI");
+
+    int x, y;
+    for (int row = 0; row < 4; row++) {
+        for (int col = 0; col < 6; col++) {
+            const char* label = col < 3 ? kDigits[row][col] : kLetters[_page][row][col - 3];
+            keyRect(row, col, x, y);
+            drawButton(x, y, MDI_KEY_W, MDI_KEY_H, label, col < 3 ? COLOR_BUTTON_GRAY : COLOR_BUTTON_ACTIVE,
+                       COLOR_WHITE, strlen(label) > 1 ? 1 : 2);
+        }
+    }
+    static const char* const kBottom[6] = { nullptr, "Space", "NL", "Del", "Back", "Send" };
+    for (int col = 0; col < 6; col++) {
+        const char* label = col == KEY_PAGE ? (_page ? "GXY" : "$=H") : kBottom[col];
+        uint16_t    bg    = col == KEY_SEND ? COLOR_DARK_GREEN : col == KEY_BACK ? COLOR_BLUE : COLOR_BUTTON_GRAY;
+        keyRect(4, col, x, y);
+        drawButton(x, y, MDI_KEY_W, MDI_KEY_H, label, bg, COLOR_WHITE, 1);
+    }
+}
+
+// ── Response pane ────────────────────────────────────────────────────────────
+
+static void drawPaneRow(LovyanGFX* g, int ox, int oy, int row, uint32_t seq) {
+    int y = oy + 1 + row * MDI_ROW_PITCH;
+    g->fillRect(ox, y, 230, MDI_ROW_PITCH, panelInk(g, COLOR_DARKER_BG));
+    ConLine l;
+    if (!con_get(seq, l)) return;
+
+    uint16_t ink;
+    switch (l.kind) {
+        case CON_SENT:  ink = COLOR_WHITE;     break;
+        case CON_OK:    ink = COLOR_GREEN;     break;
+        case CON_ERROR: ink = COLOR_ORANGE;    break;
+        case CON_MSG:   ink = COLOR_CYAN;      break;
+        default:        ink = COLOR_GRAY_TEXT; break;
+    }
+    char shown[MDI_COLS + 1];
+    snprintf(shown, sizeof(shown), "%s", l.text);
+    g->setTextSize(1);
+    g->setTextColor(panelInk(g, ink));
+    g->setCursor(ox + 4, y + 1);
+    g->print(shown);
+}
+
+// New lines scroll the retained sprite up and only they are drawn; a first
+// paint, a burst bigger than the pane or the no-sprite fallback repaints it.
+static void updatePane() {
+    uint32_t newest = con_seq();
+    if (_paneValid && newest == _shownSeq) return;
+
+    const bool hasSprite = spriteFileDisplay.getBuffer() != nullptr;
+    LovyanGFX* g         = hasSprite ? (LovyanGFX*)&spriteFileDisplay : gfx;
+    const int  ox        = hasSprite ? 0 : kMdiLayout[MDW_PANE].x;
+    const int  oy        = hasSprite ? 0 : kMdiLayout[MDW_PANE].y;
+    uint32_t   fresh     = newest - _shownSeq;
+
+    if (!_paneValid || !hasSprite || fresh >= MDI_PANE_ROWS) {
+        g->fillRect(ox, oy, 230, 92, panelInk(g, COLOR_DARKER_BG));
+        for (int row = 0; row < MDI_PANE_ROWS; row++) {
+            uint32_t back = MDI_PANE_ROWS - 1 - row;
+            if (newest > back) drawPaneRow(g, ox, oy, row, newest - back);
+        }
+    } else {
+        spriteFileDisplay.scroll(0, -(int)(fresh * MDI_ROW_PITCH));
+        for (uint32_t k = 0; k < fresh; k++) {
+            drawPaneRow(g, ox, oy, MDI_PANE_ROWS - fresh + k, _shownSeq + 1 + k);
+        }
+    }
+    if (hasSprite) spriteFileDisplay.pushSprite(gfx, kMdiLayout[MDW_PANE].x, kMdiLayout[MDW_PANE].y);
+    _shownSeq  = newest;
+    _paneValid = true;
+}
+
+// ── Input line ───────────────────────────────────────────────────────────────
+
+static void updateInput() {
+    int remaining = mdiRemaining();
+    if (!_inputDirty && remaining == _lastRemaining) return;
+    _inputDirty    = false;
+    _lastRemaining = remaining;
+
+    int ox, oy;
+    LovyanGFX* g = beginPanelSprite(kMdiLayout[MDW_INPUT], ox, oy);
+    g->fillRoundRect(ox, oy, 230, 24, 5, panelInk(g, COLOR_DARKER_BG));
+    g->setTextSize(1);
+
+    int cols = remaining ? MDI_COLS - 4 : MDI_COLS;
+    if (_len == 0 && _histPos < 0) {
+        g->setTextColor(panelInk(g, COLOR_GRAY_TEXT));
+        g->setCursor(ox + 4, oy + 8);
+        g->print(mdiHistoryCount() ? "Type a command - dial: history" : "Type a command");
+    } else {
+        // The tail that fits, with line breaks shown as '|' and a cursor.
+        char shown[MDI_COLS + 1];
+        int  start = _len + 1 > cols ? _len + 1 - cols : 0;
+        int  n     = 0;
+        for (int i = start; i < _len; i++) {
+            shown[n++] = _input[i] == '\n' ? '|' : _input[i];
+        }
+        shown[n++] = '_';
+        shown[n]   = '\0';
+        g->setTextColor(panelInk(g, _histPos >= 0 ? COLOR_CYAN : COLOR_WHITE));
+        g->setCursor(ox + 4, oy + 8);
+        g->print(shown);
+    }
+    if (remaining) {
+        char busy[8];
+        snprintf(busy, sizeof(busy), "%d>", remaining);
+        g->setTextColor(panelInk(g, COLOR_ORANGE));
+        g->setCursor(ox + 226 - g->textWidth(busy), oy + 8);
+        g->print(busy);
+    }
+    endPanelSprite(kMdiLayout[MDW_INPUT]);
+}
+
+void updateMdiDisplay() {
+    if (currentPendantScreen != PSCREEN_MDI) return;
+    updatePane();
+    updateInput();
+}
+
+void drawMdiScreen() {
+    drawChrome(drawMdiChrome, _page);
+    drawTitleIcons();
+    _paneValid  = false;
+    _inputDirty = true;
+    updateMdiDisplay();
+}
+
+// ── Input ────────────────────────────────────────────────────────────────────
+
+static void setInput(const char* text) {
+    strlcpy(_input, text, sizeof(_input));
+    _len        = strlen(_input);
+    _inputDirty = true;
+}
+
+static void typed() {
+    _histPos    = -1;  // an edited recall becomes the draft
+    _inputDirty = true;
+}
+
+static void insert(const char* s) {
+    size_t n = strlen(s);
+    if (_len + n >= sizeof(_input)) return;
+    memcpy(_input + _len, s, n + 1);
+    _len += n;
+    typed();
+}
+
+void handleMdiEncoder(int delta) {
+    int n = mdiHistoryCount();
+    if (!n || !delta) return;
+    if (_histPos < 0) strlcpy(_draft, _input, sizeof(_draft));
+    _histPos += delta;  // clockwise goes back in time
+    if (_histPos >= n) _histPos = n - 1;
+    if (_histPos < -1) _histPos = -1;
+    setInput(_histPos < 0 ? _draft : mdiHistoryAt(_histPos));
+    updateInput();
+}
+
+void handleMdiTouch(int x, int y) {
+    if (uiHitTest(kMdi, x, y) != MDW_KEYS) return;
+    int dx  = x - kMdiLayout[MDW_KEYS].x;
+    int dy  = y - kMdiLayout[MDW_KEYS].y;
+    int col = dx / MDI_KEY_PITCH_X;
+    int row = dy / MDI_KEY_PITCH_Y;
+    if (col > 5 || row > 4 || dx % MDI_KEY_PITCH_X >= MDI_KEY_W || dy % MDI_KEY_PITCH_Y >= MDI_KEY_H) return;
+
+    if (row < 4) {
+        const char* label = col < 3 ? kDigits[row][col] : kLetters[_page][row][col - 3];
+        if (strcmp(label, "Clr") == 0) {
+            setInput("");
+            typed();
+        } else {
+            insert(label);
+        }
+        updateInput();
+        return;
+    }
+
+    switch (col) {
+        case KEY_PAGE:
+            _page ^= 1;
+            drawCurrentPendantScreen();
+            return;
+        case KEY_SPACE:
+            if (_len && _input[_len - 1] != ' ' && _input[_len - 1] != '\n') insert(" ");
+            break;
+        case KEY_NEWLINE:
+            if (_len && _input[_len - 1] != '\n') insert("\n");
+            break;
+        case KEY_DEL:
+            if (_len) {
+                _input[--_len] = '\0';
+                typed();
+            }
+            break;
+        case KEY_BACK:
+            currentPendantScreen = PSCREEN_FLUIDNC;
+            return;
+        case KEY_SEND:
+            if (mdiSend(_input)) {
+                setInput("");
+                _histPos = -1;
+            }
+            updatePane();
+            break;
+    }
+    updateInput();
+}
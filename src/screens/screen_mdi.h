@@ -0,0 +1,7 @@
+#pragma once
+void enterMdi();
+void exitMdi();
+void drawMdiScreen();
+void updateMdiDisplay();          // sprite refresh — called by updateCurrentScreenSprites()
+void handleMdiTouch(int x, int y);
+void handleMdiEncoder(int delta);  // dial steps through the history
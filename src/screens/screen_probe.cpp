@@ -108,11 +108,11 @@ void probeDrawPosPanel(int y, int h) {
     const char* uu  = inInch ? "in" : "mm";
     char buf[12];
 
-    // Shared 16-bit scratch panel (true colour for PROBE_BG_PANEL; direct-draw
+    // Shared 4-bit scratch panel (exact palette PROBE_BG_PANEL; direct-draw
     // fallback at (5, y) if it can't allocate — never blank).
     int ox, oy;
     LovyanGFX* g = beginPanelSprite(230, h, ox, oy, 5, y);
-    g->fillRoundRect(ox, oy, 230, h, 4, PROBE_BG_PANEL);
+    g->fillRoundRect(ox, oy, 230, h, 4, panelInk(g, PROBE_BG_PANEL));
 
     if (h >= 38) {
         // ── Large layout: textSize=2, two rows ───────────────────────────
@@ -125,18 +125,18 @@ void probeDrawPosPanel(int y, int h) {
         // Row 1 — axis labels (green) + unit hint (dim, top-right)
         g->setTextSize(2);
         for (int i = 0; i < 3; i++) {
-            g->setTextColor(PROBE_C_GREEN);
+            g->setTextColor(panelInk(g, PROBE_C_GREEN));
             g->setCursor(ox + cols[i], oy + 3);
             g->print(axLabels[i]);
         }
         g->setTextSize(1);
-        g->setTextColor(PROBE_C_DIMBLUE);
+        g->setTextColor(panelInk(g, PROBE_C_DIMBLUE));
         g->setCursor(ox + 212, oy + 3);
         g->print(uu);
 
         // Row 2 — position values (yellow)
         g->setTextSize(2);
-        g->setTextColor(PROBE_C_YELLOW);
+        g->setTextColor(panelInk(g, PROBE_C_YELLOW));
         for (int i = 0; i < 3; i++) {
             snprintf(buf, sizeof(buf), fmt, vals[i]);
             g->setCursor(ox + cols[i], oy + 20);
@@ -145,37 +145,37 @@ void probeDrawPosPanel(int y, int h) {
     } else {
         // ── Compact layout: textSize=1, single row ────────────────────────
         g->setTextSize(1);
-        g->setTextColor(PROBE_C_LBLUE);
+        g->setTextColor(panelInk(g, PROBE_C_LBLUE));
         g->setCursor(ox + 5, oy + 3);
         g->print("CURRENT POSITION");
 
         const char* fmt = inInch ? "%.4f" : "%.2f";
 
-        g->setTextColor(PROBE_C_GREEN);
+        g->setTextColor(panelInk(g, PROBE_C_GREEN));
         g->setCursor(ox + 5, oy + 14);
         g->print("X");
-        g->setTextColor(PROBE_C_YELLOW);
+        g->setTextColor(panelInk(g, PROBE_C_YELLOW));
         snprintf(buf, sizeof(buf), fmt, px);
         g->setCursor(ox + 13, oy + 14);
         g->print(buf);
 
-        g->setTextColor(PROBE_C_GREEN);
+        g->setTextColor(panelInk(g, PROBE_C_GREEN));
         g->setCursor(ox + 83, oy + 14);
         g->print("Y");
-        g->setTextColor(PROBE_C_YELLOW);
+        g->setTextColor(panelInk(g, PROBE_C_YELLOW));
         snprintf(buf, sizeof(buf), fmt, py);
         g->setCursor(ox + 91, oy + 14);
         g->print(buf);
 
-        g->setTextColor(PROBE_C_GREEN);
+        g->setTextColor(panelInk(g, PROBE_C_GREEN));
         g->setCursor(ox + 161, oy + 14);
         g->print("Z");
-        g->setTextColor(PROBE_C_YELLOW);
+        g->setTextColor(panelInk(g, PROBE_C_YELLOW));
         snprintf(buf, sizeof(buf), fmt, pz);
         g->setCursor(ox + 169, oy + 14);
         g->print(buf);
 
-        g->setTextColor(PROBE_C_DIMBLUE);
+        g->setTextColor(panelInk(g, PROBE_C_DIMBLUE));
         g->setCursor(ox + 215, oy + 18);
         g->print(uu);
     }
@@ -192,12 +192,12 @@ void probeDrawSettingsLink(int y) {
 
 // Focused-field selection bar — drawn at bottom of the settings region
 void probeDrawSelBar(int y, const char* fieldName, float value, const char* unit, int decimals) {
-    display.fillRoundRect(5, y, 230, 20, 3, PROBE_SEL_BG);
-    display.drawRoundRect(5, y, 230, 20, 3, PROBE_C_YELLOW);
-    display.setTextSize(1);
-    display.setTextColor(PROBE_C_LBLUE);
-    display.setCursor(10, y + 6);
-    display.print(fieldName);
+    gfx->fillRoundRect(5, y, 230, 20, 3, PROBE_SEL_BG);
+    gfx->drawRoundRect(5, y, 230, 20, 3, PROBE_C_YELLOW);
+    gfx->setTextSize(1);
+    gfx->setTextColor(PROBE_C_LBLUE);
+    gfx->setCursor(10, y + 6);
+    gfx->print(fieldName);
 
     char vbuf[16];
     if (decimals == 0)      snprintf(vbuf, sizeof(vbuf), "%.0f", value);
@@ -205,31 +205,31 @@ void probeDrawSelBar(int y, const char* fieldName, float value, const char* unit
     else if (decimals == 2) snprintf(vbuf, sizeof(vbuf), "%.2f", value);
     else                    snprintf(vbuf, sizeof(vbuf), "%.3f", value);
 
-    display.setTextSize(2);
-    display.setTextColor(PROBE_C_YELLOW);
-    int16_t vw = display.textWidth(vbuf);
-    display.setCursor(215 - vw - display.textWidth(unit), y + 3);
-    display.print(vbuf);
-    display.setTextSize(1);
-    display.setTextColor(PROBE_C_DIMBLUE);
-    display.setCursor(218 - display.textWidth(unit), y + 8);
-    display.print(unit);
+    gfx->setTextSize(2);
+    gfx->setTextColor(PROBE_C_YELLOW);
+    int16_t vw = gfx->textWidth(vbuf);
+    gfx->setCursor(215 - vw - gfx->textWidth(unit), y + 3);
+    gfx->print(vbuf);
+    gfx->setTextSize(1);
+    gfx->setTextColor(PROBE_C_DIMBLUE);
+    gfx->setCursor(218 - gfx->textWidth(unit), y + 8);
+    gfx->print(unit);
 }
 
 void probeDrawSelBarInt(int y, const char* fieldName, int value) {
-    display.fillRoundRect(5, y, 230, 20, 3, PROBE_SEL_BG);
-    display.drawRoundRect(5, y, 230, 20, 3, PROBE_C_YELLOW);
-    display.setTextSize(1);
-    display.setTextColor(PROBE_C_LBLUE);
-    display.setCursor(10, y + 6);
-    display.print(fieldName);
-    display.setTextSize(2);
-    display.setTextColor(PROBE_C_YELLOW);
+    gfx->fillRoundRect(5, y, 230, 20, 3, PROBE_SEL_BG);
+    gfx->drawRoundRect(5, y, 230, 20, 3, PROBE_C_YELLOW);
+    gfx->setTextSize(1);
+    gfx->setTextColor(PROBE_C_LBLUE);
+    gfx->setCursor(10, y + 6);
+    gfx->print(fieldName);
+    gfx->setTextSize(2);
+    gfx->setTextColor(PROBE_C_YELLOW);
     char vbuf[8];
     snprintf(vbuf, sizeof(vbuf), "%d", value);
-    int16_t vw = display.textWidth(vbuf);
-    display.setCursor(228 - vw, y + 3);
-    display.print(vbuf);
+    int16_t vw = gfx->textWidth(vbuf);
+    gfx->setCursor(228 - vw, y + 3);
+    gfx->print(vbuf);
 }
 
 // A single KV-touch row inside a panel.
@@ -239,12 +239,12 @@ void probeDrawKVTouch(int x, int y, int w, int h,
                       uint16_t valColor, bool focused, int decimals) {
     uint16_t bg  = focused ? PROBE_SEL_BG : PROBE_BG_SCREEN;
     uint16_t bdr = focused ? PROBE_C_YELLOW : PROBE_C_TAPBDR;
-    display.fillRoundRect(x, y, w, h, 2, bg);
-    display.drawRoundRect(x, y, w, h, 2, bdr);
-    display.setTextSize(1);
-    display.setTextColor(focused ? COLOR_WHITE : PROBE_C_LBLUE);
-    display.setCursor(x + 3, y + 2);
-    display.print(label);
+    gfx->fillRoundRect(x, y, w, h, 2, bg);
+    gfx->drawRoundRect(x, y, w, h, 2, bdr);
+    gfx->setTextSize(1);
+    gfx->setTextColor(focused ? COLOR_WHITE : PROBE_C_LBLUE);
+    gfx->setCursor(x + 3, y + 2);
+    gfx->print(label);
 
     char vbuf[14];
     if (decimals == 0)      snprintf(vbuf, sizeof(vbuf), "%.0f", value);
@@ -252,15 +252,15 @@ void probeDrawKVTouch(int x, int y, int w, int h,
     else if (decimals == 2) snprintf(vbuf, sizeof(vbuf), "%.2f", value);
     else                    snprintf(vbuf, sizeof(vbuf), "%.3f", value);
 
-    display.setTextSize(2);
-    display.setTextColor(focused ? PROBE_C_YELLOW : valColor);
-    display.setCursor(x + 3, y + 11);
-    display.print(vbuf);
-    display.setTextSize(1);
-    display.setTextColor(PROBE_C_DIMBLUE);
-    int16_t vw = display.textWidth(vbuf) * 2;
-    display.setCursor(x + 3 + vw + 1, y + 14);
-    display.print(unit);
+    gfx->setTextSize(2);
+    gfx->setTextColor(focused ? PROBE_C_YELLOW : valColor);
+    gfx->setCursor(x + 3, y + 11);
+    gfx->print(vbuf);
+    gfx->setTextSize(1);
+    gfx->setTextColor(PROBE_C_DIMBLUE);
+    int16_t vw = gfx->textWidth(vbuf) * 2;
+    gfx->setCursor(x + 3 + vw + 1, y + 14);
+    gfx->print(unit);
 }
 
 void probeDrawKVTouchInt(int x, int y, int w, int h,
@@ -268,56 +268,56 @@ void probeDrawKVTouchInt(int x, int y, int w, int h,
                          uint16_t valColor, bool focused) {
     uint16_t bg  = focused ? PROBE_SEL_BG : PROBE_BG_SCREEN;
     uint16_t bdr = focused ? PROBE_C_YELLOW : PROBE_C_TAPBDR;
-    display.fillRoundRect(x, y, w, h, 2, bg);
-    display.drawRoundRect(x, y, w, h, 2, bdr);
-    display.setTextSize(1);
-    display.setTextColor(focused ? COLOR_WHITE : PROBE_C_LBLUE);
-    display.setCursor(x + 3, y + 2);
-    display.print(label);
-    display.setTextSize(2);
-    display.setTextColor(focused ? PROBE_C_YELLOW : valColor);
+    gfx->fillRoundRect(x, y, w, h, 2, bg);
+    gfx->drawRoundRect(x, y, w, h, 2, bdr);
+    gfx->setTextSize(1);
+    gfx->setTextColor(focused ? COLOR_WHITE : PROBE_C_LBLUE);
+    gfx->setCursor(x + 3, y + 2);
+    gfx->print(label);
+    gfx->setTextSize(2);
+    gfx->setTextColor(focused ? PROBE_C_YELLOW : valColor);
     char vbuf[8];
     snprintf(vbuf, sizeof(vbuf), "%d", value);
-    display.setCursor(x + 3, y + 11);
-    display.print(vbuf);
+    gfx->setCursor(x + 3, y + 11);
+    gfx->print(vbuf);
 }
 
 void probeDrawWarn(int y, const char* msg, bool isRed, int h) {
     uint16_t bg  = isRed ? PROBE_WARNR_BG  : PROBE_WARN_BG;
     uint16_t bdr = isRed ? PROBE_WARNR_BDR : PROBE_WARN_BDR;
     uint16_t fg  = isRed ? PROBE_C_RED     : PROBE_AMBER;
-    display.fillRoundRect(5, y, 230, h, 3, bg);
-    display.drawRoundRect(5, y, 230, h, 3, bdr);
-    display.setTextSize(1);
-    display.setTextColor(fg);
-    display.setCursor(10, y + (h - 8) / 2);
-    display.print(msg);
+    gfx->fillRoundRect(5, y, 230, h, 3, bg);
+    gfx->drawRoundRect(5, y, 230, h, 3, bdr);
+    gfx->setTextSize(1);
+    gfx->setTextColor(fg);
+    gfx->setCursor(10, y + (h - 8) / 2);
+    gfx->print(msg);
 }
 
 // Confirm overlay — drawn over the current screen when user taps a PROBE button.
 void probeDrawConfirmOverlay(const char* routineName) {
     // Semi-transparent dark panel
-    display.fillRoundRect(20, 100, 200, 120, 8, PROBE_BG_PANEL);
-    display.drawRoundRect(20, 100, 200, 120, 8, PROBE_C_YELLOW);
-    display.setTextSize(1);
-    display.setTextColor(PROBE_C_YELLOW);
-    display.setCursor(30, 110);
-    display.print("CONFIRM PROBE?");
-    display.setTextSize(1);
-    display.setTextColor(PROBE_C_LBLUE);
-    int16_t tw = display.textWidth(routineName);
-    display.setCursor(120 - tw / 2, 126);
-    display.print(routineName);
+    gfx->fillRoundRect(20, 100, 200, 120, 8, PROBE_BG_PANEL);
+    gfx->drawRoundRect(20, 100, 200, 120, 8, PROBE_C_YELLOW);
+    gfx->setTextSize(1);
+    gfx->setTextColor(PROBE_C_YELLOW);
+    gfx->setCursor(30, 110);
+    gfx->print("CONFIRM PROBE?");
+    gfx->setTextSize(1);
+    gfx->setTextColor(PROBE_C_LBLUE);
+    int16_t tw = gfx->textWidth(routineName);
+    gfx->setCursor(120 - tw / 2, 126);
+    gfx->print(routineName);
     // Buttons
-    display.fillRoundRect(28,  175, 78, 32, 5, COLOR_BUTTON_GRAY);  // CANCEL
-    display.fillRoundRect(114, 175, 98, 32, 5, PROBE_BTN_GREEN);  // CONFIRM
-    display.setTextSize(2);
-    display.setTextColor(COLOR_WHITE);
-    display.setCursor(36, 183);
-    display.print("CANCEL");
-    int16_t cw = display.textWidth("CONFIRM");
-    display.setCursor(114 + (98 - cw) / 2, 183);
-    display.print("CONFIRM");
+    gfx->fillRoundRect(28,  175, 78, 32, 5, COLOR_BUTTON_GRAY);     // CANCEL
+    gfx->fillRoundRect(114, 175, 98, 32, 5, PROBE_BTN_GREEN);       // CONFIRM
+    gfx->setTextSize(2);
+    gfx->setTextColor(COLOR_WHITE);
+    gfx->setCursor(36, 183);
+    gfx->print("CANCEL");
+    int16_t cw = gfx->textWidth("CONFIRM");
+    gfx->setCursor(114 + (98 - cw) / 2, 183);
+    gfx->print("CONFIRM");
 }
 
 // Dial acceleration — returns effective step multiplier.
@@ -349,20 +349,20 @@ void probeSeekFine(const char* axis, float seekDist, float seekF, float fineF) {
 // rect, small label over the WCS).  Shared by every routine screen so the WCS
 // the probe zeroes can be cycled from each one.
 void probeDrawWorkAreaButton(int x, int y, int w, int h) {
-    display.fillRoundRect(x, y, w, h, 8, PROBE_BG_SCREEN);
-    display.drawRoundRect(x, y, w, h, 8, PROBE_C_TAPBDR);
-    display.setTextSize(1);
-    display.setTextColor(PROBE_C_LBLUE);
+    gfx->fillRoundRect(x, y, w, h, 8, PROBE_BG_SCREEN);
+    gfx->drawRoundRect(x, y, w, h, 8, PROBE_C_TAPBDR);
+    gfx->setTextSize(1);
+    gfx->setTextColor(PROBE_C_LBLUE);
     const char* lbl = "WORK AREA";
-    int16_t lw = display.textWidth(lbl);
-    display.setCursor(x + (w - lw) / 2, y + 5);
-    display.print(lbl);
-    display.setTextSize(2);
-    display.setTextColor(PROBE_C_BLUE);
+    int16_t lw = gfx->textWidth(lbl);
+    gfx->setCursor(x + (w - lw) / 2, y + 5);
+    gfx->print(lbl);
+    gfx->setTextSize(2);
+    gfx->setTextColor(PROBE_C_BLUE);
     const char* v = pendantProbing.selectedCoordSystem.c_str();
-    int16_t vw = display.textWidth(v);
-    display.setCursor(x + (w - vw) / 2, y + 17);
-    display.print(v);
+    int16_t vw = gfx->textWidth(v);
+    gfx->setCursor(x + (w - vw) / 2, y + 17);
+    gfx->print(v);
 }
 
 // Cycle G54 → G55 → G56 → G57 → G54.  Selection only — the button doesn't switch
@@ -386,15 +386,17 @@ void drawSeqStep(int x, int y, int num, const char* txt, bool active) {
     uint16_t bg = active ? PROBE_AMBER    : PROBE_BG_PANEL;
     uint16_t fg = active ? COLOR_WHITE    : PROBE_C_DIMBLUE;
     uint16_t tc = active ? PROBE_C_YELLOW : PROBE_C_DIMBLUE;
-    display.fillCircle(x + 6, y + 6, 6, bg);
-    display.setTextSize(1);
-    display.setTextColor(fg);
-    int16_t nw = display.textWidth(String(num).c_str());
-    display.setCursor(x + 6 - nw / 2, y + 2);
-    display.print(num);
-    display.setTextColor(tc);
-    display.setCursor(x + 16, y + 2);
-    display.print(txt);
+    gfx->fillCircle(x + 6, y + 6, 6, bg);
+    gfx->setTextSize(1);
+    gfx->setTextColor(fg);
+    char numStr[8];
+    snprintf(numStr, sizeof(numStr), "%d", num);
+    int16_t nw = gfx->textWidth(numStr);
+    gfx->setCursor(x + 6 - nw / 2, y + 2);
+    gfx->print(num);
+    gfx->setTextColor(tc);
+    gfx->setCursor(x + 16, y + 2);
+    gfx->print(txt);
 }
 
 // ── SCR0 screen lifecycle ────────────────────────────────────────────────────
@@ -451,20 +453,20 @@ void updateProbeSharedFields() {
 }
 
 static void drawSharedKVPanel() {
-    display.fillRoundRect(5, 82, 230, 84, 4, PROBE_BG_PANEL);
-    display.setTextSize(1);
-    display.setTextColor(PROBE_C_LBLUE);
-    display.setCursor(10, 84);
-    display.print("SHARED SETTINGS");
+    gfx->fillRoundRect(5, 82, 230, 84, 4, PROBE_BG_PANEL);
+    gfx->setTextSize(1);
+    gfx->setTextColor(PROBE_C_LBLUE);
+    gfx->setCursor(10, 84);
+    gfx->print("SHARED SETTINGS");
     updateProbeSharedFields();
 }
 
 static void drawRoutineButtons() {
-    display.fillRoundRect(5, 170, 230, 104, 4, PROBE_BG_PANEL);
-    display.setTextSize(1);
-    display.setTextColor(PROBE_C_LBLUE);
-    display.setCursor(10, 172);
-    display.print("PROBE ROUTINES");
+    gfx->fillRoundRect(5, 170, 230, 104, 4, PROBE_BG_PANEL);
+    gfx->setTextSize(1);
+    gfx->setTextColor(PROBE_C_LBLUE);
+    gfx->setCursor(10, 172);
+    gfx->print("PROBE ROUTINES");
 
     // Routines available depend on the probe type:
     //   Z-Height Plate → Z Surface only
@@ -486,7 +488,7 @@ static void drawRoutineButtons() {
 }
 
 void drawProbeScreen() {
-    display.fillScreen(PROBE_BG_SCREEN);
+    gfx->fillScreen(PROBE_BG_SCREEN);
     drawTitle("PROBE");
     drawProbeTypeRow();
     drawSharedKVPanel();
@@ -520,7 +522,7 @@ void handleProbeTouch(int x, int y) {
         if (isTouchInBounds(x, y, kProbeTypeX[i], 38, kProbeTypeW[i], 40)) {
             if (pendantProbeV2.probeTypeIdx != i) {
                 pendantProbeV2.probeTypeIdx = i;
-                drawProbeScreen();   // type change → re-gate routines (full redraw)
+                drawCurrentPendantScreen();  // type change → re-gate routines (full redraw)
             }
             return;
         }
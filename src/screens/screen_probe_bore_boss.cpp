@@ -132,19 +132,19 @@ static void runProbeBore() {
 static void drawBoreDiagram() {
     // Inverted boss: a pocket recessed into the stock (cross-section).  Stylus
     // descends into the hole; arrows probe outward to the side walls (XY).
-    display.fillRect(18, 182, 84, 20, PROBE_C_DIMBLUE);   // stock block (surface y182)
-    display.fillRect(46, 182, 28, 13, PROBE_BG_PANEL);    // bored pocket (void, boss-width)
+    gfx->fillRect(18, 182, 84, 20, PROBE_C_DIMBLUE);      // stock block (surface y182)
+    gfx->fillRect(46, 182, 28, 13, PROBE_BG_PANEL);       // bored pocket (void, boss-width)
     // Probe body/stem + stylus descending into the hole
-    display.fillRoundRect(55, 150, 10, 12, 2, PROBE_C_LBLUE);
-    display.drawLine(60, 161, 60, 189, PROBE_C_YELLOW);
-    display.fillCircle(60, 191, 2, PROBE_C_YELLOW);
+    gfx->fillRoundRect(55, 150, 10, 12, 2, PROBE_C_LBLUE);
+    gfx->drawLine(60, 161, 60, 189, PROBE_C_YELLOW);
+    gfx->fillCircle(60, 191, 2, PROBE_C_YELLOW);
     // Side-wall probes (XY) — outward arrows
-    display.drawLine(60, 188, 48, 188, PROBE_C_GREEN);    // left shaft
-    display.drawLine(48, 188, 52, 185, PROBE_C_GREEN);    // left head
-    display.drawLine(48, 188, 52, 191, PROBE_C_GREEN);
-    display.drawLine(60, 188, 72, 188, PROBE_C_GREEN);    // right shaft
-    display.drawLine(72, 188, 68, 185, PROBE_C_GREEN);    // right head
-    display.drawLine(72, 188, 68, 191, PROBE_C_GREEN);
+    gfx->drawLine(60, 188, 48, 188, PROBE_C_GREEN);       // left shaft
+    gfx->drawLine(48, 188, 52, 185, PROBE_C_GREEN);       // left head
+    gfx->drawLine(48, 188, 52, 191, PROBE_C_GREEN);
+    gfx->drawLine(60, 188, 72, 188, PROBE_C_GREEN);       // right shaft
+    gfx->drawLine(72, 188, 68, 185, PROBE_C_GREEN);       // right head
+    gfx->drawLine(72, 188, 68, 191, PROBE_C_GREEN);
 }
 
 // Redraws ONLY the bore settings fields (opaque boxes) — used by the full draw
@@ -156,60 +156,64 @@ void updateProbeBoreFields() {
     probeDrawKVTouch(122, 113, 111, 27, "Wall offset",  pendantProbeV2.boreOffset, "mm", PROBE_C_BLUE, fo==1, 3);
 }
 
-void drawProbeBoreScreen() {
-    display.fillScreen(PROBE_BG_SCREEN);
-    drawTitle("BORE");
-    probeDrawPosPanel(38);
+static void drawProbeBoreChrome() {
+    gfx->fillScreen(PROBE_BG_SCREEN);
+    drawTitleBar("BORE");
 
     // ── Combined panel: sequence (left) + settings & result (right) ───────────
-    display.fillRoundRect(5, 70, 230, 146, 4, PROBE_BG_PANEL);
+    gfx->fillRoundRect(5, 70, 230, 146, 4, PROBE_BG_PANEL);
 
     // Left column: sequence steps
-    display.setTextSize(1);
-    display.setTextColor(PROBE_C_LBLUE);
-    display.setCursor(10, 73);
-    display.print("SEQUENCE");
+    gfx->setTextSize(1);
+    gfx->setTextColor(PROBE_C_LBLUE);
+    gfx->setCursor(10, 73);
+    gfx->print("SEQUENCE");
     drawSeqStep( 8, 87,  1, "Probe 4 points", true);
     drawSeqStep( 8, 105, 2, "Find centre",    false);
     drawSeqStep( 8, 123, 3, "Set X0 Y0",      false);
     drawBoreDiagram();
 
     // Right column: 2 KV-touch settings (h=27 so the value isn't clipped)
-    display.setTextSize(1);
-    display.setTextColor(PROBE_C_LBLUE);
-    display.setCursor(122, 73);
-    display.print("SETTINGS");
-
-    updateProbeBoreFields();
+    gfx->setTextSize(1);
+    gfx->setTextColor(PROBE_C_LBLUE);
+    gfx->setCursor(122, 73);
+    gfx->print("SETTINGS");
 
     // Right column, centred: result line, then the Z-Surface note.
-    display.setTextSize(1);
+    gfx->setTextSize(1);
     {
         const char* s = "Sets X0 Y0";
-        display.setTextColor(PROBE_C_GREEN);
-        display.setCursor(177 - display.textWidth(s) / 2, 150);
-        display.print(s);
+        gfx->setTextColor(PROBE_C_GREEN);
+        gfx->setCursor(177 - gfx->textWidth(s) / 2, 150);
+        gfx->print(s);
         const char* a = "Z work-zero:";
-        display.setTextColor(PROBE_C_LBLUE);
-        display.setCursor(177 - display.textWidth(a) / 2, 168);
-        display.print(a);
-        display.setTextColor(PROBE_C_GREEN);
+        gfx->setTextColor(PROBE_C_LBLUE);
+        gfx->setCursor(177 - gfx->textWidth(a) / 2, 168);
+        gfx->print(a);
+        gfx->setTextColor(PROBE_C_GREEN);
         const char* b = "use Z Surface";
-        display.setCursor(177 - display.textWidth(b) / 2, 182);
-        display.print(b);
+        gfx->setCursor(177 - gfx->textWidth(b) / 2, 182);
+        gfx->print(b);
         const char* c = "probe routine";
-        display.setCursor(177 - display.textWidth(c) / 2, 196);
-        display.print(c);
+        gfx->setCursor(177 - gfx->textWidth(c) / 2, 196);
+        gfx->print(c);
     }
 
     probeDrawWarn(220, "! Place tip inside the bore");
 
     // Bottom-nav row: Back (left) | work-area selector (right)
     drawButton(5, 239, 112, 38, "Back", PROBE_BTN_BLUE, COLOR_WHITE, 2);
-    probeDrawWorkAreaButton(123, 239, 112, 38);
 
     drawButton(  5, 280, 112, 38, "Main Menu", PROBE_BTN_BLUE,  COLOR_WHITE, 2);
     drawButton(123, 280, 112, 38, "Probe",     PROBE_BTN_GREEN, COLOR_WHITE, 2);
+}
+
+void drawProbeBoreScreen() {
+    drawChrome(drawProbeBoreChrome);
+    drawTitleIcons();
+    probeDrawPosPanel(38);
+    updateProbeBoreFields();
+    probeDrawWorkAreaButton(123, 239, 112, 38);
 
     if (pendantProbeV2.confirmActive)
         probeDrawConfirmOverlay("BORE");
@@ -224,7 +228,7 @@ void handleProbeBoreTouch(int x, int y) {
     if (pendantProbeV2.confirmActive) {
         if (isTouchInBounds(x, y, 28, 175, 78, 32)) {
             pendantProbeV2.confirmActive = false;
-            drawProbeBoreScreen();
+            drawCurrentPendantScreen();
         } else if (isTouchInBounds(x, y, 114, 175, 98, 32)) {
             pendantProbeV2.confirmActive = false;
             runProbeBore();
@@ -236,7 +240,7 @@ void handleProbeBoreTouch(int x, int y) {
     bool redraw = false;
     if (isTouchInBounds(x, y, 122, 84,  111, 27)) { pendantProbeV2.focusedField=(pendantProbeV2.focusedField==0)?-1:0; redraw=true; }
     if (isTouchInBounds(x, y, 122, 113, 111, 27)) { pendantProbeV2.focusedField=(pendantProbeV2.focusedField==1)?-1:1; redraw=true; }
-    if (redraw) { drawProbeBoreScreen(); return; }
+    if (redraw) { drawCurrentPendantScreen(); return; }
 
     if (isTouchInBounds(x, y, 5, 239, 112, 38)) {
         pendantProbeV2.returnScreen  = PSCREEN_PROBE_BORE;
@@ -245,7 +249,7 @@ void handleProbeBoreTouch(int x, int y) {
     }
     if (isTouchInBounds(x, y, 123, 239, 112, 38)) {
         probeCycleWorkArea();
-        drawProbeBoreScreen();
+        drawCurrentPendantScreen();
         return;
     }
 
@@ -253,7 +257,7 @@ void handleProbeBoreTouch(int x, int y) {
     if (isTouchInBounds(x, y, 123, 280, 112, 38)) {
         if (!pendantConnected) { probeDrawWarn(204, "! Not connected", true); return; }
         pendantProbeV2.confirmActive = true;
-        drawProbeBoreScreen();
+        drawCurrentPendantScreen();
         return;
     }
 }
@@ -368,21 +372,21 @@ static void runProbeBoss() {
 static void drawBossDiagram() {
     // Raised boss on the stock (cross-section).  Stylus touches the top (Z0);
     // arrows probe inward to the side walls (XY).
-    display.fillRect(18, 196, 84, 9, PROBE_C_DIMBLUE);   // stock slab
-    display.fillRect(46, 182, 28, 14, PROBE_C_LBLUE);    // raised boss
+    gfx->fillRect(18, 196, 84, 9, PROBE_C_DIMBLUE);      // stock slab
+    gfx->fillRect(46, 182, 28, 14, PROBE_C_LBLUE);       // raised boss
     // Probe body/stem + stylus touching the boss top (Z0)
-    display.fillRoundRect(55, 141, 10, 12, 2, PROBE_C_LBLUE);
-    display.drawLine(60, 152, 60, 180, PROBE_C_YELLOW);
-    display.fillCircle(60, 182, 2, PROBE_C_YELLOW);
-    display.drawLine(57, 165, 60, 169, PROBE_C_YELLOW);  // down chevron
-    display.drawLine(63, 165, 60, 169, PROBE_C_YELLOW);
+    gfx->fillRoundRect(55, 141, 10, 12, 2, PROBE_C_LBLUE);
+    gfx->drawLine(60, 152, 60, 180, PROBE_C_YELLOW);
+    gfx->fillCircle(60, 182, 2, PROBE_C_YELLOW);
+    gfx->drawLine(57, 165, 60, 169, PROBE_C_YELLOW);     // down chevron
+    gfx->drawLine(63, 165, 60, 169, PROBE_C_YELLOW);
     // Side-wall probes (XY) — inward arrows
-    display.drawLine(26, 189, 44, 189, PROBE_C_GREEN);   // left shaft
-    display.drawLine(44, 189, 40, 186, PROBE_C_GREEN);   // left head
-    display.drawLine(44, 189, 40, 192, PROBE_C_GREEN);
-    display.drawLine(94, 189, 76, 189, PROBE_C_GREEN);   // right shaft
-    display.drawLine(76, 189, 80, 186, PROBE_C_GREEN);   // right head
-    display.drawLine(76, 189, 80, 192, PROBE_C_GREEN);
+    gfx->drawLine(26, 189, 44, 189, PROBE_C_GREEN);      // left shaft
+    gfx->drawLine(44, 189, 40, 186, PROBE_C_GREEN);      // left head
+    gfx->drawLine(44, 189, 40, 192, PROBE_C_GREEN);
+    gfx->drawLine(94, 189, 76, 189, PROBE_C_GREEN);      // right shaft
+    gfx->drawLine(76, 189, 80, 186, PROBE_C_GREEN);      // right head
+    gfx->drawLine(76, 189, 80, 192, PROBE_C_GREEN);
 }
 
 // Top-down diagram of RECTANGULAR boss probing: the boss outline (plan view) with
@@ -391,30 +395,30 @@ static void drawBossDiagram() {
 // rectangular mode is active.
 static void drawBossDiagramRect() {
     // Boss outline (plan view), centred on (60, 175).
-    display.drawRect(40, 161, 41, 29, PROBE_C_LBLUE);
+    gfx->drawRect(40, 161, 41, 29, PROBE_C_LBLUE);
     // Inward face-probe arrows (green), one per side, pointing at the face middle.
     // +X (from the right, probing toward −X)
-    display.drawLine(94, 175, 83, 175, PROBE_C_GREEN);
-    display.drawLine(83, 175, 87, 172, PROBE_C_GREEN);
-    display.drawLine(83, 175, 87, 178, PROBE_C_GREEN);
+    gfx->drawLine(94, 175, 83, 175, PROBE_C_GREEN);
+    gfx->drawLine(83, 175, 87, 172, PROBE_C_GREEN);
+    gfx->drawLine(83, 175, 87, 178, PROBE_C_GREEN);
     // −X (from the left, probing toward +X)
-    display.drawLine(26, 175, 37, 175, PROBE_C_GREEN);
-    display.drawLine(37, 175, 33, 172, PROBE_C_GREEN);
-    display.drawLine(37, 175, 33, 178, PROBE_C_GREEN);
+    gfx->drawLine(26, 175, 37, 175, PROBE_C_GREEN);
+    gfx->drawLine(37, 175, 33, 172, PROBE_C_GREEN);
+    gfx->drawLine(37, 175, 33, 178, PROBE_C_GREEN);
     // +Y (from the top, probing downward)
-    display.drawLine(60, 145, 60, 158, PROBE_C_GREEN);
-    display.drawLine(60, 158, 57, 154, PROBE_C_GREEN);
-    display.drawLine(60, 158, 63, 154, PROBE_C_GREEN);
+    gfx->drawLine(60, 145, 60, 158, PROBE_C_GREEN);
+    gfx->drawLine(60, 158, 57, 154, PROBE_C_GREEN);
+    gfx->drawLine(60, 158, 63, 154, PROBE_C_GREEN);
     // −Y (from the bottom, probing upward)
-    display.drawLine(60, 205, 60, 192, PROBE_C_GREEN);
-    display.drawLine(60, 192, 57, 196, PROBE_C_GREEN);
-    display.drawLine(60, 192, 63, 196, PROBE_C_GREEN);
+    gfx->drawLine(60, 205, 60, 192, PROBE_C_GREEN);
+    gfx->drawLine(60, 192, 57, 196, PROBE_C_GREEN);
+    gfx->drawLine(60, 192, 63, 196, PROBE_C_GREEN);
     // Z0 tick at the centre (the top touch still sets Z0 first).
-    display.fillCircle(60, 175, 2, PROBE_C_YELLOW);
-    display.setTextSize(1);
-    display.setTextColor(PROBE_C_YELLOW);
-    display.setCursor(64, 172);
-    display.print("Z0");
+    gfx->fillCircle(60, 175, 2, PROBE_C_YELLOW);
+    gfx->setTextSize(1);
+    gfx->setTextColor(PROBE_C_YELLOW);
+    gfx->setCursor(64, 172);
+    gfx->print("Z0");
 }
 
 // Redraws ONLY the boss settings fields (opaque boxes, no screen/panel clear) —
@@ -437,19 +441,18 @@ void updateProbeBossFields() {
     }
 }
 
-void drawProbeBossScreen() {
-    display.fillScreen(PROBE_BG_SCREEN);
-    drawTitle("BOSS");
-    probeDrawPosPanel(38);
+static void drawProbeBossChrome() {
+    gfx->fillScreen(PROBE_BG_SCREEN);
+    drawTitleBar("BOSS");
 
     // Combined panel: sequence + diagram (left) / settings + result (right).
-    display.fillRoundRect(5, 70, 230, 146, 4, PROBE_BG_PANEL);
+    gfx->fillRoundRect(5, 70, 230, 146, 4, PROBE_BG_PANEL);
 
     // Left: sequence + diagram
-    display.setTextSize(1);
-    display.setTextColor(PROBE_C_LBLUE);
-    display.setCursor(10, 73);
-    display.print("SEQUENCE");
+    gfx->setTextSize(1);
+    gfx->setTextColor(PROBE_C_LBLUE);
+    gfx->setCursor(10, 73);
+    gfx->print("SEQUENCE");
     drawSeqStep( 8, 87,  1, "Touch top->Z0",  true);
     drawSeqStep( 8, 105, 2, "Probe 4 points", false);
     drawSeqStep( 8, 123, 3, "Set X0 Y0",      false);
@@ -457,40 +460,45 @@ void drawProbeBossScreen() {
     // grey border marks it as a button (our tappable-field convention) and the
     // diagram itself is the mode indicator, so tapping it to change shape reads
     // naturally.  Replaces the old triple-tap on the first settings field.
-    display.drawRoundRect(6, 136, 112, 79, 3, PROBE_C_TAPBDR);
+    gfx->drawRoundRect(6, 136, 112, 79, 3, PROBE_C_TAPBDR);
     if (pendantProbeV2.bossRect) drawBossDiagramRect();
     else                         drawBossDiagram();
-    display.setTextSize(1);
-    display.setTextColor(PROBE_C_LBLUE);
-    display.setCursor(10, 206);
-    display.print("Tap: shape");
+    gfx->setTextSize(1);
+    gfx->setTextColor(PROBE_C_LBLUE);
+    gfx->setCursor(10, 206);
+    gfx->print("Tap: shape");
 
     // Right: KV settings (h=27 so the value isn't clipped).  Rectangular mode
     // splits the nominal size into X-size / Y-size, so it shows one extra field.
-    display.setTextSize(1);
-    display.setTextColor(PROBE_C_LBLUE);
-    display.setCursor(122, 73);
-    display.print("SETTINGS");
-
-    updateProbeBossFields();
+    gfx->setTextSize(1);
+    gfx->setTextColor(PROBE_C_LBLUE);
+    gfx->setCursor(122, 73);
+    gfx->print("SETTINGS");
 
     // Result line — what axes the probe will set (below the last field)
     {
         const char* s = "Sets X0 Y0 Z0";
-        display.setTextSize(1);
-        display.setTextColor(PROBE_C_GREEN);
-        display.setCursor(177 - display.textWidth(s) / 2, pendantProbeV2.bossRect ? 205 : 182);
-        display.print(s);
+        gfx->setTextSize(1);
+        gfx->setTextColor(PROBE_C_GREEN);
+        gfx->setCursor(177 - gfx->textWidth(s) / 2, pendantProbeV2.bossRect ? 205 : 182);
+        gfx->print(s);
     }
 
     probeDrawWarn(220, "! Start above centre of boss");
 
     // Bottom-nav row: Back (left) | work-area selector (right)
     drawButton(5, 239, 112, 38, "Back", PROBE_BTN_BLUE, COLOR_WHITE, 2);
-    probeDrawWorkAreaButton(123, 239, 112, 38);
 
     drawButton(  5, 280, 112, 38, "Main Menu", PROBE_BTN_BLUE,  COLOR_WHITE, 2);
     drawButton(123, 280, 112, 38, "Probe",     PROBE_BTN_GREEN, COLOR_WHITE, 2);
+}
+
+void drawProbeBossScreen() {
+    drawChrome(drawProbeBossChrome, pendantProbeV2.bossRect);   // shape picks the diagram
+    drawTitleIcons();
+    probeDrawPosPanel(38);
+    updateProbeBossFields();
+    probeDrawWorkAreaButton(123, 239, 112, 38);
 
     if (pendantProbeV2.confirmActive)
         probeDrawConfirmOverlay("BOSS");
@@ -505,7 +513,7 @@ void handleProbeBossTouch(int x, int y) {
     if (pendantProbeV2.confirmActive) {
         if (isTouchInBounds(x, y, 28, 175, 78, 32)) {
             pendantProbeV2.confirmActive = false;
-            drawProbeBossScreen();
+            drawCurrentPendantScreen();
         } else if (isTouchInBounds(x, y, 114, 175, 98, 32)) {
             pendantProbeV2.confirmActive = false;
             runProbeBoss();
@@ -521,7 +529,7 @@ void handleProbeBossTouch(int x, int y) {
         int maxField = pendantProbeV2.bossRect ? 3 : 2;
         if (pendantProbeV2.focusedField > maxField) pendantProbeV2.focusedField = -1;
         saveProbeSettings();
-        drawProbeBossScreen();
+        drawCurrentPendantScreen();
         return;
     }
 
@@ -532,7 +540,7 @@ void handleProbeBossTouch(int x, int y) {
     if (isTouchInBounds(x, y, 122, 142, 111, 27)) { pendantProbeV2.focusedField=(pendantProbeV2.focusedField==2)?-1:2; redraw=true; }
     if (pendantProbeV2.bossRect &&
         isTouchInBounds(x, y, 122, 171, 111, 27)) { pendantProbeV2.focusedField=(pendantProbeV2.focusedField==3)?-1:3; redraw=true; }
-    if (redraw) { drawProbeBossScreen(); return; }
+    if (redraw) { drawCurrentPendantScreen(); return; }
 
     if (isTouchInBounds(x, y, 5, 239, 112, 38)) {
         pendantProbeV2.returnScreen  = PSCREEN_PROBE_BOSS;
@@ -541,7 +549,7 @@ void handleProbeBossTouch(int x, int y) {
     }
     if (isTouchInBounds(x, y, 123, 239, 112, 38)) {
         probeCycleWorkArea();
-        drawProbeBossScreen();
+        drawCurrentPendantScreen();
         return;
     }
 
@@ -549,7 +557,7 @@ void handleProbeBossTouch(int x, int y) {
     if (isTouchInBounds(x, y, 123, 280, 112, 38)) {
         if (!pendantConnected) { probeDrawWarn(204, "! Not connected", true); return; }
         pendantProbeV2.confirmActive = true;
-        drawProbeBossScreen();
+        drawCurrentPendantScreen();
         return;
     }
 }
@@ -30,35 +30,35 @@ static const int kGfxCX = 120;   // horizontal centre of all illustrations
 // Compact form so it fits the space left below the deflection-cal panel (y188+).
 static void drawProbe3DGraphic() {
     const int cx = kGfxCX;
-    display.fillRoundRect(5, 188, 230, 82, 4, PROBE_BG_PANEL);
-    display.fillRect(cx - 7, 194, 14, 8, PROBE_C_DIMBLUE);            // collet/shank
-    display.fillRoundRect(cx - 17, 202, 34, 18, 4, COLOR_GRAY_TEXT); // probe body
-    display.drawFastVLine(cx - 1, 220, 24, PROBE_C_LBLUE);           // stylus (3px)
-    display.drawFastVLine(cx,     220, 24, PROBE_C_LBLUE);
-    display.drawFastVLine(cx + 1, 220, 24, PROBE_C_LBLUE);
-    display.fillCircle(cx, 247, 5, PROBE_C_RED);                     // ruby ball
-    display.drawFastHLine(cx - 50, 255, 100, COLOR_GRAY_TEXT);       // work surface
+    gfx->fillRoundRect(5, 188, 230, 82, 4, PROBE_BG_PANEL);
+    gfx->fillRect(cx - 7, 194, 14, 8, PROBE_C_DIMBLUE);              // collet/shank
+    gfx->fillRoundRect(cx - 17, 202, 34, 18, 4, COLOR_GRAY_TEXT);    // probe body
+    gfx->drawFastVLine(cx - 1, 220, 24, PROBE_C_LBLUE);              // stylus (3px)
+    gfx->drawFastVLine(cx,     220, 24, PROBE_C_LBLUE);
+    gfx->drawFastVLine(cx + 1, 220, 24, PROBE_C_LBLUE);
+    gfx->fillCircle(cx, 247, 5, PROBE_C_RED);                        // ruby ball
+    gfx->drawFastHLine(cx - 50, 255, 100, COLOR_GRAY_TEXT);          // work surface
     for (int i = 0; i < 7; i++)
-        display.drawLine(cx - 46 + i * 14, 255, cx - 52 + i * 14, 261, PROBE_C_DIMBLUE);
+        gfx->drawLine(cx - 46 + i * 14, 255, cx - 52 + i * 14, 261, PROBE_C_DIMBLUE);
 }
 
 // Z-height touch plate: tool descending onto a flat plate sitting on the stock.
 static void drawPlateZGraphic() {
     const int cx = kGfxCX;
-    display.fillRoundRect(5, 128, 230, 142, 4, PROBE_BG_PANEL);
-    display.fillRect(cx - 45, 206, 90, 32, COLOR_BUTTON_GRAY);  // workpiece
-    display.fillRect(cx - 55, 194, 110, 12, PROBE_C_BLUE);      // touch plate (top)
-    display.fillRect(cx - 7, 164, 14, 30, COLOR_GRAY_TEXT);     // tool
+    gfx->fillRoundRect(5, 128, 230, 142, 4, PROBE_BG_PANEL);
+    gfx->fillRect(cx - 45, 206, 90, 32, COLOR_BUTTON_GRAY);     // workpiece
+    gfx->fillRect(cx - 55, 194, 110, 12, PROBE_C_BLUE);         // touch plate (top)
+    gfx->fillRect(cx - 7, 164, 14, 30, COLOR_GRAY_TEXT);        // tool
 }
 
 // XYZ touch plate: L-shaped corner block wrapping the top-left corner of stock.
 static void drawPlateXYZGraphic() {
     const int cx = kGfxCX;
-    display.fillRoundRect(5, 170, 230, 100, 4, PROBE_BG_PANEL);
-    display.fillRect(cx - 28, 213, 90, 43, COLOR_BUTTON_GRAY);  // workpiece block
-    display.fillRect(cx - 40, 203, 78, 10, PROBE_C_BLUE);       // plate — top arm
-    display.fillRect(cx - 40, 203, 10, 53, PROBE_C_BLUE);       // plate — left arm
-    display.fillRect(cx - 10, 180, 12, 23, COLOR_GRAY_TEXT);    // tool
+    gfx->fillRoundRect(5, 170, 230, 100, 4, PROBE_BG_PANEL);
+    gfx->fillRect(cx - 28, 213, 90, 43, COLOR_BUTTON_GRAY);     // workpiece block
+    gfx->fillRect(cx - 40, 203, 78, 10, PROBE_C_BLUE);          // plate — top arm
+    gfx->fillRect(cx - 40, 203, 10, 53, PROBE_C_BLUE);          // plate — left arm
+    gfx->fillRect(cx - 10, 180, 12, 23, COLOR_GRAY_TEXT);       // tool
 }
 
 // ══════════════════════════════════════════════════════════════════════════════
@@ -86,30 +86,30 @@ void exitProbeCfg3D() { g_calCapture = false; }
 // buttons: 0 = none (busy), 1 = single OK (dismiss), 2 = CANCEL + affirmative
 static void drawCalOverlay(const char* l1, const char* l2, uint16_t l2col, int buttons,
                            const char* okLabel = "APPLY") {
-    display.fillRoundRect(20, 100, 200, 120, 8, PROBE_BG_PANEL);
-    display.drawRoundRect(20, 100, 200, 120, 8, PROBE_C_YELLOW);
-    display.setTextSize(1);
-    display.setTextColor(PROBE_C_YELLOW);
-    int16_t w1 = display.textWidth(l1);
-    display.setCursor(120 - w1 / 2, 118);
-    display.print(l1);
-    display.setTextSize(2);
-    display.setTextColor(l2col);
-    int16_t w2 = display.textWidth(l2);
-    display.setCursor(120 - w2 / 2, 140);   // centre the size-2 line
-    display.print(l2);
-    display.setTextSize(2);
-    display.setTextColor(COLOR_WHITE);
+    gfx->fillRoundRect(20, 100, 200, 120, 8, PROBE_BG_PANEL);
+    gfx->drawRoundRect(20, 100, 200, 120, 8, PROBE_C_YELLOW);
+    gfx->setTextSize(1);
+    gfx->setTextColor(PROBE_C_YELLOW);
+    int16_t w1 = gfx->textWidth(l1);
+    gfx->setCursor(120 - w1 / 2, 118);
+    gfx->print(l1);
+    gfx->setTextSize(2);
+    gfx->setTextColor(l2col);
+    int16_t w2 = gfx->textWidth(l2);
+    gfx->setCursor(120 - w2 / 2, 140);      // centre the size-2 line
+    gfx->print(l2);
+    gfx->setTextSize(2);
+    gfx->setTextColor(COLOR_WHITE);
     if (buttons == 2) {
-        display.fillRoundRect(28,  175, 78, 32, 5, COLOR_BUTTON_GRAY);   // CANCEL
-        display.fillRoundRect(114, 175, 98, 32, 5, PROBE_BTN_GREEN);     // affirmative
-        display.setCursor(36, 183);  display.print("CANCEL");
-        int16_t aw = display.textWidth(okLabel);
-        display.setCursor(114 + (98 - aw) / 2, 183);  display.print(okLabel);
+        gfx->fillRoundRect(28,  175, 78, 32, 5, COLOR_BUTTON_GRAY);      // CANCEL
+        gfx->fillRoundRect(114, 175, 98, 32, 5, PROBE_BTN_GREEN);        // affirmative
+        gfx->setCursor(36, 183);  gfx->print("CANCEL");
+        int16_t aw = gfx->textWidth(okLabel);
+        gfx->setCursor(114 + (98 - aw) / 2, 183);  gfx->print(okLabel);
     } else if (buttons == 1) {
-        display.fillRoundRect(71, 175, 98, 32, 5, PROBE_BTN_BLUE);       // OK / dismiss
-        int16_t ow = display.textWidth("OK");
-        display.setCursor(71 + (98 - ow) / 2, 183);  display.print("OK");
+        gfx->fillRoundRect(71, 175, 98, 32, 5, PROBE_BTN_BLUE);          // OK / dismiss
+        int16_t ow = gfx->textWidth("OK");
+        gfx->setCursor(71 + (98 - ow) / 2, 183);  gfx->print("OK");
     }
 }
 
@@ -131,32 +131,32 @@ void updateProbeCfg3DFields() {
 }
 
 void drawProbeCfg3DScreen() {
-    display.fillScreen(PROBE_BG_SCREEN);
+    gfx->fillScreen(PROBE_BG_SCREEN);
     drawTitle("PROBE CONFIG");
 
     // ── Hardware panel (static info) ──────────────────────────────────────
-    display.fillRoundRect(5, 38, 230, 26, 4, PROBE_BG_PANEL);
-    display.setTextSize(1);
-    display.setTextColor(PROBE_C_LBLUE);
-    display.setCursor(10, 41);
-    display.print("PROBE HARDWARE");
-    display.setTextColor(PROBE_C_GREEN);
-    display.setCursor(10, 53);
-    display.print("3D Touch Probe");
+    gfx->fillRoundRect(5, 38, 230, 26, 4, PROBE_BG_PANEL);
+    gfx->setTextSize(1);
+    gfx->setTextColor(PROBE_C_LBLUE);
+    gfx->setCursor(10, 41);
+    gfx->print("PROBE HARDWARE");
+    gfx->setTextColor(PROBE_C_GREEN);
+    gfx->setCursor(10, 53);
+    gfx->print("3D Touch Probe");
 
     // ── Stylus panel (Ball dia · Deflection) ─────────────────────────────
-    display.fillRoundRect(5, 67, 230, 55, 4, PROBE_BG_PANEL);
-    display.setTextSize(1);
-    display.setTextColor(PROBE_C_LBLUE);
-    display.setCursor(10, 70);
-    display.print("STYLUS");
+    gfx->fillRoundRect(5, 67, 230, 55, 4, PROBE_BG_PANEL);
+    gfx->setTextSize(1);
+    gfx->setTextColor(PROBE_C_LBLUE);
+    gfx->setCursor(10, 70);
+    gfx->print("STYLUS");
 
     // ── Deflection-calibration panel (field spaced like the Stylus panel) ─
-    display.fillRoundRect(5, 128, 230, 55, 4, PROBE_BG_PANEL);
-    display.setTextSize(1);
-    display.setTextColor(PROBE_C_LBLUE);
-    display.setCursor(10, 131);
-    display.print("DEFLECTION CAL");
+    gfx->fillRoundRect(5, 128, 230, 55, 4, PROBE_BG_PANEL);
+    gfx->setTextSize(1);
+    gfx->setTextColor(PROBE_C_LBLUE);
+    gfx->setCursor(10, 131);
+    gfx->print("DEFLECTION CAL");
 
     drawButton(122, 140, 111, 40, "Calibrate", PROBE_BTN_BLUE, COLOR_WHITE, 2);
 
@@ -243,24 +243,30 @@ static void runProbeCalibration() {
     send_line("G90 G0 X#<sx> Y#<sy> F1000");
 }
 
+// Safety timeout for a calibration run that never finishes.
+#define CAL_DEADLINE_MS 90000UL
+
+static void calExpired(void* /*ctx*/) {
+    if (pendantProbeV2.calState != 1) return;
+    g_calCapture            = false;
+    pendantProbeV2.calState = 3;
+    if (currentPendantScreen == PSCREEN_PROBE_CFG_3D) drawCurrentPendantScreen();
+}
+
 // Poll the calibration flow: fired from the periodic update while calState==1.
 void updateProbeCfg3DScreen() {
     if (currentPendantScreen != PSCREEN_PROBE_CFG_3D) return;
     if (pendantProbeV2.calState != 1) return;
 
     if (!g_calAllOk) {                                      // a probe missed contact
+        ui_timer_cancel(pendantProbeV2.calDeadline);
         g_calCapture = false;
         pendantProbeV2.calState = 3;
-        drawProbeCfg3DScreen();
-        return;
-    }
-    if (millis() - pendantProbeV2.calStartMs > 90000UL) {   // safety timeout
-        g_calCapture = false;
-        pendantProbeV2.calState = 3;
-        drawProbeCfg3DScreen();
+        drawCurrentPendantScreen();
         return;
     }
     if (g_calCount >= 5) {                                  // Z + 2 two-pass faces done
+        ui_timer_cancel(pendantProbeV2.calDeadline);
         g_calCapture = false;
         int c = g_calCount;
         float x1u = g_calProbeXe4[c - 3] / 10000.0f;        // left slow re-probe
@@ -272,7 +278,7 @@ void updateProbeCfg3DScreen() {
         float defl = ((x2 - x1) - pendantProbeV2.calGaugeWidth - pendantProbeV2.ballDia) / 2.0f;
         pendantProbeV2.calResult = constrain(defl, -1.0f, 1.0f);
         pendantProbeV2.calState  = 2;                       // → result/confirm overlay
-        drawProbeCfg3DScreen();
+        drawCurrentPendantScreen();
     }
 }
 
@@ -280,27 +286,27 @@ void handleProbeCfg3DTouch(int x, int y) {
     // ── Calibration overlay is modal ──────────────────────────────────────
     if (pendantProbeV2.calState == 4) {                    // confirm: CANCEL | START
         if (isTouchInBounds(x, y, 28, 175, 78, 32)) {      // CANCEL
-            pendantProbeV2.calState = 0; drawProbeCfg3DScreen();
+            pendantProbeV2.calState = 0; drawCurrentPendantScreen();
         } else if (isTouchInBounds(x, y, 114, 175, 98, 32)) {  // START
             pendantProbeV2.calState   = 1;
-            pendantProbeV2.calStartMs = millis();
-            drawProbeCfg3DScreen();       // show the CALIBRATING overlay first
+            ui_timer_arm(pendantProbeV2.calDeadline, CAL_DEADLINE_MS, calExpired);
+            drawCurrentPendantScreen();   // show the CALIBRATING overlay first
             runProbeCalibration();
         }
         return;
     }
     if (pendantProbeV2.calState == 2) {                    // result: CANCEL | APPLY
         if (isTouchInBounds(x, y, 28, 175, 78, 32)) {      // CANCEL
-            pendantProbeV2.calState = 0; drawProbeCfg3DScreen();
+            pendantProbeV2.calState = 0; drawCurrentPendantScreen();
         } else if (isTouchInBounds(x, y, 114, 175, 98, 32)) {  // APPLY
             pendantProbeV2.deflection = pendantProbeV2.calResult;
             saveProbeSettings();
-            pendantProbeV2.calState = 0; drawProbeCfg3DScreen();
+            pendantProbeV2.calState = 0; drawCurrentPendantScreen();
         }
         return;
     }
     if (pendantProbeV2.calState == 3) {                    // error: OK dismiss
-        if (isTouchInBounds(x, y, 71, 175, 98, 32)) { pendantProbeV2.calState = 0; drawProbeCfg3DScreen(); }
+        if (isTouchInBounds(x, y, 71, 175, 98, 32)) { pendantProbeV2.calState = 0; drawCurrentPendantScreen(); }
         return;
     }
     if (pendantProbeV2.calState == 1) return;              // busy — ignore taps
@@ -310,13 +316,13 @@ void handleProbeCfg3DTouch(int x, int y) {
     if (isTouchInBounds(x, y,  7,  79, 112, 40)) { pendantProbeV2.focusedField = (pendantProbeV2.focusedField == 0) ? -1 : 0; redraw = true; }
     if (isTouchInBounds(x, y, 122,  79, 111, 40)) { pendantProbeV2.focusedField = (pendantProbeV2.focusedField == 1) ? -1 : 1; redraw = true; }
     if (isTouchInBounds(x, y,  7, 140, 112, 40)) { pendantProbeV2.focusedField = (pendantProbeV2.focusedField == 2) ? -1 : 2; redraw = true; }
-    if (redraw) { drawProbeCfg3DScreen(); return; }
+    if (redraw) { drawCurrentPendantScreen(); return; }
 
     // ── Calibrate button → confirm first (motion safety) ──────────────────
     if (isTouchInBounds(x, y, 122, 140, 111, 40)) {
-        if (!pendantConnected) { pendantProbeV2.calState = 3; drawProbeCfg3DScreen(); return; }
+        if (!pendantConnected) { pendantProbeV2.calState = 3; drawCurrentPendantScreen(); return; }
         pendantProbeV2.calState = 4;     // ask before any motion
-        drawProbeCfg3DScreen();
+        drawCurrentPendantScreen();
         return;
     }
 
@@ -376,29 +382,29 @@ void updateProbeCfgPlateFields() {
 }
 
 void drawProbeCfgPlateScreen() {
-    display.fillScreen(PROBE_BG_SCREEN);
+    gfx->fillScreen(PROBE_BG_SCREEN);
     drawTitle("PROBE CONFIG");
 
     bool xyz = (pendantProbeV2.probeTypeIdx == PROBE_TYPE_XYZPLATE);
 
     // ── Type panel (static info — the probe type is shown here, so the title
     //    can stay generic "Probe Config") ──────────────────────────────────
-    display.fillRoundRect(5, 38, 230, 26, 4, PROBE_BG_PANEL);
-    display.setTextSize(1);
-    display.setTextColor(PROBE_C_LBLUE);
-    display.setCursor(10, 41);
-    display.print("PROBE TYPE");
-    display.setTextColor(PROBE_C_GREEN);
-    display.setCursor(10, 53);
-    display.print(xyz ? "XYZ Touch Plate" : "Z-Height Touch Plate");
+    gfx->fillRoundRect(5, 38, 230, 26, 4, PROBE_BG_PANEL);
+    gfx->setTextSize(1);
+    gfx->setTextColor(PROBE_C_LBLUE);
+    gfx->setCursor(10, 41);
+    gfx->print("PROBE TYPE");
+    gfx->setTextColor(PROBE_C_GREEN);
+    gfx->setCursor(10, 53);
+    gfx->print(xyz ? "XYZ Touch Plate" : "Z-Height Touch Plate");
 
     // ── Dimensions panel ──────────────────────────────────────────────────
     int panelH = xyz ? 98 : 55;
-    display.fillRoundRect(5, 67, 230, panelH, 4, PROBE_BG_PANEL);
-    display.setTextSize(1);
-    display.setTextColor(PROBE_C_LBLUE);
-    display.setCursor(10, 70);
-    display.print(xyz ? "PLATE DIMENSIONS" : "PLATE THICKNESS");
+    gfx->fillRoundRect(5, 67, 230, panelH, 4, PROBE_BG_PANEL);
+    gfx->setTextSize(1);
+    gfx->setTextColor(PROBE_C_LBLUE);
+    gfx->setCursor(10, 70);
+    gfx->print(xyz ? "PLATE DIMENSIONS" : "PLATE THICKNESS");
 
     updateProbeCfgPlateFields();
 
@@ -422,7 +428,7 @@ void handleProbeCfgPlateTouch(int x, int y) {
         if (isTouchInBounds(x, y,   7, 122, 112, 40)) { pendantProbeV2.focusedField = (pendantProbeV2.focusedField == 2) ? -1 : 2; redraw = true; }
         if (isTouchInBounds(x, y, 122, 122, 111, 40)) { pendantProbeV2.focusedField = (pendantProbeV2.focusedField == 3) ? -1 : 3; redraw = true; }
     }
-    if (redraw) { drawProbeCfgPlateScreen(); return; }
+    if (redraw) { drawCurrentPendantScreen(); return; }
 
     // Setup — return to SCR0 without saving
     if (isTouchInBounds(x, y, 5, 280, 112, 40)) {
@@ -139,19 +139,19 @@ static const char* cornerLabels[] = { "Bot-Left", "Bot-Right", "Top-Left", "Top-
 // Top-down diagram of corner probing: a workpiece corner with arrows probing the
 // X and Y edges, and a dot marking the found corner.
 static void drawCornerDiagram() {
-    display.fillRect(20, 182, 38, 22, PROBE_C_DIMBLUE);   // workpiece (corner top-right)
+    gfx->fillRect(20, 182, 38, 22, PROBE_C_DIMBLUE);      // workpiece (corner top-right)
     // Probe body/stem + stylus descending onto the corner
-    display.fillRoundRect(53, 141, 10, 12, 2, PROBE_C_LBLUE);
-    display.drawLine(58, 152, 58, 180, PROBE_C_YELLOW);
-    display.fillCircle(58, 182, 2, PROBE_C_YELLOW);       // probe ball at the corner
+    gfx->fillRoundRect(53, 141, 10, 12, 2, PROBE_C_LBLUE);
+    gfx->drawLine(58, 152, 58, 180, PROBE_C_YELLOW);
+    gfx->fillCircle(58, 182, 2, PROBE_C_YELLOW);          // probe ball at the corner
     // X probe → toward the right edge
-    display.drawLine(80, 192, 61, 192, PROBE_C_GREEN);
-    display.drawLine(61, 192, 65, 189, PROBE_C_GREEN);
-    display.drawLine(61, 192, 65, 195, PROBE_C_GREEN);
+    gfx->drawLine(80, 192, 61, 192, PROBE_C_GREEN);
+    gfx->drawLine(61, 192, 65, 189, PROBE_C_GREEN);
+    gfx->drawLine(61, 192, 65, 195, PROBE_C_GREEN);
     // Y probe → toward the top edge
-    display.drawLine(40, 164, 40, 177, PROBE_C_GREEN);
-    display.drawLine(40, 177, 37, 173, PROBE_C_GREEN);
-    display.drawLine(40, 177, 43, 173, PROBE_C_GREEN);
+    gfx->drawLine(40, 164, 40, 177, PROBE_C_GREEN);
+    gfx->drawLine(40, 177, 37, 173, PROBE_C_GREEN);
+    gfx->drawLine(40, 177, 43, 173, PROBE_C_GREEN);
 }
 
 // Layout (boss style):
@@ -172,52 +172,57 @@ void updateProbeCornerFields() {
     probeDrawKVTouch(122, 183, 111, 31, "XY retract",  pendantProbeV2.cornerRetXY, "mm", PROBE_C_BLUE, fo==2, 3);
 }
 
-void drawProbeCornerScreen() {
-    display.fillScreen(PROBE_BG_SCREEN);
-    drawTitle("XYZ CORNER");
-    probeDrawPosPanel(38);
+static void drawProbeCornerChrome() {
+    gfx->fillScreen(PROBE_BG_SCREEN);
+    drawTitleBar("XYZ CORNER");
 
-    display.fillRoundRect(5, 70, 230, 146, 4, PROBE_BG_PANEL);
+    gfx->fillRoundRect(5, 70, 230, 146, 4, PROBE_BG_PANEL);
 
     // Left column: sequence + diagram
-    display.setTextSize(1);
-    display.setTextColor(PROBE_C_LBLUE);
-    display.setCursor(10, 73);
-    display.print("SEQUENCE");
+    gfx->setTextSize(1);
+    gfx->setTextColor(PROBE_C_LBLUE);
+    gfx->setCursor(10, 73);
+    gfx->print("SEQUENCE");
     drawSeqStep( 8, 87,  1, "Touch top->Z0", true);
     drawSeqStep( 8, 105, 2, "Probe X & Y",   false);
     drawSeqStep( 8, 123, 3, "Set X0 Y0 Z0",  false);
     drawCornerDiagram();
 
     // Right column: settings
-    display.setTextSize(1);
-    display.setTextColor(PROBE_C_LBLUE);
-    display.setCursor(122, 73);
-    display.print("SETTINGS");
-
-    // Corner selector (tap to cycle) — top of the right column, drawn in the
-    // shared tappable-field style (TAPBDR border; yellow is reserved for focus).
-    // The result line was removed: sequence step 3 already reads "Set X0 Y0 Z0",
-    // freeing the space so all four controls get taller, evenly spaced targets.
-    display.fillRoundRect(122, 84, 111, 31, 2, PROBE_BG_SCREEN);
-    display.drawRoundRect(122, 84, 111, 31, 2, PROBE_C_TAPBDR);
-    display.setTextColor(PROBE_C_LBLUE);
-    display.setCursor(125, 87);
-    display.print("CORNER");
-    display.setTextColor(PROBE_C_BLUE);
-    display.setCursor(125, 101);
-    display.print(cornerLabels[pendantProbeV2.cornerIdx]);
-
-    updateProbeCornerFields();
+    gfx->setTextSize(1);
+    gfx->setTextColor(PROBE_C_LBLUE);
+    gfx->setCursor(122, 73);
+    gfx->print("SETTINGS");
 
     probeDrawWarn(220, "! Position probe above corner edge");
 
     // Bottom-nav row: Back (left) | work-area selector (right)
     drawButton(5, 239, 112, 38, "Back", PROBE_BTN_BLUE, COLOR_WHITE, 2);
-    probeDrawWorkAreaButton(123, 239, 112, 38);
 
     drawButton(  5, 280, 112, 38, "Main Menu", PROBE_BTN_BLUE,  COLOR_WHITE, 2);
     drawButton(123, 280, 112, 38, "Probe",     PROBE_BTN_GREEN, COLOR_WHITE, 2);
+}
+
+void drawProbeCornerScreen() {
+    drawChrome(drawProbeCornerChrome);
+    drawTitleIcons();
+    probeDrawPosPanel(38);
+
+    // Corner selector (tap to cycle) — top of the right column, drawn in the
+    // shared tappable-field style (TAPBDR border; yellow is reserved for focus).
+    // The result line was removed: sequence step 3 already reads "Set X0 Y0 Z0",
+    // freeing the space so all four controls get taller, evenly spaced targets.
+    gfx->fillRoundRect(122, 84, 111, 31, 2, PROBE_BG_SCREEN);
+    gfx->drawRoundRect(122, 84, 111, 31, 2, PROBE_C_TAPBDR);
+    gfx->setTextColor(PROBE_C_LBLUE);
+    gfx->setCursor(125, 87);
+    gfx->print("CORNER");
+    gfx->setTextColor(PROBE_C_BLUE);
+    gfx->setCursor(125, 101);
+    gfx->print(cornerLabels[pendantProbeV2.cornerIdx]);
+
+    updateProbeCornerFields();
+    probeDrawWorkAreaButton(123, 239, 112, 38);
 
     if (pendantProbeV2.confirmActive)
         probeDrawConfirmOverlay("XYZ CORNER");
@@ -232,7 +237,7 @@ void handleProbeCornerTouch(int x, int y) {
     if (pendantProbeV2.confirmActive) {
         if (isTouchInBounds(x, y, 28, 175, 78, 32)) {
             pendantProbeV2.confirmActive = false;
-            drawProbeCornerScreen();
+            drawCurrentPendantScreen();
         } else if (isTouchInBounds(x, y, 114, 175, 98, 32)) {
             pendantProbeV2.confirmActive = false;
             runProbeCorner();
@@ -244,7 +249,7 @@ void handleProbeCornerTouch(int x, int y) {
     // CORNER cycle button (top of right column)
     if (isTouchInBounds(x, y, 122, 84, 111, 31)) {
         pendantProbeV2.cornerIdx = (pendantProbeV2.cornerIdx + 1) % 4;
-        drawProbeCornerScreen();
+        drawCurrentPendantScreen();
         return;
     }
 
@@ -253,7 +258,7 @@ void handleProbeCornerTouch(int x, int y) {
     if (isTouchInBounds(x, y, 122, 117, 111, 31)) { pendantProbeV2.focusedField = (pendantProbeV2.focusedField==0)?-1:0; redraw=true; }
     if (isTouchInBounds(x, y, 122, 150, 111, 31)) { pendantProbeV2.focusedField = (pendantProbeV2.focusedField==1)?-1:1; redraw=true; }
     if (isTouchInBounds(x, y, 122, 183, 111, 31)) { pendantProbeV2.focusedField = (pendantProbeV2.focusedField==2)?-1:2; redraw=true; }
-    if (redraw) { drawProbeCornerScreen(); return; }
+    if (redraw) { drawCurrentPendantScreen(); return; }
 
     // Back → config hub
     if (isTouchInBounds(x, y, 5, 239, 112, 38)) {
@@ -264,7 +269,7 @@ void handleProbeCornerTouch(int x, int y) {
     // Work-area selector → cycle G54..G57
     if (isTouchInBounds(x, y, 123, 239, 112, 38)) {
         probeCycleWorkArea();
-        drawProbeCornerScreen();
+        drawCurrentPendantScreen();
         return;
     }
 
@@ -277,7 +282,7 @@ void handleProbeCornerTouch(int x, int y) {
     if (isTouchInBounds(x, y, 123, 280, 112, 38)) {
         if (!pendantConnected) { probeDrawWarn(220, "! Not connected", true); return; }
         pendantProbeV2.confirmActive = true;
-        drawProbeCornerScreen();
+        drawCurrentPendantScreen();
         return;
     }
 }
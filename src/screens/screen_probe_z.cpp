@@ -75,15 +75,15 @@ static void drawZParamButton(int x, int y, int w, int h,
     uint16_t bg  = focused ? PROBE_SEL_BG   : PROBE_BG_SCREEN;
     uint16_t bdr = focused ? PROBE_C_YELLOW : PROBE_C_TAPBDR;
     uint16_t vc  = focused ? PROBE_C_YELLOW : PROBE_C_BLUE;
-    display.fillRoundRect(x, y, w, h, 8, bg);
-    display.drawRoundRect(x, y, w, h, 8, bdr);
+    gfx->fillRoundRect(x, y, w, h, 8, bg);
+    gfx->drawRoundRect(x, y, w, h, 8, bdr);
 
     // Label (small, vertically centred in top half)
-    display.setTextSize(1);
-    display.setTextColor(focused ? COLOR_WHITE : PROBE_C_LBLUE);
-    int16_t lw = display.textWidth(label);
-    display.setCursor(x + (w - lw) / 2, y + 5);
-    display.print(label);
+    gfx->setTextSize(1);
+    gfx->setTextColor(focused ? COLOR_WHITE : PROBE_C_LBLUE);
+    int16_t lw = gfx->textWidth(label);
+    gfx->setCursor(x + (w - lw) / 2, y + 5);
+    gfx->print(label);
 
     // Value (large, bottom)
     char valBuf[16];
@@ -91,24 +91,24 @@ static void drawZParamButton(int x, int y, int w, int h,
         snprintf(valBuf, sizeof(valBuf), "%.3f in", valueMm / 25.4f);
     else
         snprintf(valBuf, sizeof(valBuf), "%.0f mm", valueMm);
-    display.setTextSize(2);
-    display.setTextColor(vc);
-    int16_t vw = display.textWidth(valBuf);
-    display.setCursor(x + (w - vw) / 2, y + 17);
-    display.print(valBuf);
+    gfx->setTextSize(2);
+    gfx->setTextColor(vc);
+    int16_t vw = gfx->textWidth(valBuf);
+    gfx->setCursor(x + (w - vw) / 2, y + 17);
+    gfx->print(valBuf);
 }
 
 // Side-view diagram of a Z-surface probe: stylus descending onto the work
 // surface, with a down arrow showing the probe direction.
 static void drawZDiagram() {
-    display.fillRect(22, 192, 76, 10, PROBE_C_DIMBLUE);   // work surface
-    display.fillRoundRect(55, 150, 10, 12, 2, PROBE_C_LBLUE);  // probe body/stem
-    display.drawLine(60, 161, 60, 189, PROBE_C_YELLOW);   // stylus
-    display.fillCircle(60, 191, 2, PROBE_C_YELLOW);       // ball touching surface
+    gfx->fillRect(22, 192, 76, 10, PROBE_C_DIMBLUE);      // work surface
+    gfx->fillRoundRect(55, 150, 10, 12, 2, PROBE_C_LBLUE);     // probe body/stem
+    gfx->drawLine(60, 161, 60, 189, PROBE_C_YELLOW);      // stylus
+    gfx->fillCircle(60, 191, 2, PROBE_C_YELLOW);          // ball touching surface
     // Probe direction (down arrow beside the stylus)
-    display.drawLine(42, 166, 42, 184, PROBE_C_GREEN);    // shaft
-    display.drawLine(42, 184, 39, 180, PROBE_C_GREEN);    // head
-    display.drawLine(42, 184, 45, 180, PROBE_C_GREEN);
+    gfx->drawLine(42, 166, 42, 184, PROBE_C_GREEN);       // shaft
+    gfx->drawLine(42, 184, 39, 180, PROBE_C_GREEN);       // head
+    gfx->drawLine(42, 184, 45, 180, PROBE_C_GREEN);
 }
 
 // Redraws ONLY the Z-Surface settings fields (opaque boxes) — used by the full
@@ -120,38 +120,36 @@ void updateProbeZFields() {
     drawZParamButton(122, 120, 111, 33, "Retract dist", pendantProbeV2.retractDist, fo==1);
 }
 
-void drawProbeZScreen() {
-    display.fillScreen(PROBE_BG_SCREEN);
-    drawTitle("Z SURFACE");
-    probeDrawPosPanel(38);
+static void drawProbeZChrome() {
+    gfx->fillScreen(PROBE_BG_SCREEN);
+    drawTitleBar("Z SURFACE");
 
     // Combined panel: sequence + diagram (left) / settings (right) — boss style.
-    display.fillRoundRect(5, 70, 230, 146, 4, PROBE_BG_PANEL);
+    gfx->fillRoundRect(5, 70, 230, 146, 4, PROBE_BG_PANEL);
 
     // Left column: sequence + diagram
-    display.setTextSize(1);
-    display.setTextColor(PROBE_C_LBLUE);
-    display.setCursor(10, 73);
-    display.print("SEQUENCE");
+    gfx->setTextSize(1);
+    gfx->setTextColor(PROBE_C_LBLUE);
+    gfx->setCursor(10, 73);
+    gfx->print("SEQUENCE");
     drawSeqStep( 8, 87,  1, "Fast seek -Z",  true);
     drawSeqStep( 8, 105, 2, "Slow re-probe", false);
     drawSeqStep( 8, 123, 3, "Set Z0",        false);
     drawZDiagram();
 
     // Right column: settings
-    display.setTextSize(1);
-    display.setTextColor(PROBE_C_LBLUE);
-    display.setCursor(122, 73);
-    display.print("SETTINGS");
-    updateProbeZFields();
+    gfx->setTextSize(1);
+    gfx->setTextColor(PROBE_C_LBLUE);
+    gfx->setCursor(122, 73);
+    gfx->print("SETTINGS");
 
     // Result line — what the probe will set
     {
         const char* s = "Sets Z0";
-        display.setTextSize(1);
-        display.setTextColor(PROBE_C_GREEN);
-        display.setCursor(177 - display.textWidth(s) / 2, 166);
-        display.print(s);
+        gfx->setTextSize(1);
+        gfx->setTextColor(PROBE_C_GREEN);
+        gfx->setCursor(177 - gfx->textWidth(s) / 2, 166);
+        gfx->print(s);
     }
 
     // Warning — same height/placement as the Boss screen (type-aware).
@@ -160,11 +158,18 @@ void drawProbeZScreen() {
 
     // Bottom-nav row: Back (left) | work-area selector (right)
     drawButton(5, 239, 112, 38, "Back", PROBE_BTN_BLUE, COLOR_WHITE, 2);
-    probeDrawWorkAreaButton(123, 239, 112, 38);
 
     // Bottom buttons: Main Menu | Probe
     drawButton(  5, 280, 112, 38, "Main Menu", PROBE_BTN_BLUE,  COLOR_WHITE, 2);
     drawButton(123, 280, 112, 38, "Probe",     PROBE_BTN_GREEN, COLOR_WHITE, 2);
+}
+
+void drawProbeZScreen() {
+    drawChrome(drawProbeZChrome, probeIs3D());   // the warning line is type-aware
+    drawTitleIcons();
+    probeDrawPosPanel(38);
+    updateProbeZFields();
+    probeDrawWorkAreaButton(123, 239, 112, 38);
 
     if (pendantProbeV2.confirmActive)
         probeDrawConfirmOverlay("Z SURFACE");
@@ -181,7 +186,7 @@ void handleProbeZTouch(int x, int y) {
         if (isTouchInBounds(x, y, 28, 175, 78, 32)) {
             // CANCEL
             pendantProbeV2.confirmActive = false;
-            drawProbeZScreen();
+            drawCurrentPendantScreen();
         } else if (isTouchInBounds(x, y, 114, 175, 98, 32)) {
             // CONFIRM — run probe
             pendantProbeV2.confirmActive = false;
@@ -194,13 +199,13 @@ void handleProbeZTouch(int x, int y) {
     // Max Z travel — tap to focus/unfocus
     if (isTouchInBounds(x, y, 122, 84, 111, 33)) {
         pendantProbeV2.focusedField = (pendantProbeV2.focusedField == 0) ? -1 : 0;
-        drawProbeZScreen();
+        drawCurrentPendantScreen();
         return;
     }
     // Retract dist — tap to focus/unfocus
     if (isTouchInBounds(x, y, 122, 120, 111, 33)) {
         pendantProbeV2.focusedField = (pendantProbeV2.focusedField == 1) ? -1 : 1;
-        drawProbeZScreen();
+        drawCurrentPendantScreen();
         return;
     }
 
@@ -213,7 +218,7 @@ void handleProbeZTouch(int x, int y) {
     // Work-area selector → cycle G54..G57
     if (isTouchInBounds(x, y, 123, 239, 112, 38)) {
         probeCycleWorkArea();
-        drawProbeZScreen();
+        drawCurrentPendantScreen();
         return;
     }
 
@@ -230,7 +235,7 @@ void handleProbeZTouch(int x, int y) {
             return;
         }
         pendantProbeV2.confirmActive = true;
-        drawProbeZScreen();
+        drawCurrentPendantScreen();
         return;
     }
 }
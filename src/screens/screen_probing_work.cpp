@@ -3,13 +3,11 @@
 
 void enterProbingWork() {
     releasePanelSprites();
-    // These panels fill with COLOR_BACKGROUND (black), which is identical in 8-
-    // and 16-bit — so they keep the cheaper persistent 8-bit allocation (no
-    // rgb332 colour tint to worry about, unlike the grey panels which use the
-    // 16-bit beginPanelSprite scratch).  update*() falls back to direct draw if
+    // These panels are one ink on black, so they get the 2-bit palette sprite
+    // (230 x 45 / 4 = ~2.6 KB each).  update*() falls back to direct draw if
     // allocation fails.
-    allocPanelSprite(spriteAxisDisplay,  230, 45, 40000);
-    allocPanelSprite(spriteValueDisplay, 230, 45);
+    allocMonoPanelSprite(spriteAxisDisplay,  230, 45, COLOR_ORANGE, 40000);
+    allocMonoPanelSprite(spriteValueDisplay, 230, 45, COLOR_CYAN);
 }
 
 void exitProbingWork() {
@@ -17,33 +15,25 @@ void exitProbingWork() {
     spriteValueDisplay.deleteSprite();
 }
 
-void drawProbingWorkScreen() {
-    display.fillScreen(COLOR_BACKGROUND);
-    drawTitle("WORK AREA");
-
-    display.setTextColor(COLOR_GRAY_TEXT);
-    display.setTextSize(1);
-    display.setCursor(5, 43);
-    display.print("COORDINATE SYSTEM");
-
-    redrawWorkCoordButtons();
+static void drawProbingWorkChrome() {
+    gfx->fillScreen(COLOR_BACKGROUND);
+    drawTitleBar("WORK AREA");
 
-    display.setTextColor(COLOR_GRAY_TEXT);
-    display.setTextSize(1);
-    display.setCursor(5, 100);
-    display.print("MACHINE POS");
-    updateWorkMachinePos();
-
-    display.setTextColor(COLOR_GRAY_TEXT);
-    display.setTextSize(1);
-    display.setCursor(5, 158);
-    display.print("WORK POS");
-    updateWorkAreaPos();
-
-    display.setTextColor(COLOR_GRAY_TEXT);
-    display.setTextSize(1);
-    display.setCursor(5, 218);
-    display.print("SET WORK ZERO");
+    gfx->setTextColor(COLOR_GRAY_TEXT);
+    gfx->setTextSize(1);
+    gfx->setCursor(5, 43);
+    gfx->print("COORDINATE SYSTEM");
+    gfx->setCursor(5, 100);
+    const char* hint = pendantProbing.showOffsets ? "tap for positions" : "tap for offsets";
+    gfx->print(pendantProbing.showOffsets ? "WORK OFFSETS" : "MACHINE POS");
+    gfx->setCursor(235 - gfx->textWidth(hint), 100);
+    gfx->print(hint);
+    if (!pendantProbing.showOffsets) {
+        gfx->setCursor(5, 158);
+        gfx->print("WORK POS");
+    }
+    gfx->setCursor(5, 218);
+    gfx->print("SET WORK ZERO");
 
     {
         const char* axisLabels[] = { "X", "Y", "Z", "A" };
@@ -59,11 +49,98 @@ void drawProbingWorkScreen() {
     drawButton(123, 277, 112, 40, "Jog",       COLOR_BLUE, COLOR_WHITE, 2);
 }
 
+void drawProbingWorkScreen() {
+    drawChrome(drawProbingWorkChrome, pendantMachine.numAxes | (pendantProbing.showOffsets ? 0x100 : 0));
+    drawTitleIcons();
+    redrawWorkCoordButtons();
+    if (pendantProbing.showOffsets) {
+        drawWorkOffsets();
+    } else {
+        updateWorkMachinePos();
+        updateWorkAreaPos();
+    }
+}
+
+// ── Offset table ─────────────────────────────────────────────────────────────
+// Shown in place of the two position panels, straight from the local copy of
+// the controller's "$#" parameters (WcsOffsets.h) — no query on the way in.
+// Rows that fit, in order of interest; G59.1-3 only where the firmware has them.
+static const uint8_t kOffsetRows[] = {
+    WCS_G54, WCS_G55, WCS_G56, WCS_G57, WCS_G58, WCS_G59, WCS_G92, WCS_TLO,
+    WCS_G28, WCS_G30, WCS_G59_1, WCS_G59_2, WCS_G59_3,
+};
+#define OFS_Y      110
+#define OFS_H      102
+#define OFS_PITCH  9
+#define OFS_NAME_W 36
+
+static void printOffsetValue(int32_t e4, int right, int colW) {
+    float v   = pendantMachine.inInches ? e4 / 254000.0f : e4 / 10000.0f;
+    int   dec = pendantMachine.inInches ? 4 : 3;
+    char  buf[16];
+    snprintf(buf, sizeof(buf), "%.*f", dec, v);
+    while (dec > 0 && gfx->textWidth(buf) > colW - 4) {  // wide values give up decimals
+        snprintf(buf, sizeof(buf), "%.*f", --dec, v);
+    }
+    gfx->setCursor(right - gfx->textWidth(buf), gfx->getCursorY());
+    gfx->print(buf);
+}
+
+void drawWorkOffsets() {
+    if (currentPendantScreen != PSCREEN_PROBING_WORK || !pendantProbing.showOffsets) return;
+    pendantProbing.drawnOffsetsGen = wcs_generation();
+
+    static const char* const axisNames[] = { "X", "Y", "Z", "A" };
+    int numAx = pendantMachine.numAxes;
+    int colW  = (230 - OFS_NAME_W) / numAx;
+
+    gfx->fillRect(5, OFS_Y, 230, OFS_H, COLOR_BACKGROUND);
+    gfx->setTextSize(1);
+    gfx->setTextColor(COLOR_GRAY_TEXT);
+    for (int i = 0; i < numAx; i++) {
+        gfx->setCursor(5 + OFS_NAME_W + (i + 1) * colW - 2 - gfx->textWidth(axisNames[i]), OFS_Y);
+        gfx->print(axisNames[i]);
+    }
+
+    int y    = OFS_Y + OFS_PITCH + 2;
+    int rows = 0;
+    for (uint8_t id : kOffsetRows) {
+        WcsOffset o;
+        if (!wcs_get(id, o)) continue;
+        if (y + 8 > OFS_Y + OFS_H) break;
+        bool selected = id == WCS_G54 + pendantProbing.selectedCoordIndex;
+        gfx->setTextColor(selected ? COLOR_ORANGE : COLOR_GRAY_TEXT);
+        gfx->setCursor(5, y);
+        gfx->print(wcs_name(id));
+        gfx->setTextColor(selected ? COLOR_ORANGE : COLOR_WHITE);
+        if (id == WCS_TLO) {  // one value, along Z
+            if (numAx > 2) printOffsetValue(o.e4[0], 5 + OFS_NAME_W + 3 * colW - 2, colW);
+        } else {
+            for (int i = 0; i < numAx && i < o.n; i++) {
+                printOffsetValue(o.e4[i], 5 + OFS_NAME_W + (i + 1) * colW - 2, colW);
+            }
+        }
+        y += OFS_PITCH;
+        rows++;
+    }
+    if (!rows) {
+        gfx->setTextColor(COLOR_GRAY_TEXT);
+        gfx->setCursor(5, OFS_Y + 20);
+        gfx->print(pendantConnected ? "Reading offsets..." : "Not connected");
+    }
+}
+
+// Periodic: redraw the table only when an entry actually changed.
+void updateWorkOffsets() {
+    if (currentPendantScreen != PSCREEN_PROBING_WORK || !pendantProbing.showOffsets) return;
+    if (wcs_generation() != pendantProbing.drawnOffsetsGen) drawWorkOffsets();
+}
+
 void updateWorkMachinePos() {
-    if (currentPendantScreen != PSCREEN_PROBING_WORK) return;
+    if (currentPendantScreen != PSCREEN_PROBING_WORK || pendantProbing.showOffsets) return;
 
     const bool hasSprite = spriteAxisDisplay.getBuffer() != nullptr;  // pushed at (5, 108)
-    LovyanGFX*  g  = hasSprite ? (LovyanGFX*)&spriteAxisDisplay : (LovyanGFX*)&display;
+    LovyanGFX*  g  = hasSprite ? (LovyanGFX*)&spriteAxisDisplay : gfx;
     const int   ox = hasSprite ? 0 : 5;
     const int   oy = hasSprite ? 0 : 108;
 
@@ -79,22 +156,22 @@ void updateWorkMachinePos() {
 
     const char* axisNames[] = { "X", "Y", "Z", "A" };
     float       positions[] = { px, py, pz, pa };
-    if (hasSprite) spriteAxisDisplay.fillSprite(COLOR_BACKGROUND);
-    else           display.fillRect(5, 108, 230, 45, COLOR_BACKGROUND);
-    g->setTextColor(COLOR_ORANGE);
+    if (hasSprite) spriteAxisDisplay.fillSprite(panelInk(g, COLOR_BACKGROUND));
+    else           gfx->fillRect(5, 108, 230, 45, COLOR_BACKGROUND);
+    g->setTextColor(panelInk(g, COLOR_ORANGE));
     g->setTextSize(2);
     for (int i = 0; i < pendantMachine.numAxes; i++) {
         g->setCursor(ox + ((i % 2) ? 120 : 0), oy + 5 + (i / 2) * 20);
         g->print(axisNames[i]); g->print(":"); g->print(positions[i], 1);
     }
-    if (hasSprite) spriteAxisDisplay.pushSprite(5, 108);
+    if (hasSprite) spriteAxisDisplay.pushSprite(gfx, 5, 108);
 }
 
 void updateWorkAreaPos() {
-    if (currentPendantScreen != PSCREEN_PROBING_WORK) return;
+    if (currentPendantScreen != PSCREEN_PROBING_WORK || pendantProbing.showOffsets) return;
 
     const bool hasSprite = spriteValueDisplay.getBuffer() != nullptr;  // pushed at (5, 166)
-    LovyanGFX*  g  = hasSprite ? (LovyanGFX*)&spriteValueDisplay : (LovyanGFX*)&display;
+    LovyanGFX*  g  = hasSprite ? (LovyanGFX*)&spriteValueDisplay : gfx;
     const int   ox = hasSprite ? 0 : 5;
     const int   oy = hasSprite ? 0 : 166;
 
@@ -110,19 +187,19 @@ void updateWorkAreaPos() {
 
     const char* wAxisNames[] = { "X", "Y", "Z", "A" };
     float       workPos[]    = { wx, wy, wz, wa };
-    if (hasSprite) spriteValueDisplay.fillSprite(COLOR_BACKGROUND);
-    else           display.fillRect(5, 166, 230, 45, COLOR_BACKGROUND);
-    g->setTextColor(COLOR_CYAN);
+    if (hasSprite) spriteValueDisplay.fillSprite(panelInk(g, COLOR_BACKGROUND));
+    else           gfx->fillRect(5, 166, 230, 45, COLOR_BACKGROUND);
+    g->setTextColor(panelInk(g, COLOR_CYAN));
     g->setTextSize(2);
     for (int i = 0; i < pendantMachine.numAxes; i++) {
         g->setCursor(ox + ((i % 2) ? 120 : 0), oy + 5 + (i / 2) * 20);
         g->print(wAxisNames[i]); g->print(":"); g->print(workPos[i], 1);
     }
-    if (hasSprite) spriteValueDisplay.pushSprite(5, 166);
+    if (hasSprite) spriteValueDisplay.pushSprite(gfx, 5, 166);
 }
 
 void redrawWorkCoordButtons() {
-    String coordSystems[] = { "G54", "G55", "G56", "G57" };
+    static const char* const coordSystems[] = { "G54", "G55", "G56", "G57" };
     for (int i = 0; i < 4; i++) {
         uint16_t bg = (i == pendantProbing.selectedCoordIndex) ? COLOR_ORANGE : COLOR_BUTTON_GRAY;
         drawButton(5 + i * 56, 55, 52, 38, coordSystems[i], bg, COLOR_WHITE, 2);
@@ -131,17 +208,25 @@ void redrawWorkCoordButtons() {
 
 void handleProbingWorkTouch(int x, int y) {
     // Coordinate system selection
-    String coords[] = { "G54", "G55", "G56", "G57" };
+    static const char* const coords[] = { "G54", "G55", "G56", "G57" };
     for (int i = 0; i < 4; i++) {
         if (isTouchInBounds(x, y, 5 + i * 56, 55, 52, 38)) {
             pendantProbing.selectedCoordIndex  = i;
             pendantProbing.selectedCoordSystem = coords[i];
             redrawWorkCoordButtons();
-            if (pendantConnected) send_line(coords[i].c_str());
+            drawWorkOffsets();   // move the highlight
+            if (pendantConnected) send_line(coords[i]);
             return;
         }
     }
 
+    // Position panels ⇄ offset table
+    if (isTouchInBounds(x, y, 5, 98, 230, 115)) {
+        pendantProbing.showOffsets = !pendantProbing.showOffsets;
+        drawCurrentPendantScreen();
+        return;
+    }
+
     // Set Work Zero buttons — P number matches selected coord system (G54=P1 … G57=P4)
     {
         const char* axisLabels[] = { "X", "Y", "Z", "A" };
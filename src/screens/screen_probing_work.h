@@ -5,4 +5,6 @@ void drawProbingWorkScreen();
 void updateWorkMachinePos();
 void updateWorkAreaPos();
 void redrawWorkCoordButtons();
+void drawWorkOffsets();
+void updateWorkOffsets();
 void handleProbingWorkTouch(int x, int y);
@@ -1,6 +1,8 @@
 #include "pendant_shared.h"
 #include "screen_sd_card.h"
 #include "../FileParser.h"
+#include "../GcodeStreamer.h"
+#include "job_queue.h"
 
 // Sprite covers the file-list area: x=5..234, y=40..239 (230 x 200 px).
 // Same pattern as screen_macros — prevents fillScreen flicker on STATE_UPDATE.
@@ -8,29 +10,62 @@
 // Forward declarations for the dirty-state tracker (defined below).
 static void invalidateSDRender();
 
-void enterSDCard() {
-    releasePanelSprites();
+// UI safety deadline.  The list request is fire-once (no auto-retry), so if
+// its reply is ever dropped, "Loading…" would otherwise sit forever.  After
+// 10 s, fail it cleanly so the screen invites a manual Refresh instead.
+#define SD_LOAD_DEADLINE_MS 10000
 
-    pendantSdCard.pendingRun = false;
-    invalidateSDRender();  // force the first paint after entry / full redraw
+static void sdLoadExpired(void* /*ctx*/) {
+    if (!pendantSdCard.loading) return;
+    pendantSdCard.loading    = false;
+    pendantSdCard.loadFailed = true;
+    updateSDCardFileList();
+}
 
-    g_expecting_json = false;  // clear any stuck request state from a prior screen
+// Files stored on the pendant itself, for streaming.  A directory scan of
+// LittleFS takes a few ms, so it runs right here rather than as a request.
+static void listPendantFiles() {
+    static char names[20][STREAM_PATH_MAX];
+    ui_timer_cancel(pendantSdCard.loadDeadline);
+    pendantSdCard.loading      = false;
+    pendantSdCard.loadFailed   = false;
+    pendantSdCard.fileCount    = stream_list_files(names, 20);
+    pendantSdCard.scrollOffset = 0;
+    pendantSdCard.selectedFile = 0;
+    for (int i = 0; i < pendantSdCard.fileCount; i++) {
+        pendantSdCard.files[i] = names[i];
+    }
+}
 
-    // Request a fresh file list from the controller
-    if (pendantConnected) {
+// Request a fresh file list from the controller, or rescan the pendant's.
+static void refreshFileList() {
+    if (pendantSdCard.local) {
+        listPendantFiles();
+    } else if (pendantConnected) {
         pendantSdCard.loading      = true;
         pendantSdCard.loadFailed   = false;
-        pendantSdCard.loadStartMs  = millis();   // arm the UI loading deadline
+        ui_timer_arm(pendantSdCard.loadDeadline, SD_LOAD_DEADLINE_MS, sdLoadExpired);
         pendantSdCard.fileCount    = 0;
         pendantSdCard.scrollOffset = 0;
         pendantSdCard.selectedFile = 0;
         request_file_list("/sd");
     }
+}
 
-    // Flicker-free list sprite, now 8-bit (230 x 200 x 1 = ~46 KB, was ~92 KB at
-    // 16-bit) so it allocates far more often.  Falls back to direct draw (slight
-    // flicker, never blank) when heap is too tight.
-    allocPanelSprite(spriteFileDisplay, 230, 200, 60000);
+void enterSDCard() {
+    releasePanelSprites();
+
+    pendantSdCard.pendingRun = false;
+    invalidateSDRender();  // force the first paint after entry / full redraw
+
+    g_expecting_json = false;  // clear any stuck request state from a prior screen
+
+    refreshFileList();
+
+    // Flicker-free list sprite, 4-bit palette (230 x 200 / 2 = ~23 KB, was
+    // ~46 KB at 8-bit) so it allocates far more often.  Falls back to direct draw
+    // (slight flicker, never blank) when heap is too tight.
+    allocPanelSprite(spriteFileDisplay, 230, 200, 40000);
 }
 
 void exitSDCard() {
@@ -48,6 +83,7 @@ struct SdRenderState {
     bool   loading;
     bool   loadFailed;
     bool   pendingRun;
+    bool   local;
     int    fileCount;
     int    scrollOffset;
     int    selectedFile;
@@ -75,15 +111,6 @@ void sdCardListChanged() { _sdListGeneration++; }
 void updateSDCardFileList() {
     if (currentPendantScreen != PSCREEN_SD_CARD) return;
 
-    // UI safety deadline.  The list request is fire-once (no auto-retry), so if
-    // its reply is ever dropped, "Loading…" would otherwise sit forever.  After
-    // 10 s, fail it cleanly so the screen invites a manual Refresh instead.
-    if (pendantSdCard.loading && pendantSdCard.loadStartMs != 0 &&
-        (millis() - pendantSdCard.loadStartMs) > 10000) {
-        pendantSdCard.loading    = false;
-        pendantSdCard.loadFailed = true;
-    }
-
     // Skip the paint if nothing visible has changed since the last call.
     // Eliminates the 100 ms flicker tick in direct-draw mode.
     SdRenderState cur = {
@@ -92,6 +119,7 @@ void updateSDCardFileList() {
         /*loading*/        pendantSdCard.loading,
         /*loadFailed*/     pendantSdCard.loadFailed,
         /*pendingRun*/     pendantSdCard.pendingRun,
+        /*local*/          pendantSdCard.local,
         /*fileCount*/      pendantSdCard.fileCount,
         /*scrollOffset*/   pendantSdCard.scrollOffset,
         /*selectedFile*/   pendantSdCard.selectedFile,
@@ -102,6 +130,7 @@ void updateSDCardFileList() {
         _lastRender.loading        == cur.loading &&
         _lastRender.loadFailed     == cur.loadFailed &&
         _lastRender.pendingRun     == cur.pendingRun &&
+        _lastRender.local          == cur.local &&
         _lastRender.fileCount      == cur.fileCount &&
         _lastRender.scrollOffset   == cur.scrollOffset &&
         _lastRender.selectedFile   == cur.selectedFile &&
@@ -114,33 +143,40 @@ void updateSDCardFileList() {
     // Pick the target canvas.  LGFX_Sprite and LGFX_Device share the
     // LovyanGFX base class, so most drawing calls work on either.
     LovyanGFX* g = hasSprite ? (LovyanGFX*)&spriteFileDisplay
-                             : (LovyanGFX*)&display;
+                             : gfx;
     // Sprite is pushed at (5, 40); direct-draw uses absolute screen coords.
     const int ox = hasSprite ? 0 : 5;
     const int oy = hasSprite ? 0 : 40;
 
     // Clear the area
     if (hasSprite) {
-        spriteFileDisplay.fillSprite(COLOR_BACKGROUND);
+        spriteFileDisplay.fillSprite(panelInk(g, COLOR_BACKGROUND));
     } else {
-        display.fillRect(5, 40, 230, 200, COLOR_BACKGROUND);
+        gfx->fillRect(5, 40, 230, 200, COLOR_BACKGROUND);
     }
 
     if (pendantSdCard.loading) {
-        g->setTextColor(COLOR_GRAY_TEXT);
+        g->setTextColor(panelInk(g, COLOR_GRAY_TEXT));
         g->setTextSize(2);
         g->setCursor(ox + 50, oy + 100);
         g->print("Loading...");
     } else if (pendantSdCard.loadFailed) {
-        g->setTextColor(COLOR_ORANGE);
+        g->setTextColor(panelInk(g, COLOR_ORANGE));
         g->setTextSize(1);
         g->setCursor(ox + 15, oy + 90);
         g->print("Couldn't load file list.");
-        g->setTextColor(COLOR_GRAY_TEXT);
+        g->setTextColor(panelInk(g, COLOR_GRAY_TEXT));
         g->setCursor(ox + 15, oy + 108);
         g->print("Tap Refresh to try again.");
+    } else if (pendantSdCard.fileCount == 0 && pendantSdCard.local) {
+        g->setTextColor(panelInk(g, COLOR_GRAY_TEXT));
+        g->setTextSize(1);
+        g->setCursor(ox + 15, oy + 90);
+        g->print("No GCode files on the pendant.");
+        g->setCursor(ox + 15, oy + 108);
+        g->print("Upload .nc files to its LittleFS.");
     } else if (pendantSdCard.fileCount == 0) {
-        g->setTextColor(COLOR_GRAY_TEXT);
+        g->setTextColor(panelInk(g, COLOR_GRAY_TEXT));
         g->setTextSize(1);
         g->setCursor(ox + 15, oy + 90);
         g->print(pendantConnected ? "No GCode files found." : "Not connected.");
@@ -159,20 +195,20 @@ void updateSDCardFileList() {
             } else {
                 bg = COLOR_BUTTON_GRAY;
             }
-            g->fillRoundRect(ox, oy + i * 40, 230, 36, 8, bg);
-            g->setTextColor(COLOR_WHITE);
+            g->fillRoundRect(ox, oy + i * 40, 230, 36, 8, panelInk(g, bg));
+            g->setTextColor(panelInk(g, COLOR_WHITE));
             g->setTextSize(1);
             g->setCursor(ox + 5, oy + 12 + i * 40);
             g->print(pendantSdCard.files[displayIndex]);
         }
     }
 
-    if (hasSprite) spriteFileDisplay.pushSprite(5, 40);
+    if (hasSprite) spriteFileDisplay.pushSprite(gfx, 5, 40);
 }
 
 void drawSDCardScreen() {
-    display.fillScreen(COLOR_BACKGROUND);
-    drawTitle("SD CARD");
+    gfx->fillScreen(COLOR_BACKGROUND);
+    drawTitle(pendantSdCard.local ? "PENDANT FILES" : "SD CARD");
 
     // Full redraw — invalidate the dirty cache so the file-list area
     // gets painted (fillScreen above just cleared it back to background).
@@ -184,11 +220,21 @@ void drawSDCardScreen() {
     drawButton(83,  242, 72, 36, "Refresh", COLOR_DARK_GREEN,  COLOR_WHITE, 1);
     drawButton(161, 242, 72, 36, ">>",      COLOR_BUTTON_GRAY, COLOR_WHITE, 2);
 
-    if (pendantSdCard.pendingRun) {
-        drawButton(5,   282, 110, 36, "Load", COLOR_BLUE,       COLOR_WHITE, 2);
-        drawButton(121, 282, 114, 36, "Run",  COLOR_DARK_GREEN, COLOR_WHITE, 2);
+    // The job queue runs controller files, so pendant files have no Queue.
+    if (pendantSdCard.pendingRun && pendantSdCard.local) {
+        drawButton(5,   282, 110, 36, "Load",   COLOR_BLUE,       COLOR_WHITE, 2);
+        drawButton(121, 282, 114, 36, "Stream", COLOR_DARK_GREEN, COLOR_WHITE, 2);
+    } else if (pendantSdCard.pendingRun) {
+        drawButton(5,   282, 72, 36, "Load",  COLOR_BLUE,        COLOR_WHITE, 2);
+        drawButton(83,  282, 72, 36, "Queue", COLOR_BUTTON_GRAY, COLOR_WHITE, 2);
+        drawButton(161, 282, 74, 36, "Run",   COLOR_DARK_GREEN,  COLOR_WHITE, 2);
     } else {
-        drawButton(5, 282, 230, 36, "Main Menu", COLOR_BLUE, COLOR_WHITE, 2);
+        char queueLabel[16];
+        snprintf(queueLabel, sizeof(queueLabel), "Queue (%d)", jobQueueCount());
+        drawButton(5,   282, 72, 36, "Main Menu", COLOR_BLUE, COLOR_WHITE, 1);
+        drawMultiLineButton(83, 282, 72, 36, "Files on", pendantSdCard.local ? "Pendant" : "SD",
+                            COLOR_BUTTON_GRAY, COLOR_WHITE, 1);
+        drawButton(161, 282, 74, 36, queueLabel, COLOR_BUTTON_GRAY, COLOR_WHITE, 1);
     }
 }
 
@@ -200,7 +246,7 @@ void handleSDCardTouch(int x, int y) {
             if (displayIndex < pendantSdCard.fileCount) {
                 pendantSdCard.selectedFile = displayIndex;
                 pendantSdCard.pendingRun   = true;
-                drawSDCardScreen();
+                drawCurrentPendantScreen();
             }
             return;
         }
@@ -217,16 +263,12 @@ void handleSDCardTouch(int x, int y) {
 
     // Refresh
     if (isTouchInBounds(x, y, 83, 242, 72, 36)) {
-        if (pendantConnected) {
-            pendantSdCard.loading      = true;
-            pendantSdCard.loadFailed   = false;
-            pendantSdCard.loadStartMs  = millis();   // re-arm the deadline
-            pendantSdCard.fileCount    = 0;
-            pendantSdCard.scrollOffset = 0;
-            pendantSdCard.selectedFile = 0;
-            pendantSdCard.pendingRun   = false;
-            updateSDCardFileList();
-            request_file_list("/sd");
+        if (pendantConnected || pendantSdCard.local) {
+            bool wasPending          = pendantSdCard.pendingRun;
+            pendantSdCard.pendingRun = false;
+            refreshFileList();
+            if (wasPending) drawCurrentPendantScreen();  // bottom row changes back
+            else            updateSDCardFileList();
         }
         return;
     }
@@ -240,20 +282,49 @@ void handleSDCardTouch(int x, int y) {
         return;
     }
 
-    // Bottom row — depends on pendingRun state
-    if (pendantSdCard.pendingRun) {
-        // LOAD — store filename, navigate to Status; green button will send run command
+    // Bottom row — depends on pendingRun state and the file source
+    if (pendantSdCard.pendingRun && pendantSdCard.local) {
+        const String& file = pendantSdCard.files[pendantSdCard.selectedFile];
+        // LOAD — green button streams it from the Status screen
         if (isTouchInBounds(x, y, 5, 282, 110, 36)) {
-            pendantSdCard.loadedFile = pendantSdCard.files[pendantSdCard.selectedFile];
-            pendantSdCard.pendingRun = false;
+            pendantSdCard.loadedFile  = file;
+            pendantSdCard.loadedLocal = true;
+            pendantSdCard.pendingRun  = false;
             currentPendantScreen = PSCREEN_STATUS;
             return;
         }
-        // RUN — send command immediately
+        // STREAM — start now; Status shows progress, or why it didn't start
         if (isTouchInBounds(x, y, 121, 282, 114, 36)) {
             if (pendantConnected) {
-                String cmd = "$SD/Run=" + pendantSdCard.files[pendantSdCard.selectedFile];
-                send_line(cmd.c_str());
+                stream_start(file.c_str());
+                pendantSdCard.loadedFile = "";
+                pendantSdCard.pendingRun = false;
+                currentPendantScreen = PSCREEN_STATUS;
+            }
+            return;
+        }
+    } else if (pendantSdCard.pendingRun) {
+        // LOAD — store filename, navigate to Status; green button will send run command
+        if (isTouchInBounds(x, y, 5, 282, 72, 36)) {
+            pendantSdCard.loadedFile  = pendantSdCard.files[pendantSdCard.selectedFile];
+            pendantSdCard.loadedLocal = false;
+            pendantSdCard.pendingRun  = false;
+            currentPendantScreen = PSCREEN_STATUS;
+            return;
+        }
+        // QUEUE — append to the job queue and stay here to pick the next one
+        if (isTouchInBounds(x, y, 83, 282, 72, 36)) {
+            jobQueueAdd(pendantSdCard.files[pendantSdCard.selectedFile].c_str());
+            pendantSdCard.pendingRun = false;
+            drawCurrentPendantScreen();
+            return;
+        }
+        // RUN — send command immediately
+        if (isTouchInBounds(x, y, 161, 282, 74, 36)) {
+            if (pendantConnected) {
+                char cmd[128];
+                snprintf(cmd, sizeof(cmd), "$SD/Run=%s", pendantSdCard.files[pendantSdCard.selectedFile].c_str());
+                send_line(cmd);
                 pendantSdCard.loadedFile = "";
                 pendantSdCard.pendingRun = false;
                 currentPendantScreen = PSCREEN_STATUS;
@@ -261,8 +332,17 @@ void handleSDCardTouch(int x, int y) {
             return;
         }
     } else {
-        if (isTouchInBounds(x, y, 5, 282, 230, 36)) {
+        if (isTouchInBounds(x, y, 5, 282, 72, 36)) {
             currentPendantScreen = PSCREEN_MAIN_MENU;
         }
+        if (isTouchInBounds(x, y, 83, 282, 72, 36)) {
+            pendantSdCard.local     = !pendantSdCard.local;
+            pendantSdCard.fileCount = 0;  // never show one source's names under the other
+            refreshFileList();
+            drawCurrentPendantScreen();
+        }
+        if (isTouchInBounds(x, y, 161, 282, 74, 36)) {
+            currentPendantScreen = PSCREEN_JOB_QUEUE;
+        }
     }
 }
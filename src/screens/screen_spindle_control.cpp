@@ -2,6 +2,7 @@
 #include "screen_spindle_control.h"
 #include "../CNC_Pendant_UI.h"
 #include "screen_probe.h"   // PROBE_* colours — shared adjustable-field style
+#include "../CommandQueue.h"
 
 // Dial toggle drawn in the Probe screens' adjustable-field style: a bordered
 // box that highlights (yellow border + text) while dial mode is active.  Label
@@ -10,13 +11,66 @@ static void drawSpindleDialButton() {
     bool     active = pendantSpindle.dialMode;
     uint16_t bg     = active ? PROBE_SEL_BG   : PROBE_BG_SCREEN;
     uint16_t bdr    = active ? PROBE_C_YELLOW : PROBE_C_TAPBDR;
-    display.fillRoundRect(179, 163, 56, 37, 2, bg);
-    display.drawRoundRect(179, 163, 56, 37, 2, bdr);
-    display.setTextSize(2);
-    display.setTextColor(active ? PROBE_C_YELLOW : COLOR_TEAL_BRIGHT);
-    int16_t tw = display.textWidth("Dial");
-    display.setCursor(179 + (56 - tw) / 2, 163 + (37 - 16) / 2);
-    display.print("Dial");
+    gfx->fillRoundRect(179, 163, 56, 37, 2, bg);
+    gfx->drawRoundRect(179, 163, 56, 37, 2, bdr);
+    gfx->setTextSize(2);
+    gfx->setTextColor(active ? PROBE_C_YELLOW : COLOR_TEAL_BRIGHT);
+    int16_t tw = gfx->textWidth("Dial");
+    gfx->setCursor(179 + (56 - tw) / 2, 163 + (37 - 16) / 2);
+    gfx->print("Dial");
+}
+
+// ── Live speed while running ─────────────────────────────────────────────────
+// Once the spindle is on, dialing streams the target to the controller: one
+// "S" line in flight at a time, at most every SPINDLE_STREAM_MS so a Modbus
+// VFD can keep up, and whatever the dial reads when the previous one is
+// acknowledged is what goes next — the values in between are dropped.  While
+// a job is running the controller won't take an S word from the pendant, so
+// the target becomes a spindle override % instead.
+static const unsigned long SPINDLE_STREAM_MS = 100;
+static int           _streamedRPM  = 0;  // last target handed to the controller
+static cmd_handle_t  _speedPending = 0;
+static unsigned long _lastSpeedMs  = 0;
+
+static void onSpindleSpeedDone(const CmdResult& /*r*/, void* /*ctx*/) {
+    _speedPending = 0;
+    fnc_realtime(StatusReport);  // show the measured RPM moving now, not next report
+}
+
+void spindleStreamTick() {
+    if (currentPendantScreen != PSCREEN_SPINDLE_CONTROL || !pendantConnected) return;
+    if (!pendantMachine.spindleRunning || _speedPending) return;
+    int target = pendantSpindle.targetRPM;
+    if (target == _streamedRPM) return;
+    unsigned long now = millis();
+    if (now - _lastSpeedMs < SPINDLE_STREAM_MS) return;
+    _lastSpeedMs = now;
+
+    if (pendantMachine.status.startsWith("Run") || pendantMachine.status.startsWith("Hold")) {
+        // The reported speed already includes the override; scale from it.
+        int rpm = pendantMachine.spindleRPM;
+        int ovr = pendantMachine.spindleOverride;
+        if (rpm <= 0 || ovr <= 0) return;
+        overrideSetSpindleTarget((int)((long)target * ovr / rpm));
+        _streamedRPM = target;
+        return;
+    }
+    char cmd[16];
+    snprintf(cmd, sizeof(cmd), "S%d", target);
+    _speedPending = cmd_submit(cmd, onSpindleSpeedDone);
+    if (_speedPending) {
+        _streamedRPM = target;
+    }
+}
+
+// Start is shown as running straight away; if FluidNC refuses the M3/M4
+// (error:N, eg. in Alarm) or it never got there, put the flag back.
+static void onSpindleStartDone(const CmdResult& r, void* /*ctx*/) {
+    if (r.status == CMD_OK) return;
+    if (xSemaphoreTake(stateMutex, pdMS_TO_TICKS(5)) == pdTRUE) {
+        pendantMachine.spindleRunning = false;
+        xSemaphoreGive(stateMutex);
+    }
 }
 
 // Compute dynamic presets: 25%, 50%, 100% of max, floored to nearest 100 RPM
@@ -28,10 +82,11 @@ static void getSpindlePresets(int presets[3]) {
     presets[2] = maxRPM;
 }
 
-// Format RPM as "Xk" if divisible by 1000, else plain number
-static String fmtRPM(int rpm) {
-    if (rpm >= 1000 && rpm % 1000 == 0) return String(rpm / 1000) + "k";
-    return String(rpm);
+// Format RPM as "Xk" if divisible by 1000, else plain number, into buf
+static const char* fmtRPM(int rpm, char* buf, size_t n) {
+    if (rpm >= 1000 && rpm % 1000 == 0) snprintf(buf, n, "%dk", rpm / 1000);
+    else                                snprintf(buf, n, "%d", rpm);
+    return buf;
 }
 
 void enterSpindleControl() {
@@ -51,7 +106,7 @@ void enterSpindleControl() {
         pendantSpindle.targetRPM = presets[pendantSpindle.selectedPreset];
     }
 
-    // RPM panel uses a transient 16-bit sprite (see updateSpindleRPMDisplay).
+    // RPM panel uses a shared 4-bit panel scratch (see updateSpindleRPMDisplay).
 }
 
 void exitSpindleControl() {
@@ -59,28 +114,29 @@ void exitSpindleControl() {
 }
 
 void drawSpindleControlScreen() {
-    display.fillScreen(COLOR_BACKGROUND);
+    gfx->fillScreen(COLOR_BACKGROUND);
     drawTitle("SPINDLE CONTROL");
 
-    display.fillRoundRect(5, 40, 230, 60, 5, COLOR_DARKER_BG);
+    gfx->fillRoundRect(5, 40, 230, 60, 5, COLOR_DARKER_BG);
     updateSpindleRPMDisplay();
 
     drawButton(5,   110, 112, 38, "Fwd", pendantSpindle.directionFwd ? COLOR_DARK_GREEN : COLOR_BUTTON_GRAY, COLOR_WHITE, 2);
     drawButton(123, 110, 112, 38, "Rev", !pendantSpindle.directionFwd ? COLOR_DARK_GREEN : COLOR_BUTTON_GRAY, COLOR_WHITE, 2);
 
     // Min/Max from controller
-    display.setTextColor(COLOR_GRAY_TEXT);
-    display.setTextSize(1);
-    display.setCursor(5, 152);
-    display.printf("Min: %d  Max: %d RPM", pendantMachine.spindleMinRPM, pendantMachine.spindleMaxRPM);
+    gfx->setTextColor(COLOR_GRAY_TEXT);
+    gfx->setTextSize(1);
+    gfx->setCursor(5, 152);
+    gfx->printf("Min: %d  Max: %d RPM", pendantMachine.spindleMinRPM, pendantMachine.spindleMaxRPM);
 
     // 3 preset buttons + 1 Dial button, 4 across 230px: w=56, spacing=58
-    int presets[3];
+    int  presets[3];
+    char rpmStr[12];
     getSpindlePresets(presets);
     for (int i = 0; i < 3; i++) {
         uint16_t bg = (!pendantSpindle.dialMode && i == pendantSpindle.selectedPreset)
                       ? COLOR_ORANGE : COLOR_BUTTON_GRAY;
-        drawButton(5 + i * 58, 163, 56, 37, fmtRPM(presets[i]), bg, COLOR_WHITE, 2);
+        drawButton(5 + i * 58, 163, 56, 37, fmtRPM(presets[i], rpmStr, sizeof(rpmStr)), bg, COLOR_WHITE, 2);
     }
     // Dial toggle — adjustable-field style (label only; target RPM shown above)
     drawSpindleDialButton();
@@ -94,32 +150,34 @@ void updateSpindleRPMDisplay() {
     if (currentPendantScreen != PSCREEN_SPINDLE_CONTROL) return;
 
     int spindleRPM;
-    String spindleDir;
     if (xSemaphoreTake(stateMutex, pdMS_TO_TICKS(5)) != pdTRUE) return;
     spindleRPM = pendantMachine.spindleRPM;
-    spindleDir = pendantMachine.spindleDir;
     xSemaphoreGive(stateMutex);
 
     int ox, oy;
     LovyanGFX* g = beginPanelSprite(230, 60, ox, oy, 5, 40);
-    g->fillRect(ox, oy, 230, 60, COLOR_DARKER_BG);
+    g->fillRect(ox, oy, 230, 60, panelInk(g, COLOR_DARKER_BG));
 
-    // Left column — current actual spindle RPM
-    g->setTextColor(COLOR_GRAY_TEXT);
+    // Left column — current actual spindle RPM; orange while it is still
+    // converging on the target, green once within 2 %.
+    int  target    = pendantSpindle.targetRPM;
+    bool running   = pendantMachine.spindleRunning;
+    bool converged = running && abs(spindleRPM - target) <= max(target / 50, 10);
+    g->setTextColor(panelInk(g, COLOR_GRAY_TEXT));
     g->setTextSize(1);
     g->setCursor(ox + 5, oy + 5);
-    g->print("RPM");
-    g->setTextColor(COLOR_ORANGE);
+    g->print(running ? "RPM (live)" : "RPM");
+    g->setTextColor(panelInk(g, converged ? COLOR_GREEN : COLOR_ORANGE));
     g->setTextSize(3);
     g->setCursor(ox + 5, oy + 22);
     g->print(spindleRPM);
 
     // Right column — user-selected target RPM
-    g->setTextColor(COLOR_GRAY_TEXT);
+    g->setTextColor(panelInk(g, COLOR_GRAY_TEXT));
     g->setTextSize(1);
     g->setCursor(ox + 120, oy + 5);
     g->print("Target RPM");
-    g->setTextColor(COLOR_DARK_GREEN);
+    g->setTextColor(panelInk(g, COLOR_DARK_GREEN));
     g->setTextSize(3);
     g->setCursor(ox + 120, oy + 22);
     g->print(pendantSpindle.targetRPM);
@@ -136,12 +194,13 @@ void redrawSpindleDirectionButtons() {
 
 void redrawSpindlePresetButtons() {
     if (currentPendantScreen != PSCREEN_SPINDLE_CONTROL) return;
-    int presets[3];
+    int  presets[3];
+    char rpmStr[12];
     getSpindlePresets(presets);
     for (int i = 0; i < 3; i++) {
         uint16_t bg = (!pendantSpindle.dialMode && i == pendantSpindle.selectedPreset)
                       ? COLOR_ORANGE : COLOR_BUTTON_GRAY;
-        drawButton(5 + i * 58, 163, 56, 37, fmtRPM(presets[i]), bg, COLOR_WHITE, 2);
+        drawButton(5 + i * 58, 163, 56, 37, fmtRPM(presets[i], rpmStr, sizeof(rpmStr)), bg, COLOR_WHITE, 2);
     }
     drawSpindleDialButton();
     updateSpindleRPMDisplay();
@@ -166,7 +225,8 @@ void handleSpindleControlTouch(int x, int y) {
         return;
     }
 
-    int presets[3];
+    int  presets[3];
+    char rpmStr[12];
     getSpindlePresets(presets);
     for (int i = 0; i < 3; i++) {
         if (isTouchInBounds(x, y, 5 + i * 58, 163, 56, 37)) {
@@ -196,7 +256,8 @@ void handleSpindleControlTouch(int x, int y) {
             char cmd[32];
             // M3 = clockwise (Fwd), M4 = counterclockwise (Rev)
             snprintf(cmd, sizeof(cmd), "%s S%d", pendantSpindle.directionFwd ? "M3" : "M4", pendantSpindle.targetRPM);
-            send_line(cmd);
+            cmd_submit(cmd, onSpindleStartDone);
+            _streamedRPM = pendantSpindle.targetRPM;
         }
         if (xSemaphoreTake(stateMutex, pdMS_TO_TICKS(5)) == pdTRUE) {
             pendantMachine.spindleRunning = true;
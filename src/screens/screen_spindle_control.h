@@ -6,3 +6,4 @@ void updateSpindleRPMDisplay();
 void redrawSpindleDirectionButtons();
 void redrawSpindlePresetButtons();
 void handleSpindleControlTouch(int x, int y);
+void spindleStreamTick();  // loop_pendant(): live S updates while dialing
@@ -1,8 +1,26 @@
 #include "pendant_shared.h"
 #include "screen_status.h"
+#include "job_queue.h"
+#include "../GcodeStreamer.h"
+
+// ── Layout ──────────────────────────────────────────────────────────────────
+enum StatusWidget : uint8_t {
+    ST_MACHINE, ST_FILE, ST_AXES, ST_FEED_SPINDLE, ST_MAIN_MENU, ST_FLUIDNC, ST_COUNT
+};
+
+static constexpr UiWidget kStatusLayout[] = {
+    { ST_MACHINE,        5,  40, 230, 50, nullptr,     nullptr },
+    { ST_FILE,           5,  95, 230, 40, nullptr,     nullptr },
+    { ST_AXES,           5, 140, 230, 65, nullptr,     nullptr },
+    { ST_FEED_SPINDLE,   5, 210, 230, 65, nullptr,     nullptr },
+    { ST_MAIN_MENU,      5, 280, 112, 40, "Main Menu", nullptr },
+    { ST_FLUIDNC,      123, 280, 112, 40, "FluidNC",   nullptr },
+};
+static_assert(uiIdsMatchIndex(kStatusLayout, ST_COUNT), "kStatusLayout must be in StatusWidget order");
+static constexpr UiLayout kStatus = uiLayout(kStatusLayout);
 
 void enterStatus() {
-    // The four status panels all render through the shared 16-bit scratch sprite
+    // The four status panels all render through the shared 4-bit scratch sprite
     // (begin/endPanelSprite) — one buffer reused for every panel, grown to the
     // largest and then held with no per-frame churn.  Holding four separate
     // persistent buffers (~50 KB) failed on the WiFi build; the shared scratch
@@ -14,17 +32,21 @@ void exitStatus() {
     releasePanelSprites();
 }
 
+static void drawStatusChrome() {
+    gfx->fillScreen(COLOR_BACKGROUND);
+    drawTitleBar("STATUS");
+    uiDrawButton(kStatusLayout[ST_MAIN_MENU], COLOR_BLUE, COLOR_WHITE, 2);
+    uiDrawButton(kStatusLayout[ST_FLUIDNC], COLOR_BLUE, COLOR_WHITE, 2);
+}
+
 void drawStatusScreen() {
-    display.fillScreen(COLOR_BACKGROUND);
-    drawTitle("STATUS");
+    drawChrome(drawStatusChrome);
+    drawTitleIcons();
 
     updateStatusMachineStatus();
     updateStatusCurrentFile();
     updateStatusAxisPositions();
     updateStatusFeedSpindle();
-
-    drawButton(5, 280, 112, 40, "Main Menu", COLOR_BLUE, COLOR_WHITE, 2);
-    drawButton(123, 280, 112, 40, "FluidNC", COLOR_BLUE, COLOR_WHITE, 2);
 }
 
 void updateStatusMachineStatus() {
@@ -33,42 +55,40 @@ void updateStatusMachineStatus() {
     // Snapshot shared state under the lock FIRST.  Skip this frame if the lock
     // is briefly unavailable rather than reading Strings unlocked (Core 0 may be
     // mid-write, and a String realloc during the copy would corrupt the heap).
-    String statusStr;
-    String fileStr;
-    int    pct = 0;
+    char statusStr[24];
+    bool jobRunning;
+    int  pct = 0;
     if (xSemaphoreTake(stateMutex, pdMS_TO_TICKS(5)) != pdTRUE) return;
-    statusStr = pendantMachine.status;
-    fileStr   = pendantMachine.currentFile;
-    pct       = pendantMachine.jobPercent;
+    copyStr(statusStr, sizeof(statusStr), pendantMachine.status);
+    jobRunning = pendantMachine.currentFile.length() > 0;
+    pct        = pendantMachine.jobPercent;
     xSemaphoreGive(stateMutex);
 
-    bool jobRunning = fileStr.length() > 0;
-
     int ox, oy;
-    LovyanGFX* g = beginPanelSprite(230, 50, ox, oy, 5, 40);
-    g->fillRect(ox, oy, 230, 50, COLOR_DARKER_BG);
+    LovyanGFX* g = beginPanelSprite(kStatusLayout[ST_MACHINE], ox, oy);
+    g->fillRect(ox, oy, 230, 50, panelInk(g, COLOR_DARKER_BG));
 
-    if (!pendantSynced || statusStr == "N/C" || statusStr.length() == 0) {
+    if (!pendantSynced || strcmp(statusStr, "N/C") == 0 || statusStr[0] == '\0') {
         // Two-phase power-up / reconnect indicator (matches the main menu):
         //   "Connecting" — link not yet established
         //   "Syncing"    — link up; fetching config + waiting for live state
         const char* phase = pendantConnected ? "Syncing" : "Connecting";
-        g->setTextColor(COLOR_GRAY_TEXT);
+        g->setTextColor(panelInk(g, COLOR_GRAY_TEXT));
         g->setTextSize(1);
         int16_t lw = g->textWidth("MACHINE STATUS");
         g->setCursor(ox + 115 - lw / 2, oy + 5);
         g->print("MACHINE STATUS");
-        g->setTextColor(COLOR_ORANGE);
+        g->setTextColor(panelInk(g, COLOR_ORANGE));
         g->setTextSize(3);
         int16_t cw = g->textWidth(phase);
         g->setCursor(ox + 115 - cw / 2, oy + 22);
         g->print(phase);
 
-    } else if (statusStr.startsWith("Alarm")) {
-        String desc = alarmDescription(statusStr);
-        g->setTextColor(TFT_RED);
+    } else if (strncmp(statusStr, "Alarm", 5) == 0) {
+        const char* desc = alarmDescription(statusStr);
+        g->setTextColor(panelInk(g, TFT_RED));
         g->setTextSize(1);
-        int16_t dw = g->textWidth(desc.c_str());
+        int16_t dw = g->textWidth(desc);
         g->setCursor(ox + 115 - dw / 2, oy + 5);
         g->print(desc);
         g->setTextSize(3);
@@ -78,78 +98,131 @@ void updateStatusMachineStatus() {
 
     } else if (jobRunning) {
         // Two-column layout
-        g->setTextColor(COLOR_GRAY_TEXT);
+        g->setTextColor(panelInk(g, COLOR_GRAY_TEXT));
         g->setTextSize(1);
         g->setCursor(ox + 5, oy + 5);
         g->print("MACHINE STATUS");
-        g->setTextColor(COLOR_CYAN);
+        g->setTextColor(panelInk(g, COLOR_CYAN));
         g->setTextSize(3);
-        int16_t sw = g->textWidth(statusStr.c_str());
+        int16_t sw = g->textWidth(statusStr);
         int16_t cx = 56 - sw / 2;
         if (cx < 0) cx = 0;
         g->setCursor(ox + cx, oy + 22);
         g->print(statusStr);
 
-        g->drawLine(ox + 115, oy + 2, ox + 115, oy + 47, COLOR_BUTTON_GRAY);
+        g->drawLine(ox + 115, oy + 2, ox + 115, oy + 47, panelInk(g, COLOR_BUTTON_GRAY));
 
-        String pctStr = String(pct) + "%";
-        g->setTextColor(COLOR_GRAY_TEXT);
+        char pctStr[8];
+        snprintf(pctStr, sizeof(pctStr), "%d%%", pct);
+        g->setTextColor(panelInk(g, COLOR_GRAY_TEXT));
         g->setTextSize(1);
         int16_t lw = g->textWidth("PROGRESS");
         g->setCursor(ox + 174 - lw / 2, oy + 5);
         g->print("PROGRESS");
-        g->setTextColor(COLOR_GREEN);
+        g->setTextColor(panelInk(g, COLOR_GREEN));
         g->setTextSize(3);
-        int16_t pw = g->textWidth(pctStr.c_str());
+        int16_t pw = g->textWidth(pctStr);
         g->setCursor(ox + 174 - pw / 2, oy + 22);
         g->print(pctStr);
 
     } else {
-        g->setTextColor(COLOR_GRAY_TEXT);
+        g->setTextColor(panelInk(g, COLOR_GRAY_TEXT));
         g->setTextSize(1);
         int16_t lw = g->textWidth("MACHINE STATUS");
         g->setCursor(ox + 115 - lw / 2, oy + 5);
         g->print("MACHINE STATUS");
-        g->setTextColor(COLOR_CYAN);
+        g->setTextColor(panelInk(g, COLOR_CYAN));
         g->setTextSize(3);
-        int16_t sw = g->textWidth(statusStr.c_str());
+        int16_t sw = g->textWidth(statusStr);
         g->setCursor(ox + 115 - sw / 2, oy + 22);
         g->print(statusStr);
     }
 
-    endPanelSprite(230, 50, 5, 40);
+    endPanelSprite(kStatusLayout[ST_MACHINE]);
 }
 
 void updateStatusCurrentFile() {
     if (currentPendantScreen != PSCREEN_STATUS) return;
 
-    String fileStr;
+    char fileStr[64];
     if (xSemaphoreTake(stateMutex, pdMS_TO_TICKS(5)) != pdTRUE) return;
-    fileStr = pendantMachine.currentFile;
+    copyStr(fileStr, sizeof(fileStr), pendantMachine.currentFile);
     xSemaphoreGive(stateMutex);
 
     int ox, oy;
-    LovyanGFX* g = beginPanelSprite(230, 40, ox, oy, 5, 95);
-    g->fillRoundRect(ox, oy, 230, 40, 5, COLOR_DARKER_BG);
-
-    if (pendantSdCard.loadedFile.length() > 0 && fileStr.length() == 0) {
-        g->setTextColor(COLOR_GREEN);
+    LovyanGFX* g = beginPanelSprite(kStatusLayout[ST_FILE], ox, oy);
+    g->fillRoundRect(ox, oy, 230, 40, 5, panelInk(g, COLOR_DARKER_BG));
+
+    StreamStatus stream;
+    stream_status(stream);
+    bool streaming = stream.state == STREAM_OPENING || stream.state == STREAM_RUNNING;
+
+    JobQueuePhase queued = jobQueuePhase();
+    if (streaming) {
+        // A file the pendant is sending itself: progress is how much of it
+        // has been read, throughput is what the controller has acked.
+        int  pct = stream.fileBytes ? (int)((uint64_t)stream.readBytes * 100 / stream.fileBytes) : 0;
+        char line1[48];
+        snprintf(line1, sizeof(line1), "STREAMING %d%%  %u B/s  %u ln/s", pct,
+                 (unsigned)stream.bytesPerSec, (unsigned)stream.linesPerSec);
+        g->setTextColor(panelInk(g, COLOR_GRAY_TEXT));
+        g->setTextSize(1);
+        g->setCursor(ox + 5, oy + 5);
+        g->print(line1);
+        g->setTextColor(panelInk(g, COLOR_CYAN));
+        g->setCursor(ox + 5, oy + 20);
+        g->print(stream.file);
+    } else if ((queued == JQ_CONFIRM || queued == JQ_COUNTDOWN) && fileStr[0] == '\0') {
+        char prompt[40];
+        if (queued == JQ_COUNTDOWN) snprintf(prompt, sizeof(prompt), "NEXT JOB in %d s", jobQueueCountdownS());
+        else                        snprintf(prompt, sizeof(prompt), "NEXT JOB — press green to run");
+        g->setTextColor(panelInk(g, COLOR_GREEN));
+        g->setTextSize(1);
+        g->setCursor(ox + 5, oy + 5);
+        g->print(prompt);
+        g->setCursor(ox + 5, oy + 20);
+        g->print(jobQueueAt(0).file);
+    } else if (pendantSdCard.loadedFile.length() > 0 && fileStr[0] == '\0') {
+        g->setTextColor(panelInk(g, COLOR_GREEN));
         g->setTextSize(1);
         g->setCursor(ox + 5, oy + 5);
-        g->print("READY — press green to run");
+        g->print(pendantSdCard.loadedLocal ? "READY — press green to stream" : "READY — press green to run");
         g->setCursor(ox + 5, oy + 20);
         g->print(pendantSdCard.loadedFile);
+    } else if (stream.state >= STREAM_DONE && fileStr[0] == '\0') {
+        char line1[48];
+        char line2[64];
+        if (stream.state == STREAM_DONE) {
+            snprintf(line1, sizeof(line1), "STREAMED %u lines in %u s", (unsigned)stream.linesAcked,
+                     (unsigned)(stream.elapsedMs / 1000));
+        } else {
+            snprintf(line1, sizeof(line1), "STREAM: %s", stream.message);
+        }
+        if (stream.errorCode) {
+            snprintf(line2, sizeof(line2), "line %u error:%d  %s", (unsigned)stream.errorLine, stream.errorCode, stream.file);
+        } else if (stream.errorLine) {
+            snprintf(line2, sizeof(line2), "line %u  %s", (unsigned)stream.errorLine, stream.file);
+        } else {
+            snprintf(line2, sizeof(line2), "%s", stream.file);
+        }
+        g->setTextColor(panelInk(g, stream.state == STREAM_DONE ? COLOR_GREEN : COLOR_ORANGE));
+        g->setTextSize(1);
+        g->setCursor(ox + 5, oy + 5);
+        g->print(line1);
+        g->setTextColor(panelInk(g, COLOR_GRAY_TEXT));
+        g->setCursor(ox + 5, oy + 20);
+        g->print(line2);
     } else {
-        g->setTextColor(COLOR_GRAY_TEXT);
+        g->setTextColor(panelInk(g, COLOR_GRAY_TEXT));
         g->setTextSize(1);
         g->setCursor(ox + 5, oy + 5);
         g->print("CURRENT FILE");
-        g->setTextColor(COLOR_CYAN);
+        g->setTextColor(panelInk(g, COLOR_CYAN));
         g->setCursor(ox + 5, oy + 20);
         g->print(fileStr);
     }
 
-    endPanelSprite(230, 40, 5, 95);
+    endPanelSprite(kStatusLayout[ST_FILE]);
 }
 
 void updateStatusAxisPositions() {
@@ -165,18 +238,18 @@ void updateStatusAxisPositions() {
     xSemaphoreGive(stateMutex);
 
     int ox, oy;
-    LovyanGFX* g = beginPanelSprite(230, 65, ox, oy, 5, 140);
+    LovyanGFX* g = beginPanelSprite(kStatusLayout[ST_AXES], ox, oy);
 
-    g->fillRoundRect(ox, oy, 230, 65, 5, COLOR_DARKER_BG);
+    g->fillRoundRect(ox, oy, 230, 65, 5, panelInk(g, COLOR_DARKER_BG));
 
-    g->setTextColor(COLOR_GRAY_TEXT);
+    g->setTextColor(panelInk(g, COLOR_GRAY_TEXT));
     g->setTextSize(1);
     g->setCursor(ox + 5, oy + 5);
     g->print("MACHINE POSITION");
 
     const char* axisNames[] = { "X", "Y", "Z", "A" };
     float       positions[] = { px, py, pz, pa };
-    g->setTextColor(COLOR_ORANGE);
+    g->setTextColor(panelInk(g, COLOR_ORANGE));
     g->setTextSize(2);
     for (int i = 0; i < numAxes; i++) {
         g->setCursor(ox + ((i % 2) ? 125 : 5), oy + 20 + (i / 2) * 23);
@@ -185,67 +258,67 @@ void updateStatusAxisPositions() {
         g->print(positions[i], 1);
     }
 
-    endPanelSprite(230, 65, 5, 140);
+    endPanelSprite(kStatusLayout[ST_AXES]);
 }
 
 void updateStatusFeedSpindle() {
     if (currentPendantScreen != PSCREEN_STATUS) return;
 
     int feedRate, spindleRPM;
-    String spindleDir;
+    char spindleDir[8];
     if (xSemaphoreTake(stateMutex, pdMS_TO_TICKS(5)) != pdTRUE) return;
     feedRate   = pendantMachine.feedRate;
     spindleRPM = pendantMachine.spindleRPM;
-    spindleDir = pendantMachine.spindleDir;
+    copyStr(spindleDir, sizeof(spindleDir), pendantMachine.spindleDir);
     xSemaphoreGive(stateMutex);
 
     int ox, oy;
-    LovyanGFX* g = beginPanelSprite(230, 65, ox, oy, 5, 210);
+    LovyanGFX* g = beginPanelSprite(kStatusLayout[ST_FEED_SPINDLE], ox, oy);
 
-    g->fillRect(ox, oy, 230, 65, COLOR_BACKGROUND);
+    g->fillRect(ox, oy, 230, 65, panelInk(g, COLOR_BACKGROUND));
 
     // Feed Rate box
-    g->fillRoundRect(ox + 0, oy, 112, 65, 5, COLOR_DARKER_BG);
-    g->setTextColor(COLOR_GRAY_TEXT);
+    g->fillRoundRect(ox + 0, oy, 112, 65, 5, panelInk(g, COLOR_DARKER_BG));
+    g->setTextColor(panelInk(g, COLOR_GRAY_TEXT));
     g->setTextSize(1);
     g->setCursor(ox + 5, oy + 3);
     g->print("FEED");
-    g->setTextColor(COLOR_ORANGE);
+    g->setTextColor(panelInk(g, COLOR_ORANGE));
     g->setTextSize(2);
     g->setCursor(ox + 5, oy + 25);
     g->print(feedRate);
-    g->setTextColor(COLOR_GRAY_TEXT);
+    g->setTextColor(panelInk(g, COLOR_GRAY_TEXT));
     g->setTextSize(1);
     int16_t mmW = g->textWidth("mm/min");
     g->setCursor(ox + 112 - 5 - mmW, oy + 50);
     g->print("mm/min");
 
     // Spindle box
-    g->fillRoundRect(ox + 118, oy, 112, 65, 5, COLOR_DARKER_BG);
-    g->setTextColor(COLOR_GRAY_TEXT);
+    g->fillRoundRect(ox + 118, oy, 112, 65, 5, panelInk(g, COLOR_DARKER_BG));
+    g->setTextColor(panelInk(g, COLOR_GRAY_TEXT));
     g->setTextSize(1);
     g->setCursor(ox + 123, oy + 3);
     g->print("SPINDLE");
-    int16_t dirW = g->textWidth(spindleDir.c_str());
+    int16_t dirW = g->textWidth(spindleDir);
     g->setCursor(ox + 230 - 5 - dirW, oy + 3);
     g->print(spindleDir);
-    g->setTextColor(COLOR_GREEN);
+    g->setTextColor(panelInk(g, COLOR_GREEN));
     g->setTextSize(2);
     g->setCursor(ox + 123, oy + 25);
     g->print(spindleRPM);
-    g->setTextColor(COLOR_GRAY_TEXT);
+    g->setTextColor(panelInk(g, COLOR_GRAY_TEXT));
     g->setTextSize(1);
     int16_t rpmW = g->textWidth("RPM");
     g->setCursor(ox + 230 - 5 - rpmW, oy + 50);
     g->print("RPM");
 
-    endPanelSprite(230, 65, 5, 210);
+    endPanelSprite(kStatusLayout[ST_FEED_SPINDLE]);
 }
 
 void handleStatusTouch(int x, int y) {
-    if (isTouchInBounds(x, y, 5, 280, 112, 40)) {
-        currentPendantScreen = PSCREEN_MAIN_MENU;
-    } else if (isTouchInBounds(x, y, 123, 280, 112, 40)) {
-        currentPendantScreen = PSCREEN_FLUIDNC;
+    switch (uiHitTest(kStatus, x, y)) {
+        case ST_MAIN_MENU: currentPendantScreen = PSCREEN_MAIN_MENU; break;
+        case ST_FLUIDNC:   currentPendantScreen = PSCREEN_FLUIDNC;   break;
+        default:           break;
     }
 }
@@ -1,15 +1,17 @@
 #include "pendant_shared.h"
 #include "screen_wifi_setup.h"
 #include "../Comms.h"             // comms_active_mode(), transport_force_*()
+#include "../TaskMonitor.h"       // per-task CPU / stack view
 
 #ifdef USE_WIFI
 #include "../WiFiConnection.h"    // status / signal / AP-config helpers (WiFi-only)
+#include "../FluidNCDiscovery.h"  // FncHost, for the controller picker
 #endif
 
 #include <Esp.h>
 #include <Preferences.h>
 
-// ── Layout (all direct display.* calls — no sprites, no heap dependency) ──────
+// ── Layout (all direct gfx-> calls — no sprites, no heap dependency) ──────────
 //
 // Transport selection is MANUAL:
 //   • NVS key "tport_force" stores UART (default) or WiFi.
@@ -22,7 +24,7 @@
 //
 //  y=  0–35   title bar       (drawTitle)
 //  y= 40–98   mode banner     (live transport + override; tappable)
-//  y=106–221  status panel    (WiFi status, or UART explanation)
+//  y=106–221  status panel    (WiFi status, or UART explanation; tap → tasks)
 //  y=228–264  action button   (Reconfigure WiFi — WiFi mode only)
 //  y=272–312  back button
 
@@ -52,31 +54,31 @@ static constexpr int BTN_BACK_H   = 40;
 // that cycles the override.  Drawn once per screen entry — the values are
 // fixed for the boot.
 static void drawModeBanner(bool uartMode) {
-    display.fillRoundRect(PNL_MODE_X, PNL_MODE_Y, PNL_MODE_W, PNL_MODE_H,
+    gfx->fillRoundRect(PNL_MODE_X, PNL_MODE_Y, PNL_MODE_W, PNL_MODE_H,
                           5, COLOR_DARKER_BG);
-    display.drawRoundRect(PNL_MODE_X, PNL_MODE_Y, PNL_MODE_W, PNL_MODE_H,
+    gfx->drawRoundRect(PNL_MODE_X, PNL_MODE_Y, PNL_MODE_W, PNL_MODE_H,
                           5, COLOR_CYAN);                          // tappable hint
 
     // Header row: live transport + small "TAP TO CHANGE" cue
-    display.setTextColor(COLOR_GRAY_TEXT); display.setTextSize(1);
-    display.setCursor(PNL_MODE_X + 5, PNL_MODE_Y + 5);
-    display.print("TRANSPORT");
+    gfx->setTextColor(COLOR_GRAY_TEXT); gfx->setTextSize(1);
+    gfx->setCursor(PNL_MODE_X + 5, PNL_MODE_Y + 5);
+    gfx->print("TRANSPORT");
     const char* cue = "TAP";
-    display.setTextColor(COLOR_CYAN);
-    display.setCursor(PNL_MODE_X + PNL_MODE_W - 5 - display.textWidth(cue),
+    gfx->setTextColor(COLOR_CYAN);
+    gfx->setCursor(PNL_MODE_X + PNL_MODE_W - 5 - gfx->textWidth(cue),
                       PNL_MODE_Y + 5);
-    display.print(cue);
+    gfx->print(cue);
 
     // Big live mode label
-    display.setTextColor(uartMode ? COLOR_ORANGE : COLOR_GREEN);
-    display.setTextSize(2);
-    display.setCursor(PNL_MODE_X + 5, PNL_MODE_Y + 18);
-    display.print(uartMode ? "UART cable" : "WiFi");
+    gfx->setTextColor(uartMode ? COLOR_ORANGE : COLOR_GREEN);
+    gfx->setTextSize(2);
+    gfx->setCursor(PNL_MODE_X + 5, PNL_MODE_Y + 18);
+    gfx->print(uartMode ? "UART cable" : "WiFi");
 
     // Subtitle: hint that the banner is tappable to switch transport
-    display.setTextColor(COLOR_GRAY_TEXT); display.setTextSize(1);
-    display.setCursor(PNL_MODE_X + 5, PNL_MODE_Y + 44);
-    display.print("Tap to switch transport");
+    gfx->setTextColor(COLOR_GRAY_TEXT); gfx->setTextSize(1);
+    gfx->setCursor(PNL_MODE_X + 5, PNL_MODE_Y + 44);
+    gfx->print("Tap to switch transport");
 }
 
 // ── Status panel ──────────────────────────────────────────────────────────────
@@ -90,52 +92,143 @@ static void sampleMinHeap() {
     if (now < _minHeapEverSeen) _minHeapEverSeen = now;
 }
 
+// Tapping the status panel swaps it for the task monitor view and back.
+static bool _showTasks = false;
+
+// Small right-aligned cue in the panel's top row.
+static void drawPanelCue(const char* cue) {
+    gfx->setTextColor(COLOR_CYAN); gfx->setTextSize(1);
+    gfx->setCursor(PNL_STAT_X + PNL_STAT_W - 5 - gfx->textWidth(cue), PNL_STAT_Y + 6);
+    gfx->print(cue);
+}
+
+// ── Task monitor view ─────────────────────────────────────────────────────────
+// Core load (last window, min-max and mean since boot) and the tasks with the
+// least stack headroom — TaskMonitor samples every 5 s.
+static void drawTaskPanel() {
+    char buf[40];
+    gfx->setTextSize(1);
+    for (int c = 0; c < 2; c++) {
+        CoreLoad l;
+        gfx->setCursor(PNL_STAT_X + 5, PNL_STAT_Y + 6 + c * 12);
+        if (!task_monitor_core(c, l)) {
+            gfx->setTextColor(COLOR_GRAY_TEXT);
+            gfx->print(c == 0 ? "CPU sampling..." : "");
+            continue;
+        }
+        snprintf(buf, sizeof(buf), "CPU%d %3u%%  %u-%u avg %u", c, l.last, l.min, l.max, l.mean);
+        gfx->setTextColor(l.last >= 90 ? COLOR_RED : l.last >= 70 ? COLOR_ORANGE : COLOR_GREEN);
+        gfx->print(buf);
+    }
+    drawPanelCue("BACK");
+
+    gfx->setTextColor(COLOR_GRAY_TEXT);
+    gfx->setCursor(PNL_STAT_X + 5, PNL_STAT_Y + 34);
+    gfx->print("TASK           CORE CPU  FREE");
+
+    TaskStat t[TASK_MONITOR_MAX_TASKS];
+    int      n = task_monitor_tasks(t, TASK_MONITOR_MAX_TASKS);
+    for (int i = 0; i < n && i < 7; i++) {
+        char core[3] = "-";
+        if (t[i].core >= 0) snprintf(core, sizeof(core), "%d", t[i].core);
+        char cpu[5] = "-";
+        if (t[i].cpu >= 0) snprintf(cpu, sizeof(cpu), "%d%%", t[i].cpu);
+        snprintf(buf, sizeof(buf), "%-15.15s%-5s%-5s%u", t[i].name, core, cpu, (unsigned)t[i].minFreeStack);
+        gfx->setTextColor(t[i].minFreeStack < 512  ? COLOR_RED
+                            : t[i].minFreeStack < 1024 ? COLOR_ORANGE
+                            : t[i].alive               ? COLOR_CYAN
+                                                       : COLOR_GRAY_TEXT);
+        gfx->setCursor(PNL_STAT_X + 5, PNL_STAT_Y + 46 + i * 10);
+        gfx->print(buf);
+    }
+}
+
+#ifdef USE_WIFI
+// ── Controller picker ─────────────────────────────────────────────────────────
+// Nothing configured or remembered and discovery found several controllers:
+// the panel lists them (name, address) and a tap on a row connects there.
+#define PICK_ROW_Y     22
+#define PICK_ROW_PITCH 15
+
+static FncHost _choices[DISC_MAX];
+static int     _nChoices = 0;
+
+static void drawPickPanel() {
+    gfx->setTextSize(1);
+    gfx->setTextColor(COLOR_GRAY_TEXT);
+    gfx->setCursor(PNL_STAT_X + 5, PNL_STAT_Y + 6);
+    gfx->print("SEVERAL FLUIDNC FOUND - TAP ONE");
+    for (int i = 0; i < _nChoices; i++) {
+        int y = PNL_STAT_Y + PICK_ROW_Y + i * PICK_ROW_PITCH;
+        gfx->drawFastHLine(PNL_STAT_X + 5, y - 2, PNL_STAT_W - 10, COLOR_BUTTON_GRAY);
+        gfx->setTextColor(COLOR_CYAN);
+        gfx->setCursor(PNL_STAT_X + 5, y + 2);
+        gfx->print(_choices[i].name[0] ? _choices[i].name : "fluidnc");
+        gfx->setTextColor(COLOR_GRAY_TEXT);
+        gfx->setCursor(PNL_STAT_X + PNL_STAT_W - 5 - gfx->textWidth(_choices[i].ip), y + 2);
+        gfx->print(_choices[i].ip);
+    }
+}
+#endif
+
 static void redrawStatusPanel() {
     sampleMinHeap();  // cheap; safe to call every 100ms tick
 
-    display.fillRoundRect(PNL_STAT_X, PNL_STAT_Y, PNL_STAT_W, PNL_STAT_H,
+    gfx->fillRoundRect(PNL_STAT_X, PNL_STAT_Y, PNL_STAT_W, PNL_STAT_H,
                           5, COLOR_DARKER_BG);
-
+    if (_showTasks) {
+        drawTaskPanel();
+        return;
+    }
 #ifdef USE_WIFI
     bool uartMode = (comms_active_mode() == COMMS_MODE_UART);
+    _nChoices     = uartMode ? 0 : wifi_controller_choices(_choices, DISC_MAX);
+    if (_nChoices) {
+        drawPickPanel();
+        return;
+    }
+#endif
+    drawPanelCue("TASKS");
+
+#ifdef USE_WIFI
 
     if (uartMode) {
         // ── UART mode summary ──────────────────────────────────────────────
-        display.setTextColor(COLOR_GRAY_TEXT); display.setTextSize(1);
-        display.setCursor(PNL_STAT_X + 5, PNL_STAT_Y + 8);
-        display.print("Talking to FluidNC via");
-        display.setCursor(PNL_STAT_X + 5, PNL_STAT_Y + 21);
-        display.print("the UART (RJ12) cable.");
-
-        display.setTextColor(COLOR_GRAY_TEXT);
-        display.setCursor(PNL_STAT_X + 5, PNL_STAT_Y + 45);
-        display.print("Baud:");
-        display.setTextColor(COLOR_ORANGE);
-        display.setCursor(PNL_STAT_X + 5, PNL_STAT_Y + 58);
-        display.print(pendantMachine.baudRate);
-
-        display.setTextColor(COLOR_GRAY_TEXT);
-        display.setCursor(PNL_STAT_X + 118, PNL_STAT_Y + 45);
-        display.print("Port:");
-        display.setTextColor(COLOR_CYAN);
-        display.setCursor(PNL_STAT_X + 118, PNL_STAT_Y + 58);
-        display.print(pendantMachine.port);
-
-        display.setTextColor(COLOR_GRAY_TEXT);
-        display.setCursor(PNL_STAT_X + 5, PNL_STAT_Y + 82);
-        display.print("Tap the banner above to");
-        display.setCursor(PNL_STAT_X + 5, PNL_STAT_Y + 95);
-        display.print("change transport.  Last:");
+        gfx->setTextColor(COLOR_GRAY_TEXT); gfx->setTextSize(1);
+        gfx->setCursor(PNL_STAT_X + 5, PNL_STAT_Y + 8);
+        gfx->print("Talking to FluidNC via");
+        gfx->setCursor(PNL_STAT_X + 5, PNL_STAT_Y + 21);
+        gfx->print("the UART (RJ12) cable.");
+
+        gfx->setTextColor(COLOR_GRAY_TEXT);
+        gfx->setCursor(PNL_STAT_X + 5, PNL_STAT_Y + 45);
+        gfx->print("Baud:");
+        gfx->setTextColor(COLOR_ORANGE);
+        gfx->setCursor(PNL_STAT_X + 5, PNL_STAT_Y + 58);
+        gfx->print(pendantMachine.baudRate);
+
+        gfx->setTextColor(COLOR_GRAY_TEXT);
+        gfx->setCursor(PNL_STAT_X + 118, PNL_STAT_Y + 45);
+        gfx->print("Port:");
+        gfx->setTextColor(COLOR_CYAN);
+        gfx->setCursor(PNL_STAT_X + 118, PNL_STAT_Y + 58);
+        gfx->print(pendantMachine.port);
+
+        gfx->setTextColor(COLOR_GRAY_TEXT);
+        gfx->setCursor(PNL_STAT_X + 5, PNL_STAT_Y + 82);
+        gfx->print("Tap the banner above to");
+        gfx->setCursor(PNL_STAT_X + 5, PNL_STAT_Y + 95);
+        gfx->print("change transport.  Last:");
         {
             bool healthy = (lastResetReason == ESP_RST_POWERON ||
                             lastResetReason == ESP_RST_SW);
-            display.setTextColor(healthy ? COLOR_GRAY_TEXT : COLOR_ORANGE);
+            gfx->setTextColor(healthy ? COLOR_GRAY_TEXT : COLOR_ORANGE);
             char buf[24];
             snprintf(buf, sizeof(buf), " %s/%u:%u",
                      resetReasonName(lastResetReason),
                      (unsigned)capturedBootStage,
                      (unsigned)capturedCore1Stage);
-            display.print(buf);
+            gfx->print(buf);
         }
 
     } else {
@@ -151,60 +244,70 @@ static void redrawStatusPanel() {
         if (bars < 0) bars = 0;
 
         bool connected = websocket_is_connected();
-        display.setTextSize(1);
-        display.setTextColor(COLOR_GRAY_TEXT);
-        display.setCursor(PNL_STAT_X + 5, PNL_STAT_Y + 6);
-        display.print("STATUS");
-        display.setTextColor(connected ? COLOR_GREEN : COLOR_ORANGE);
-        display.setCursor(PNL_STAT_X + 5, PNL_STAT_Y + 18);
-        display.print(status);
+        gfx->setTextSize(1);
+        gfx->setTextColor(COLOR_GRAY_TEXT);
+        gfx->setCursor(PNL_STAT_X + 5, PNL_STAT_Y + 6);
+        gfx->print("STATUS");
+        gfx->setTextColor(connected ? COLOR_GREEN : COLOR_ORANGE);
+        gfx->setCursor(PNL_STAT_X + 5, PNL_STAT_Y + 18);
+        gfx->print(status);
 
         if (errMsg && *errMsg) {
-            display.setTextColor(COLOR_RED);
-            display.setCursor(PNL_STAT_X + 5, PNL_STAT_Y + 31);
-            display.print(errMsg);
+            gfx->setTextColor(COLOR_RED);
+            gfx->setCursor(PNL_STAT_X + 5, PNL_STAT_Y + 31);
+            gfx->print(errMsg);
         }
 
         if (apMode) {
-            display.setTextColor(COLOR_GRAY_TEXT);
-            display.setCursor(PNL_STAT_X + 5, PNL_STAT_Y + 50);
-            display.print("Connect phone to WiFi:");
-            display.setTextColor(COLOR_CYAN);
-            display.setCursor(PNL_STAT_X + 5, PNL_STAT_Y + 63);
-            display.print(wifi_ap_ssid());
-
-            display.setTextColor(COLOR_GRAY_TEXT);
-            display.setCursor(PNL_STAT_X + 5, PNL_STAT_Y + 82);
-            display.print("Then open browser:");
-            display.setTextColor(COLOR_CYAN);
-            display.setCursor(PNL_STAT_X + 5, PNL_STAT_Y + 95);
-            display.print("192.168.4.1");
+            gfx->setTextColor(COLOR_GRAY_TEXT);
+            gfx->setCursor(PNL_STAT_X + 5, PNL_STAT_Y + 50);
+            gfx->print("Connect phone to WiFi:");
+            gfx->setTextColor(COLOR_CYAN);
+            gfx->setCursor(PNL_STAT_X + 5, PNL_STAT_Y + 63);
+            gfx->print(wifi_ap_ssid());
+
+            gfx->setTextColor(COLOR_GRAY_TEXT);
+            gfx->setCursor(PNL_STAT_X + 5, PNL_STAT_Y + 82);
+            gfx->print("Then open browser:");
+            gfx->setTextColor(COLOR_CYAN);
+            gfx->setCursor(PNL_STAT_X + 5, PNL_STAT_Y + 95);
+            gfx->print("192.168.4.1");
 
         } else {
             // STA: SSID + signal / FluidNC IP
-            String barStr;
-            for (int i = 0; i < 4; i++) barStr += (i < bars) ? "|" : ".";
-
-            display.setTextSize(1);
-            display.setTextColor(COLOR_GRAY_TEXT);
-            display.setCursor(PNL_STAT_X + 5,   PNL_STAT_Y + 50);
-            display.print("NETWORK");
-            display.setCursor(PNL_STAT_X + 118, PNL_STAT_Y + 50);
-            display.print("SIGNAL");
-
-            display.setTextColor(COLOR_CYAN);
-            display.setCursor(PNL_STAT_X + 5,   PNL_STAT_Y + 63);
-            display.print(cfg.valid ? cfg.ssid : "---");
-            display.setTextColor(bars > 0 ? COLOR_GREEN : COLOR_GRAY_TEXT);
-            display.setCursor(PNL_STAT_X + 118, PNL_STAT_Y + 63);
-            display.print(barStr.c_str());
-
-            display.setTextColor(COLOR_GRAY_TEXT);
-            display.setCursor(PNL_STAT_X + 5, PNL_STAT_Y + 85);
-            display.print("FluidNC IP");
-            display.setTextColor(COLOR_CYAN);
-            display.setCursor(PNL_STAT_X + 5, PNL_STAT_Y + 98);
-            display.print(cfg.valid ? cfg.fluidnc_ip : "---");
+            char barStr[5];
+            for (int i = 0; i < 4; i++) barStr[i] = (i < bars) ? '|' : '.';
+            barStr[4] = '\0';
+
+            gfx->setTextSize(1);
+            gfx->setTextColor(COLOR_GRAY_TEXT);
+            gfx->setCursor(PNL_STAT_X + 5,   PNL_STAT_Y + 50);
+            gfx->print("NETWORK");
+            gfx->setCursor(PNL_STAT_X + 118, PNL_STAT_Y + 50);
+            gfx->print("SIGNAL");
+
+            gfx->setTextColor(COLOR_CYAN);
+            gfx->setCursor(PNL_STAT_X + 5,   PNL_STAT_Y + 63);
+            gfx->print(cfg.valid ? cfg.ssid : "---");
+            gfx->setTextColor(bars > 0 ? COLOR_GREEN : COLOR_GRAY_TEXT);
+            gfx->setCursor(PNL_STAT_X + 118, PNL_STAT_Y + 63);
+            gfx->print(barStr);
+
+            gfx->setTextColor(COLOR_GRAY_TEXT);
+            gfx->setCursor(PNL_STAT_X + 5, PNL_STAT_Y + 85);
+            gfx->print("FluidNC IP");
+            gfx->setTextColor(COLOR_CYAN);
+            gfx->setCursor(PNL_STAT_X + 5, PNL_STAT_Y + 98);
+            gfx->print(!cfg.valid ? "---" : cfg.fluidnc_ip[0] ? cfg.fluidnc_ip : "(find it)");
+            // Where discovery / the cache actually pointed the link, when
+            // that isn't the configured address.
+            const char* target = wifi_fluidnc_target();
+            if (cfg.valid && target[0] && strcmp(target, cfg.fluidnc_ip) != 0) {
+                gfx->setTextColor(COLOR_GRAY_TEXT);
+                gfx->setCursor(PNL_STAT_X + 5, PNL_STAT_Y + 108);
+                gfx->print("> ");
+                gfx->print(target);
+            }
         }
 
         // Last reset reason + stages reached on previous boot.  Format is
@@ -213,11 +316,11 @@ static void redrawStatusPanel() {
         // Arduino loop task running screens + connect-time config fetches).
         bool healthy = (lastResetReason == ESP_RST_POWERON ||
                         lastResetReason == ESP_RST_SW);
-        display.setTextColor(COLOR_GRAY_TEXT); display.setTextSize(1);
-        display.setCursor(PNL_STAT_X + 118, PNL_STAT_Y + 85);
-        display.print("Reset c0/c1");
-        display.setTextColor(healthy ? COLOR_GRAY_TEXT : COLOR_ORANGE);
-        display.setCursor(PNL_STAT_X + 118, PNL_STAT_Y + 98);
+        gfx->setTextColor(COLOR_GRAY_TEXT); gfx->setTextSize(1);
+        gfx->setCursor(PNL_STAT_X + 118, PNL_STAT_Y + 85);
+        gfx->print("Reset c0/c1");
+        gfx->setTextColor(healthy ? COLOR_GRAY_TEXT : COLOR_ORANGE);
+        gfx->setCursor(PNL_STAT_X + 118, PNL_STAT_Y + 98);
         char buf[32];
         unsigned i0 = capturedCore0Iters > 999 ? 999 : capturedCore0Iters;
         unsigned i1 = capturedCore1Iters > 999 ? 999 : capturedCore1Iters;
@@ -225,11 +328,11 @@ static void redrawStatusPanel() {
                  resetReasonName(lastResetReason),
                  (unsigned)capturedBootStage,
                  (unsigned)capturedCore1Stage);
-        display.print(buf);
-        display.setCursor(PNL_STAT_X + 118, PNL_STAT_Y + 108);
+        gfx->print(buf);
+        gfx->setCursor(PNL_STAT_X + 118, PNL_STAT_Y + 108);
         char buf2[24];
         snprintf(buf2, sizeof(buf2), "i %u/%u", i0, i1);
-        display.print(buf2);
+        gfx->print(buf2);
     }
 
     // Live free-heap monitor — shown at bottom of status panel in WiFi mode.
@@ -242,12 +345,12 @@ static void redrawStatusPanel() {
         snprintf(hbuf, sizeof(hbuf), "Heap %uK (min %uK)",
                  (unsigned)(nowHeap / 1024),
                  (unsigned)(_minHeapEverSeen / 1024));
-        display.setTextColor(nowHeap < 30000 ? COLOR_RED
+        gfx->setTextColor(nowHeap < 30000 ? COLOR_RED
                             : nowHeap < 60000 ? COLOR_ORANGE
                                               : COLOR_GRAY_TEXT);
-        display.setTextSize(1);
-        display.setCursor(PNL_STAT_X + 5, PNL_STAT_Y + 108);
-        display.print(hbuf);
+        gfx->setTextSize(1);
+        gfx->setCursor(PNL_STAT_X + 5, PNL_STAT_Y + 108);
+        gfx->print(hbuf);
     }
 
     // Previous-boot NVS checkpoint — only shown if there's a meaningful
@@ -261,16 +364,16 @@ static void redrawStatusPanel() {
                  (unsigned)nvsPrevIter0,
                  (unsigned)nvsPrevIter1,
                  (unsigned)(nvsPrevMinHeap / 1024));
-        display.setTextColor(COLOR_GRAY_TEXT); display.setTextSize(1);
-        display.setCursor(PNL_STAT_X + 5, PNL_STAT_Y + 118);
-        display.print(nbuf);
+        gfx->setTextColor(COLOR_GRAY_TEXT); gfx->setTextSize(1);
+        gfx->setCursor(PNL_STAT_X + 5, PNL_STAT_Y + 118);
+        gfx->print(nbuf);
     }
 #else
-    display.setTextColor(COLOR_GRAY_TEXT); display.setTextSize(1);
-    display.setCursor(PNL_STAT_X + 5, PNL_STAT_Y + 20);
-    display.print("WiFi not compiled in.");
-    display.setCursor(PNL_STAT_X + 5, PNL_STAT_Y + 35);
-    display.print("Build with -DUSE_WIFI.");
+    gfx->setTextColor(COLOR_GRAY_TEXT); gfx->setTextSize(1);
+    gfx->setCursor(PNL_STAT_X + 5, PNL_STAT_Y + 20);
+    gfx->print("WiFi not compiled in.");
+    gfx->setCursor(PNL_STAT_X + 5, PNL_STAT_Y + 35);
+    gfx->print("Build with -DUSE_WIFI.");
 #endif
 }
 
@@ -281,6 +384,7 @@ void enterWiFiSetup() {
     spriteAxisDisplay.deleteSprite();
     spriteValueDisplay.deleteSprite();
     spriteFileDisplay.deleteSprite();
+    dropChromeCache();   // the setup portal wants the heap more than fast navigation
 }
 
 void exitWiFiSetup() {
@@ -289,7 +393,7 @@ void exitWiFiSetup() {
 
 // ── Full redraw ───────────────────────────────────────────────────────────────
 void drawWiFiSetupScreen() {
-    display.fillScreen(COLOR_BACKGROUND);
+    gfx->fillScreen(COLOR_BACKGROUND);
     drawTitle("WIFI SETUP");
 
 #ifdef USE_WIFI
@@ -329,24 +433,24 @@ void updateWiFiSetupDisplay() {
 // ─── Shared restart splash ────────────────────────────────────────────────────
 static void showRestartSplash(const char* line1, const char* line2 = nullptr,
                                const char* line3 = nullptr) {
-    display.fillScreen(COLOR_BACKGROUND);
+    gfx->fillScreen(COLOR_BACKGROUND);
     drawTitle("WIFI SETUP");
-    display.setTextSize(2);
-    display.setTextColor(COLOR_WHITE);
+    gfx->setTextSize(2);
+    gfx->setTextColor(COLOR_WHITE);
     int y = 135;
     auto centre = [&](const char* s, uint16_t col = COLOR_WHITE) {
-        display.setTextColor(col);
-        display.setCursor((240 - display.textWidth(s)) / 2, y);
-        display.print(s);
+        gfx->setTextColor(col);
+        gfx->setCursor((240 - gfx->textWidth(s)) / 2, y);
+        gfx->print(s);
         y += 26;
     };
     centre(line1);
     if (line2) centre(line2);
     if (line3) centre(line3, COLOR_CYAN);
-    display.setTextColor(COLOR_GRAY_TEXT);
+    gfx->setTextColor(COLOR_GRAY_TEXT);
     const char* sub = "Restarting...";
-    display.setCursor((240 - display.textWidth(sub)) / 2, y + 8);
-    display.print(sub);
+    gfx->setCursor((240 - gfx->textWidth(sub)) / 2, y + 8);
+    gfx->print(sub);
 }
 
 // Toggle the transport selection: UART ↔ WiFi.  Writes NVS and restarts so
@@ -374,6 +478,24 @@ void handleWiFiSetupTouch(int x, int y) {
         return;
     }
 
+#ifdef USE_WIFI
+    // Controller picker — a row connects to that controller
+    if (!_showTasks && _nChoices &&
+        isTouchInBounds(x, y, PNL_STAT_X, PNL_STAT_Y + PICK_ROW_Y - 2, PNL_STAT_W, _nChoices * PICK_ROW_PITCH)) {
+        int row = (y - (PNL_STAT_Y + PICK_ROW_Y - 2)) / PICK_ROW_PITCH;
+        wifi_choose_controller(_choices[row < _nChoices ? row : _nChoices - 1].ip);
+        _nChoices = 0;
+        return;
+    }
+#endif
+
+    // Status panel — toggle the task monitor view
+    if (isTouchInBounds(x, y, PNL_STAT_X, PNL_STAT_Y, PNL_STAT_W, PNL_STAT_H)) {
+        _showTasks = !_showTasks;
+        redrawStatusPanel();
+        return;
+    }
+
     // Mode banner — tap to cycle transport override (Auto / UART / WiFi)
     if (isTouchInBounds(x, y, PNL_MODE_X, PNL_MODE_Y, PNL_MODE_W, PNL_MODE_H)) {
         cycleTransportOverride();
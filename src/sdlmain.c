@@ -1,17 +1,28 @@
 #ifndef ARDUINO
 #    include <lgfx/v1/platforms/sdl/Panel_sdl.hpp>
 #    if defined(SDL_h_)
+#        include <stdlib.h>
+#        include <string.h>
 
 extern void setup();
 extern void loop();
 
 char* comname;
+char* replayname;        // --replay: capture file fed to the parser instead of COMn
+int   replayspeed = 100;  // percent of the captured timing; 0 = flat out
 int   main(int argc, char** argv) {
-    if (argc != 2) {
+    if (argc >= 3 && argc <= 4 && strcmp(argv[1], "--replay") == 0) {
+        replayname = argv[2];
+        if (argc == 4) {
+            replayspeed = atoi(argv[3]);
+        }
+    } else if (argc == 2) {
+        comname = argv[1];
+    } else {
         printf("Usage: %s COMn\n", argv[0]);
+        printf("       %s --replay capture.fnc [speed%%]\n", argv[0]);
         exit(1);
     }
-    comname = argv[1];
 
     setup();
 